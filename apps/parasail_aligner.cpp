@@ -44,6 +44,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <list>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -74,22 +75,41 @@
 extern "C" size_t getMemorySize(void);
 
 using ::std::bad_alloc;
+using ::std::copy;
 using ::std::istringstream;
+using ::std::list;
 using ::std::make_pair;
+using ::std::max;
+using ::std::min;
 using ::std::pair;
 using ::std::set;
 using ::std::size_t;
+using ::std::sort;
 using ::std::stack;
 using ::std::string;
 using ::std::toupper;
 using ::std::transform;
+using ::std::unique;
 using ::std::vector;
 
 typedef pair<int,int> Pair;
 
-typedef set<Pair> PairSet;
+/* a Pair packed as (first << 32) | second, which sorts the same way */
+typedef unsigned long long PackedPair;
+
+typedef vector<PackedPair> PairBuffer;
 typedef vector<Pair> PairVec;
 
+inline static PackedPair pack_pair(int first, int second)
+{
+    return (PackedPair(unsigned(first)) << 32) | unsigned(second);
+}
+
+inline static Pair unpack_pair(PackedPair packed)
+{
+    return make_pair(int(packed >> 32), int(packed & 0xFFFFFFFFULL));
+}
+
 struct quad {
     int lcp;
     int lb;
@@ -106,9 +126,260 @@ struct quad {
     bool empty() { return rb == INT_MAX; }
 };
 
+/* Hands finished results from the aligning threads to the output code.
+ * Each pair owns its slot in results; a slot becoming non-NULL is the
+ * hand-off. Whichever thread holds the writer lock writes the finished
+ * prefix in pair order while the others keep aligning. A pair may only
+ * be started once it is within depth of the next result to be written
+ * and inside the current memory batch, so the number of live results
+ * stays bounded. Pairs are claimed in short runs that share a query, so
+ * a thread keeps that query's profile and sequence hot. */
+class result_queue {
+public:
+    result_queue(
+            vector<parasail_result_t*> &results,
+            const vector<long long> &batches,
+            const PairVec &vpairs,
+            int threads)
+        : results(results), batches(batches), vpairs(vpairs),
+          size((long long)results.size()), depth(64*(long long)threads),
+          threads(threads), next_claim(0), next_write(0), limit(0),
+          batch(0)
+    {
+#ifdef _OPENMP
+        omp_init_lock(&writer);
+#endif
+        update_limit();
+    }
+
+    ~result_queue() {
+#ifdef _OPENMP
+        omp_destroy_lock(&writer);
+#endif
+    }
+
+    /* Next run [index,stop) of pairs with the same query for the
+     * calling thread; empty once all pairs were claimed. Runs shrink
+     * towards the end so the last pairs still spread over threads. */
+    long long claim(long long &stop) {
+        long long index;
+#pragma omp critical(result_queue_claim)
+        {
+            long long grain = (size-next_claim) / (4*threads);
+            index = next_claim;
+            stop = index + max(1LL, min(8LL, grain));
+            if (stop > size) {
+                stop = size;
+            }
+            for (long long k=index+1; k<stop; ++k) {
+                if (vpairs[k].first != vpairs[index].first) {
+                    stop = k;
+                }
+            }
+            next_claim = stop;
+        }
+        return index;
+    }
+
+    bool may_start(long long index) {
+#pragma omp flush
+        return index < limit;
+    }
+
+    void push(long long index, parasail_result_t *result) {
+#pragma omp flush
+        results[index] = result;
+#pragma omp flush
+    }
+
+    /* on success the caller owns [start,stop) until end_write */
+    bool begin_write(long long &start, long long &stop) {
+#ifdef _OPENMP
+        if (!omp_test_lock(&writer)) {
+            return false;
+        }
+#endif
+#pragma omp flush
+        start = next_write;
+        stop = start;
+        while (stop < limit && NULL != results[stop]) {
+            ++stop;
+        }
+        if (stop == start) {
+#ifdef _OPENMP
+            omp_unset_lock(&writer);
+#endif
+            return false;
+        }
+        return true;
+    }
+
+    void end_write(long long stop) {
+        next_write = stop;
+        update_limit();
+#pragma omp flush
+#ifdef _OPENMP
+        omp_unset_lock(&writer);
+#endif
+    }
+
+    bool done() {
+#pragma omp flush
+        return next_write >= size;
+    }
+
+private:
+    void update_limit() {
+        while (batch+1 < batches.size() && batches[batch+1] <= next_write) {
+            ++batch;
+        }
+        limit = next_write + depth;
+        if (batch+1 < batches.size() && batches[batch+1] < limit) {
+            limit = batches[batch+1];
+        }
+        if (size < limit) {
+            limit = size;
+        }
+    }
+
+    vector<parasail_result_t*> &results;
+    const vector<long long> &batches;
+    const PairVec &vpairs;
+    long long size;
+    long long depth;
+    long long threads;
+    long long next_claim;
+    long long next_write;
+    long long limit;
+    size_t batch;
+#ifdef _OPENMP
+    omp_lock_t writer;
+#endif
+};
+
+/* Builds query profiles on first use and keeps the most recently used
+ * ones within a byte budget. A profile is pinned while a thread aligns
+ * against it; once the budget is exceeded, unpinned profiles are freed
+ * least recently used first. A profile larger than the whole budget is
+ * still built, it just evicts everything else. */
+class profile_cache {
+public:
+    profile_cache(
+            parasail_pcreator_t *pcreator,
+            const parasail_matrix_t *matrix,
+            const unsigned char *T,
+            const vector<long> &BEG,
+            const vector<long> &END,
+            size_t profile_bits,
+            size_t capacity)
+        : pcreator(pcreator), matrix(matrix), T(T), BEG(BEG), END(END),
+          profile_bits(profile_bits), capacity(capacity), used(0),
+          entries(BEG.size()), lru(), built(0)
+    {}
+
+    ~profile_cache() {
+        for (size_t i=0; i<entries.size(); ++i) {
+            if (NULL != entries[i].profile) {
+                parasail_profile_free(entries[i].profile);
+            }
+        }
+    }
+
+    /* estimated size of the profile for sequence i */
+    size_t bytes(int i) const {
+        return matrix->size * (END[i]-BEG[i]) * profile_bits;
+    }
+
+    parasail_profile_t* acquire(int i) {
+        parasail_profile_t *profile = NULL;
+        bool build = false;
+#pragma omp critical(profile_cache)
+        {
+            entry &e = entries[i];
+            if (e.cached) {
+                lru.splice(lru.begin(), lru, e.lru);
+            }
+            else {
+                lru.push_front(i);
+                e.lru = lru.begin();
+                e.cached = true;
+                used += bytes(i);
+                ++built;
+                build = true;
+            }
+            ++e.pins;
+            profile = e.profile;
+            evict();
+        }
+        if (build) {
+            profile = pcreator(
+                    (const char*)&T[BEG[i]], END[i]-BEG[i], matrix);
+            if (NULL == profile) {
+                eprintf(stderr, "BAD PROFILE %d\n", i);
+                exit(EXIT_FAILURE);
+            }
+#pragma omp critical(profile_cache)
+            entries[i].profile = profile;
+        }
+        /* another thread is still building it */
+        while (NULL == profile) {
+#pragma omp critical(profile_cache)
+            profile = entries[i].profile;
+        }
+        return profile;
+    }
+
+    void release(int i) {
+#pragma omp critical(profile_cache)
+        {
+            --entries[i].pins;
+            evict();
+        }
+    }
+
+    unsigned long profiles_built() const { return built; }
+
+private:
+    struct entry {
+        parasail_profile_t *profile;
+        int pins;
+        bool cached;
+        list<int>::iterator lru;
+        entry() : profile(NULL), pins(0), cached(false), lru() {}
+    };
+
+    /* caller holds the profile_cache critical section */
+    void evict() {
+        list<int>::iterator it = lru.end();
+        while (used > capacity && it != lru.begin()) {
+            --it;
+            entry &e = entries[*it];
+            if (0 == e.pins) {
+                parasail_profile_free(e.profile);
+                e.profile = NULL;
+                e.cached = false;
+                used -= bytes(*it);
+                it = lru.erase(it);
+            }
+        }
+    }
+
+    parasail_pcreator_t *pcreator;
+    const parasail_matrix_t *matrix;
+    const unsigned char *T;
+    const vector<long> &BEG;
+    const vector<long> &END;
+    size_t profile_bits;
+    size_t capacity;
+    size_t used;
+    vector<entry> entries;
+    list<int> lru;
+    unsigned long built;
+};
+
 inline static void pair_check(
         unsigned long &count_generated,
-        PairSet &pairs,
+        PairBuffer &pairs,
         const int &i,
         const int &j,
         const int * const restrict SA,
@@ -119,7 +390,7 @@ inline static void pair_check(
 
 inline static void process(
         unsigned long &count_generated,
-        PairSet &pairs,
+        PairBuffer &pairs,
         const quad &q,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
@@ -128,6 +399,39 @@ inline static void process(
         const char &sentinal,
         const int &cutoff);
 
+inline static void enumerate_intervals(
+        unsigned long &count_generated,
+        PairBuffer &pairs,
+        size_t &compact_at,
+        int bup_start,
+        int bup_stop,
+        const int * const restrict SA,
+        const int * const restrict LCP,
+        const unsigned char * const restrict BWT,
+        const int * const restrict SID,
+        const vector<int> &DB,
+        const char &sentinal,
+        const int &cutoff);
+
+inline static int parallel_sais(
+        const unsigned char * const restrict T,
+        int * const restrict SA,
+        int * const restrict LCP,
+        int n);
+
+inline static void compact_pairs(
+        PairBuffer &pairs,
+        size_t &compact_at);
+
+inline static void merge_pairs(
+        vector<PairBuffer> &buffers,
+        PairBuffer &pairs);
+
+inline static void schedule_pairs(
+        PairVec &vpairs,
+        const vector<long> &BEG,
+        const vector<long> &END);
+
 inline static void print_array(
         const char * filename_,
         const int * const restrict array,
@@ -139,6 +443,15 @@ inline static int self_score(
         int len,
         const parasail_matrix_t *matrix);
 
+inline static int min_reported_score(
+        unsigned char *T,
+        int OS,
+        const parasail_matrix_t *matrix,
+        long i_beg,
+        long i_len,
+        long j_beg,
+        long j_len);
+
 inline static void output_edges(
         FILE *fop,
         bool has_query,
@@ -296,7 +609,7 @@ static void print_help(const char *progname, int status) {
             "[-d] "
             "[-M match] "
             "[-X mismatch] "
-            "[-k band size (for nw_banded)] "
+            "[-k band size (for banded functions)] "
             "[-l AOL] "
             "[-s SIM] "
             "[-i OS] "
@@ -308,6 +621,7 @@ static void print_help(const char *progname, int status) {
             "[-O output_format {EMBOSS,SAM,SAMH,SSW}] "
             "[-b batch_size] "
             "[-r memory_budget] "
+            "[-P profile_percent] "
             "\n\n",
             progname);
     eprintf(stderr, "Defaults:\n"
@@ -324,7 +638,10 @@ THREAD_DOC
             "          AOL: 80, must be 0 <= AOL <= 100, percent alignment length\n"
             "          SIM: 40, must be 0 <= SIM <= 100, percent exact matches\n"
             "           OS: 30, must be 0 <= OS <= 100, percent optimal score\n"
-            "                                           over self score\n"
+            "                                           over self score;\n"
+            "                                           with -E or -G, profile\n"
+            "                                           functions stop early on\n"
+            "                                           pairs that cannot reach it\n"
             "           -v: verbose output, report input parameters and timing\n"
             "           -V: verbose memory output, report memory use\n"
             "         file: no default, must be in FASTA format\n"
@@ -333,7 +650,9 @@ THREAD_DOC
             "output_format: no deafult, must be one of {EMBOSS,SAM,SAMH,SSW}\n"
             "   batch_size: 0 (calculate based on memory budget),\n"
             "               how many alignments before writing output\n"
-            "memory_budget: 2GB or half available from system query (%.3f GB)\n",
+            "memory_budget: 2GB or half available from system query (%.3f GB)\n"
+            "profile_percent: 25, must be 1 <= profile_percent <= 100,\n"
+            "               percent of memory_budget for cached profiles\n",
         getMemorySize()/2.0*GB
             );
     exit(status);
@@ -585,7 +904,7 @@ int main(int argc, char **argv) {
     bool use_sam_format = false;
     bool use_sam_header = false;
     bool use_ssw_format = false;
-    PairSet pairs;
+    PairBuffer pairs;
     PairVec vpairs;
     unsigned long count_possible = 0;
     unsigned long count_generated = 0;
@@ -597,7 +916,8 @@ int main(int argc, char **argv) {
     parasail_function_t *function = NULL;
     parasail_pfunction_t *pfunction = NULL;
     parasail_pcreator_t *pcreator = NULL;
-    int is_banded = 0;
+    const parasail_kfunction_info_t *kfunction_info = NULL;
+    parasail_kfunction_t *kfunction = NULL;
     int is_trace = 0;
     int kbandsize = 3;
     const char *matrixname = NULL;
@@ -610,6 +930,7 @@ int main(int argc, char **argv) {
     bool pairs_only = false;
     bool edge_output = false;
     bool graph_output = false;
+    bool prune = false;
     bool is_stats = true;
     bool is_table = false;
     bool has_query = false;
@@ -625,6 +946,7 @@ int main(int argc, char **argv) {
     size_t memory_budget = 0;
     size_t bytes_used = 0;
     size_t profile_bits = 0;
+    int profile_percent = 25;
 
     set_signal_handler();
 
@@ -640,7 +962,7 @@ int main(int argc, char **argv) {
     }
 
     /* Check arguments. */
-    while ((c = getopt(argc, argv, "a:b:c:de:Ef:g:Ghi:k:l:m:M:o:O:pq:r:s:t:vVxX:")) != -1) {
+    while ((c = getopt(argc, argv, "a:b:c:de:Ef:g:Ghi:k:l:m:M:o:O:pP:q:r:s:t:vVxX:")) != -1) {
         switch (c) {
             case 'a':
                 funcname = optarg;
@@ -730,6 +1052,12 @@ int main(int argc, char **argv) {
             case 'p':
                 pairs_only = true;
                 break;
+            case 'P':
+                profile_percent = atoi(optarg);
+                if (profile_percent < 1 || profile_percent > 100) {
+                    print_help(progname, EXIT_FAILURE);
+                }
+                break;
             case 'q':
                 qname = optarg;
                 break;
@@ -821,14 +1149,19 @@ int main(int argc, char **argv) {
         }
         else {
             function_info = parasail_lookup_function_info(funcname);
-            if (NULL == function_info && NULL != strstr(funcname, "nw_banded")) {
-                is_banded = 1;
+            if (NULL == function_info) {
+                kfunction_info = parasail_lookup_kfunction_info(funcname);
             }
-            if (NULL == function_info && 0 == is_banded) {
+            if (NULL == function_info && NULL == kfunction_info) {
                 eprintf(stderr, "Specified function not found.\n");
                 exit(EXIT_FAILURE);
             }
-            function = function_info->pointer;
+            if (function_info) {
+                function = function_info->pointer;
+            }
+            else {
+                kfunction = kfunction_info->pointer;
+            }
         }
     }
     else {
@@ -876,6 +1209,8 @@ int main(int argc, char **argv) {
         eprintf(stderr, "Cannot specify a query file and output as a graph.\n");
         exit(EXIT_FAILURE);
     }
+    /* edges and graphs only report pairs that pass the OS filter */
+    prune = (edge_output || graph_output) && OS > 0;
 
     if (NULL != output_format) {
         bool trace_warning = false;
@@ -1186,6 +1521,22 @@ int main(int argc, char **argv) {
         eprintf(stdout, "%20s: %ld\n", "number of db seqs", sid_crossover);
     }
 
+#ifdef _OPENMP
+    if (-1 == num_threads) {
+        num_threads = omp_get_max_threads();
+    }
+    else if (num_threads >= 1) {
+        omp_set_num_threads(num_threads);
+    }
+    else {
+        eprintf(stderr, "invalid number of threads chosen (%d)\n", num_threads);
+        exit(EXIT_FAILURE);
+    }
+    if (verbose) {
+        eprintf(stdout, "%20s: %d\n", "omp num threads", num_threads);
+    }
+#endif
+
     /* use the enhanced SA filter */
     if (use_filter) {
         size_t memsize_local = 0;
@@ -1228,19 +1579,30 @@ int main(int argc, char **argv) {
         bytes_used += memsize;
 
         /* Construct the suffix and LCP arrays.
-         * The following sais routine is from Fischer, with bugs fixed. */
+         * The following sais routine is from Fischer, with bugs fixed.
+         * The parallel construction does about twice the work of sais,
+         * so it is only used once there are enough threads to win. */
         start = parasail_time();
-        if(sais(T, SA, LCP, (int)n) != 0) {
+        if (num_threads >= 4) {
+            if(parallel_sais(T, SA, LCP, (int)n) != 0) {
+                eprintf(stderr, "%s: Cannot allocate memory.\n", progname);
+                exit(EXIT_FAILURE);
+            }
+        }
+        else if(sais(T, SA, LCP, (int)n) != 0) {
             eprintf(stderr, "%s: Cannot allocate memory.\n", progname);
             exit(EXIT_FAILURE);
         }
         finish = parasail_time();
         if (verbose) {
-            eprintf(stdout,"%20s: %.4f seconds\n", "induced SA time", finish-start);
+            eprintf(stdout,"%20s: %.4f seconds\n",
+                    num_threads >= 4 ? "parallel SA time" : "induced SA time",
+                    finish-start);
         }
 
         /* construct naive BWT: */
         start = parasail_time();
+#pragma omp parallel for
         for (i = 0; i < n; ++i) {
             BWT[i] = (SA[i] > 0) ? T[SA[i]-1] : sentinal;
         }
@@ -1251,6 +1613,7 @@ int main(int argc, char **argv) {
 
         /* "fix" the LCP array to clamp LCP's that are too long */
         start = parasail_time();
+#pragma omp parallel for
         for (i = 0; i < n; ++i) {
             int len = END[SID[SA[i]]] - SA[i]; /* don't include sentinal */
             if (LCP[i] > len) LCP[i] = len;
@@ -1286,36 +1649,46 @@ int main(int argc, char **argv) {
         count_generated = 0;
         LCP[n] = 0; /* doesn't really exist, but for the root */
         {
-            stack<quad> the_stack;
-            quad last_interval;
-            the_stack.push(quad());
-            for (i = bup_start; i <= bup_stop; ++i) {
-                int lb = i - 1;
-                while (LCP[i] < the_stack.top().lcp) {
-                    the_stack.top().rb = i - 1;
-                    last_interval = the_stack.top();
-                    the_stack.pop();
-                    process(count_generated, pairs, last_interval, SA, BWT, SID, DB, sentinal, cutoff);
-                    lb = last_interval.lb;
-                    if (LCP[i] <= the_stack.top().lcp) {
-                        last_interval.children.clear();
-                        the_stack.top().children.push_back(last_interval);
-                        last_interval = quad();
+            /* An l-interval with lcp >= cutoff never spans a position
+             * whose LCP is below cutoff, so the SA is split at such
+             * positions into ranges that are traversed independently.
+             * Splitting is skipped when cutoff would admit the root. */
+            vector<int> splits(1, bup_start);
+            if (num_threads > 1 && cutoff > 0) {
+                int chunks = 16 * num_threads;
+                int step = (bup_stop - bup_start) / chunks + 1;
+                for (int c=1; c<chunks; ++c) {
+                    int split = max(bup_start + c*step, splits.back()+1);
+                    while (split < bup_stop && LCP[split] >= cutoff) {
+                        ++split;
                     }
-                }
-                if (LCP[i] > the_stack.top().lcp) {
-                    if (!last_interval.empty()) {
-                        last_interval.children.clear();
-                        the_stack.push(quad(LCP[i],lb,INT_MAX,vector<quad>(1, last_interval)));
-                        last_interval = quad();
-                    }
-                    else {
-                        the_stack.push(quad(LCP[i],lb,INT_MAX));
+                    if (split >= bup_stop) {
+                        break;
                     }
+                    splits.push_back(split);
                 }
             }
-            the_stack.top().rb = bup_stop - 1;
-            process(count_generated, pairs, the_stack.top(), SA, BWT, SID, DB, sentinal, cutoff);
+            splits.push_back(bup_stop);
+            /* each thread appends to its own buffer across the ranges
+             * it traverses, so its compactions also drop duplicates
+             * found in different ranges */
+            vector<PairBuffer> thread_pairs(max(num_threads, 1));
+            vector<size_t> compact_at(thread_pairs.size(), 1<<16);
+#pragma omp parallel for schedule(dynamic)
+            for (long long c=0; c<(long long)splits.size()-1; ++c) {
+                unsigned long local_count = 0;
+#ifdef _OPENMP
+                int tid = omp_get_thread_num();
+#else
+                int tid = 0;
+#endif
+                enumerate_intervals(local_count, thread_pairs[tid],
+                        compact_at[tid], splits[c], splits[c+1], SA, LCP,
+                        BWT, SID, DB, sentinal, cutoff);
+#pragma omp atomic
+                count_generated += local_count;
+            }
+            merge_pairs(thread_pairs, pairs);
         }
         finish = parasail_time();
         if (!has_query) {
@@ -1371,9 +1744,10 @@ int main(int argc, char **argv) {
         /* Done with input text. */
         free(T);
         if (vpairs.empty() && !pairs.empty()) {
-            for (PairSet::iterator it=pairs.begin(); it!=pairs.end(); ++it) {
-                int i = it->first;
-                int j = it->second;
+            for (PairBuffer::iterator it=pairs.begin(); it!=pairs.end(); ++it) {
+                Pair p = unpack_pair(*it);
+                int i = p.first;
+                int j = p.second;
                 eprintf(fop, "%d,%d\n", i, j);
             }
         }
@@ -1392,23 +1766,7 @@ int main(int argc, char **argv) {
         return 0;
     }
 
-#ifdef _OPENMP
-    if (-1 == num_threads) {
-        num_threads = omp_get_max_threads();
-    }
-    else if (num_threads >= 1) {
-        omp_set_num_threads(num_threads);
-    }
-    else {
-        eprintf(stderr, "invalid number of threads chosen (%d)\n", num_threads);
-        exit(EXIT_FAILURE);
-    }
-    if (verbose) {
-        eprintf(stdout, "%20s: %d\n", "omp num threads", num_threads);
-    }
-#endif
-
-    /* OpenMP can't iterate over an STL set. Convert to STL vector. */
+    /* Unpack the sorted pairs for the alignment loop. */
     start = parasail_time();
     if (vpairs.empty()) {
         if (pairs.empty()) {
@@ -1421,15 +1779,19 @@ int main(int argc, char **argv) {
                 exit(EXIT_FAILURE);
             }
         }
-        vpairs.assign(pairs.begin(), pairs.end());
-        /* set::clear() might not deallocate memory.
+        vpairs.resize(pairs.size());
+#pragma omp parallel for
+        for (long long index=0; index<(long long)pairs.size(); ++index) {
+            vpairs[index] = unpack_pair(pairs[index]);
+        }
+        /* vector::clear() might not deallocate memory.
          * Use swap with temporary instead */
-        PairSet().swap(pairs);
-        /* don't increment bytes_used since memory use should remain same */
+        PairBuffer().swap(pairs);
     }
     if (!pairs.empty()) {
         eprintf(stderr, "failed to free pair memory, continuing\n");
     }
+    schedule_pairs(vpairs, BEG, END);
     /* finally tally the pair memory */
     bytes_used += vpairs.size()*sizeof(Pair);
     /* pre-allocate result pointers */
@@ -1444,42 +1806,25 @@ int main(int argc, char **argv) {
         eprintf(stdout, "%20s: %.4f GB\n", "openmp prep memory", bytes_used*GB);
     }
 
-    /* create profiles, if necessary */
-    vector<parasail_profile_t*> profiles;
+    /* profiles are created on demand; reserve room for the cache, but
+     * no more than all of the profiles would take */
+    profile_cache *profiles = NULL;
     if (pfunction) {
-        start = parasail_time();
-        set<int> profile_indices_set;
+        size_t capacity = memory_budget / 100 * profile_percent;
+        size_t all_profiles = 0;
+        vector<bool> is_query(sid, false);
+        profiles = new profile_cache(pcreator, matrix, T, BEG, END,
+                profile_bits, capacity);
         for (size_t index=0; index<vpairs.size(); ++index) {
-            profile_indices_set.insert(vpairs[index].first);
-        }
-        vector<int> profile_indices(
-                profile_indices_set.begin(),
-                profile_indices_set.end());
-        profiles.assign(sid, static_cast<parasail_profile_t*>(NULL));
-        bytes_used += sizeof(parasail_profile_t*) * sid;
-        finish = parasail_time();
-        if (verbose) {
-            eprintf(stdout, "%20s: %.4f seconds\n", "profile init", finish-start);
-        }
-        start = parasail_time();
-#pragma omp parallel for schedule(guided)
-        for (long long index=0; index<(long long)profile_indices.size(); ++index)
-        {
-            int i = profile_indices[index];
-            long i_beg = BEG[i];
-            long i_end = END[i];
-            long i_len = i_end-i_beg;
-            size_t local_mem = matrix->size * i_len * profile_bits;
-            profiles[i] = pcreator((const char*)&T[i_beg], i_len, matrix);
-#pragma omp atomic
-            bytes_used += local_mem;
-        }
-        finish = parasail_time();
-        if (verbose) {
-            eprintf(stdout, "%20s: %.4f seconds\n", "profile creation", finish-start);
+            int i = vpairs[index].first;
+            if (!is_query[i]) {
+                is_query[i] = true;
+                all_profiles += profiles->bytes(i);
+            }
         }
+        bytes_used += min(capacity, all_profiles);
         if (verbose_memory) {
-            eprintf(stdout, "%20s: %.4f GB\n", "profile creation memory", bytes_used*GB);
+            eprintf(stdout, "%20s: %.4f GB\n", "profile cache", min(capacity, all_profiles)*GB);
         }
     }
 
@@ -1488,172 +1833,123 @@ int main(int argc, char **argv) {
         return 0;
     }
 
-    /* align pairs */
+    /* align pairs; results are written while later pairs align */
     start = parasail_time();
-    if (function) {
+    if (function || kfunction || pfunction) {
         size_t memory_estimate;
         long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, function_info,
-                vpairs, BEG, END,
-                memory_estimate);
-        bytes_used += memory_estimate;
-        vector<vector<pair<int,float> > > graph;
-        unsigned long edge_count = 0;
-        if (graph_output) {
-            graph.resize(sid);
-        }
-        for (size_t batch=0; batch<batches.size()-1; ++batch) {
-            long long start = batches[batch];
-            long long stop = batches[batch+1];
-            if (stop > vpairs_size) stop = vpairs_size;
-#pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
-            {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
-                long i_beg = BEG[i];
-                long i_end = END[i];
-                long i_len = i_end-i_beg;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = function(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, matrix);
-#pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            if (graph_output) {
-                output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG,
-                        END, vpairs, results, graph, edge_count, start,
-                        stop);
-            }
-            else {
-                output(is_stats, is_table, is_trace, edge_output,
-                        use_emboss_format, use_ssw_format,
-                        use_sam_format, use_sam_header, fop, has_query,
-                        sid_crossover, T, AOL, SIM, OS, matrix,
-                        BEG, END, vpairs, queries, sequences, results,
-                        start, stop);
-            }
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
-            }
-        }
-        if (graph_output) {
-            output_graph(fop, 0, T, AOL, SIM, OS, matrix, BEG,
-                    END, vpairs, results, graph, edge_count, 0,
-                    vpairs_size);
+        vector<long long> batches;
+        if (function) {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    memory_budget-bytes_used, function_info,
+                    vpairs, BEG, END,
+                    memory_estimate);
+        }
+        else if (kfunction) {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    memory_budget-bytes_used, kfunction_info,
+                    vpairs, BEG, END,
+                    memory_estimate);
         }
-    }
-    else if (is_banded) {
-        size_t memory_estimate;
-        long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, function_info,
-                vpairs, BEG, END,
-                memory_estimate);
-        bytes_used += memory_estimate;
-        for (size_t batch=0; batch<batches.size()-1; ++batch) {
-            long long start = batches[batch];
-            long long stop = batches[batch+1];
-            if (stop > vpairs_size) stop = vpairs_size;
-#pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
-            {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
-                long i_beg = BEG[i];
-                long i_end = END[i];
-                long i_len = i_end-i_beg;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                unsigned long local_work = i_len * j_len;
-                parasail_result_t *result = parasail_nw_banded(
-                        (const char*)&T[i_beg], i_len,
-                        (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend, kbandsize, matrix);
-#pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            output(is_stats, is_table, is_trace, edge_output,
-                    use_emboss_format, use_ssw_format, use_sam_format,
-                    use_sam_header, fop, has_query, sid_crossover, T, AOL,
-                    SIM, OS, matrix, BEG, END, vpairs, queries, sequences,
-                    results, start, stop);
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
-            }
+        else {
+            batches = calc_batches(
+                    batch_size,
+                    verbose && verbose_memory,
+                    memory_budget-bytes_used, pfunction_info,
+                    vpairs, BEG, END,
+                    memory_estimate);
         }
-    }
-    else if (pfunction) {
-        size_t memory_estimate;
-        long long vpairs_size = (long long)vpairs.size();
-        vector<long long> batches = calc_batches(
-                batch_size,
-                verbose && verbose_memory,
-                memory_budget-bytes_used, pfunction_info,
-                vpairs, BEG, END,
-                memory_estimate);
         bytes_used += memory_estimate;
         vector<vector<pair<int,float> > > graph;
         unsigned long edge_count = 0;
         if (graph_output) {
             graph.resize(sid);
         }
-        for (size_t batch=0; batch<batches.size()-1; ++batch) {
-            long long start = batches[batch];
-            long long stop = batches[batch+1];
-            if (stop > vpairs_size) stop = vpairs_size;
-#pragma omp parallel for schedule(guided)
-            for (long long index=start; index<stop; ++index)
-            {
-                int i = vpairs[index].first;
-                int j = vpairs[index].second;
-                long j_beg = BEG[j];
-                long j_end = END[j];
-                long j_len = j_end-j_beg;
-                parasail_profile_t *profile = profiles[i];
-                if (NULL == profile) {
-                    eprintf(stderr, "BAD PROFILE %d\n", i);
-                    exit(EXIT_FAILURE);
-                }
-                unsigned long local_work = profile->s1Len * j_len;
-                parasail_result_t *result = pfunction(
-                        profile, (const char*)&T[j_beg], j_len,
-                        gap_open, gap_extend);
+        result_queue queue(results, batches, vpairs, max(num_threads, 1));
+#pragma omp parallel
+        {
+            long long stop;
+            long long index = queue.claim(stop);
+            while (!queue.done()) {
+                long long write_start;
+                long long write_stop;
+                if (index < stop && queue.may_start(index)) {
+                    int i = vpairs[index].first;
+                    int j = vpairs[index].second;
+                    long i_beg = BEG[i];
+                    long i_end = END[i];
+                    long i_len = i_end-i_beg;
+                    long j_beg = BEG[j];
+                    long j_end = END[j];
+                    long j_len = j_end-j_beg;
+                    unsigned long local_work = i_len * j_len;
+                    parasail_result_t *result = NULL;
+                    if (function) {
+                        result = function(
+                                (const char*)&T[i_beg], i_len,
+                                (const char*)&T[j_beg], j_len,
+                                gap_open, gap_extend, matrix);
+                    }
+                    else if (kfunction) {
+                        result = kfunction(
+                                (const char*)&T[i_beg], i_len,
+                                (const char*)&T[j_beg], j_len,
+                                gap_open, gap_extend, kbandsize, matrix);
+                    }
+                    else {
+                        parasail_profile_t *profile = profiles->acquire(i);
+                        if (prune) {
+                            /* profiles are shared between threads, so the
+                             * per-pair threshold goes on a shallow copy */
+                            parasail_profile_t pair_profile = *profile;
+                            pair_profile.min_score = min_reported_score(
+                                    T, OS, matrix, i_beg, i_len,
+                                    j_beg, j_len);
+                            result = pfunction(
+                                    &pair_profile, (const char*)&T[j_beg], j_len,
+                                    gap_open, gap_extend);
+                        }
+                        else {
+                            result = pfunction(
+                                    profile, (const char*)&T[j_beg], j_len,
+                                    gap_open, gap_extend);
+                        }
+                        profiles->release(i);
+                    }
+                    if (NULL == result) {
+                        eprintf(stderr, "alignment of seq %d and seq %d failed\n", i, j);
+                        exit(EXIT_FAILURE);
+                    }
 #pragma omp atomic
-                work += local_work;
-                results[index] = result;
-            }
-            if (graph_output) {
-                output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG,
-                        END, vpairs, results, graph, edge_count, start,
-                        stop);
-            }
-            else {
-                output(is_stats, is_table, is_trace, edge_output,
-                        use_emboss_format, use_ssw_format,
-                        use_sam_format, use_sam_header, fop, has_query,
-                        sid_crossover, T, AOL, SIM, OS, matrix,
-                        BEG, END, vpairs, queries, sequences, results,
-                        start, stop);
-            }
-            for (long long index=start; index<stop; ++index) {
-                parasail_result_t *result = results[index];
-                parasail_result_free(result);
+                    work += local_work;
+                    queue.push(index, result);
+                    if (++index == stop) {
+                        index = queue.claim(stop);
+                    }
+                }
+                if (queue.begin_write(write_start, write_stop)) {
+                    if (graph_output) {
+                        output_graph(NULL, 0, T, AOL, SIM, OS, matrix, BEG,
+                                END, vpairs, results, graph, edge_count,
+                                write_start, write_stop);
+                    }
+                    else {
+                        output(is_stats, is_table, is_trace, edge_output,
+                                use_emboss_format, use_ssw_format,
+                                use_sam_format, use_sam_header, fop, has_query,
+                                sid_crossover, T, AOL, SIM, OS, matrix,
+                                BEG, END, vpairs, queries, sequences, results,
+                                write_start, write_stop);
+                    }
+                    for (long long k=write_start; k<write_stop; ++k) {
+                        parasail_result_free(results[k]);
+                    }
+                    queue.end_write(write_stop);
+                }
             }
         }
         if (graph_output) {
@@ -1679,14 +1975,10 @@ int main(int argc, char **argv) {
 
     if (pfunction) {
         start = parasail_time();
-#pragma omp parallel for schedule(guided)
-        for (long long index=0; index<(long long)profiles.size(); ++index)
-        {
-            if (NULL != profiles[index]) {
-                parasail_profile_free(profiles[index]);
-            }
+        if (verbose) {
+            eprintf(stdout, "%20s: %lu\n", "profiles built", profiles->profiles_built());
         }
-        profiles.clear();
+        delete profiles;
         finish = parasail_time();
         if (verbose) {
             eprintf(stdout, "%20s: %.4f seconds\n", "profile cleanup", finish-start);
@@ -1715,7 +2007,7 @@ int main(int argc, char **argv) {
 
 inline static void pair_check(
         unsigned long &count_generated,
-        PairSet &pairs,
+        PairBuffer &pairs,
         const int &i,
         const int &j,
         const int * const restrict SA,
@@ -1731,10 +2023,10 @@ inline static void pair_check(
             if (sidi != sidj) {
                 ++count_generated;
                 if (sidi < sidj) {
-                    pairs.insert(make_pair(sidi,sidj));
+                    pairs.push_back(pack_pair(sidi,sidj));
                 }
                 else {
-                    pairs.insert(make_pair(sidj,sidi));
+                    pairs.push_back(pack_pair(sidj,sidi));
                 }
             }
         }
@@ -1742,10 +2034,10 @@ inline static void pair_check(
             if (sidi != sidj && DB[sidi] != DB[sidj]) {
                 ++count_generated;
                 if (sidi > sidj) {
-                    pairs.insert(make_pair(sidi,sidj));
+                    pairs.push_back(pack_pair(sidi,sidj));
                 }
                 else {
-                    pairs.insert(make_pair(sidj,sidi));
+                    pairs.push_back(pack_pair(sidj,sidi));
                 }
             }
         }
@@ -1764,7 +2056,7 @@ inline static void pair_check(
  */
 inline static void process(
         unsigned long &count_generated,
-        PairSet &pairs,
+        PairBuffer &pairs,
         const quad &q,
         const int * const restrict SA,
         const unsigned char * const restrict BWT,
@@ -1803,6 +2095,356 @@ inline static void process(
     }
 }
 
+/* bottom-up traversal of the l-intervals of SA[bup_start-1..bup_stop-1];
+ * every interval is handed to process() once its right bound is known */
+inline static void enumerate_intervals(
+        unsigned long &count_generated,
+        PairBuffer &pairs,
+        size_t &compact_at,
+        int bup_start,
+        int bup_stop,
+        const int * const restrict SA,
+        const int * const restrict LCP,
+        const unsigned char * const restrict BWT,
+        const int * const restrict SID,
+        const vector<int> &DB,
+        const char &sentinal,
+        const int &cutoff)
+{
+    stack<quad> the_stack;
+    quad last_interval;
+    the_stack.push(quad());
+    for (int i = bup_start; i <= bup_stop; ++i) {
+        int lb = i - 1;
+        while (LCP[i] < the_stack.top().lcp) {
+            the_stack.top().rb = i - 1;
+            last_interval = the_stack.top();
+            the_stack.pop();
+            process(count_generated, pairs, last_interval, SA, BWT, SID, DB, sentinal, cutoff);
+            compact_pairs(pairs, compact_at);
+            lb = last_interval.lb;
+            if (LCP[i] <= the_stack.top().lcp) {
+                last_interval.children.clear();
+                the_stack.top().children.push_back(last_interval);
+                last_interval = quad();
+            }
+        }
+        if (LCP[i] > the_stack.top().lcp) {
+            if (!last_interval.empty()) {
+                last_interval.children.clear();
+                the_stack.push(quad(LCP[i],lb,INT_MAX,vector<quad>(1, last_interval)));
+                last_interval = quad();
+            }
+            else {
+                the_stack.push(quad(LCP[i],lb,INT_MAX));
+            }
+        }
+    }
+    the_stack.top().rb = bup_stop - 1;
+    process(count_generated, pairs, the_stack.top(), SA, BWT, SID, DB, sentinal, cutoff);
+    compact_pairs(pairs, compact_at);
+}
+
+/* Computes the same suffix and LCP arrays as sais(), using
+ * prefix doubling in the style of Larsson and Sadakane followed by the
+ * permuted LCP construction of Kasai et al. Groups of suffixes that
+ * still share a rank are refined independently of each other, and the
+ * permuted LCP is computed in chunks that each restart their match
+ * length at zero, so both phases run in parallel. Needs 3n ints of
+ * workspace. Returns 0 on success, -1 if memory ran out. */
+inline static int parallel_sais(
+        const unsigned char * const restrict T,
+        int * const restrict SA,
+        int * const restrict LCP,
+        int n)
+{
+    typedef unsigned long long packed_t;
+    int *rank = NULL;
+    packed_t *keys = NULL;
+    vector<pair<int,int> > groups;
+    long long h = 0;
+
+    if (n <= 1) {
+        if (n == 1) {
+            SA[0] = 0;
+            LCP[0] = 0;
+        }
+        return 0;
+    }
+
+    rank = (int*)malloc(sizeof(int) * n);
+    keys = (packed_t*)malloc(sizeof(packed_t) * n);
+    if (NULL == rank || NULL == keys) {
+        free(rank);
+        free(keys);
+        return -1;
+    }
+
+    /* bucket the suffixes by their first character; the rank of a
+     * suffix is the start of its group in SA */
+    {
+        int bucket[257] = {0};
+        int next[256];
+        for (int i=0; i<n; ++i) {
+            ++bucket[T[i]+1];
+        }
+        for (int c=0; c<256; ++c) {
+            bucket[c+1] += bucket[c];
+            next[c] = bucket[c];
+        }
+        for (int i=0; i<n; ++i) {
+            SA[next[T[i]]++] = i;
+        }
+        for (int c=0; c<256; ++c) {
+            if (bucket[c+1] - bucket[c] > 1) {
+                groups.push_back(make_pair(bucket[c], bucket[c+1]));
+            }
+        }
+#pragma omp parallel for
+        for (int i=0; i<n; ++i) {
+            rank[i] = bucket[T[i]];
+        }
+    }
+
+    /* each round sorts the tied groups by the rank h characters on,
+     * doubling the length of the prefixes known to be sorted */
+    for (h=1; !groups.empty(); h*=2) {
+        vector<pair<int,int> > next_groups;
+#pragma omp parallel for schedule(dynamic)
+        for (long long g=0; g<(long long)groups.size(); ++g) {
+            const int lo = groups[g].first;
+            const int hi = groups[g].second;
+            for (int k=lo; k<hi; ++k) {
+                /* a suffix ending within h sorts first */
+                packed_t p = SA[k];
+                packed_t key = p+h < (packed_t)n ? packed_t(rank[p+h])+1 : 0;
+                keys[k] = (key << 32) | p;
+            }
+            sort(keys+lo, keys+hi);
+        }
+        /* ranks are only updated after all groups were sorted on the
+         * ranks of the previous round */
+#pragma omp parallel
+        {
+            vector<pair<int,int> > local_groups;
+#pragma omp for schedule(dynamic)
+            for (long long g=0; g<(long long)groups.size(); ++g) {
+                const int hi = groups[g].second;
+                int k = groups[g].first;
+                while (k < hi) {
+                    int e = k+1;
+                    while (e < hi && (keys[e]>>32) == (keys[k]>>32)) {
+                        ++e;
+                    }
+                    for (int m=k; m<e; ++m) {
+                        SA[m] = int(keys[m] & 0xFFFFFFFFULL);
+                        rank[SA[m]] = k;
+                    }
+                    if (e-k > 1) {
+                        local_groups.push_back(make_pair(k, e));
+                    }
+                    k = e;
+                }
+            }
+#pragma omp critical(parallel_sais_groups)
+            next_groups.insert(next_groups.end(),
+                    local_groups.begin(), local_groups.end());
+        }
+        groups.swap(next_groups);
+    }
+
+    /* the rank array becomes PHI, the suffix preceding each suffix in
+     * SA, and the key array holds the permuted LCP */
+    {
+        int * const restrict phi = rank;
+        int * const restrict plcp = (int*)keys;
+        const int chunk = 1<<16;
+        phi[SA[0]] = -1;
+#pragma omp parallel for
+        for (int k=1; k<n; ++k) {
+            phi[SA[k]] = SA[k-1];
+        }
+#pragma omp parallel for schedule(dynamic)
+        for (int c=0; c<n; c+=chunk) {
+            const int stop = min(c+chunk, n);
+            int l = 0;
+            for (int i=c; i<stop; ++i) {
+                const int j = phi[i];
+                if (j < 0) {
+                    l = 0;
+                }
+                else {
+                    while (i+l < n && j+l < n && T[i+l] == T[j+l]) {
+                        ++l;
+                    }
+                }
+                plcp[i] = l;
+                if (l > 0) {
+                    --l;
+                }
+            }
+        }
+#pragma omp parallel for
+        for (int k=0; k<n; ++k) {
+            LCP[k] = plcp[SA[k]];
+        }
+        LCP[0] = 0;
+    }
+
+    free(keys);
+    free(rank);
+
+    return 0;
+}
+
+/* Sorts and deduplicates a thread's pairs whenever they have doubled
+ * since the last time, which bounds the buffer by about twice its
+ * unique pairs even when the same pair is generated many times. */
+inline static void compact_pairs(
+        PairBuffer &pairs,
+        size_t &compact_at)
+{
+    if (pairs.size() >= compact_at) {
+        sort(pairs.begin(), pairs.end());
+        pairs.erase(unique(pairs.begin(), pairs.end()), pairs.end());
+        compact_at = max(compact_at, 2*pairs.size());
+    }
+}
+
+/* Concatenates the per-thread buffers into pairs, then sorts them with
+ * a parallel LSD radix sort and removes duplicates in parallel. Each
+ * pass handles one byte; bytes that are equal in every pair are
+ * skipped, so small sequence counts need few passes. The buffers are
+ * released as they are copied. */
+inline static void merge_pairs(
+        vector<PairBuffer> &buffers,
+        PairBuffer &pairs)
+{
+    vector<size_t> offsets(buffers.size()+1, 0);
+    for (size_t b=0; b<buffers.size(); ++b) {
+        offsets[b+1] = offsets[b] + buffers[b].size();
+    }
+    const size_t n = offsets.back();
+    const long long blocks = (long long)min(n/(1<<16)+1, size_t(256));
+    PackedPair differ = 0;
+
+    pairs.resize(n);
+#pragma omp parallel for schedule(dynamic)
+    for (long long b=0; b<(long long)buffers.size(); ++b) {
+        copy(buffers[b].begin(), buffers[b].end(),
+                pairs.begin()+offsets[b]);
+        PairBuffer().swap(buffers[b]);
+    }
+    if (0 == n) {
+        return;
+    }
+
+    PairBuffer scratch(n);
+#pragma omp parallel for reduction(|:differ)
+    for (long long k=1; k<(long long)n; ++k) {
+        differ |= pairs[k] ^ pairs[0];
+    }
+    for (int shift=0; shift<64; shift+=8) {
+        vector<size_t> count(blocks*256, 0);
+        size_t sum = 0;
+        if (0 == ((differ >> shift) & 0xFF)) {
+            continue;
+        }
+#pragma omp parallel for
+        for (long long b=0; b<blocks; ++b) {
+            size_t * const restrict local = &count[b*256];
+            for (size_t k=n*b/blocks; k<n*(b+1)/blocks; ++k) {
+                ++local[(pairs[k] >> shift) & 0xFF];
+            }
+        }
+        /* digit-major so each block scatters stably into its own
+         * slice of every bucket */
+        for (int d=0; d<256; ++d) {
+            for (long long b=0; b<blocks; ++b) {
+                size_t tmp = count[b*256+d];
+                count[b*256+d] = sum;
+                sum += tmp;
+            }
+        }
+#pragma omp parallel for
+        for (long long b=0; b<blocks; ++b) {
+            size_t * const restrict local = &count[b*256];
+            for (size_t k=n*b/blocks; k<n*(b+1)/blocks; ++k) {
+                scratch[local[(pairs[k] >> shift) & 0xFF]++] = pairs[k];
+            }
+        }
+        pairs.swap(scratch);
+    }
+
+    /* keep the first of each run of equal pairs */
+    {
+        vector<size_t> kept(blocks+1, 0);
+#pragma omp parallel for
+        for (long long b=0; b<blocks; ++b) {
+            for (size_t k=n*b/blocks; k<n*(b+1)/blocks; ++k) {
+                if (0 == k || pairs[k] != pairs[k-1]) {
+                    ++kept[b+1];
+                }
+            }
+        }
+        for (long long b=0; b<blocks; ++b) {
+            kept[b+1] += kept[b];
+        }
+#pragma omp parallel for
+        for (long long b=0; b<blocks; ++b) {
+            size_t out = kept[b];
+            for (size_t k=n*b/blocks; k<n*(b+1)/blocks; ++k) {
+                if (0 == k || pairs[k] != pairs[k-1]) {
+                    scratch[out++] = pairs[k];
+                }
+            }
+        }
+        PairBuffer(scratch.begin(), scratch.begin()+kept[blocks]).swap(pairs);
+    }
+}
+
+/* Groups the pairs by query (first) index and orders the groups by
+ * their total number of cells, largest first; ties keep the query
+ * order and each group keeps its pair order. Threads claim runs of
+ * consecutive pairs, so this keeps a query's profile hot while the
+ * costly groups start early and the cheap ones even out the end. */
+inline static void schedule_pairs(
+        PairVec &vpairs,
+        const vector<long> &BEG,
+        const vector<long> &END)
+{
+    const size_t sid = BEG.size();
+    vector<unsigned long long> cost(sid, 0);
+    vector<size_t> count(sid, 0);
+    vector<pair<unsigned long long,int> > order;
+    vector<size_t> offset(sid, 0);
+    size_t sum = 0;
+
+    for (size_t index=0; index<vpairs.size(); ++index) {
+        int i = vpairs[index].first;
+        int j = vpairs[index].second;
+        cost[i] += (unsigned long long)(END[i]-BEG[i]) * (END[j]-BEG[j]);
+        ++count[i];
+    }
+    for (size_t i=0; i<sid; ++i) {
+        if (count[i]) {
+            /* complemented so an ascending sort puts costly groups first */
+            order.push_back(make_pair(~cost[i], int(i)));
+        }
+    }
+    sort(order.begin(), order.end());
+    for (size_t g=0; g<order.size(); ++g) {
+        offset[order[g].second] = sum;
+        sum += count[order[g].second];
+    }
+
+    PairVec scheduled(vpairs.size());
+    for (size_t index=0; index<vpairs.size(); ++index) {
+        scheduled[offset[vpairs[index].first]++] = vpairs[index];
+    }
+    vpairs.swap(scheduled);
+}
+
 inline static void print_array(
         const char * filename_,
         const int * const restrict array,
@@ -1847,6 +2489,31 @@ inline static int self_score(
     return score;
 }
 
+/* The lowest score that passes the OS filter of output_edges and
+ * output_graph, or INT32_MIN when every score might pass. */
+inline static int min_reported_score(
+        unsigned char *T,
+        int OS,
+        const parasail_matrix_t *matrix,
+        long i_beg,
+        long i_len,
+        long j_beg,
+        long j_len)
+{
+    int self_score_ = 0;
+    if (i_len > j_len) {
+        self_score_ = self_score((const char*)&T[i_beg], i_len, matrix);
+    }
+    else {
+        self_score_ = self_score((const char*)&T[j_beg], j_len, matrix);
+    }
+    if (OS <= 0 || self_score_ <= 0) {
+        return INT32_MIN;
+    }
+    /* smallest score with score * 100 >= OS * self_score_ */
+    return (OS * self_score_ + 99) / 100;
+}
+
 inline static void output_edges(
         FILE *fop,
         bool has_query,
@@ -1888,6 +2555,11 @@ inline static void output_edges(
             continue;
         }
 
+        /* pruned pairs cannot pass the OS filter */
+        if (parasail_result_is_pruned(result)) {
+            continue;
+        }
+
         int score = parasail_result_get_score(result);
         int matches = parasail_result_get_matches(result);
         int length = parasail_result_get_length(result);
@@ -1956,6 +2628,10 @@ inline static void output_graph(
                 continue;
             }
 
+            if (parasail_result_is_pruned(result)) {
+                continue;
+            }
+
             int score = parasail_result_get_score(result);
             int matches = parasail_result_get_matches(result);
             int length = parasail_result_get_length(result);
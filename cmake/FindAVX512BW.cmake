@@ -0,0 +1,103 @@
+#.rst:
+# FindAVX512BW
+# ------------
+#
+# Finds AVX512BW support
+#
+# This module can be used to detect AVX512BW support in a C compiler.  If
+# the compiler supports AVX512BW, the flags required to compile with
+# AVX512BW support are returned in variables for the different languages.
+# The variables may be empty if the compiler does not need a special
+# flag to support AVX512BW.
+#
+# The following variables are set:
+#
+# ::
+#
+#    AVX512BW_C_FLAGS - flags to add to the C compiler for AVX512BW support
+#    AVX512BW_FOUND - true if AVX512BW is detected
+#
+#=============================================================================
+
+set(_AVX512BW_REQUIRED_VARS)
+set(CMAKE_REQUIRED_QUIET_SAVE ${CMAKE_REQUIRED_QUIET})
+set(CMAKE_REQUIRED_QUIET ${AVX512BW_FIND_QUIETLY})
+
+# sample AVX512BW source code to test
+set(AVX512BW_C_TEST_SOURCE
+"
+#include <immintrin.h>
+void parasail_memset___m512i(__m512i *b, __m512i c, size_t len)
+{
+    size_t i;
+    for (i=0; i<len; ++i) {
+        _mm512_store_si512(&b[i], c);
+    }
+}
+
+int foo() {
+    __m512i vOne = _mm512_set1_epi8(1);
+    __m512i result =  _mm512_adds_epi8(vOne,vOne);
+    result = _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(result,vOne));
+    return _mm_extract_epi16(_mm512_castsi512_si128(result),0);
+}
+int main(void) { return (int)foo(); }
+")
+
+# if these are set then do not try to find them again,
+# by avoiding any try_compiles for the flags
+if((DEFINED AVX512BW_C_FLAGS) OR (DEFINED HAVE_AVX512BW))
+else()
+  if(WIN32)
+    set(AVX512BW_C_FLAG_CANDIDATES
+      "/arch:AVX512")
+  else()
+    set(AVX512BW_C_FLAG_CANDIDATES
+      #Empty, if compiler automatically accepts AVX512BW
+      " "
+      #GNU, Intel, clang
+      "-mavx512bw"
+      #Intel
+      "-xCORE-AVX512"
+    )
+  endif()
+
+  include(CheckCSourceCompiles)
+
+  foreach(FLAG IN LISTS AVX512BW_C_FLAG_CANDIDATES)
+    set(SAFE_CMAKE_REQUIRED_FLAGS "${CMAKE_REQUIRED_FLAGS}")
+    set(CMAKE_REQUIRED_FLAGS "${FLAG}")
+    unset(HAVE_AVX512BW CACHE)
+    if(NOT CMAKE_REQUIRED_QUIET)
+      message(STATUS "Try AVX512BW C flag = [${FLAG}]")
+    endif()
+    check_c_source_compiles("${AVX512BW_C_TEST_SOURCE}" HAVE_AVX512BW)
+    set(CMAKE_REQUIRED_FLAGS "${SAFE_CMAKE_REQUIRED_FLAGS}")
+    if(HAVE_AVX512BW)
+      set(AVX512BW_C_FLAGS_INTERNAL "${FLAG}")
+      break()
+    endif()
+  endforeach()
+
+  unset(AVX512BW_C_FLAG_CANDIDATES)
+
+  set(AVX512BW_C_FLAGS "${AVX512BW_C_FLAGS_INTERNAL}"
+    CACHE STRING "C compiler flags for AVX512BW intrinsics")
+endif()
+
+list(APPEND _AVX512BW_REQUIRED_VARS AVX512BW_C_FLAGS)
+
+set(CMAKE_REQUIRED_QUIET ${CMAKE_REQUIRED_QUIET_SAVE})
+
+if(_AVX512BW_REQUIRED_VARS)
+  include(FindPackageHandleStandardArgs)
+
+  find_package_handle_standard_args(AVX512BW
+                                    REQUIRED_VARS ${_AVX512BW_REQUIRED_VARS})
+
+  mark_as_advanced(${_AVX512BW_REQUIRED_VARS})
+
+  unset(_AVX512BW_REQUIRED_VARS)
+else()
+  message(SEND_ERROR "FindAVX512BW requires C or CXX language to be enabled")
+endif()
@@ -45,6 +45,8 @@ extern "C" {
 #define PARASAIL_FLAG_NW          (1 << 0) /*00000000000000000000000000000001*/
 #define PARASAIL_FLAG_SG          (1 << 1) /*00000000000000000000000000000010*/
 #define PARASAIL_FLAG_SW          (1 << 2) /*00000000000000000000000000000100*/
+#define PARASAIL_FLAG_XDROP       (1 << 3) /*00000000000000000000000000001000*/
+#define PARASAIL_FLAG_PRUNED      (1 << 4) /*00000000000000000000000000010000*/
 #define PARASAIL_FLAG_SATURATED   (1 << 6) /*00000000000000000000000001000000*/
 #define PARASAIL_FLAG_BANDED      (1 << 7) /*00000000000000000000000010000000*/
 #define PARASAIL_FLAG_NOVEC       (1 << 8) /*00000000000000000000000100000000*/
@@ -53,6 +55,8 @@ extern "C" {
 #define PARASAIL_FLAG_STRIPED     (1 <<11) /*00000000000000000000100000000000*/
 #define PARASAIL_FLAG_DIAG        (1 <<12) /*00000000000000000001000000000000*/
 #define PARASAIL_FLAG_BLOCKED     (1 <<13) /*00000000000000000010000000000000*/
+#define PARASAIL_FLAG_BATCH       (1 <<14) /*00000000000000000100000000000000*/
+#define PARASAIL_FLAG_LINEAR      (1 <<15) /*00000000000000001000000000000000*/
 #define PARASAIL_FLAG_STATS       (1 <<16) /*00000000000000010000000000000000*/
 #define PARASAIL_FLAG_TABLE       (1 <<17) /*00000000000000100000000000000000*/
 #define PARASAIL_FLAG_ROWCOL      (1 <<18) /*00000000000001000000000000000000*/
@@ -68,7 +72,7 @@ extern "C" {
 #define PARASAIL_FLAG_LANES_16    (1 <<28) /*00010000000000000000000000000000*/
 #define PARASAIL_FLAG_LANES_32    (1 <<29) /*00100000000000000000000000000000*/
 #define PARASAIL_FLAG_LANES_64    (1 <<30) /*01000000000000000000000000000000*/
-#define PARASAIL_FLAG_INVALID  0x8000C038  /*10000000000000001100000000111000*/
+#define PARASAIL_FLAG_INVALID  0x80000020  /*10000000000000000000000000100000*/
 
 /*
  * This helps users not familiar with the restrict keyword.
@@ -120,9 +124,11 @@ typedef struct parasail_result_extra_rowcols {
 } parasail_result_extra_rowcols_t;
 
 typedef struct parasail_result_extra_trace {
-    void * restrict trace_table;    /* DP table of traceback */
+    void * restrict trace_table;    /* DP table of traceback, int8_t per cell */
     void * restrict trace_ins_table;/* DP table of insertions traceback */
     void * restrict trace_del_table;/* DP table of deletions traceback */
+    int band;                       /* band size k of banded traces */
+    int * band_start;               /* first column of each adaptive band row */
 } parasail_result_extra_trace_t;
 
 typedef struct parasail_result {
@@ -130,6 +136,7 @@ typedef struct parasail_result {
     int end_query;  /* end position of query sequence */
     int end_ref;    /* end position of reference sequence */
     int flag;       /* bit field for various flags */
+    int stop_ref;   /* reference position where X-drop or pruning stopped, else -1 */
     /* union of pointers to extra result data based on the flag */
     union {
         void *extra;
@@ -166,6 +173,9 @@ typedef struct parasail_profile {
     struct parasail_profile_data profile64;
     void (*free)(void * profile);
     int stop;
+    int xdrop;      /* striped sw/sg stop once the column max drops this far, 0 disables */
+    int zdrop;      /* as xdrop, but forgiving gap-extend per diagonal of drift, 0 disables */
+    int min_score;  /* striped sw/sg give up once this score is out of reach, INT32_MIN disables */
 } parasail_profile_t;
 
 extern void parasail_profile_free(parasail_profile_t *profile);
@@ -197,10 +207,87 @@ typedef parasail_result_t* parasail_pfunction_t(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+typedef parasail_result_t** parasail_bfunction_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix);
+
+typedef parasail_result_t** parasail_bpfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap);
+
+/* Scratch memory reused by the *_ws profile functions.  Not thread
+ * safe; use one workspace per thread.  It grows to fit the largest
+ * alignment seen and is released by parasail_workspace_free. */
+typedef struct parasail_workspace {
+    void *buffer;   /* SIMD-aligned scratch memory */
+    size_t size;    /* size of buffer in bytes */
+} parasail_workspace_t;
+
+typedef parasail_result_t* parasail_pwfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+/* Sequence already passed through a matrix mapper, for the *_enc
+ * profile functions.  Each residue is stored as a code of bits bits,
+ * packed from the low bits of each byte.  Two bits hold the four
+ * nucleotides of dnafull and nuc44, four bits hold their ambiguity
+ * codes too, and eight bits hold the code of any matrix. */
+typedef struct parasail_encoded {
+    unsigned char *codes;
+    int length;     /* number of residues */
+    int bits;       /* 2, 4, or 8 */
+} parasail_encoded_t;
+
+typedef parasail_result_t* parasail_pefunction_t(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+/* Banded functions take the band size k.  The band holds the cells
+ * within k diagonals of the two diagonals through the corners of the
+ * table; cells outside the band are never aligned. */
+typedef parasail_result_t* parasail_kfunction_t(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix);
+
+typedef struct parasail_kfunction_info {
+    parasail_kfunction_t * pointer;
+    const char * name;
+    const char * alg;
+    const char * type;
+    const char * isa;
+    const char * bits;
+    const char * width;
+    int lanes;
+    char is_table;
+    char is_rowcol;
+    char is_trace;
+    char is_stats;
+    char is_ref;
+} parasail_kfunction_info_t;
+
 typedef parasail_profile_t* parasail_pcreator_t(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix);
 
+/* Called by the striped Smith-Waterman _sat functions each time a
+ * saturated alignment is promoted to a wider element.  cells is the
+ * number of cells that did not need to be computed again. */
+typedef void parasail_sat_hook_t(
+        int from_bits, int to_bits, long long cells, void *data);
+
 typedef struct parasail_pfunction_info {
     parasail_pfunction_t * pointer;
     parasail_pcreator_t * creator;
@@ -224,6 +311,44 @@ extern void parasail_version(int *major, int *minor, int *patch);
 /** Deallocate result. */
 extern void parasail_result_free(parasail_result_t *result);
 
+/** Deallocate the array of results returned by a batch function. */
+extern void parasail_result_batch_free(parasail_result_t **results, int count);
+
+/** Allocate an empty workspace for the *_ws profile functions. */
+extern parasail_workspace_t* parasail_workspace_new(void);
+
+/** Deallocate workspace and its scratch memory. */
+extern void parasail_workspace_free(parasail_workspace_t *workspace);
+
+/** Encode s using the codes of matrix, packed into bits bits per
+ * residue.  Returns NULL if bits is not 2, 4, or 8 or if the code of a
+ * residue does not fit. */
+extern parasail_encoded_t* parasail_encode(
+        const char *s, const int length,
+        const parasail_matrix_t *matrix, const int bits);
+
+/** Deallocate encoded sequence. */
+extern void parasail_encoded_free(parasail_encoded_t *encoded);
+
+/** Set the saturation promotion hook, or unset it with NULL.  Not
+ * thread safe; set it before aligning. */
+extern void parasail_set_sat_hook(parasail_sat_hook_t *hook, void *data);
+
+/** Set the size in bytes beyond which the striped functions do not
+ * build a query profile but look scores up from the matrix row of each
+ * database residue, for matrices of at most 32 residues with scores in
+ * the int8_t range.  The default is 256 KiB.  Not thread safe; set it
+ * before aligning. */
+extern void parasail_set_profile_budget(size_t bytes);
+
+/** Calibrate the cost model of the _auto functions.  The model is read
+ * from path if it names a model saved on this instruction set, else it
+ * is measured and, if path is not NULL, saved there.  Returns 0, or -1
+ * if the model could not be saved.  The first _auto call calibrates
+ * with path taken from the PARASAIL_AUTO_CACHE environment variable.
+ * Not thread safe while the _auto functions are running. */
+extern int parasail_auto_calibrate(const char *path);
+
 /** Lookup function by name. */
 extern parasail_function_t * parasail_lookup_function(const char *funcname);
 
@@ -239,6 +364,12 @@ extern const parasail_function_info_t * parasail_lookup_function_info(const char
 /** Lookup function info by name. */
 extern const parasail_pfunction_info_t * parasail_lookup_pfunction_info(const char *funcname);
 
+/** Lookup banded function by name. */
+extern parasail_kfunction_t * parasail_lookup_kfunction(const char *funcname);
+
+/** Lookup banded function info by name. */
+extern const parasail_kfunction_info_t * parasail_lookup_kfunction_info(const char *funcname);
+
 /** Current time in seconds with nanosecond resolution. */
 extern double parasail_time(void);
 
@@ -267,6 +398,128 @@ extern parasail_result_t* parasail_nw_banded(
         const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+/* Banded trace functions.  The trace table holds only the cells of the
+ * band, one row of 2k+|s2Len-s1Len|+1 cells per query position.  Use
+ * the result with parasail_result_get_cigar and the traceback functions
+ * like any trace result. */
+extern parasail_result_t* parasail_nw_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+/* Adaptive banded functions.  The band holds the 2k+1 cells of each
+ * query row around a centre that follows the best cell of the row
+ * above, so it tracks the alignment as indels shift it off the main
+ * diagonal.  The trace variants record the band of every row in
+ * trace->band_start for the cigar and traceback functions. */
+extern parasail_result_t* parasail_nw_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix);
+
+/* Automatic functions.  Each call runs the scan, striped or diag
+ * kernel and the element width that a calibrated cost model predicts
+ * to be fastest for the sequence lengths and gap extension.  A width
+ * that saturates is retried at the next wider one.  See
+ * parasail_auto_calibrate. */
+extern parasail_result_t* parasail_nw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+/* Trace functions that use memory linear in s2Len and sublinear in
+ * s1Len instead of a full s1Len*s2Len trace table, at roughly twice the
+ * cost.  Use the result with parasail_result_get_cigar and the
+ * traceback functions like any trace result; the cigar and traceback
+ * are identical to those of parasail_{nw,sg,sw}_trace.  The trace table
+ * of these results holds only the cells visited by the traceback. */
+extern parasail_result_t* parasail_nw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 typedef struct parasail_traceback_{
     char *query;
     char *comp;
@@ -412,11 +665,15 @@ extern int parasail_result_is_nw(const parasail_result_t * const restrict result
 extern int parasail_result_is_sg(const parasail_result_t * const restrict result);
 extern int parasail_result_is_sw(const parasail_result_t * const restrict result);
 extern int parasail_result_is_saturated(const parasail_result_t * const restrict result);
+extern int parasail_result_is_xdrop(const parasail_result_t * const restrict result);
+extern int parasail_result_is_pruned(const parasail_result_t * const restrict result);
 extern int parasail_result_is_banded(const parasail_result_t * const restrict result);
 extern int parasail_result_is_scan(const parasail_result_t * const restrict result);
 extern int parasail_result_is_striped(const parasail_result_t * const restrict result);
 extern int parasail_result_is_diag(const parasail_result_t * const restrict result);
 extern int parasail_result_is_blocked(const parasail_result_t * const restrict result);
+extern int parasail_result_is_batch(const parasail_result_t * const restrict result);
+extern int parasail_result_is_linear(const parasail_result_t * const restrict result);
 extern int parasail_result_is_stats(const parasail_result_t * const restrict result);
 extern int parasail_result_is_stats_table(const parasail_result_t * const restrict result);
 extern int parasail_result_is_stats_rowcol(const parasail_result_t * const restrict result);
@@ -795,6 +1052,36 @@ extern parasail_result_t* parasail_nw_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -945,6 +1232,36 @@ extern parasail_result_t* parasail_nw_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1095,6 +1412,36 @@ extern parasail_result_t* parasail_nw_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1245,6 +1592,36 @@ extern parasail_result_t* parasail_nw_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1395,6 +1772,36 @@ extern parasail_result_t* parasail_nw_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1545,7 +1952,37 @@ extern parasail_result_t* parasail_nw_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_table_diag_altivec_128_64(
+extern parasail_result_t* parasail_nw_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -1695,6 +2132,36 @@ extern parasail_result_t* parasail_nw_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1845,6 +2312,36 @@ extern parasail_result_t* parasail_nw_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -1995,6 +2492,36 @@ extern parasail_result_t* parasail_nw_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2145,6 +2672,36 @@ extern parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2295,6 +2852,36 @@ extern parasail_result_t* parasail_nw_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2445,6 +3032,36 @@ extern parasail_result_t* parasail_nw_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2595,6 +3212,36 @@ extern parasail_result_t* parasail_nw_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2745,6 +3392,36 @@ extern parasail_result_t* parasail_nw_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -2895,6 +3572,36 @@ extern parasail_result_t* parasail_nw_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3045,31 +3752,61 @@ extern parasail_result_t* parasail_nw_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_64(
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_32(
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_16(
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_8(
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_sat(
+extern parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -3195,6 +3932,36 @@ extern parasail_result_t* parasail_nw_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3345,6 +4112,36 @@ extern parasail_result_t* parasail_nw_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3495,6 +4292,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3645,6 +4472,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3795,6 +4652,36 @@ extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -3945,6 +4832,36 @@ extern parasail_result_t* parasail_sg_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4095,6 +5012,36 @@ extern parasail_result_t* parasail_sg_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4245,6 +5192,36 @@ extern parasail_result_t* parasail_sg_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4395,6 +5372,36 @@ extern parasail_result_t* parasail_sg_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4545,7 +5552,37 @@ extern parasail_result_t* parasail_sg_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_altivec_128_64(
+extern parasail_result_t* parasail_sg_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -4695,6 +5732,36 @@ extern parasail_result_t* parasail_sg_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4845,6 +5912,36 @@ extern parasail_result_t* parasail_sg_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -4995,6 +6092,36 @@ extern parasail_result_t* parasail_sg_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5145,6 +6272,36 @@ extern parasail_result_t* parasail_sg_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5295,6 +6452,36 @@ extern parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5445,6 +6632,36 @@ extern parasail_result_t* parasail_sg_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5595,6 +6812,36 @@ extern parasail_result_t* parasail_sg_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5745,6 +6992,36 @@ extern parasail_result_t* parasail_sg_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -5895,6 +7172,36 @@ extern parasail_result_t* parasail_sg_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6045,31 +7352,61 @@ extern parasail_result_t* parasail_sg_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_altivec_128_64(
+extern parasail_result_t* parasail_sg_stats_diag_avx512bw_512_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_altivec_128_32(
+extern parasail_result_t* parasail_sg_stats_diag_avx512bw_512_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_altivec_128_16(
+extern parasail_result_t* parasail_sg_stats_diag_avx512bw_512_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_altivec_128_8(
+extern parasail_result_t* parasail_sg_stats_diag_avx512bw_512_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_altivec_128_sat(
+extern parasail_result_t* parasail_sg_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -6195,6 +7532,36 @@ extern parasail_result_t* parasail_sg_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6345,6 +7712,36 @@ extern parasail_result_t* parasail_sg_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6495,6 +7892,36 @@ extern parasail_result_t* parasail_sg_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6645,6 +8072,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6795,6 +8252,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -6945,6 +8432,36 @@ extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7095,6 +8612,36 @@ extern parasail_result_t* parasail_sw_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7245,6 +8792,36 @@ extern parasail_result_t* parasail_sw_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7395,6 +8972,36 @@ extern parasail_result_t* parasail_sw_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7545,7 +9152,37 @@ extern parasail_result_t* parasail_sw_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_altivec_128_64(
+extern parasail_result_t* parasail_sw_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -7695,6 +9332,36 @@ extern parasail_result_t* parasail_sw_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7845,6 +9512,36 @@ extern parasail_result_t* parasail_sw_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -7995,6 +9692,36 @@ extern parasail_result_t* parasail_sw_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8145,6 +9872,36 @@ extern parasail_result_t* parasail_sw_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8295,6 +10052,36 @@ extern parasail_result_t* parasail_sw_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8445,6 +10232,36 @@ extern parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8595,6 +10412,36 @@ extern parasail_result_t* parasail_sw_trace_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8745,6 +10592,36 @@ extern parasail_result_t* parasail_sw_trace_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_trace_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -8895,6 +10772,36 @@ extern parasail_result_t* parasail_sw_stats_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9045,31 +10952,61 @@ extern parasail_result_t* parasail_sw_stats_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_altivec_128_64(
+extern parasail_result_t* parasail_sw_stats_striped_avx512bw_512_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_altivec_128_32(
+extern parasail_result_t* parasail_sw_stats_striped_avx512bw_512_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_altivec_128_16(
+extern parasail_result_t* parasail_sw_stats_striped_avx512bw_512_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_altivec_128_8(
+extern parasail_result_t* parasail_sw_stats_striped_avx512bw_512_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_altivec_128_sat(
+extern parasail_result_t* parasail_sw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -9195,6 +11132,36 @@ extern parasail_result_t* parasail_sw_stats_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9345,6 +11312,36 @@ extern parasail_result_t* parasail_sw_stats_table_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9495,6 +11492,36 @@ extern parasail_result_t* parasail_sw_stats_table_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9645,6 +11672,36 @@ extern parasail_result_t* parasail_sw_stats_table_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_table_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9795,6 +11852,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_scan_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -9945,6 +12032,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_striped_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10095,6 +12212,36 @@ extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx2_256_sat(
         const int open, const int gap,
         const parasail_matrix_t* matrix);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_diag_altivec_128_64(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
@@ -10230,6 +12377,31 @@ extern parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -10355,6 +12527,31 @@ extern parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -10480,42 +12677,67 @@ extern parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_64(
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_32(
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_16(
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_8(
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_sat(
+extern parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_64(
+extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_32(
+extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_16(
+extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_neon_128_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
@@ -10605,6 +12827,31 @@ extern parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -10730,6 +12977,31 @@ extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -10855,6 +13127,31 @@ extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -10980,6 +13277,31 @@ extern parasail_result_t* parasail_nw_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11105,6 +13427,31 @@ extern parasail_result_t* parasail_nw_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11230,6 +13577,31 @@ extern parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11355,6 +13727,31 @@ extern parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11480,6 +13877,31 @@ extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11605,6 +14027,31 @@ extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11730,6 +14177,31 @@ extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11855,6 +14327,31 @@ extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -11980,42 +14477,67 @@ extern parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_altivec_128_64(
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_altivec_128_32(
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_altivec_128_16(
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_altivec_128_8(
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_altivec_128_sat(
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_neon_128_64(
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_neon_128_32(
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_scan_profile_neon_128_16(
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
@@ -12105,6 +14627,31 @@ extern parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12230,6 +14777,31 @@ extern parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12355,6 +14927,31 @@ extern parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12480,6 +15077,31 @@ extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12605,6 +15227,31 @@ extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12730,6 +15377,31 @@ extern parasail_result_t* parasail_sg_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12855,6 +15527,31 @@ extern parasail_result_t* parasail_sg_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -12980,6 +15677,31 @@ extern parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13105,6 +15827,31 @@ extern parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13230,6 +15977,31 @@ extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13355,6 +16127,31 @@ extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13480,42 +16277,67 @@ extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_64(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_32(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_16(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_8(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_sat(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_64(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_32(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_16(
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
@@ -13605,6 +16427,31 @@ extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13730,6 +16577,31 @@ extern parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13855,6 +16727,31 @@ extern parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -13980,6 +16877,31 @@ extern parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14105,6 +17027,31 @@ extern parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14230,6 +17177,31 @@ extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14355,6 +17327,31 @@ extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14480,6 +17477,31 @@ extern parasail_result_t* parasail_sw_trace_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_trace_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14605,6 +17627,31 @@ extern parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_trace_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14730,6 +17777,31 @@ extern parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14855,6 +17927,31 @@ extern parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -14980,42 +18077,67 @@ extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_64(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_32(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_16(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_8(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_8(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_sat(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_64(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_32(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_32(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_16(
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_16(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
@@ -15105,6 +18227,31 @@ extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_table_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -15230,6 +18377,31 @@ extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -15355,6 +18527,31 @@ extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
 extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_64(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
@@ -15405,3558 +18602,7995 @@ extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_striped_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_diag_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_diag_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_diag_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_diag_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_trace_diag_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_nw_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_trace_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sg_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_64(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_32(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_16(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_8(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
         const int open, const int gap,
-        const parasail_matrix_t* matrix);
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_profile_64(
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_profile_32(
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_profile_16(
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_profile_8(
+extern parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_scan_profile_sat(
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_profile_64(
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_profile_32(
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_profile_16(
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_profile_8(
+extern parasail_result_t* parasail_sw_scan_profile_neon_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_striped_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_scan_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_table_striped_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_scan_profile_sat(
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_64_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_profile_64(
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_32_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_profile_32(
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_16_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_profile_16(
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_8_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_profile_8(
+extern parasail_result_t* parasail_sw_striped_profile_neon_128_sat_enc(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
 
-extern parasail_result_t* parasail_nw_trace_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_scan_64(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_scan_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_scan_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_scan_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_striped_64(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_striped_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_striped_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_striped_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_diag_64(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_diag_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_nw_diag_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_profile_16(
+extern parasail_result_t* parasail_nw_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_trace_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_trace_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_trace_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap);
+
+extern parasail_result_t* parasail_nw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_scan_profile_sat_enc(
         const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_nw_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_scan_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sg_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_scan_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_result_t* parasail_sw_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+extern parasail_profile_t* parasail_profile_create_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_avx_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_avx_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_profile_t* parasail_profile_create_stats_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sg_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_trace_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_trace_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_trace_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_stats_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_stats_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_stats_diag_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_stats_table_scan_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
+extern parasail_result_t* parasail_sw_stats_table_striped_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_table_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
+
+extern parasail_result_t** parasail_sw_batch_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_profile_32(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_profile_16(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_profile_8(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_profile_64(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_profile_32(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_profile_16(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_profile_8(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_scan_profile_64(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap);
+extern parasail_result_t** parasail_sw_batch_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_scan_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_scan_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_scan_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_scan_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_striped_profile_64(
+extern parasail_result_t** parasail_sw_batch_profile_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_striped_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile_sse2_128_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_striped_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_sse2_128_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_striped_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_sse2_128_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_striped_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_64(
+extern parasail_result_t** parasail_sw_batch_profile_sse41_128_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile_sse41_128_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_sse41_128_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_avx2_256_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_profile_64(
+extern parasail_result_t** parasail_sw_batch_profile_avx2_256_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile_avx2_256_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_avx512bw_512_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_avx512bw_512_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64(
+extern parasail_result_t** parasail_sw_batch_profile_avx512bw_512_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_altivec_128_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_altivec_128_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_altivec_128_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64(
+extern parasail_result_t** parasail_sw_batch_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32(
+extern parasail_result_t** parasail_sw_batch_profile_neon_128_32(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16(
+extern parasail_result_t** parasail_sw_batch_profile_neon_128_16(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8(
+extern parasail_result_t** parasail_sw_batch_profile_neon_128_8(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+extern parasail_result_t** parasail_sw_batch_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
         const int open, const int gap);
 
-extern parasail_profile_t* parasail_profile_create_sse_128_64(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_sse_128_32(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_sse_128_16(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_sse_128_8(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_sse_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_avx_256_64(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_avx_256_32(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_avx_256_16(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_avx_256_8(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_avx_256_sat(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_altivec_128_64(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_altivec_128_32(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_altivec_128_16(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_altivec_128_8(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_altivec_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_neon_128_64(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_neon_128_32(
-        const char * const restrict s1, const int s1Len,
-        const parasail_matrix_t* matrix);
-
-extern parasail_profile_t* parasail_profile_create_neon_128_16(
+extern parasail_result_t* parasail_nw_banded_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_neon_128_8(
+extern parasail_result_t* parasail_nw_banded_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_neon_128_sat(
+extern parasail_result_t* parasail_nw_banded_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_64(
+extern parasail_result_t* parasail_nw_banded_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_32(
+extern parasail_result_t* parasail_nw_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_16(
+extern parasail_result_t* parasail_nw_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_8(
+extern parasail_result_t* parasail_nw_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_sat(
+extern parasail_result_t* parasail_nw_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+extern parasail_result_t* parasail_nw_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+extern parasail_result_t* parasail_nw_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+extern parasail_result_t* parasail_nw_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+extern parasail_result_t* parasail_nw_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+extern parasail_result_t* parasail_nw_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+extern parasail_result_t* parasail_nw_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+extern parasail_result_t* parasail_nw_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+extern parasail_result_t* parasail_nw_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+extern parasail_result_t* parasail_nw_trace_banded_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+extern parasail_result_t* parasail_nw_trace_banded_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_altivec_128_64(
+extern parasail_result_t* parasail_nw_trace_banded_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_altivec_128_32(
+extern parasail_result_t* parasail_nw_trace_banded_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_altivec_128_16(
+extern parasail_result_t* parasail_nw_trace_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_altivec_128_8(
+extern parasail_result_t* parasail_nw_trace_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_altivec_128_sat(
+extern parasail_result_t* parasail_nw_trace_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_neon_128_64(
+extern parasail_result_t* parasail_nw_trace_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_neon_128_32(
+extern parasail_result_t* parasail_nw_trace_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_neon_128_16(
+extern parasail_result_t* parasail_nw_trace_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_neon_128_8(
+extern parasail_result_t* parasail_nw_trace_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_neon_128_sat(
+extern parasail_result_t* parasail_nw_trace_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_64(
+extern parasail_result_t* parasail_nw_trace_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_32(
+extern parasail_result_t* parasail_nw_trace_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_16(
+extern parasail_result_t* parasail_nw_trace_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_8(
+extern parasail_result_t* parasail_nw_trace_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_profile_t* parasail_profile_create_stats_sat(
+extern parasail_result_t* parasail_sg_banded_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_scan_sat(
+extern parasail_result_t* parasail_sg_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_striped_sat(
+extern parasail_result_t* parasail_sg_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_diag_sat(
+extern parasail_result_t* parasail_sg_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_table_scan_sat(
+extern parasail_result_t* parasail_sg_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_table_striped_sat(
+extern parasail_result_t* parasail_sg_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_table_diag_sat(
+extern parasail_result_t* parasail_sg_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_rowcol_scan_sat(
+extern parasail_result_t* parasail_sg_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_rowcol_striped_sat(
+extern parasail_result_t* parasail_sg_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_rowcol_diag_sat(
+extern parasail_result_t* parasail_sg_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_trace_scan_sat(
+extern parasail_result_t* parasail_sg_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_trace_striped_sat(
+extern parasail_result_t* parasail_sg_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_trace_diag_sat(
+extern parasail_result_t* parasail_sg_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_scan_sat(
+extern parasail_result_t* parasail_sg_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_striped_sat(
+extern parasail_result_t* parasail_sg_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_diag_sat(
+extern parasail_result_t* parasail_sg_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_striped_sat(
+extern parasail_result_t* parasail_sg_trace_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_table_diag_sat(
+extern parasail_result_t* parasail_sg_trace_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_striped_sat(
+extern parasail_result_t* parasail_sg_trace_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_nw_stats_rowcol_diag_sat(
+extern parasail_result_t* parasail_sg_trace_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_striped_sat(
+extern parasail_result_t* parasail_sg_trace_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_diag_sat(
+extern parasail_result_t* parasail_sg_trace_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_striped_sat(
+extern parasail_result_t* parasail_sg_trace_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_table_diag_sat(
+extern parasail_result_t* parasail_sg_trace_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_striped_sat(
+extern parasail_result_t* parasail_sg_trace_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_rowcol_diag_sat(
+extern parasail_result_t* parasail_sg_trace_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_scan_sat(
+extern parasail_result_t* parasail_sg_trace_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_striped_sat(
+extern parasail_result_t* parasail_sw_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_trace_diag_sat(
+extern parasail_result_t* parasail_sw_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_scan_sat(
+extern parasail_result_t* parasail_sw_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_striped_sat(
+extern parasail_result_t* parasail_sw_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_diag_sat(
+extern parasail_result_t* parasail_sw_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_scan_sat(
+extern parasail_result_t* parasail_sw_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_striped_sat(
+extern parasail_result_t* parasail_sw_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_table_diag_sat(
+extern parasail_result_t* parasail_sw_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_scan_sat(
+extern parasail_result_t* parasail_sw_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_striped_sat(
+extern parasail_result_t* parasail_sw_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sg_stats_rowcol_diag_sat(
+extern parasail_result_t* parasail_sw_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_scan_sat(
+extern parasail_result_t* parasail_sw_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_striped_sat(
+extern parasail_result_t* parasail_sw_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_diag_sat(
+extern parasail_result_t* parasail_sw_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_scan_sat(
+extern parasail_result_t* parasail_sw_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_striped_sat(
+extern parasail_result_t* parasail_sw_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_table_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_scan_sat(
+extern parasail_result_t* parasail_sw_trace_banded_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_striped_sat(
+extern parasail_result_t* parasail_sw_trace_banded_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_rowcol_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_scan_sat(
+extern parasail_result_t* parasail_sw_trace_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_striped_sat(
+extern parasail_result_t* parasail_sw_trace_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_trace_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_scan_sat(
+extern parasail_result_t* parasail_sw_trace_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_striped_sat(
+extern parasail_result_t* parasail_sw_trace_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_table_scan_sat(
+extern parasail_result_t* parasail_sw_trace_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_table_striped_sat(
+extern parasail_result_t* parasail_sw_trace_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_table_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_scan_sat(
+extern parasail_result_t* parasail_sw_trace_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_striped_sat(
+extern parasail_result_t* parasail_sw_trace_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
-extern parasail_result_t* parasail_sw_stats_rowcol_diag_sat(
+extern parasail_result_t* parasail_sw_trace_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix);
 
 /* END GENERATED NAMES */
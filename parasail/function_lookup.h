@@ -50,6 +50,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_sse41_128_16,       "parasail_nw_diag_sse41_128_16",       "nw",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_8,        "parasail_nw_diag_sse41_128_8",        "nw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sse41_128_sat,      "parasail_nw_diag_sse41_128_sat",      "nw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_sse41_128_32,    "parasail_nw_blocked_sse41_128_32",    "nw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_sse41_128_16,    "parasail_nw_blocked_sse41_128_16",    "nw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_sse41_128_32,  "parasail_nw_wavefront_sse41_128_32",  "nw", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_sse41_128_16,  "parasail_nw_wavefront_sse41_128_16",  "nw", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_scan_avx2_256_64,        "parasail_nw_scan_avx2_256_64",        "nw",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0, 0},
@@ -67,6 +71,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_avx2_256_16,        "parasail_nw_diag_avx2_256_16",        "nw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_8,         "parasail_nw_diag_avx2_256_8",         "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_nw_diag_avx2_256_sat,       "parasail_nw_diag_avx2_256_sat",       "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_avx2_256_32,     "parasail_nw_blocked_avx2_256_32",     "nw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_avx2_256_16,     "parasail_nw_blocked_avx2_256_16",     "nw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_avx2_256_32,   "parasail_nw_wavefront_avx2_256_32",   "nw", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_avx2_256_16,   "parasail_nw_wavefront_avx2_256_16",   "nw", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_nw_scan_avx512bw_512_64,    "parasail_nw_scan_avx512bw_512_64",    "nw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512bw_512_32,    "parasail_nw_scan_avx512bw_512_32",    "nw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512bw_512_16,    "parasail_nw_scan_avx512bw_512_16",    "nw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512bw_512_8,     "parasail_nw_scan_avx512bw_512_8",     "nw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_scan_avx512bw_512_sat,   "parasail_nw_scan_avx512bw_512_sat",   "nw",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512bw_512_64, "parasail_nw_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512bw_512_32, "parasail_nw_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512bw_512_16, "parasail_nw_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512bw_512_8,  "parasail_nw_striped_avx512bw_512_8",  "nw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_avx512bw_512_sat, "parasail_nw_striped_avx512bw_512_sat", "nw", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512bw_512_64,    "parasail_nw_diag_avx512bw_512_64",    "nw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512bw_512_32,    "parasail_nw_diag_avx512bw_512_32",    "nw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512bw_512_16,    "parasail_nw_diag_avx512bw_512_16",    "nw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512bw_512_8,     "parasail_nw_diag_avx512bw_512_8",     "nw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_diag_avx512bw_512_sat,   "parasail_nw_diag_avx512bw_512_sat",   "nw",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_nw_scan_altivec_128_64,     "parasail_nw_scan_altivec_128_64",     "nw",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -101,6 +126,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_neon_128_16,        "parasail_nw_diag_neon_128_16",        "nw",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_diag_neon_128_8,         "parasail_nw_diag_neon_128_8",         "nw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_nw_diag_neon_128_sat,       "parasail_nw_diag_neon_128_sat",       "nw",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_neon_128_32,     "parasail_nw_blocked_neon_128_32",     "nw", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_blocked_neon_128_16,     "parasail_nw_blocked_neon_128_16",     "nw", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_neon_128_32,   "parasail_nw_wavefront_neon_128_32",   "nw", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_wavefront_neon_128_16,   "parasail_nw_wavefront_neon_128_16",   "nw", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 {parasail_nw_scan_64,                 "parasail_nw_scan_64",                 "nw",    "scan", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_nw_scan_32,                 "parasail_nw_scan_32",                 "nw",    "scan", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
@@ -117,6 +146,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_diag_16,                 "parasail_nw_diag_16",                 "nw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_8,                  "parasail_nw_diag_8",                  "nw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_nw_diag_sat,                "parasail_nw_diag_sat",                "nw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_auto,                    "parasail_nw_auto",                    "nw",    "auto", "disp",   "NA", "NA", -1, 0, 0, 0, 0, 0},
 {parasail_sg,                         "parasail_sg",                         "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sg_scan,                    "parasail_sg_scan",                    "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -152,6 +182,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_sse41_128_16,       "parasail_sg_diag_sse41_128_16",       "sg",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_8,        "parasail_sg_diag_sse41_128_8",        "sg",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sse41_128_sat,      "parasail_sg_diag_sse41_128_sat",      "sg",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_sse41_128_32,    "parasail_sg_blocked_sse41_128_32",    "sg", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_sse41_128_16,    "parasail_sg_blocked_sse41_128_16",    "sg", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_sse41_128_32,  "parasail_sg_wavefront_sse41_128_32",  "sg", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_sse41_128_16,  "parasail_sg_wavefront_sse41_128_16",  "sg", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_scan_avx2_256_64,        "parasail_sg_scan_avx2_256_64",        "sg",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0, 0},
@@ -169,6 +203,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_avx2_256_16,        "parasail_sg_diag_avx2_256_16",        "sg",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_8,         "parasail_sg_diag_avx2_256_8",         "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_diag_avx2_256_sat,       "parasail_sg_diag_avx2_256_sat",       "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_avx2_256_32,     "parasail_sg_blocked_avx2_256_32",     "sg", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_avx2_256_16,     "parasail_sg_blocked_avx2_256_16",     "sg", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_avx2_256_32,   "parasail_sg_wavefront_avx2_256_32",   "sg", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_avx2_256_16,   "parasail_sg_wavefront_avx2_256_16",   "sg", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sg_scan_avx512bw_512_64,    "parasail_sg_scan_avx512bw_512_64",    "sg",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512bw_512_32,    "parasail_sg_scan_avx512bw_512_32",    "sg",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512bw_512_16,    "parasail_sg_scan_avx512bw_512_16",    "sg",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512bw_512_8,     "parasail_sg_scan_avx512bw_512_8",     "sg",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_scan_avx512bw_512_sat,   "parasail_sg_scan_avx512bw_512_sat",   "sg",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512bw_512_64, "parasail_sg_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512bw_512_32, "parasail_sg_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512bw_512_16, "parasail_sg_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512bw_512_8,  "parasail_sg_striped_avx512bw_512_8",  "sg", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_avx512bw_512_sat, "parasail_sg_striped_avx512bw_512_sat", "sg", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512bw_512_64,    "parasail_sg_diag_avx512bw_512_64",    "sg",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512bw_512_32,    "parasail_sg_diag_avx512bw_512_32",    "sg",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512bw_512_16,    "parasail_sg_diag_avx512bw_512_16",    "sg",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512bw_512_8,     "parasail_sg_diag_avx512bw_512_8",     "sg",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_diag_avx512bw_512_sat,   "parasail_sg_diag_avx512bw_512_sat",   "sg",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sg_scan_altivec_128_64,     "parasail_sg_scan_altivec_128_64",     "sg",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -203,6 +258,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_neon_128_16,        "parasail_sg_diag_neon_128_16",        "sg",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_diag_neon_128_8,         "parasail_sg_diag_neon_128_8",         "sg",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sg_diag_neon_128_sat,       "parasail_sg_diag_neon_128_sat",       "sg",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_neon_128_32,     "parasail_sg_blocked_neon_128_32",     "sg", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_blocked_neon_128_16,     "parasail_sg_blocked_neon_128_16",     "sg", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_neon_128_32,   "parasail_sg_wavefront_neon_128_32",   "sg", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_wavefront_neon_128_16,   "parasail_sg_wavefront_neon_128_16",   "sg", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 {parasail_sg_scan_64,                 "parasail_sg_scan_64",                 "sg",    "scan", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sg_scan_32,                 "parasail_sg_scan_32",                 "sg",    "scan", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
@@ -219,6 +278,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_diag_16,                 "parasail_sg_diag_16",                 "sg",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_8,                  "parasail_sg_diag_8",                  "sg",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sg_diag_sat,                "parasail_sg_diag_sat",                "sg",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_auto,                    "parasail_sg_auto",                    "sg",    "auto", "disp",   "NA", "NA", -1, 0, 0, 0, 0, 0},
 {parasail_sw,                         "parasail_sw",                         "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
 {parasail_sw_scan,                    "parasail_sw_scan",                    "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
 #if HAVE_SSE2
@@ -256,6 +316,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_sse41_128_sat,      "parasail_sw_diag_sse41_128_sat",      "sw",    "diag", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
 {parasail_sw_blocked_sse41_128_32,    "parasail_sw_blocked_sse41_128_32",    "sw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_sw_blocked_sse41_128_16,    "parasail_sw_blocked_sse41_128_16",    "sw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_sse41_128_32,  "parasail_sw_wavefront_sse41_128_32",  "sw", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_sse41_128_16,  "parasail_sw_wavefront_sse41_128_16",  "sw", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sw_scan_avx2_256_64,        "parasail_sw_scan_avx2_256_64",        "sw",    "scan", "avx2",  "256", "64",  4, 0, 0, 0, 0, 0},
@@ -273,6 +335,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_avx2_256_16,        "parasail_sw_diag_avx2_256_16",        "sw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_sw_diag_avx2_256_8,         "parasail_sw_diag_avx2_256_8",         "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sw_diag_avx2_256_sat,       "parasail_sw_diag_avx2_256_sat",       "sw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+{parasail_sw_blocked_avx2_256_32,     "parasail_sw_blocked_avx2_256_32",     "sw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sw_blocked_avx2_256_16,     "parasail_sw_blocked_avx2_256_16",     "sw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_avx2_256_32,   "parasail_sw_wavefront_avx2_256_32",   "sw", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_avx2_256_16,   "parasail_sw_wavefront_avx2_256_16",   "sw", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sw_scan_avx512bw_512_64,    "parasail_sw_scan_avx512bw_512_64",    "sw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512bw_512_32,    "parasail_sw_scan_avx512bw_512_32",    "sw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512bw_512_16,    "parasail_sw_scan_avx512bw_512_16",    "sw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512bw_512_8,     "parasail_sw_scan_avx512bw_512_8",     "sw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_scan_avx512bw_512_sat,   "parasail_sw_scan_avx512bw_512_sat",   "sw",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512bw_512_64, "parasail_sw_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512bw_512_32, "parasail_sw_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512bw_512_16, "parasail_sw_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512bw_512_8,  "parasail_sw_striped_avx512bw_512_8",  "sw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_avx512bw_512_sat, "parasail_sw_striped_avx512bw_512_sat", "sw", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512bw_512_64,    "parasail_sw_diag_avx512bw_512_64",    "sw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512bw_512_32,    "parasail_sw_diag_avx512bw_512_32",    "sw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512bw_512_16,    "parasail_sw_diag_avx512bw_512_16",    "sw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512bw_512_8,     "parasail_sw_diag_avx512bw_512_8",     "sw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_diag_avx512bw_512_sat,   "parasail_sw_diag_avx512bw_512_sat",   "sw",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sw_scan_altivec_128_64,     "parasail_sw_scan_altivec_128_64",     "sw",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
@@ -307,6 +390,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_neon_128_16,        "parasail_sw_diag_neon_128_16",        "sw",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sw_diag_neon_128_8,         "parasail_sw_diag_neon_128_8",         "sw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
 {parasail_sw_diag_neon_128_sat,       "parasail_sw_diag_neon_128_sat",       "sw",    "diag", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+{parasail_sw_blocked_neon_128_32,     "parasail_sw_blocked_neon_128_32",     "sw", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_blocked_neon_128_16,     "parasail_sw_blocked_neon_128_16",     "sw", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_neon_128_32,   "parasail_sw_wavefront_neon_128_32",   "sw", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_wavefront_neon_128_16,   "parasail_sw_wavefront_neon_128_16",   "sw", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 #endif
 {parasail_sw_scan_64,                 "parasail_sw_scan_64",                 "sw",    "scan", "disp",   "NA", "64", -1, 0, 0, 0, 0, 0},
 {parasail_sw_scan_32,                 "parasail_sw_scan_32",                 "sw",    "scan", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
@@ -323,6 +410,7 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_diag_16,                 "parasail_sw_diag_16",                 "sw",    "diag", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_8,                  "parasail_sw_diag_8",                  "sw",    "diag", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
 {parasail_sw_diag_sat,                "parasail_sw_diag_sat",                "sw",    "diag", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_auto,                    "parasail_sw_auto",                    "sw",    "auto", "disp",   "NA", "NA", -1, 0, 0, 0, 0, 0},
 {parasail_nw_stats,                   "parasail_nw_stats",                   "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
 {parasail_nw_stats_scan,              "parasail_nw_stats_scan",              "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
 #if HAVE_SSE2
@@ -376,6 +464,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_diag_avx2_256_8,   "parasail_nw_stats_diag_avx2_256_8",   "nw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_nw_stats_diag_avx2_256_sat, "parasail_nw_stats_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_scan_avx512bw_512_64, "parasail_nw_stats_scan_avx512bw_512_64", "nw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512bw_512_32, "parasail_nw_stats_scan_avx512bw_512_32", "nw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512bw_512_16, "parasail_nw_stats_scan_avx512bw_512_16", "nw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512bw_512_8, "parasail_nw_stats_scan_avx512bw_512_8", "nw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_avx512bw_512_sat, "parasail_nw_stats_scan_avx512bw_512_sat", "nw_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512bw_512_64, "parasail_nw_stats_striped_avx512bw_512_64", "nw_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512bw_512_32, "parasail_nw_stats_striped_avx512bw_512_32", "nw_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512bw_512_16, "parasail_nw_stats_striped_avx512bw_512_16", "nw_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512bw_512_8, "parasail_nw_stats_striped_avx512bw_512_8", "nw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_avx512bw_512_sat, "parasail_nw_stats_striped_avx512bw_512_sat", "nw_stats", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512bw_512_64, "parasail_nw_stats_diag_avx512bw_512_64", "nw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512bw_512_32, "parasail_nw_stats_diag_avx512bw_512_32", "nw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512bw_512_16, "parasail_nw_stats_diag_avx512bw_512_16", "nw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512bw_512_8, "parasail_nw_stats_diag_avx512bw_512_8", "nw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_diag_avx512bw_512_sat, "parasail_nw_stats_diag_avx512bw_512_sat", "nw_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_scan_altivec_128_64, "parasail_nw_stats_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_nw_stats_scan_altivec_128_32, "parasail_nw_stats_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -478,6 +583,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_diag_avx2_256_8,   "parasail_sg_stats_diag_avx2_256_8",   "sg_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_stats_diag_avx2_256_sat, "parasail_sg_stats_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_scan_avx512bw_512_64, "parasail_sg_stats_scan_avx512bw_512_64", "sg_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512bw_512_32, "parasail_sg_stats_scan_avx512bw_512_32", "sg_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512bw_512_16, "parasail_sg_stats_scan_avx512bw_512_16", "sg_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512bw_512_8, "parasail_sg_stats_scan_avx512bw_512_8", "sg_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_avx512bw_512_sat, "parasail_sg_stats_scan_avx512bw_512_sat", "sg_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512bw_512_64, "parasail_sg_stats_striped_avx512bw_512_64", "sg_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512bw_512_32, "parasail_sg_stats_striped_avx512bw_512_32", "sg_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512bw_512_16, "parasail_sg_stats_striped_avx512bw_512_16", "sg_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512bw_512_8, "parasail_sg_stats_striped_avx512bw_512_8", "sg_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_avx512bw_512_sat, "parasail_sg_stats_striped_avx512bw_512_sat", "sg_stats", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512bw_512_64, "parasail_sg_stats_diag_avx512bw_512_64", "sg_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512bw_512_32, "parasail_sg_stats_diag_avx512bw_512_32", "sg_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512bw_512_16, "parasail_sg_stats_diag_avx512bw_512_16", "sg_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512bw_512_8, "parasail_sg_stats_diag_avx512bw_512_8", "sg_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_diag_avx512bw_512_sat, "parasail_sg_stats_diag_avx512bw_512_sat", "sg_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_scan_altivec_128_64, "parasail_sg_stats_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_stats_scan_altivec_128_32, "parasail_sg_stats_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -580,6 +702,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_diag_avx2_256_8,   "parasail_sw_stats_diag_avx2_256_8",   "sw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sw_stats_diag_avx2_256_sat, "parasail_sw_stats_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_scan_avx512bw_512_64, "parasail_sw_stats_scan_avx512bw_512_64", "sw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512bw_512_32, "parasail_sw_stats_scan_avx512bw_512_32", "sw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512bw_512_16, "parasail_sw_stats_scan_avx512bw_512_16", "sw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512bw_512_8, "parasail_sw_stats_scan_avx512bw_512_8", "sw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_avx512bw_512_sat, "parasail_sw_stats_scan_avx512bw_512_sat", "sw_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512bw_512_64, "parasail_sw_stats_striped_avx512bw_512_64", "sw_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512bw_512_32, "parasail_sw_stats_striped_avx512bw_512_32", "sw_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512bw_512_16, "parasail_sw_stats_striped_avx512bw_512_16", "sw_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512bw_512_8, "parasail_sw_stats_striped_avx512bw_512_8", "sw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_avx512bw_512_sat, "parasail_sw_stats_striped_avx512bw_512_sat", "sw_stats", "striped", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512bw_512_64, "parasail_sw_stats_diag_avx512bw_512_64", "sw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512bw_512_32, "parasail_sw_stats_diag_avx512bw_512_32", "sw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512bw_512_16, "parasail_sw_stats_diag_avx512bw_512_16", "sw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512bw_512_8, "parasail_sw_stats_diag_avx512bw_512_8", "sw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_diag_avx512bw_512_sat, "parasail_sw_stats_diag_avx512bw_512_sat", "sw_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_scan_altivec_128_64, "parasail_sw_stats_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sw_stats_scan_altivec_128_32, "parasail_sw_stats_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -664,6 +803,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_sse41_128_16, "parasail_nw_table_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_8,  "parasail_nw_table_diag_sse41_128_8",  "nw",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_sat, "parasail_nw_table_diag_sse41_128_sat", "nw",    "diag", "sse41", "128", "sat", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_32, "parasail_nw_table_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_16, "parasail_nw_table_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_table_scan_avx2_256_64,  "parasail_nw_table_scan_avx2_256_64",  "nw",    "scan", "avx2",  "256", "64",  4, 1, 0, 0, 0, 0},
@@ -681,6 +822,25 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_avx2_256_16,  "parasail_nw_table_diag_avx2_256_16",  "nw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_8,   "parasail_nw_table_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_sat, "parasail_nw_table_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_32, "parasail_nw_table_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_16, "parasail_nw_table_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_nw_table_scan_avx512bw_512_64, "parasail_nw_table_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_32, "parasail_nw_table_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_16, "parasail_nw_table_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_8, "parasail_nw_table_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_sat, "parasail_nw_table_scan_avx512bw_512_sat", "nw",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_64, "parasail_nw_table_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_32, "parasail_nw_table_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_16, "parasail_nw_table_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_8, "parasail_nw_table_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_sat, "parasail_nw_table_striped_avx512bw_512_sat", "nw", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_64, "parasail_nw_table_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_32, "parasail_nw_table_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_16, "parasail_nw_table_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_8, "parasail_nw_table_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_sat, "parasail_nw_table_diag_avx512bw_512_sat", "nw",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_nw_table_scan_altivec_128_64, "parasail_nw_table_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
@@ -715,6 +875,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_table_diag_neon_128_16,  "parasail_nw_table_diag_neon_128_16",  "nw",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_neon_128_8,   "parasail_nw_table_diag_neon_128_8",   "nw",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_neon_128_sat, "parasail_nw_table_diag_neon_128_sat", "nw",    "diag", "neon",  "128", "sat", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_neon_128_32, "parasail_nw_table_blocked_neon_128_32", "nw", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_neon_128_16, "parasail_nw_table_blocked_neon_128_16", "nw", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 #endif
 {parasail_nw_table_scan_64,           "parasail_nw_table_scan_64",           "nw",    "scan", "disp",   "NA", "64", -1, 1, 0, 0, 0, 0},
 {parasail_nw_table_scan_32,           "parasail_nw_table_scan_32",           "nw",    "scan", "disp",   "NA", "32", -1, 1, 0, 0, 0, 0},
@@ -766,6 +928,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_sse41_128_16, "parasail_sg_table_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_8,  "parasail_sg_table_diag_sse41_128_8",  "sg",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_sat, "parasail_sg_table_diag_sse41_128_sat", "sg",    "diag", "sse41", "128", "sat", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_32, "parasail_sg_table_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_16, "parasail_sg_table_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_table_scan_avx2_256_64,  "parasail_sg_table_scan_avx2_256_64",  "sg",    "scan", "avx2",  "256", "64",  4, 1, 0, 0, 0, 0},
@@ -783,6 +947,25 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_avx2_256_16,  "parasail_sg_table_diag_avx2_256_16",  "sg",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_8,   "parasail_sg_table_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_sat, "parasail_sg_table_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_32, "parasail_sg_table_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_16, "parasail_sg_table_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sg_table_scan_avx512bw_512_64, "parasail_sg_table_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_32, "parasail_sg_table_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_16, "parasail_sg_table_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_8, "parasail_sg_table_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_sat, "parasail_sg_table_scan_avx512bw_512_sat", "sg",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_64, "parasail_sg_table_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_32, "parasail_sg_table_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_16, "parasail_sg_table_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_8, "parasail_sg_table_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_sat, "parasail_sg_table_striped_avx512bw_512_sat", "sg", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_64, "parasail_sg_table_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_32, "parasail_sg_table_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_16, "parasail_sg_table_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_8, "parasail_sg_table_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_sat, "parasail_sg_table_diag_avx512bw_512_sat", "sg",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sg_table_scan_altivec_128_64, "parasail_sg_table_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
@@ -817,6 +1000,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_table_diag_neon_128_16,  "parasail_sg_table_diag_neon_128_16",  "sg",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_neon_128_8,   "parasail_sg_table_diag_neon_128_8",   "sg",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_neon_128_sat, "parasail_sg_table_diag_neon_128_sat", "sg",    "diag", "neon",  "128", "sat", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_neon_128_32, "parasail_sg_table_blocked_neon_128_32", "sg", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_neon_128_16, "parasail_sg_table_blocked_neon_128_16", "sg", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 #endif
 {parasail_sg_table_scan_64,           "parasail_sg_table_scan_64",           "sg",    "scan", "disp",   "NA", "64", -1, 1, 0, 0, 0, 0},
 {parasail_sg_table_scan_32,           "parasail_sg_table_scan_32",           "sg",    "scan", "disp",   "NA", "32", -1, 1, 0, 0, 0, 0},
@@ -887,6 +1072,25 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_avx2_256_16,  "parasail_sw_table_diag_avx2_256_16",  "sw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_8,   "parasail_sw_table_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_sat, "parasail_sw_table_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_32, "parasail_sw_table_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_16, "parasail_sw_table_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sw_table_scan_avx512bw_512_64, "parasail_sw_table_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_32, "parasail_sw_table_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_16, "parasail_sw_table_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_8, "parasail_sw_table_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_sat, "parasail_sw_table_scan_avx512bw_512_sat", "sw",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_64, "parasail_sw_table_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_32, "parasail_sw_table_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_16, "parasail_sw_table_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_8, "parasail_sw_table_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_sat, "parasail_sw_table_striped_avx512bw_512_sat", "sw", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_64, "parasail_sw_table_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_32, "parasail_sw_table_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_16, "parasail_sw_table_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_8, "parasail_sw_table_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_sat, "parasail_sw_table_diag_avx512bw_512_sat", "sw",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sw_table_scan_altivec_128_64, "parasail_sw_table_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
@@ -921,6 +1125,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_table_diag_neon_128_16,  "parasail_sw_table_diag_neon_128_16",  "sw",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_neon_128_8,   "parasail_sw_table_diag_neon_128_8",   "sw",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_neon_128_sat, "parasail_sw_table_diag_neon_128_sat", "sw",    "diag", "neon",  "128", "sat", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_neon_128_32, "parasail_sw_table_blocked_neon_128_32", "sw", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_neon_128_16, "parasail_sw_table_blocked_neon_128_16", "sw", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 #endif
 {parasail_sw_table_scan_64,           "parasail_sw_table_scan_64",           "sw",    "scan", "disp",   "NA", "64", -1, 1, 0, 0, 0, 0},
 {parasail_sw_table_scan_32,           "parasail_sw_table_scan_32",           "sw",    "scan", "disp",   "NA", "32", -1, 1, 0, 0, 0, 0},
@@ -990,6 +1196,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_table_diag_avx2_256_8, "parasail_nw_stats_table_diag_avx2_256_8", "nw_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_diag_avx2_256_sat, "parasail_nw_stats_table_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_table_scan_avx512bw_512_64, "parasail_nw_stats_table_scan_avx512bw_512_64", "nw_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_32, "parasail_nw_stats_table_scan_avx512bw_512_32", "nw_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_16, "parasail_nw_stats_table_scan_avx512bw_512_16", "nw_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_8, "parasail_nw_stats_table_scan_avx512bw_512_8", "nw_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_sat, "parasail_nw_stats_table_scan_avx512bw_512_sat", "nw_stats",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_64, "parasail_nw_stats_table_striped_avx512bw_512_64", "nw_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_32, "parasail_nw_stats_table_striped_avx512bw_512_32", "nw_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_16, "parasail_nw_stats_table_striped_avx512bw_512_16", "nw_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_8, "parasail_nw_stats_table_striped_avx512bw_512_8", "nw_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_sat, "parasail_nw_stats_table_striped_avx512bw_512_sat", "nw_stats", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_64, "parasail_nw_stats_table_diag_avx512bw_512_64", "nw_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_32, "parasail_nw_stats_table_diag_avx512bw_512_32", "nw_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_16, "parasail_nw_stats_table_diag_avx512bw_512_16", "nw_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_8, "parasail_nw_stats_table_diag_avx512bw_512_8", "nw_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_sat, "parasail_nw_stats_table_diag_avx512bw_512_sat", "nw_stats",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_table_scan_altivec_128_64, "parasail_nw_stats_table_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_scan_altivec_128_32, "parasail_nw_stats_table_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -1092,6 +1315,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_table_diag_avx2_256_8, "parasail_sg_stats_table_diag_avx2_256_8", "sg_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_diag_avx2_256_sat, "parasail_sg_stats_table_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_table_scan_avx512bw_512_64, "parasail_sg_stats_table_scan_avx512bw_512_64", "sg_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_32, "parasail_sg_stats_table_scan_avx512bw_512_32", "sg_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_16, "parasail_sg_stats_table_scan_avx512bw_512_16", "sg_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_8, "parasail_sg_stats_table_scan_avx512bw_512_8", "sg_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_sat, "parasail_sg_stats_table_scan_avx512bw_512_sat", "sg_stats",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_64, "parasail_sg_stats_table_striped_avx512bw_512_64", "sg_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_32, "parasail_sg_stats_table_striped_avx512bw_512_32", "sg_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_16, "parasail_sg_stats_table_striped_avx512bw_512_16", "sg_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_8, "parasail_sg_stats_table_striped_avx512bw_512_8", "sg_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_sat, "parasail_sg_stats_table_striped_avx512bw_512_sat", "sg_stats", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_64, "parasail_sg_stats_table_diag_avx512bw_512_64", "sg_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_32, "parasail_sg_stats_table_diag_avx512bw_512_32", "sg_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_16, "parasail_sg_stats_table_diag_avx512bw_512_16", "sg_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_8, "parasail_sg_stats_table_diag_avx512bw_512_8", "sg_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_sat, "parasail_sg_stats_table_diag_avx512bw_512_sat", "sg_stats",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_table_scan_altivec_128_64, "parasail_sg_stats_table_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_scan_altivec_128_32, "parasail_sg_stats_table_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -1194,6 +1434,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_table_diag_avx2_256_8, "parasail_sw_stats_table_diag_avx2_256_8", "sw_stats",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_diag_avx2_256_sat, "parasail_sw_stats_table_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_table_scan_avx512bw_512_64, "parasail_sw_stats_table_scan_avx512bw_512_64", "sw_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_32, "parasail_sw_stats_table_scan_avx512bw_512_32", "sw_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_16, "parasail_sw_stats_table_scan_avx512bw_512_16", "sw_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_8, "parasail_sw_stats_table_scan_avx512bw_512_8", "sw_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_sat, "parasail_sw_stats_table_scan_avx512bw_512_sat", "sw_stats",    "scan", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_64, "parasail_sw_stats_table_striped_avx512bw_512_64", "sw_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_32, "parasail_sw_stats_table_striped_avx512bw_512_32", "sw_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_16, "parasail_sw_stats_table_striped_avx512bw_512_16", "sw_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_8, "parasail_sw_stats_table_striped_avx512bw_512_8", "sw_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_sat, "parasail_sw_stats_table_striped_avx512bw_512_sat", "sw_stats", "striped", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_64, "parasail_sw_stats_table_diag_avx512bw_512_64", "sw_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_32, "parasail_sw_stats_table_diag_avx512bw_512_32", "sw_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_16, "parasail_sw_stats_table_diag_avx512bw_512_16", "sw_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_8, "parasail_sw_stats_table_diag_avx512bw_512_8", "sw_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_sat, "parasail_sw_stats_table_diag_avx512bw_512_sat", "sw_stats",    "diag", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_table_scan_altivec_128_64, "parasail_sw_stats_table_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_scan_altivec_128_32, "parasail_sw_stats_table_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -1278,6 +1535,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_sse41_128_16, "parasail_nw_rowcol_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_8, "parasail_nw_rowcol_diag_sse41_128_8", "nw",    "diag", "sse41", "128",  "8", 16, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_sat, "parasail_nw_rowcol_diag_sse41_128_sat", "nw",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_32, "parasail_nw_rowcol_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_16, "parasail_nw_rowcol_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_sse41_128_32, "parasail_nw_rowcol_wavefront_sse41_128_32", "nw", "wavefront", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_sse41_128_16, "parasail_nw_rowcol_wavefront_sse41_128_16", "nw", "wavefront", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_nw_rowcol_scan_avx2_256_64, "parasail_nw_rowcol_scan_avx2_256_64", "nw",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0, 0},
@@ -1295,6 +1556,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_avx2_256_16, "parasail_nw_rowcol_diag_avx2_256_16", "nw",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_8,  "parasail_nw_rowcol_diag_avx2_256_8",  "nw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_sat, "parasail_nw_rowcol_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_32, "parasail_nw_rowcol_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_16, "parasail_nw_rowcol_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_avx2_256_32, "parasail_nw_rowcol_wavefront_avx2_256_32", "nw", "wavefront", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_avx2_256_16, "parasail_nw_rowcol_wavefront_avx2_256_16", "nw", "wavefront", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_nw_rowcol_scan_avx512bw_512_64, "parasail_nw_rowcol_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_32, "parasail_nw_rowcol_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_16, "parasail_nw_rowcol_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_8, "parasail_nw_rowcol_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_sat, "parasail_nw_rowcol_scan_avx512bw_512_sat", "nw",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_64, "parasail_nw_rowcol_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_32, "parasail_nw_rowcol_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_16, "parasail_nw_rowcol_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_8, "parasail_nw_rowcol_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_sat, "parasail_nw_rowcol_striped_avx512bw_512_sat", "nw", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_64, "parasail_nw_rowcol_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_32, "parasail_nw_rowcol_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_16, "parasail_nw_rowcol_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_8, "parasail_nw_rowcol_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_sat, "parasail_nw_rowcol_diag_avx512bw_512_sat", "nw",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_nw_rowcol_scan_altivec_128_64, "parasail_nw_rowcol_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
@@ -1329,6 +1611,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_rowcol_diag_neon_128_16, "parasail_nw_rowcol_diag_neon_128_16", "nw",    "diag", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_neon_128_8,  "parasail_nw_rowcol_diag_neon_128_8",  "nw",    "diag", "neon",  "128",  "8", 16, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_diag_neon_128_sat, "parasail_nw_rowcol_diag_neon_128_sat", "nw",    "diag", "neon",  "128", "sat", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_neon_128_32, "parasail_nw_rowcol_blocked_neon_128_32", "nw", "blocked", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_blocked_neon_128_16, "parasail_nw_rowcol_blocked_neon_128_16", "nw", "blocked", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_neon_128_32, "parasail_nw_rowcol_wavefront_neon_128_32", "nw", "wavefront", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_neon_128_16, "parasail_nw_rowcol_wavefront_neon_128_16", "nw", "wavefront", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 {parasail_nw_rowcol_scan_64,          "parasail_nw_rowcol_scan_64",          "nw",    "scan", "disp",   "NA", "64", -1, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_scan_32,          "parasail_nw_rowcol_scan_32",          "nw",    "scan", "disp",   "NA", "32", -1, 0, 1, 0, 0, 0},
@@ -1380,6 +1666,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_sse41_128_16, "parasail_sg_rowcol_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_8, "parasail_sg_rowcol_diag_sse41_128_8", "sg",    "diag", "sse41", "128",  "8", 16, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_sat, "parasail_sg_rowcol_diag_sse41_128_sat", "sg",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_32, "parasail_sg_rowcol_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_16, "parasail_sg_rowcol_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_sse41_128_32, "parasail_sg_rowcol_wavefront_sse41_128_32", "sg", "wavefront", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_sse41_128_16, "parasail_sg_rowcol_wavefront_sse41_128_16", "sg", "wavefront", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sg_rowcol_scan_avx2_256_64, "parasail_sg_rowcol_scan_avx2_256_64", "sg",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0, 0},
@@ -1397,6 +1687,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_avx2_256_16, "parasail_sg_rowcol_diag_avx2_256_16", "sg",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_8,  "parasail_sg_rowcol_diag_avx2_256_8",  "sg",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_sat, "parasail_sg_rowcol_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_32, "parasail_sg_rowcol_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_16, "parasail_sg_rowcol_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_avx2_256_32, "parasail_sg_rowcol_wavefront_avx2_256_32", "sg", "wavefront", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_avx2_256_16, "parasail_sg_rowcol_wavefront_avx2_256_16", "sg", "wavefront", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sg_rowcol_scan_avx512bw_512_64, "parasail_sg_rowcol_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_32, "parasail_sg_rowcol_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_16, "parasail_sg_rowcol_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_8, "parasail_sg_rowcol_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_sat, "parasail_sg_rowcol_scan_avx512bw_512_sat", "sg",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_64, "parasail_sg_rowcol_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_32, "parasail_sg_rowcol_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_16, "parasail_sg_rowcol_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_8, "parasail_sg_rowcol_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_sat, "parasail_sg_rowcol_striped_avx512bw_512_sat", "sg", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_64, "parasail_sg_rowcol_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_32, "parasail_sg_rowcol_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_16, "parasail_sg_rowcol_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_8, "parasail_sg_rowcol_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_sat, "parasail_sg_rowcol_diag_avx512bw_512_sat", "sg",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sg_rowcol_scan_altivec_128_64, "parasail_sg_rowcol_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
@@ -1431,6 +1742,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_rowcol_diag_neon_128_16, "parasail_sg_rowcol_diag_neon_128_16", "sg",    "diag", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_neon_128_8,  "parasail_sg_rowcol_diag_neon_128_8",  "sg",    "diag", "neon",  "128",  "8", 16, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_diag_neon_128_sat, "parasail_sg_rowcol_diag_neon_128_sat", "sg",    "diag", "neon",  "128", "sat", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_neon_128_32, "parasail_sg_rowcol_blocked_neon_128_32", "sg", "blocked", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_blocked_neon_128_16, "parasail_sg_rowcol_blocked_neon_128_16", "sg", "blocked", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_neon_128_32, "parasail_sg_rowcol_wavefront_neon_128_32", "sg", "wavefront", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_neon_128_16, "parasail_sg_rowcol_wavefront_neon_128_16", "sg", "wavefront", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 {parasail_sg_rowcol_scan_64,          "parasail_sg_rowcol_scan_64",          "sg",    "scan", "disp",   "NA", "64", -1, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_scan_32,          "parasail_sg_rowcol_scan_32",          "sg",    "scan", "disp",   "NA", "32", -1, 0, 1, 0, 0, 0},
@@ -1484,6 +1799,8 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_sse41_128_sat, "parasail_sw_rowcol_diag_sse41_128_sat", "sw",    "diag", "sse41", "128", "sat", 16, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_blocked_sse41_128_32, "parasail_sw_rowcol_blocked_sse41_128_32", "sw", "blocked", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_blocked_sse41_128_16, "parasail_sw_rowcol_blocked_sse41_128_16", "sw", "blocked", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_sse41_128_32, "parasail_sw_rowcol_wavefront_sse41_128_32", "sw", "wavefront", "sse41", "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_sse41_128_16, "parasail_sw_rowcol_wavefront_sse41_128_16", "sw", "wavefront", "sse41", "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_AVX2
 {parasail_sw_rowcol_scan_avx2_256_64, "parasail_sw_rowcol_scan_avx2_256_64", "sw",    "scan", "avx2",  "256", "64",  4, 0, 1, 0, 0, 0},
@@ -1501,6 +1818,27 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_avx2_256_16, "parasail_sw_rowcol_diag_avx2_256_16", "sw",    "diag", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_8,  "parasail_sw_rowcol_diag_avx2_256_8",  "sw",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_sat, "parasail_sw_rowcol_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_32, "parasail_sw_rowcol_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_16, "parasail_sw_rowcol_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_avx2_256_32, "parasail_sw_rowcol_wavefront_avx2_256_32", "sw", "wavefront", "avx2",  "256", "32",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_avx2_256_16, "parasail_sw_rowcol_wavefront_avx2_256_16", "sw", "wavefront", "avx2",  "256", "16", 16, 0, 1, 0, 0, 0},
+#endif
+#if HAVE_AVX512BW
+{parasail_sw_rowcol_scan_avx512bw_512_64, "parasail_sw_rowcol_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_32, "parasail_sw_rowcol_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_16, "parasail_sw_rowcol_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_8, "parasail_sw_rowcol_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_sat, "parasail_sw_rowcol_scan_avx512bw_512_sat", "sw",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_64, "parasail_sw_rowcol_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_32, "parasail_sw_rowcol_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_16, "parasail_sw_rowcol_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_8, "parasail_sw_rowcol_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_sat, "parasail_sw_rowcol_striped_avx512bw_512_sat", "sw", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_64, "parasail_sw_rowcol_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_32, "parasail_sw_rowcol_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_16, "parasail_sw_rowcol_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_8, "parasail_sw_rowcol_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_sat, "parasail_sw_rowcol_diag_avx512bw_512_sat", "sw",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
 #endif
 #if HAVE_ALTIVEC
 {parasail_sw_rowcol_scan_altivec_128_64, "parasail_sw_rowcol_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
@@ -1535,6 +1873,10 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_rowcol_diag_neon_128_16, "parasail_sw_rowcol_diag_neon_128_16", "sw",    "diag", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_diag_neon_128_8,  "parasail_sw_rowcol_diag_neon_128_8",  "sw",    "diag", "neon",  "128",  "8", 16, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_diag_neon_128_sat, "parasail_sw_rowcol_diag_neon_128_sat", "sw",    "diag", "neon",  "128", "sat", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_blocked_neon_128_32, "parasail_sw_rowcol_blocked_neon_128_32", "sw", "blocked", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_blocked_neon_128_16, "parasail_sw_rowcol_blocked_neon_128_16", "sw", "blocked", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_neon_128_32, "parasail_sw_rowcol_wavefront_neon_128_32", "sw", "wavefront", "neon",  "128", "32",  4, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_neon_128_16, "parasail_sw_rowcol_wavefront_neon_128_16", "sw", "wavefront", "neon",  "128", "16",  8, 0, 1, 0, 0, 0},
 #endif
 {parasail_sw_rowcol_scan_64,          "parasail_sw_rowcol_scan_64",          "sw",    "scan", "disp",   "NA", "64", -1, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_scan_32,          "parasail_sw_rowcol_scan_32",          "sw",    "scan", "disp",   "NA", "32", -1, 0, 1, 0, 0, 0},
@@ -1604,6 +1946,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_stats_rowcol_diag_avx2_256_8, "parasail_nw_stats_rowcol_diag_avx2_256_8", "nw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_diag_avx2_256_sat, "parasail_nw_stats_rowcol_diag_avx2_256_sat", "nw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_rowcol_scan_avx512bw_512_64, "parasail_nw_stats_rowcol_scan_avx512bw_512_64", "nw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_32, "parasail_nw_stats_rowcol_scan_avx512bw_512_32", "nw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_16, "parasail_nw_stats_rowcol_scan_avx512bw_512_16", "nw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_8, "parasail_nw_stats_rowcol_scan_avx512bw_512_8", "nw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_sat, "parasail_nw_stats_rowcol_scan_avx512bw_512_sat", "nw_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_64, "parasail_nw_stats_rowcol_striped_avx512bw_512_64", "nw_stats", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_32, "parasail_nw_stats_rowcol_striped_avx512bw_512_32", "nw_stats", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_16, "parasail_nw_stats_rowcol_striped_avx512bw_512_16", "nw_stats", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_8, "parasail_nw_stats_rowcol_striped_avx512bw_512_8", "nw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_sat, "parasail_nw_stats_rowcol_striped_avx512bw_512_sat", "nw_stats", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_64, "parasail_nw_stats_rowcol_diag_avx512bw_512_64", "nw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_32, "parasail_nw_stats_rowcol_diag_avx512bw_512_32", "nw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_16, "parasail_nw_stats_rowcol_diag_avx512bw_512_16", "nw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_8, "parasail_nw_stats_rowcol_diag_avx512bw_512_8", "nw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_sat, "parasail_nw_stats_rowcol_diag_avx512bw_512_sat", "nw_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_rowcol_scan_altivec_128_64, "parasail_nw_stats_rowcol_scan_altivec_128_64", "nw_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_scan_altivec_128_32, "parasail_nw_stats_rowcol_scan_altivec_128_32", "nw_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -1706,6 +2065,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_stats_rowcol_diag_avx2_256_8, "parasail_sg_stats_rowcol_diag_avx2_256_8", "sg_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_diag_avx2_256_sat, "parasail_sg_stats_rowcol_diag_avx2_256_sat", "sg_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_rowcol_scan_avx512bw_512_64, "parasail_sg_stats_rowcol_scan_avx512bw_512_64", "sg_stats",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_32, "parasail_sg_stats_rowcol_scan_avx512bw_512_32", "sg_stats",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_16, "parasail_sg_stats_rowcol_scan_avx512bw_512_16", "sg_stats",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_8, "parasail_sg_stats_rowcol_scan_avx512bw_512_8", "sg_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_sat, "parasail_sg_stats_rowcol_scan_avx512bw_512_sat", "sg_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_64, "parasail_sg_stats_rowcol_striped_avx512bw_512_64", "sg_stats", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_32, "parasail_sg_stats_rowcol_striped_avx512bw_512_32", "sg_stats", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_16, "parasail_sg_stats_rowcol_striped_avx512bw_512_16", "sg_stats", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_8, "parasail_sg_stats_rowcol_striped_avx512bw_512_8", "sg_stats", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_sat, "parasail_sg_stats_rowcol_striped_avx512bw_512_sat", "sg_stats", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_64, "parasail_sg_stats_rowcol_diag_avx512bw_512_64", "sg_stats",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_32, "parasail_sg_stats_rowcol_diag_avx512bw_512_32", "sg_stats",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_16, "parasail_sg_stats_rowcol_diag_avx512bw_512_16", "sg_stats",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_8, "parasail_sg_stats_rowcol_diag_avx512bw_512_8", "sg_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_sat, "parasail_sg_stats_rowcol_diag_avx512bw_512_sat", "sg_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_rowcol_scan_altivec_128_64, "parasail_sg_stats_rowcol_scan_altivec_128_64", "sg_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_scan_altivec_128_32, "parasail_sg_stats_rowcol_scan_altivec_128_32", "sg_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -1808,6 +2184,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_stats_rowcol_diag_avx2_256_8, "parasail_sw_stats_rowcol_diag_avx2_256_8", "sw_stats",    "diag", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_diag_avx2_256_sat, "parasail_sw_stats_rowcol_diag_avx2_256_sat", "sw_stats",    "diag", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_rowcol_scan_avx512bw_512_64, "parasail_sw_stats_rowcol_scan_avx512bw_512_64", "sw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_32, "parasail_sw_stats_rowcol_scan_avx512bw_512_32", "sw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_16, "parasail_sw_stats_rowcol_scan_avx512bw_512_16", "sw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_8, "parasail_sw_stats_rowcol_scan_avx512bw_512_8", "sw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_sat, "parasail_sw_stats_rowcol_scan_avx512bw_512_sat", "sw_stats",    "scan", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_64, "parasail_sw_stats_rowcol_striped_avx512bw_512_64", "sw_stats", "striped", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_32, "parasail_sw_stats_rowcol_striped_avx512bw_512_32", "sw_stats", "striped", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_16, "parasail_sw_stats_rowcol_striped_avx512bw_512_16", "sw_stats", "striped", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_8, "parasail_sw_stats_rowcol_striped_avx512bw_512_8", "sw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_sat, "parasail_sw_stats_rowcol_striped_avx512bw_512_sat", "sw_stats", "striped", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_64, "parasail_sw_stats_rowcol_diag_avx512bw_512_64", "sw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_32, "parasail_sw_stats_rowcol_diag_avx512bw_512_32", "sw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_16, "parasail_sw_stats_rowcol_diag_avx512bw_512_16", "sw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_8, "parasail_sw_stats_rowcol_diag_avx512bw_512_8", "sw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_sat, "parasail_sw_stats_rowcol_diag_avx512bw_512_sat", "sw_stats",    "diag", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_rowcol_scan_altivec_128_64, "parasail_sw_stats_rowcol_scan_altivec_128_64", "sw_stats",    "scan", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_scan_altivec_128_32, "parasail_sw_stats_rowcol_scan_altivec_128_32", "sw_stats",    "scan", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -1910,6 +2303,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_nw_trace_diag_avx2_256_8,   "parasail_nw_trace_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_nw_trace_diag_avx2_256_sat, "parasail_nw_trace_diag_avx2_256_sat", "nw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_trace_scan_avx512bw_512_64, "parasail_nw_trace_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_32, "parasail_nw_trace_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_16, "parasail_nw_trace_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_8, "parasail_nw_trace_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_sat, "parasail_nw_trace_scan_avx512bw_512_sat", "nw",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_64, "parasail_nw_trace_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_32, "parasail_nw_trace_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_16, "parasail_nw_trace_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_8, "parasail_nw_trace_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_sat, "parasail_nw_trace_striped_avx512bw_512_sat", "nw", "striped", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_64, "parasail_nw_trace_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_32, "parasail_nw_trace_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_16, "parasail_nw_trace_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_8, "parasail_nw_trace_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_sat, "parasail_nw_trace_diag_avx512bw_512_sat", "nw",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_trace_scan_altivec_128_64, "parasail_nw_trace_scan_altivec_128_64", "nw",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_nw_trace_scan_altivec_128_32, "parasail_nw_trace_scan_altivec_128_32", "nw",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -2012,6 +2422,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sg_trace_diag_avx2_256_8,   "parasail_sg_trace_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_trace_diag_avx2_256_sat, "parasail_sg_trace_diag_avx2_256_sat", "sg",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_trace_scan_avx512bw_512_64, "parasail_sg_trace_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_32, "parasail_sg_trace_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_16, "parasail_sg_trace_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_8, "parasail_sg_trace_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_sat, "parasail_sg_trace_scan_avx512bw_512_sat", "sg",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_64, "parasail_sg_trace_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_32, "parasail_sg_trace_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_16, "parasail_sg_trace_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_8, "parasail_sg_trace_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_sat, "parasail_sg_trace_striped_avx512bw_512_sat", "sg", "striped", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_64, "parasail_sg_trace_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_32, "parasail_sg_trace_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_16, "parasail_sg_trace_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_8, "parasail_sg_trace_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_sat, "parasail_sg_trace_diag_avx512bw_512_sat", "sg",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_trace_scan_altivec_128_64, "parasail_sg_trace_scan_altivec_128_64", "sg",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_trace_scan_altivec_128_32, "parasail_sg_trace_scan_altivec_128_32", "sg",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -2114,6 +2541,23 @@ static const parasail_function_info_t functions[] = {
 {parasail_sw_trace_diag_avx2_256_8,   "parasail_sw_trace_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sw_trace_diag_avx2_256_sat, "parasail_sw_trace_diag_avx2_256_sat", "sw",    "diag", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_trace_scan_avx512bw_512_64, "parasail_sw_trace_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_32, "parasail_sw_trace_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_16, "parasail_sw_trace_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_8, "parasail_sw_trace_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_sat, "parasail_sw_trace_scan_avx512bw_512_sat", "sw",    "scan", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_64, "parasail_sw_trace_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_32, "parasail_sw_trace_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_16, "parasail_sw_trace_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_8, "parasail_sw_trace_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_sat, "parasail_sw_trace_striped_avx512bw_512_sat", "sw", "striped", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_64, "parasail_sw_trace_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_32, "parasail_sw_trace_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_16, "parasail_sw_trace_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_8, "parasail_sw_trace_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_sat, "parasail_sw_trace_diag_avx512bw_512_sat", "sw",    "diag", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_trace_scan_altivec_128_64, "parasail_sw_trace_scan_altivec_128_64", "sw",    "scan", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sw_trace_scan_altivec_128_32, "parasail_sw_trace_scan_altivec_128_32", "sw",    "scan", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -2203,6 +2647,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_nw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_scan_profile_avx512bw_512_64", "nw", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_scan_profile_avx512bw_512_32", "nw", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_scan_profile_avx512bw_512_16", "nw", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_scan_profile_avx512bw_512_8", "nw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_scan_profile_avx512bw_512_sat", "nw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_striped_profile_avx512bw_512_64", "nw", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_striped_profile_avx512bw_512_32", "nw", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_striped_profile_avx512bw_512_16", "nw", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_striped_profile_avx512bw_512_8", "nw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_striped_profile_avx512bw_512_sat", "nw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_nw_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -2273,6 +2729,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sg_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_scan_profile_avx512bw_512_64", "sg", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_scan_profile_avx512bw_512_32", "sg", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_scan_profile_avx512bw_512_16", "sg", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_scan_profile_avx512bw_512_8", "sg", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_scan_profile_avx512bw_512_sat", "sg", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_striped_profile_avx512bw_512_64", "sg", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_striped_profile_avx512bw_512_32", "sg", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_striped_profile_avx512bw_512_16", "sg", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_striped_profile_avx512bw_512_8", "sg", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_striped_profile_avx512bw_512_sat", "sg", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sg_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -2343,6 +2811,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
 {parasail_sw_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_scan_profile_avx512bw_512_64", "sw", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_scan_profile_avx512bw_512_32", "sw", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_scan_profile_avx512bw_512_16", "sw", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_scan_profile_avx512bw_512_8", "sw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_scan_profile_avx512bw_512_sat", "sw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_striped_profile_avx512bw_512_64", "sw", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_striped_profile_avx512bw_512_32", "sw", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_striped_profile_avx512bw_512_16", "sw", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_striped_profile_avx512bw_512_8", "sw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_striped_profile_avx512bw_512_sat", "sw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 0, 0},
 {parasail_sw_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 0, 0},
@@ -2413,6 +2893,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_nw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_scan_profile_avx512bw_512_64", "nw_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_scan_profile_avx512bw_512_32", "nw_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_scan_profile_avx512bw_512_16", "nw_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_scan_profile_avx512bw_512_8", "nw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_scan_profile_avx512bw_512_sat", "nw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_striped_profile_avx512bw_512_64", "nw_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_striped_profile_avx512bw_512_32", "nw_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_striped_profile_avx512bw_512_16", "nw_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_striped_profile_avx512bw_512_8", "nw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_striped_profile_avx512bw_512_sat", "nw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_nw_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2483,6 +2975,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sg_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_scan_profile_avx512bw_512_64", "sg_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_scan_profile_avx512bw_512_32", "sg_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_scan_profile_avx512bw_512_16", "sg_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_scan_profile_avx512bw_512_8", "sg_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_scan_profile_avx512bw_512_sat", "sg_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_striped_profile_avx512bw_512_64", "sg_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_striped_profile_avx512bw_512_32", "sg_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_striped_profile_avx512bw_512_16", "sg_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_striped_profile_avx512bw_512_8", "sg_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_striped_profile_avx512bw_512_sat", "sg_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sg_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2553,6 +3057,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 0, 1, 0},
 {parasail_sw_stats_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_scan_profile_avx512bw_512_64", "sw_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_scan_profile_avx512bw_512_32", "sw_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_scan_profile_avx512bw_512_16", "sw_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_scan_profile_avx512bw_512_8", "sw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_scan_profile_avx512bw_512_sat", "sw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_striped_profile_avx512bw_512_64", "sw_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_striped_profile_avx512bw_512_32", "sw_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_striped_profile_avx512bw_512_16", "sw_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_striped_profile_avx512bw_512_8", "sw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_striped_profile_avx512bw_512_sat", "sw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 0, 0, 1, 0},
 {parasail_sw_stats_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 0, 0, 1, 0},
@@ -2623,6 +3139,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_table_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_nw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_table_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_table_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_table_scan_profile_avx512bw_512_64", "nw", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_table_scan_profile_avx512bw_512_32", "nw", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_table_scan_profile_avx512bw_512_16", "nw", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_table_scan_profile_avx512bw_512_8", "nw", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_table_scan_profile_avx512bw_512_sat", "nw", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_table_striped_profile_avx512bw_512_64", "nw", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_table_striped_profile_avx512bw_512_32", "nw", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_table_striped_profile_avx512bw_512_16", "nw", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_table_striped_profile_avx512bw_512_8", "nw", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_table_striped_profile_avx512bw_512_sat", "nw", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_table_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_nw_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_table_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2693,6 +3221,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_table_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sg_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_table_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_table_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_table_scan_profile_avx512bw_512_64", "sg", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_table_scan_profile_avx512bw_512_32", "sg", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_table_scan_profile_avx512bw_512_16", "sg", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_table_scan_profile_avx512bw_512_8", "sg", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_table_scan_profile_avx512bw_512_sat", "sg", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_table_striped_profile_avx512bw_512_64", "sg", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_table_striped_profile_avx512bw_512_32", "sg", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_table_striped_profile_avx512bw_512_16", "sg", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_table_striped_profile_avx512bw_512_8", "sg", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_table_striped_profile_avx512bw_512_sat", "sg", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_table_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sg_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_table_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2763,6 +3303,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_table_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_table_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
 {parasail_sw_table_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_table_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_table_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_table_scan_profile_avx512bw_512_64", "sw", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_table_scan_profile_avx512bw_512_32", "sw", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_table_scan_profile_avx512bw_512_16", "sw", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_table_scan_profile_avx512bw_512_8", "sw", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_table_scan_profile_avx512bw_512_sat", "sw", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_table_striped_profile_avx512bw_512_64", "sw", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_table_striped_profile_avx512bw_512_32", "sw", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_table_striped_profile_avx512bw_512_16", "sw", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_table_striped_profile_avx512bw_512_8", "sw", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_table_striped_profile_avx512bw_512_sat", "sw", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_table_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_table_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 0, 0},
 {parasail_sw_table_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_table_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 0, 0},
@@ -2833,6 +3385,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_table_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_table_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_table_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_table_scan_profile_avx512bw_512_64", "nw_stats", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_table_scan_profile_avx512bw_512_32", "nw_stats", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_table_scan_profile_avx512bw_512_16", "nw_stats", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_table_scan_profile_avx512bw_512_8", "nw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_table_scan_profile_avx512bw_512_sat", "nw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_table_striped_profile_avx512bw_512_64", "nw_stats", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_table_striped_profile_avx512bw_512_32", "nw_stats", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_table_striped_profile_avx512bw_512_16", "nw_stats", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_table_striped_profile_avx512bw_512_8", "nw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_table_striped_profile_avx512bw_512_sat", "nw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_table_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_nw_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_table_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -2903,6 +3467,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_table_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_table_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_table_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_table_scan_profile_avx512bw_512_64", "sg_stats", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_table_scan_profile_avx512bw_512_32", "sg_stats", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_table_scan_profile_avx512bw_512_16", "sg_stats", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_table_scan_profile_avx512bw_512_8", "sg_stats", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_table_scan_profile_avx512bw_512_sat", "sg_stats", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_table_striped_profile_avx512bw_512_64", "sg_stats", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_table_striped_profile_avx512bw_512_32", "sg_stats", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_table_striped_profile_avx512bw_512_16", "sg_stats", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_table_striped_profile_avx512bw_512_8", "sg_stats", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_table_striped_profile_avx512bw_512_sat", "sg_stats", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_table_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sg_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_table_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -2973,6 +3549,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_table_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_table_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_table_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 1, 0, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_table_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_table_scan_profile_avx512bw_512_64", "sw_stats", "scan_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_table_scan_profile_avx512bw_512_32", "sw_stats", "scan_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_table_scan_profile_avx512bw_512_16", "sw_stats", "scan_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_table_scan_profile_avx512bw_512_8", "sw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_table_scan_profile_avx512bw_512_sat", "sw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_table_striped_profile_avx512bw_512_64", "sw_stats", "striped_profile", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_table_striped_profile_avx512bw_512_32", "sw_stats", "striped_profile", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_table_striped_profile_avx512bw_512_16", "sw_stats", "striped_profile", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_table_striped_profile_avx512bw_512_8", "sw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_table_striped_profile_avx512bw_512_sat", "sw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 1, 0, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_table_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_table_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 1, 0, 0, 1, 0},
 {parasail_sw_stats_table_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_table_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 1, 0, 0, 1, 0},
@@ -3043,6 +3631,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_rowcol_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_rowcol_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_rowcol_scan_profile_avx512bw_512_64", "nw", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_rowcol_scan_profile_avx512bw_512_32", "nw", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_rowcol_scan_profile_avx512bw_512_16", "nw", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_rowcol_scan_profile_avx512bw_512_8", "nw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_rowcol_scan_profile_avx512bw_512_sat", "nw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_rowcol_striped_profile_avx512bw_512_64", "nw", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_rowcol_striped_profile_avx512bw_512_32", "nw", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_rowcol_striped_profile_avx512bw_512_16", "nw", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_rowcol_striped_profile_avx512bw_512_8", "nw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_nw_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_rowcol_striped_profile_avx512bw_512_sat", "nw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_rowcol_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_nw_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_rowcol_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -3113,6 +3713,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_rowcol_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_rowcol_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_rowcol_scan_profile_avx512bw_512_64", "sg", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_rowcol_scan_profile_avx512bw_512_32", "sg", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_rowcol_scan_profile_avx512bw_512_16", "sg", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_rowcol_scan_profile_avx512bw_512_8", "sg", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_rowcol_scan_profile_avx512bw_512_sat", "sg", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_rowcol_striped_profile_avx512bw_512_64", "sg", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_rowcol_striped_profile_avx512bw_512_32", "sg", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_rowcol_striped_profile_avx512bw_512_16", "sg", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_rowcol_striped_profile_avx512bw_512_8", "sg", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sg_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_rowcol_striped_profile_avx512bw_512_sat", "sg", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_rowcol_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sg_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_rowcol_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -3183,6 +3795,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_rowcol_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_rowcol_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_rowcol_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_rowcol_scan_profile_avx512bw_512_64", "sw", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_rowcol_scan_profile_avx512bw_512_32", "sw", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_rowcol_scan_profile_avx512bw_512_16", "sw", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_rowcol_scan_profile_avx512bw_512_8", "sw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_rowcol_scan_profile_avx512bw_512_sat", "sw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_rowcol_striped_profile_avx512bw_512_64", "sw", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_rowcol_striped_profile_avx512bw_512_32", "sw", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_rowcol_striped_profile_avx512bw_512_16", "sw", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_rowcol_striped_profile_avx512bw_512_8", "sw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 0, 0},
+{parasail_sw_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_rowcol_striped_profile_avx512bw_512_sat", "sw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_rowcol_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_rowcol_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 0, 0},
 {parasail_sw_rowcol_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_rowcol_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 0, 0},
@@ -3253,6 +3877,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_nw_stats_rowcol_striped_profile_avx2_256_8", "nw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_nw_stats_rowcol_striped_profile_avx2_256_sat", "nw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_stats_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_rowcol_scan_profile_avx512bw_512_64", "nw_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_rowcol_scan_profile_avx512bw_512_32", "nw_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_rowcol_scan_profile_avx512bw_512_16", "nw_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_rowcol_scan_profile_avx512bw_512_8", "nw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_rowcol_scan_profile_avx512bw_512_sat", "nw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_nw_stats_rowcol_striped_profile_avx512bw_512_64", "nw_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_nw_stats_rowcol_striped_profile_avx512bw_512_32", "nw_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_nw_stats_rowcol_striped_profile_avx512bw_512_16", "nw_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_nw_stats_rowcol_striped_profile_avx512bw_512_8", "nw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_nw_stats_rowcol_striped_profile_avx512bw_512_sat", "nw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_nw_stats_rowcol_scan_profile_altivec_128_64", "nw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_nw_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_nw_stats_rowcol_scan_profile_altivec_128_32", "nw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -3323,6 +3959,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sg_stats_rowcol_striped_profile_avx2_256_8", "sg_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sg_stats_rowcol_striped_profile_avx2_256_sat", "sg_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_stats_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_rowcol_scan_profile_avx512bw_512_64", "sg_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_rowcol_scan_profile_avx512bw_512_32", "sg_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_rowcol_scan_profile_avx512bw_512_16", "sg_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_rowcol_scan_profile_avx512bw_512_8", "sg_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_rowcol_scan_profile_avx512bw_512_sat", "sg_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sg_stats_rowcol_striped_profile_avx512bw_512_64", "sg_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sg_stats_rowcol_striped_profile_avx512bw_512_32", "sg_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sg_stats_rowcol_striped_profile_avx512bw_512_16", "sg_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sg_stats_rowcol_striped_profile_avx512bw_512_8", "sg_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sg_stats_rowcol_striped_profile_avx512bw_512_sat", "sg_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sg_stats_rowcol_scan_profile_altivec_128_64", "sg_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sg_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sg_stats_rowcol_scan_profile_altivec_128_32", "sg_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -3393,6 +4041,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_stats_rowcol_striped_profile_avx2_256_8, parasail_profile_create_stats_avx_256_8, "parasail_sw_stats_rowcol_striped_profile_avx2_256_8", "sw_stats", "striped_profile", "avx2",  "256",  "8", 32, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_striped_profile_avx2_256_sat, parasail_profile_create_stats_avx_256_sat, "parasail_sw_stats_rowcol_striped_profile_avx2_256_sat", "sw_stats", "striped_profile", "avx2",  "256", "sat", 32, 0, 1, 0, 1, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_stats_rowcol_scan_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_rowcol_scan_profile_avx512bw_512_64", "sw_stats", "scan_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32", "sw_stats", "scan_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16", "sw_stats", "scan_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8", "sw_stats", "scan_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_rowcol_scan_profile_avx512bw_512_sat", "sw_stats", "scan_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512bw_512_64, parasail_profile_create_stats_avx_512_64, "parasail_sw_stats_rowcol_striped_profile_avx512bw_512_64", "sw_stats", "striped_profile", "avx512bw", "512", "64",  8, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32, parasail_profile_create_stats_avx_512_32, "parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32", "sw_stats", "striped_profile", "avx512bw", "512", "32", 16, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16, parasail_profile_create_stats_avx_512_16, "parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16", "sw_stats", "striped_profile", "avx512bw", "512", "16", 32, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8, parasail_profile_create_stats_avx_512_8, "parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8", "sw_stats", "striped_profile", "avx512bw", "512",  "8", 64, 0, 1, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_profile_avx512bw_512_sat, parasail_profile_create_stats_avx_512_sat, "parasail_sw_stats_rowcol_striped_profile_avx512bw_512_sat", "sw_stats", "striped_profile", "avx512bw", "512", "sat", 64, 0, 1, 0, 1, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_stats_rowcol_scan_profile_altivec_128_64, parasail_profile_create_stats_altivec_128_64, "parasail_sw_stats_rowcol_scan_profile_altivec_128_64", "sw_stats", "scan_profile", "altivec", "128", "64",  2, 0, 1, 0, 1, 0},
 {parasail_sw_stats_rowcol_scan_profile_altivec_128_32, parasail_profile_create_stats_altivec_128_32, "parasail_sw_stats_rowcol_scan_profile_altivec_128_32", "sw_stats", "scan_profile", "altivec", "128", "32",  4, 0, 1, 0, 1, 0},
@@ -3463,6 +4123,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_nw_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_nw_trace_striped_profile_avx2_256_8", "nw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_nw_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_nw_trace_striped_profile_avx2_256_sat", "nw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_nw_trace_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_trace_scan_profile_avx512bw_512_64", "nw", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_trace_scan_profile_avx512bw_512_32", "nw", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_trace_scan_profile_avx512bw_512_16", "nw", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_trace_scan_profile_avx512bw_512_8", "nw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_trace_scan_profile_avx512bw_512_sat", "nw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_nw_trace_striped_profile_avx512bw_512_64", "nw", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_nw_trace_striped_profile_avx512bw_512_32", "nw", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_nw_trace_striped_profile_avx512bw_512_16", "nw", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_nw_trace_striped_profile_avx512bw_512_8", "nw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_nw_trace_striped_profile_avx512bw_512_sat", "nw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_nw_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_nw_trace_scan_profile_altivec_128_64", "nw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_nw_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_nw_trace_scan_profile_altivec_128_32", "nw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -3533,6 +4205,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sg_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sg_trace_striped_profile_avx2_256_8", "sg", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sg_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sg_trace_striped_profile_avx2_256_sat", "sg", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sg_trace_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_trace_scan_profile_avx512bw_512_64", "sg", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_trace_scan_profile_avx512bw_512_32", "sg", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_trace_scan_profile_avx512bw_512_16", "sg", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_trace_scan_profile_avx512bw_512_8", "sg", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_trace_scan_profile_avx512bw_512_sat", "sg", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sg_trace_striped_profile_avx512bw_512_64", "sg", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sg_trace_striped_profile_avx512bw_512_32", "sg", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sg_trace_striped_profile_avx512bw_512_16", "sg", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sg_trace_striped_profile_avx512bw_512_8", "sg", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sg_trace_striped_profile_avx512bw_512_sat", "sg", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sg_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sg_trace_scan_profile_altivec_128_64", "sg", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sg_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sg_trace_scan_profile_altivec_128_32", "sg", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -3603,6 +4287,18 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {parasail_sw_trace_striped_profile_avx2_256_8, parasail_profile_create_avx_256_8,   "parasail_sw_trace_striped_profile_avx2_256_8", "sw", "striped_profile", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
 {parasail_sw_trace_striped_profile_avx2_256_sat, parasail_profile_create_avx_256_sat, "parasail_sw_trace_striped_profile_avx2_256_sat", "sw", "striped_profile", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
 #endif
+#if HAVE_AVX512BW
+{parasail_sw_trace_scan_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_trace_scan_profile_avx512bw_512_64", "sw", "scan_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_trace_scan_profile_avx512bw_512_32", "sw", "scan_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_trace_scan_profile_avx512bw_512_16", "sw", "scan_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_trace_scan_profile_avx512bw_512_8", "sw", "scan_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_trace_scan_profile_avx512bw_512_sat", "sw", "scan_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512bw_512_64, parasail_profile_create_avx_512_64,  "parasail_sw_trace_striped_profile_avx512bw_512_64", "sw", "striped_profile", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512bw_512_32, parasail_profile_create_avx_512_32,  "parasail_sw_trace_striped_profile_avx512bw_512_32", "sw", "striped_profile", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512bw_512_16, parasail_profile_create_avx_512_16,  "parasail_sw_trace_striped_profile_avx512bw_512_16", "sw", "striped_profile", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512bw_512_8, parasail_profile_create_avx_512_8,   "parasail_sw_trace_striped_profile_avx512bw_512_8", "sw", "striped_profile", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_profile_avx512bw_512_sat, parasail_profile_create_avx_512_sat, "parasail_sw_trace_striped_profile_avx512bw_512_sat", "sw", "striped_profile", "avx512bw", "512", "sat", 64, 0, 0, 1, 0, 0},
+#endif
 #if HAVE_ALTIVEC
 {parasail_sw_trace_scan_profile_altivec_128_64, parasail_profile_create_altivec_128_64, "parasail_sw_trace_scan_profile_altivec_128_64", "sw", "scan_profile", "altivec", "128", "64",  2, 0, 0, 1, 0, 0},
 {parasail_sw_trace_scan_profile_altivec_128_32, parasail_profile_create_altivec_128_32, "parasail_sw_trace_scan_profile_altivec_128_32", "sw", "scan_profile", "altivec", "128", "32",  4, 0, 0, 1, 0, 0},
@@ -3640,6 +4336,154 @@ static const parasail_pfunction_info_t pfunctions[] = {
 {NULL, NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 
+static const parasail_kfunction_info_t kfunctions[] = {
+{parasail_nw_banded,                  "parasail_nw_banded",                  "nw",  "banded", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_banded_sse41_128_32,     "parasail_nw_banded_sse41_128_32",     "nw",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_16,     "parasail_nw_banded_sse41_128_16",     "nw",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_8,      "parasail_nw_banded_sse41_128_8",      "nw",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_banded_sse41_128_sat,    "parasail_nw_banded_sse41_128_sat",    "nw",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_banded_avx2_256_32,      "parasail_nw_banded_avx2_256_32",      "nw",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_16,      "parasail_nw_banded_avx2_256_16",      "nw",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_8,       "parasail_nw_banded_avx2_256_8",       "nw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_nw_banded_avx2_256_sat,     "parasail_nw_banded_avx2_256_sat",     "nw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_nw_banded_neon_128_32,      "parasail_nw_banded_neon_128_32",      "nw",  "banded", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_banded_neon_128_16,      "parasail_nw_banded_neon_128_16",      "nw",  "banded", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_banded_neon_128_8,       "parasail_nw_banded_neon_128_8",       "nw",  "banded", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_banded_neon_128_sat,     "parasail_nw_banded_neon_128_sat",     "nw",  "banded", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+{parasail_nw_banded_32,               "parasail_nw_banded_32",               "nw",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_nw_banded_16,               "parasail_nw_banded_16",               "nw",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_nw_banded_8,                "parasail_nw_banded_8",                "nw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_nw_banded_sat,              "parasail_nw_banded_sat",              "nw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_nw_banded_adaptive,         "parasail_nw_banded_adaptive",         "nw", "adaptive", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_banded,                  "parasail_sg_banded",                  "sg",  "banded", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_sg_banded_sse41_128_32,     "parasail_sg_banded_sse41_128_32",     "sg",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_banded_sse41_128_16,     "parasail_sg_banded_sse41_128_16",     "sg",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_banded_sse41_128_8,      "parasail_sg_banded_sse41_128_8",      "sg",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_banded_sse41_128_sat,    "parasail_sg_banded_sse41_128_sat",    "sg",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sg_banded_avx2_256_32,      "parasail_sg_banded_avx2_256_32",      "sg",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sg_banded_avx2_256_16,      "parasail_sg_banded_avx2_256_16",      "sg",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sg_banded_avx2_256_8,       "parasail_sg_banded_avx2_256_8",       "sg",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_sg_banded_avx2_256_sat,     "parasail_sg_banded_avx2_256_sat",     "sg",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_sg_banded_neon_128_32,      "parasail_sg_banded_neon_128_32",      "sg",  "banded", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_banded_neon_128_16,      "parasail_sg_banded_neon_128_16",      "sg",  "banded", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_banded_neon_128_8,       "parasail_sg_banded_neon_128_8",       "sg",  "banded", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_banded_neon_128_sat,     "parasail_sg_banded_neon_128_sat",     "sg",  "banded", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+{parasail_sg_banded_32,               "parasail_sg_banded_32",               "sg",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sg_banded_16,               "parasail_sg_banded_16",               "sg",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sg_banded_8,                "parasail_sg_banded_8",                "sg",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sg_banded_sat,              "parasail_sg_banded_sat",              "sg",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sg_banded_adaptive,         "parasail_sg_banded_adaptive",         "sg", "adaptive", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sw_banded,                  "parasail_sw_banded",                  "sw",  "banded", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+#if HAVE_SSE41
+{parasail_sw_banded_sse41_128_32,     "parasail_sw_banded_sse41_128_32",     "sw",  "banded", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_banded_sse41_128_16,     "parasail_sw_banded_sse41_128_16",     "sw",  "banded", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_banded_sse41_128_8,      "parasail_sw_banded_sse41_128_8",      "sw",  "banded", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sw_banded_sse41_128_sat,    "parasail_sw_banded_sse41_128_sat",    "sw",  "banded", "sse41", "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sw_banded_avx2_256_32,      "parasail_sw_banded_avx2_256_32",      "sw",  "banded", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sw_banded_avx2_256_16,      "parasail_sw_banded_avx2_256_16",      "sw",  "banded", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sw_banded_avx2_256_8,       "parasail_sw_banded_avx2_256_8",       "sw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_sw_banded_avx2_256_sat,     "parasail_sw_banded_avx2_256_sat",     "sw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 0, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_sw_banded_neon_128_32,      "parasail_sw_banded_neon_128_32",      "sw",  "banded", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_banded_neon_128_16,      "parasail_sw_banded_neon_128_16",      "sw",  "banded", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_banded_neon_128_8,       "parasail_sw_banded_neon_128_8",       "sw",  "banded", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sw_banded_neon_128_sat,     "parasail_sw_banded_neon_128_sat",     "sw",  "banded", "neon",  "128", "sat", 16, 0, 0, 0, 0, 0},
+#endif
+{parasail_sw_banded_32,               "parasail_sw_banded_32",               "sw",  "banded", "disp",   "NA", "32", -1, 0, 0, 0, 0, 0},
+{parasail_sw_banded_16,               "parasail_sw_banded_16",               "sw",  "banded", "disp",   "NA", "16", -1, 0, 0, 0, 0, 0},
+{parasail_sw_banded_8,                "parasail_sw_banded_8",                "sw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 0, 0, 0},
+{parasail_sw_banded_sat,              "parasail_sw_banded_sat",              "sw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 0, 0, 0},
+{parasail_sw_banded_adaptive,         "parasail_sw_banded_adaptive",         "sw", "adaptive", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_nw_trace_banded,            "parasail_nw_trace_banded",            "nw",  "banded", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+#if HAVE_SSE41
+{parasail_nw_trace_banded_sse41_128_32, "parasail_nw_trace_banded_sse41_128_32", "nw",  "banded", "sse41", "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_sse41_128_16, "parasail_nw_trace_banded_sse41_128_16", "nw",  "banded", "sse41", "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_sse41_128_8, "parasail_nw_trace_banded_sse41_128_8", "nw",  "banded", "sse41", "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_sse41_128_sat, "parasail_nw_trace_banded_sse41_128_sat", "nw",  "banded", "sse41", "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_nw_trace_banded_avx2_256_32, "parasail_nw_trace_banded_avx2_256_32", "nw",  "banded", "avx2",  "256", "32",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_avx2_256_16, "parasail_nw_trace_banded_avx2_256_16", "nw",  "banded", "avx2",  "256", "16", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_avx2_256_8, "parasail_nw_trace_banded_avx2_256_8", "nw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_avx2_256_sat, "parasail_nw_trace_banded_avx2_256_sat", "nw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_nw_trace_banded_neon_128_32, "parasail_nw_trace_banded_neon_128_32", "nw",  "banded", "neon",  "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_neon_128_16, "parasail_nw_trace_banded_neon_128_16", "nw",  "banded", "neon",  "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_neon_128_8, "parasail_nw_trace_banded_neon_128_8", "nw",  "banded", "neon",  "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_neon_128_sat, "parasail_nw_trace_banded_neon_128_sat", "nw",  "banded", "neon",  "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+{parasail_nw_trace_banded_32,         "parasail_nw_trace_banded_32",         "nw",  "banded", "disp",   "NA", "32", -1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_16,         "parasail_nw_trace_banded_16",         "nw",  "banded", "disp",   "NA", "16", -1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_8,          "parasail_nw_trace_banded_8",          "nw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_sat,        "parasail_nw_trace_banded_sat",        "nw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_banded_adaptive,   "parasail_nw_trace_banded_adaptive",   "nw", "adaptive", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded,            "parasail_sg_trace_banded",            "sg",  "banded", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+#if HAVE_SSE41
+{parasail_sg_trace_banded_sse41_128_32, "parasail_sg_trace_banded_sse41_128_32", "sg",  "banded", "sse41", "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_sse41_128_16, "parasail_sg_trace_banded_sse41_128_16", "sg",  "banded", "sse41", "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_sse41_128_8, "parasail_sg_trace_banded_sse41_128_8", "sg",  "banded", "sse41", "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_sse41_128_sat, "parasail_sg_trace_banded_sse41_128_sat", "sg",  "banded", "sse41", "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sg_trace_banded_avx2_256_32, "parasail_sg_trace_banded_avx2_256_32", "sg",  "banded", "avx2",  "256", "32",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_avx2_256_16, "parasail_sg_trace_banded_avx2_256_16", "sg",  "banded", "avx2",  "256", "16", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_avx2_256_8, "parasail_sg_trace_banded_avx2_256_8", "sg",  "banded", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_avx2_256_sat, "parasail_sg_trace_banded_avx2_256_sat", "sg",  "banded", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_sg_trace_banded_neon_128_32, "parasail_sg_trace_banded_neon_128_32", "sg",  "banded", "neon",  "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_neon_128_16, "parasail_sg_trace_banded_neon_128_16", "sg",  "banded", "neon",  "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_neon_128_8, "parasail_sg_trace_banded_neon_128_8", "sg",  "banded", "neon",  "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_neon_128_sat, "parasail_sg_trace_banded_neon_128_sat", "sg",  "banded", "neon",  "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+{parasail_sg_trace_banded_32,         "parasail_sg_trace_banded_32",         "sg",  "banded", "disp",   "NA", "32", -1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_16,         "parasail_sg_trace_banded_16",         "sg",  "banded", "disp",   "NA", "16", -1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_8,          "parasail_sg_trace_banded_8",          "sg",  "banded", "disp",   "NA",  "8", -1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_sat,        "parasail_sg_trace_banded_sat",        "sg",  "banded", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_banded_adaptive,   "parasail_sg_trace_banded_adaptive",   "sg", "adaptive", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded,            "parasail_sw_trace_banded",            "sw",  "banded", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+#if HAVE_SSE41
+{parasail_sw_trace_banded_sse41_128_32, "parasail_sw_trace_banded_sse41_128_32", "sw",  "banded", "sse41", "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_sse41_128_16, "parasail_sw_trace_banded_sse41_128_16", "sw",  "banded", "sse41", "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_sse41_128_8, "parasail_sw_trace_banded_sse41_128_8", "sw",  "banded", "sse41", "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_sse41_128_sat, "parasail_sw_trace_banded_sse41_128_sat", "sw",  "banded", "sse41", "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_AVX2
+{parasail_sw_trace_banded_avx2_256_32, "parasail_sw_trace_banded_avx2_256_32", "sw",  "banded", "avx2",  "256", "32",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_avx2_256_16, "parasail_sw_trace_banded_avx2_256_16", "sw",  "banded", "avx2",  "256", "16", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_avx2_256_8, "parasail_sw_trace_banded_avx2_256_8", "sw",  "banded", "avx2",  "256",  "8", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_avx2_256_sat, "parasail_sw_trace_banded_avx2_256_sat", "sw",  "banded", "avx2",  "256", "sat", 32, 0, 0, 1, 0, 0},
+#endif
+#if HAVE_NEON
+{parasail_sw_trace_banded_neon_128_32, "parasail_sw_trace_banded_neon_128_32", "sw",  "banded", "neon",  "128", "32",  4, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_neon_128_16, "parasail_sw_trace_banded_neon_128_16", "sw",  "banded", "neon",  "128", "16",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_neon_128_8, "parasail_sw_trace_banded_neon_128_8", "sw",  "banded", "neon",  "128",  "8", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_neon_128_sat, "parasail_sw_trace_banded_neon_128_sat", "sw",  "banded", "neon",  "128", "sat", 16, 0, 0, 1, 0, 0},
+#endif
+{parasail_sw_trace_banded_32,         "parasail_sw_trace_banded_32",         "sw",  "banded", "disp",   "NA", "32", -1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_16,         "parasail_sw_trace_banded_16",         "sw",  "banded", "disp",   "NA", "16", -1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_8,          "parasail_sw_trace_banded_8",          "sw",  "banded", "disp",   "NA",  "8", -1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_sat,        "parasail_sw_trace_banded_sat",        "sw",  "banded", "disp",   "NA", "sat", -1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_banded_adaptive,   "parasail_sw_trace_banded_adaptive",   "sw", "adaptive", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,37 @@ void parasail_memset___m256i(__m256i *b, __m256i c, size_t len);
 extern
 void parasail_free___m256i(void *ptr);
 
+#if defined(__AVX512BW__)
+typedef union __m512i_8 {
+    __m512i m;
+    int8_t v[64];
+} __m512i_8_t;
+
+typedef union __m512i_16 {
+    __m512i m;
+    int16_t v[32];
+} __m512i_16_t;
+
+typedef union __m512i_32 {
+    __m512i m;
+    int32_t v[16];
+} __m512i_32_t;
+
+typedef union __m512i_64 {
+    __m512i m;
+    int64_t v[8];
+} __m512i_64_t;
+
+extern
+__m512i * parasail_memalign___m512i(size_t alignment, size_t size);
+
+extern
+void parasail_memset___m512i(__m512i *b, __m512i c, size_t len);
+
+extern
+void parasail_free___m512i(void *ptr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
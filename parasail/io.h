@@ -11,6 +11,8 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include "parasail.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -42,6 +44,9 @@ typedef struct parasail_sequence {
     parasail_string_t qual;
 } parasail_sequence_t;
 
+/** All strings of all sequences live in one arena. For an uncompressed
+ * file the arena is a private mapping of the file itself, parsed in
+ * place; otherwise it is a single heap buffer. */
 typedef struct parasail_sequences {
     parasail_sequence_t *seqs;
     size_t l;
@@ -50,6 +55,9 @@ typedef struct parasail_sequences {
     size_t longest;
     float mean;
     float stddev;
+    char *arena;
+    size_t arena_size;
+    int arena_mapped;
 } parasail_sequences_t;
 
 parasail_sequences_t* parasail_sequences_from_file(const char *fname);
@@ -58,6 +66,30 @@ char* parasail_sequences_pack(const parasail_sequences_t *sequences, size_t *siz
 
 void parasail_sequences_free(parasail_sequences_t *sequences);
 
+/** Sequences encoded for the *_enc profile functions.  The codes of
+ * all sequences share one buffer and each sequence starts on a byte
+ * boundary, so 2-bit DNA takes a quarter of the text's memory.  Names,
+ * comments, and qualities are not kept. */
+typedef struct parasail_encoded_sequences {
+    parasail_encoded_t *seqs;
+    size_t l;
+    unsigned char *codes;
+    size_t size;
+} parasail_encoded_sequences_t;
+
+/** Encodes every sequence using the codes of matrix, bits bits per
+ * residue (2, 4, or 8).  Exits if a residue does not fit. */
+parasail_encoded_sequences_t* parasail_sequences_encode(
+        const parasail_sequences_t *sequences,
+        const parasail_matrix_t *matrix, int bits);
+
+/** Same as parasail_sequences_encode(parasail_sequences_from_file()),
+ * but the text is released once it is encoded. */
+parasail_encoded_sequences_t* parasail_encoded_sequences_from_file(
+        const char *fname, const parasail_matrix_t *matrix, int bits);
+
+void parasail_encoded_sequences_free(parasail_encoded_sequences_t *sequences);
+
 parasail_file_t* parasail_open(const char *fname);
 
 /** Closes file and frees file parameter. */
@@ -16,6 +16,18 @@
 extern "C" {
 #endif
 
+/* bytes of profile and H and E columns the blocked kernels keep for
+ * each block of query rows, sized to stay resident in L2 */
+#ifndef PARASAIL_BLOCKED_CACHE
+#define PARASAIL_BLOCKED_CACHE 262144
+#endif
+
+/* fewest database columns in one tile of the wavefront kernels, each
+ * anti-diagonal of tiles ends in a barrier */
+#ifndef PARASAIL_WAVEFRONT_TILE
+#define PARASAIL_WAVEFRONT_TILE 256
+#endif
+
 extern void * parasail_memalign(size_t alignment, size_t size);
 extern int * parasail_memalign_int(size_t alignment, size_t size);
 extern int8_t * parasail_memalign_int8_t(size_t alignment, size_t size);
@@ -41,6 +53,54 @@ extern parasail_result_t* parasail_result_new_rowcol1(const int a, const int b);
 extern parasail_result_t* parasail_result_new_rowcol3(const int a, const int b);
 extern parasail_result_t* parasail_result_new_trace(const int a, const int b, const size_t alignment, const size_t size);
 
+extern void* parasail_workspace_reserve(parasail_workspace_t *workspace, size_t size);
+extern void parasail_workspace_release(parasail_workspace_t *workspace);
+
+/* Column state handed from a saturated kernel to a wider one.  H and E
+ * hold s1Len values in query order and are allocated by the kernel that
+ * saturated; column is -1 until a kernel has saved its state. */
+typedef struct parasail_promote {
+    int column;
+    int score;
+    int *H;
+    int *E;
+} parasail_promote_t;
+
+/* bytes needed to hold length codes of bits bits */
+static inline size_t parasail_encoded_size(int length, int bits)
+{
+    return ((size_t)length * bits + 7) / 8;
+}
+
+/* code of residue j of encoded */
+static inline int parasail_encoded_code(
+        const parasail_encoded_t *encoded, int j)
+{
+    const size_t bit = (size_t)j * encoded->bits;
+    return (encoded->codes[bit >> 3] >> (bit & 7))
+        & ((1 << encoded->bits) - 1);
+}
+
+/* Encode length residues of s into codes, which holds
+ * parasail_encoded_size(length, bits) bytes.  Returns the index of the
+ * first residue whose code does not fit in bits, or -1. */
+extern int parasail_encode_codes(unsigned char *codes,
+        const char *s, int length,
+        const parasail_matrix_t *matrix, int bits);
+
+/* Returns 1 if every pair of residues of s1 and s2 scores either match,
+ * when the residues are equal, or mismatch, when they are not.  Such
+ * scores need no query profile. */
+extern int parasail_match_mismatch(const parasail_matrix_t *matrix,
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        int *match, int *mismatch);
+
+/* Returns 1 if a query profile of profile_size bytes would exceed the
+ * profile budget and the scores of matrix fit the two 16-entry byte
+ * tables of the lookup kernels. */
+extern int parasail_lookup_scores(const parasail_matrix_t *matrix,
+        size_t profile_size);
+
 extern parasail_profile_t* parasail_profile_new(
         const char * s1, const int s1Len, const parasail_matrix_t *matrix);
 
@@ -54,6 +54,30 @@ static inline void stats_sample_value(stats_t *stats, const double x) {
     stats->_M2 = stats->_M2 + delta * (x - stats->_mean);
 }
 
+/* combine the samples of other into stats (Chan et al.) */
+static inline void stats_merge(stats_t *stats, const stats_t *other) {
+    unsigned long n = 0;
+    double delta = 0;
+
+    if (0UL == other->_n) {
+        return;
+    }
+    if (0UL == stats->_n) {
+        *stats = *other;
+        return;
+    }
+
+    n = stats->_n + other->_n;
+    delta = other->_mean - stats->_mean;
+    stats->_sum = stats->_sum + other->_sum;
+    stats->_min = stats->_min < other->_min ? stats->_min : other->_min;
+    stats->_max = stats->_max > other->_max ? stats->_max : other->_max;
+    stats->_mean = stats->_mean + delta*other->_n/n;
+    stats->_M2 = stats->_M2 + other->_M2
+        + delta*delta*((double)stats->_n*other->_n/n);
+    stats->_n = n;
+}
+
 static inline double stats_variance(const stats_t * const stats) {
     return stats->_M2/(stats->_n-1);
 }
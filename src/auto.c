@@ -0,0 +1,393 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Automatic choice of the vectorized kernel and its element width.  A
+ * short benchmark measures the time per cell of the dispatching scan,
+ * striped and diag kernels at each width, over a grid of query lengths
+ * and two gap extension penalties; the Lazy-F loop of the striped
+ * kernels runs longest when extending a gap is cheap.  Each call
+ * interpolates the cost of every candidate from the grid and runs the
+ * cheapest.  A width that might saturate for the given lengths and
+ * scores is charged the chance that it does, taken from earlier calls
+ * of similar length, times the cost of the wider alignment that would
+ * follow it.
+ */
+#include "config.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#define AUTO_NW 0
+#define AUTO_SG 1
+#define AUTO_SW 2
+
+#define AUTO_ALGS 3
+#define AUTO_PARS 3
+#define AUTO_WIDTHS 4
+#define AUTO_GAPS 2
+#define AUTO_LENS 4
+#define AUTO_BUCKETS 32
+
+/* the cost model is a table of nanoseconds per cell */
+#define AUTO_CELLS (AUTO_ALGS*AUTO_PARS*AUTO_WIDTHS*AUTO_GAPS*AUTO_LENS)
+
+/* database length and gap open of every calibration alignment */
+#define AUTO_DB_LEN 192
+#define AUTO_OPEN 10
+
+#define AUTO_VERSION 1
+
+static const int auto_widths[AUTO_WIDTHS] = {8, 16, 32, 64};
+static const int auto_gaps[AUTO_GAPS] = {1, 4};
+static const int auto_lens[AUTO_LENS] = {32, 128, 512, 2048};
+
+static parasail_function_t * const auto_functions[AUTO_ALGS][AUTO_PARS][AUTO_WIDTHS] = {
+    {
+        {parasail_nw_scan_8, parasail_nw_scan_16, parasail_nw_scan_32, parasail_nw_scan_64},
+        {parasail_nw_striped_8, parasail_nw_striped_16, parasail_nw_striped_32, parasail_nw_striped_64},
+        {parasail_nw_diag_8, parasail_nw_diag_16, parasail_nw_diag_32, parasail_nw_diag_64},
+    },
+    {
+        {parasail_sg_scan_8, parasail_sg_scan_16, parasail_sg_scan_32, parasail_sg_scan_64},
+        {parasail_sg_striped_8, parasail_sg_striped_16, parasail_sg_striped_32, parasail_sg_striped_64},
+        {parasail_sg_diag_8, parasail_sg_diag_16, parasail_sg_diag_32, parasail_sg_diag_64},
+    },
+    {
+        {parasail_sw_scan_8, parasail_sw_scan_16, parasail_sw_scan_32, parasail_sw_scan_64},
+        {parasail_sw_striped_8, parasail_sw_striped_16, parasail_sw_striped_32, parasail_sw_striped_64},
+        {parasail_sw_diag_8, parasail_sw_diag_16, parasail_sw_diag_32, parasail_sw_diag_64},
+    },
+};
+
+static double auto_ns[AUTO_ALGS][AUTO_PARS][AUTO_WIDTHS][AUTO_GAPS][AUTO_LENS];
+static volatile int auto_ready = 0;
+
+/* attempts and saturations of the widths that might saturate, by
+ * log2 of the longer sequence */
+static int auto_tries[AUTO_ALGS][AUTO_WIDTHS][AUTO_BUCKETS];
+static int auto_saturated[AUTO_ALGS][AUTO_WIDTHS][AUTO_BUCKETS];
+
+/* a model measured on one instruction set does not apply to another */
+static int auto_isa(void)
+{
+    return (parasail_can_use_sse2()     ? 0x01 : 0)
+         | (parasail_can_use_sse41()    ? 0x02 : 0)
+         | (parasail_can_use_avx2()     ? 0x04 : 0)
+         | (parasail_can_use_avx512bw() ? 0x08 : 0)
+         | (parasail_can_use_altivec()  ? 0x10 : 0)
+         | (parasail_can_use_neon()     ? 0x20 : 0);
+}
+
+static int auto_load(const char *path)
+{
+    FILE *file = NULL;
+    double *ns = &auto_ns[0][0][0][0][0];
+    double tmp[AUTO_CELLS];
+    int version = 0;
+    int isa = 0;
+    int count = 0;
+    int i = 0;
+
+    if (NULL == path) {
+        return 0;
+    }
+    file = fopen(path, "r");
+    if (NULL == file) {
+        return 0;
+    }
+    if (3 != fscanf(file, "parasail_auto %d %d %d", &version, &isa, &count)
+            || AUTO_VERSION != version
+            || auto_isa() != isa
+            || AUTO_CELLS != count) {
+        fclose(file);
+        return 0;
+    }
+    for (i=0; i<AUTO_CELLS; ++i) {
+        if (1 != fscanf(file, "%lf", &tmp[i]) || !(tmp[i] > 0.0)) {
+            fclose(file);
+            return 0;
+        }
+    }
+    fclose(file);
+    for (i=0; i<AUTO_CELLS; ++i) {
+        ns[i] = tmp[i];
+    }
+    return 1;
+}
+
+static int auto_save(const char *path)
+{
+    FILE *file = NULL;
+    const double *ns = &auto_ns[0][0][0][0][0];
+    int i = 0;
+
+    file = fopen(path, "w");
+    if (NULL == file) {
+        return 0;
+    }
+    fprintf(file, "parasail_auto %d %d %d\n",
+            AUTO_VERSION, auto_isa(), AUTO_CELLS);
+    for (i=0; i<AUTO_CELLS; ++i) {
+        fprintf(file, "%.6g\n", ns[i]);
+    }
+    return 0 == fclose(file);
+}
+
+/* the best of two runs of every kernel on random protein sequences */
+static void auto_measure(void)
+{
+    static const char alphabet[] = "ARNDCQEGHILKMFPSTWYV";
+    const parasail_matrix_t *matrix = parasail_matrix_lookup("blosum62");
+    const int s1Len = auto_lens[AUTO_LENS-1];
+    char *s1 = (char*)malloc(s1Len + 1);
+    char *s2 = (char*)malloc(AUTO_DB_LEN + 1);
+    unsigned int seed = 1;
+    int a, p, w, g, l, i;
+
+    for (i=0; i<s1Len; ++i) {
+        seed = seed * 1103515245U + 12345U;
+        s1[i] = alphabet[(seed >> 16) % 20];
+    }
+    s1[s1Len] = '\0';
+    for (i=0; i<AUTO_DB_LEN; ++i) {
+        seed = seed * 1103515245U + 12345U;
+        s2[i] = alphabet[(seed >> 16) % 20];
+    }
+    s2[AUTO_DB_LEN] = '\0';
+
+    for (a=0; a<AUTO_ALGS; ++a) {
+        for (p=0; p<AUTO_PARS; ++p) {
+            for (w=0; w<AUTO_WIDTHS; ++w) {
+                for (g=0; g<AUTO_GAPS; ++g) {
+                    for (l=0; l<AUTO_LENS; ++l) {
+                        double best = 0.0;
+                        for (i=0; i<2; ++i) {
+                            double start = parasail_time();
+                            parasail_result_t *result = auto_functions[a][p][w](
+                                    s1, auto_lens[l], s2, AUTO_DB_LEN,
+                                    AUTO_OPEN, auto_gaps[g], matrix);
+                            double elapsed = parasail_time() - start;
+                            parasail_result_free(result);
+                            if (0 == i || elapsed < best) {
+                                best = elapsed;
+                            }
+                        }
+                        /* a clock too coarse to see the run must not
+                         * make the kernel look free */
+                        auto_ns[a][p][w][g][l] = MAX(best, 1e-9) * 1e9
+                            / ((double)auto_lens[l] * AUTO_DB_LEN);
+                    }
+                }
+            }
+        }
+    }
+
+    free(s2);
+    free(s1);
+}
+
+int parasail_auto_calibrate(const char *path)
+{
+    int ret = 0;
+
+    if (!auto_load(path)) {
+        auto_measure();
+        if (NULL != path && !auto_save(path)) {
+            ret = -1;
+        }
+    }
+    auto_ready = 1;
+
+    return ret;
+}
+
+static void auto_init(void)
+{
+    if (auto_ready) {
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp critical(parasail_auto_init)
+#endif
+    {
+        if (!auto_ready) {
+            (void)parasail_auto_calibrate(getenv("PARASAIL_AUTO_CACHE"));
+        }
+    }
+}
+
+/* linear in log2 of the query length and in the gap extension, clamped
+ * to the calibrated range */
+static double auto_predict(
+        const int alg, const int par, const int width,
+        const int s1Len, const int s2Len, const int gap)
+{
+    double (*ns)[AUTO_LENS] = auto_ns[alg][par][width];
+    double x = 0.0;
+    double y = 0.0;
+    double per_cell[AUTO_GAPS];
+    int l = 0;
+    int g = 0;
+
+    while (l < AUTO_LENS-2 && s1Len > auto_lens[l+1]) {
+        ++l;
+    }
+    x = log((double)MAX(s1Len, 1) / auto_lens[l])
+        / log((double)auto_lens[l+1] / auto_lens[l]);
+    x = MIN(MAX(x, 0.0), 1.0);
+    y = (double)(gap - auto_gaps[0]) / (auto_gaps[1] - auto_gaps[0]);
+    y = MIN(MAX(y, 0.0), 1.0);
+    for (g=0; g<AUTO_GAPS; ++g) {
+        per_cell[g] = ns[g][l] + x * (ns[g][l+1] - ns[g][l]);
+    }
+
+    return (per_cell[0] + y * (per_cell[1] - per_cell[0]))
+        * (double)s1Len * (double)s2Len;
+}
+
+/* the narrowest width no cell can saturate, with the margin the
+ * kernels' saturation checks keep */
+static int auto_safe_width(
+        const int alg,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const long long shorter = MIN(s1Len, s2Len);
+    const long long longer = MAX(s1Len, s2Len);
+    const long long element = MAX(matrix->max, -matrix->min);
+    long long bound = shorter * element + MAX(element, open);
+    int w = 0;
+
+    if (AUTO_SW != alg) {
+        bound += open + longer * gap;
+    }
+    for (w=0; w<AUTO_WIDTHS-1; ++w) {
+        if (bound < (1LL << (auto_widths[w] - 1)) - 1) {
+            break;
+        }
+    }
+
+    return w;
+}
+
+static int auto_bucket(const int s1Len, const int s2Len)
+{
+    int longer = MAX(s1Len, s2Len);
+    int bucket = 0;
+
+    while (longer > 1 && bucket < AUTO_BUCKETS-1) {
+        longer >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+static parasail_result_t* auto_align(
+        const int alg,
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    const int bucket = auto_bucket(s1Len, s2Len);
+    int safe = 0;
+    int best_par[AUTO_WIDTHS];
+    double expected[AUTO_WIDTHS];
+    int start = 0;
+    int w = 0;
+    int p = 0;
+    parasail_result_t *result = NULL;
+
+    auto_init();
+    safe = auto_safe_width(alg, s1Len, s2Len, open, gap, matrix);
+
+    /* expected cost of starting at width w and widening on saturation,
+     * from the widest width down */
+    for (w=AUTO_WIDTHS-1; w>=0; --w) {
+        double cost = 0.0;
+        best_par[w] = 0;
+        cost = auto_predict(alg, 0, w, s1Len, s2Len, gap);
+        for (p=1; p<AUTO_PARS; ++p) {
+            double c = auto_predict(alg, p, w, s1Len, s2Len, gap);
+            if (c < cost) {
+                cost = c;
+                best_par[w] = p;
+            }
+        }
+        expected[w] = cost;
+        if (w < safe) {
+            const double saturated = (auto_saturated[alg][w][bucket] + 1.0)
+                / (auto_tries[alg][w][bucket] + 2.0);
+            expected[w] += saturated * expected[w+1];
+        }
+    }
+    start = safe;
+    for (w=0; w<safe; ++w) {
+        if (expected[w] < expected[start]) {
+            start = w;
+        }
+    }
+
+    for (w=start; w<AUTO_WIDTHS; ++w) {
+        result = auto_functions[alg][best_par[w]][w](
+                s1, s1Len, s2, s2Len, open, gap, matrix);
+        if (w < safe) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            ++auto_tries[alg][w][bucket];
+            if (parasail_result_is_saturated(result)) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                ++auto_saturated[alg][w][bucket];
+            }
+        }
+        if (!parasail_result_is_saturated(result) || w == AUTO_WIDTHS-1) {
+            break;
+        }
+        parasail_result_free(result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return auto_align(AUTO_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sg_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return auto_align(AUTO_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sw_auto(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return auto_align(AUTO_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
@@ -0,0 +1,261 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Adaptive banding.  Each query row computes the W=2k+1 cells centred
+ * on column c[i].  The centre follows the diagonal, c[i+1] = c[i]+1,
+ * unless the best cell of row i lies to one side of the centre, in
+ * which case the band moves one more column toward it.  Long reads
+ * whose indels drift the path away from the main diagonal can then be
+ * aligned with a narrow band.  The trace variants keep W cells per row
+ * and record the first column of each row in trace->band_start, so
+ * cell (i,j) is at i*W + (j-band_start[i]).
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#define BANDED_NW 0
+#define BANDED_SG 1
+#define BANDED_SW 2
+
+static parasail_result_t* banded_adaptive(
+        const int alg,
+        const int trace,
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int W = 2*k + 1;
+    parasail_result_t *result = trace
+        ? parasail_result_new_trace(s1Len, W, 16, sizeof(int8_t))
+        : parasail_result_new();
+    int8_t * const restrict HT = trace
+        ? (int8_t*)result->trace->trace_table : NULL;
+    int * const restrict band_start = trace
+        ? (int*)malloc(sizeof(int)*(s1Len > 0 ? s1Len : 1)) : NULL;
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len);
+    /* H and F of the previous row, column j at index j+1; the band
+     * only ever moves right, so columns past the previous band still
+     * hold their first-row values */
+    int * const restrict H = parasail_memalign_int(16, s2Len+1);
+    int * const restrict F = parasail_memalign_int(16, s2Len+1);
+    int score = NEG_INF_32;
+    int end_query = s1Len;
+    int end_ref = s2Len;
+    int center = 0;
+    int prev_beg = -1 - k;
+    int i = 0;
+    int j = 0;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* first row, centred on column -1 */
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+    for (j=0; j<s2Len; ++j) {
+        if (j+1 <= k) {
+            H[j+1] = (BANDED_NW == alg) ? -open - j*gap : 0;
+        }
+        else {
+            H[j+1] = NEG_INF_32;
+        }
+        F[j+1] = NEG_INF_32;
+    }
+
+    for (i=0; i<s1Len; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*s1[i]];
+        const int beg = center - k;
+        const int jbeg = MAX(0, beg);
+        const int jend = MIN(s2Len-1, beg+W-1);
+        int NH;
+        int WH = NEG_INF_32;
+        int E = NEG_INF_32;
+        int best = NEG_INF_32;
+        int best_j = center;
+        /* the diagonal neighbour left of the band was never aligned */
+        if (jbeg > 0 && jbeg-1 < prev_beg) {
+            H[jbeg] = NEG_INF_32;
+        }
+        NH = H[jbeg];
+        if (0 == jbeg) {
+            if (beg <= -1) {
+                WH = (BANDED_NW == alg) ? -open - i*gap : 0;
+            }
+            H[0] = WH;
+        }
+        for (j=jbeg; j<=jend; ++j) {
+            int H_dag;
+            int E_opn;
+            int E_ext;
+            int F_opn;
+            int F_ext;
+            int NWH = NH;
+            NH = H[j+1];
+            F_opn = NH - open;
+            F_ext = F[j+1] - gap;
+            F[j+1] = MAX(F_opn, F_ext);
+            E_opn = WH - open;
+            E_ext = E - gap;
+            E = MAX(E_opn, E_ext);
+            H_dag = NWH + matrow[s2[j]];
+            WH = MAX(H_dag, E);
+            WH = MAX(WH, F[j+1]);
+            if (BANDED_SW == alg) {
+                WH = MAX(WH, 0);
+            }
+            H[j+1] = WH;
+            if (trace) {
+                int8_t t;
+                t = (F_opn > F_ext) ? PARASAIL_DIAG_F : PARASAIL_DEL_F;
+                t |= (E_opn > E_ext) ? PARASAIL_DIAG_E : PARASAIL_INS_E;
+                t |= (WH == H_dag) ? PARASAIL_DIAG
+                   : (WH == F[j+1]) ? PARASAIL_DEL
+                                    : PARASAIL_INS;
+                if (BANDED_SW == alg && 0 == WH) {
+                    t &= PARASAIL_ZERO_MASK;
+                }
+                HT[(int64_t)i*W + (j-beg)] = t;
+            }
+            /* the best cell of the row nearest the centre steers the band */
+            if (WH > best || (WH == best
+                        && abs(j-center) < abs(best_j-center))) {
+                best = WH;
+                best_j = j;
+            }
+            /* prefer the smallest end_ref, then the smallest end_query */
+            if (BANDED_SW == alg
+                    || (BANDED_SG == alg
+                        && (i == s1Len-1 || j == s2Len-1))) {
+                if (WH > score
+                        || (WH == score && (j < end_ref
+                                || (j == end_ref && i < end_query)))) {
+                    score = WH;
+                    end_query = i;
+                    end_ref = j;
+                }
+            }
+        }
+        if (trace) {
+            band_start[i] = beg;
+        }
+        prev_beg = beg;
+        center += 1;
+        if (best_j > center-1) {
+            center += 1;
+        }
+        else if (best_j < center-1) {
+            center -= 1;
+        }
+        /* global alignment must still reach the last cell, which the
+         * band can approach by at most two columns per row */
+        if (BANDED_NW == alg) {
+            const int64_t rows = s1Len-2-i;
+            const int64_t reach = (int64_t)s2Len-1-k - 2*rows;
+            if (center < reach) {
+                center = (int)reach;
+            }
+        }
+        center = MIN(center, s2Len-1+k);
+        center = MAX(center, prev_beg+k);
+    }
+
+    if (BANDED_NW == alg) {
+        score = H[s2Len];
+        end_query = s1Len-1;
+        end_ref = s2Len-1;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NOVEC | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+    result->flag |= (BANDED_NW == alg) ? PARASAIL_FLAG_NW
+                  : (BANDED_SG == alg) ? PARASAIL_FLAG_SG
+                                       : PARASAIL_FLAG_SW;
+    if (trace) {
+        result->trace->band = k;
+        result->trace->band_start = band_start;
+        result->flag |= PARASAIL_FLAG_TRACE;
+    }
+
+    parasail_free(F);
+    parasail_free(H);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_NW, 0, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sg_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_SG, 0, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_SW, 0, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_nw_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_NW, 1, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sg_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_SG, 1, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_adaptive(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_adaptive(BANDED_SW, 1, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
@@ -155,7 +155,14 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #define CONCAT3_(X, Y, Z) X##Y##Z
 #define CONCAT3(X, Y, Z) CONCAT3_(X, Y, Z)
 #define LOC_NOVEC int64_t loc = i*lenb + j;
+/* striped and scan results store one trace byte per cell at every
+ * vector width, in the striped order of the query */
 #define LOC_STRIPED int64_t loc = j*segLen*segWidth + (i%segLen)*segWidth + (i/segLen);
+/* linear results store one trace byte per step of the walk */
+#define LOC_LINEAR int64_t loc = step++;
+/* banded results store one row of band cells per query position,
+ * adaptive bands also record the first column of each row */
+#define LOC_BANDED int64_t loc = i*bandW + (j-(NULL != bandStart && i >= 0 ? bandStart[i] : i+bandLo));
 
 #define T 8
 #include "cigar_template.c"
@@ -171,31 +178,25 @@ void parasail_cigar_free(parasail_cigar_t *cigar)
 #include "cigar_template.c"
 #undef T
 
-#define T 16
-#define STRIPED
-#include "cigar_template.c"
-#undef T
-#undef STRIPED
-
 #define T 32
 #include "cigar_template.c"
 #undef T
 
-#define T 32
-#define STRIPED
+#define T 64
 #include "cigar_template.c"
 #undef T
-#undef STRIPED
 
-#define T 64
+#define T 8
+#define LINEAR
 #include "cigar_template.c"
 #undef T
+#undef LINEAR
 
-#define T 64
-#define STRIPED
+#define T 8
+#define BANDED
 #include "cigar_template.c"
 #undef T
-#undef STRIPED
+#undef BANDED
 
 parasail_cigar_t* parasail_result_get_cigar(
         parasail_result_t *result,
@@ -207,19 +208,14 @@ parasail_cigar_t* parasail_result_get_cigar(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED || result->flag & PARASAIL_FLAG_SCAN) {
-        if (result->flag & PARASAIL_FLAG_BITS_8) {
-            return parasail_cigar_striped_8(seqA, lena, seqB, lenb, matrix, result);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            return parasail_cigar_striped_16(seqA, lena, seqB, lenb, matrix, result);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            return parasail_cigar_striped_32(seqA, lena, seqB, lenb, matrix, result);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            return parasail_cigar_striped_64(seqA, lena, seqB, lenb, matrix, result);
-        }
+    if (result->flag & PARASAIL_FLAG_LINEAR) {
+        return parasail_cigar_linear_8(seqA, lena, seqB, lenb, matrix, result);
+    }
+    else if (result->flag & PARASAIL_FLAG_BANDED) {
+        return parasail_cigar_banded_8(seqA, lena, seqB, lenb, matrix, result);
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED || result->flag & PARASAIL_FLAG_SCAN) {
+        return parasail_cigar_striped_8(seqA, lena, seqB, lenb, matrix, result);
     }
     else {
         return parasail_cigar_8(seqA, lena, seqB, lenb, matrix, result);
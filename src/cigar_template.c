@@ -7,6 +7,12 @@
 #if defined(STRIPED)
 #define NAME parasail_cigar_striped_
 #define LOC LOC_STRIPED
+#elif defined(LINEAR)
+#define NAME parasail_cigar_linear_
+#define LOC LOC_LINEAR
+#elif defined(BANDED)
+#define NAME parasail_cigar_banded_
+#define LOC LOC_BANDED
 #else
 #define NAME parasail_cigar_
 #define LOC LOC_NOVEC
@@ -74,6 +80,18 @@ static inline parasail_cigar_t* CONCAT(NAME, T) (
     int64_t j = result->end_ref;
     int where = PARASAIL_DIAG;
     D *HT = (D*)result->trace->trace_table;
+#if defined(LINEAR)
+    int64_t step = 0;
+#endif
+#if defined(BANDED)
+    const int * const bandStart = result->trace->band_start;
+    int64_t bandLo = (lenb < lena ? lenb-lena : 0) - result->trace->band;
+    int64_t bandW = (lenb < lena ? lena-lenb : lenb-lena)
+        + 2*result->trace->band + 1;
+    if (NULL != bandStart) {
+        bandW = 2*result->trace->band + 1;
+    }
+#endif
 #if defined(STRIPED)
     int64_t segWidth = 0;
     int64_t segLen = 0;
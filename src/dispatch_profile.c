@@ -43,6 +43,12 @@ parasail_profile_t* parasail_profile_create_64_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_64_pointer = parasail_profile_create_avx_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_64_pointer = parasail_profile_create_avx_256_64;
@@ -72,6 +78,12 @@ parasail_profile_t* parasail_profile_create_32_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_32_pointer = parasail_profile_create_avx_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_32_pointer = parasail_profile_create_avx_256_32;
@@ -101,6 +113,12 @@ parasail_profile_t* parasail_profile_create_16_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_16_pointer = parasail_profile_create_avx_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_16_pointer = parasail_profile_create_avx_256_16;
@@ -130,6 +148,12 @@ parasail_profile_t* parasail_profile_create_8_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_8_pointer = parasail_profile_create_avx_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_8_pointer = parasail_profile_create_avx_256_8;
@@ -159,6 +183,12 @@ parasail_profile_t* parasail_profile_create_sat_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_sat_pointer = parasail_profile_create_avx_512_sat;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_sat_pointer = parasail_profile_create_avx_256_sat;
@@ -188,6 +218,12 @@ parasail_profile_t* parasail_profile_create_stats_64_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_stats_64_pointer = parasail_profile_create_stats_avx_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_stats_64_pointer = parasail_profile_create_stats_avx_256_64;
@@ -217,6 +253,12 @@ parasail_profile_t* parasail_profile_create_stats_32_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_stats_32_pointer = parasail_profile_create_stats_avx_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_stats_32_pointer = parasail_profile_create_stats_avx_256_32;
@@ -246,6 +288,12 @@ parasail_profile_t* parasail_profile_create_stats_16_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_stats_16_pointer = parasail_profile_create_stats_avx_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_stats_16_pointer = parasail_profile_create_stats_avx_256_16;
@@ -275,6 +323,12 @@ parasail_profile_t* parasail_profile_create_stats_8_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_stats_8_pointer = parasail_profile_create_stats_avx_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_stats_8_pointer = parasail_profile_create_stats_avx_256_8;
@@ -304,6 +358,12 @@ parasail_profile_t* parasail_profile_create_stats_sat_dispatcher(
         const char * const restrict s1, const int s1Len,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_profile_create_stats_sat_pointer = parasail_profile_create_stats_avx_512_sat;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_profile_create_stats_sat_pointer = parasail_profile_create_stats_avx_256_sat;
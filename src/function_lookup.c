@@ -128,3 +128,53 @@ const parasail_pfunction_info_t * parasail_lookup_pfunction_info(const char *fun
     return f;
 }
 
+parasail_kfunction_t * parasail_lookup_kfunction(const char *funcname)
+{
+    const parasail_kfunction_info_t * info = NULL;
+
+    info = parasail_lookup_kfunction_info(funcname);
+
+    if (info && info->pointer) {
+        return info->pointer;
+    }
+
+    return NULL;
+}
+
+const parasail_kfunction_info_t * parasail_lookup_kfunction_info(const char *funcname)
+{
+    const parasail_kfunction_info_t * f = NULL;
+
+    if (funcname) {
+        int index = 0;
+        f = &kfunctions[index++];
+        while (f->pointer) {
+            if (0 == strcmp(funcname, f->name)) {
+                break;
+            }
+            f = &kfunctions[index++];
+        }
+        if (!f->pointer) {
+            /* perhaps caller forgot "parasail_" prefix? */
+            const char *prefix = "parasail_";
+            char *newname = (char*)malloc(strlen(prefix)+strlen(funcname)+1);
+            strcpy(newname, prefix);
+            strcat(newname, funcname);
+            index = 0;
+            f = &kfunctions[index++];
+            while (f->pointer) {
+                if (0 == strcmp(newname, f->name)) {
+                    break;
+                }
+                f = &kfunctions[index++];
+            }
+            free(newname);
+        }
+    }
+
+    if (!f->pointer) {
+        f = NULL;
+    }
+
+    return f;
+}
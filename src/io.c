@@ -23,6 +23,10 @@
 #include <unistd.h>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "parasail.h"
 #include "parasail/io.h"
 #include "parasail/memory.h"
@@ -243,162 +247,160 @@ inline static off_t skip_line(const char *T, off_t i)
     return i;
 }
 
-parasail_file_stat_t* parasail_stat_fasta(const parasail_file_t *pf)
+/* Large buffers are scanned by several threads. The buffer is split
+ * into chunks that begin at record headers, each chunk is scanned on
+ * its own, and the per-chunk counts are merged in file order. */
+#define CHUNK_MIN_SIZE (4L<<20)
+
+enum chunk_error {
+    CHUNK_OK = 0,
+    CHUNK_BAD_FASTA,
+    CHUNK_NON_ALPHA,
+    CHUNK_NON_PRINT,
+    CHUNK_EMPTY_LAST,
+    CHUNK_BAD_FASTQ
+};
+
+typedef struct chunk {
+    off_t begin;
+    off_t end;
+    off_t stop;             /* where scanning stopped, == end if aligned */
+    unsigned long sequences;
+    unsigned long characters;
+    unsigned long lines;    /* lines before the error, FASTQ only */
+    stats_t stats;
+    int error;
+    off_t error_at;
+} chunk_t;
+
+static int chunk_count(off_t size)
 {
-    if (NULL == pf) {
-        fprintf(stderr, "parasail_stat_fasta given NULL pointer\n");
-        exit(EXIT_FAILURE);
+    int count = 1;
+#ifdef _OPENMP
+    count = omp_get_max_threads();
+#endif
+    if (size/CHUNK_MIN_SIZE < count) {
+        count = (int)(size/CHUNK_MIN_SIZE);
     }
+    return count < 1 ? 1 : count;
+}
 
-    return parasail_stat_fasta_buffer(pf->buf, pf->size);
+/* first FASTA header at or after i; any '>' starting a line begins a
+ * record */
+static off_t next_fasta_record(const char *T, off_t i, off_t size)
+{
+    while (i < size && !(T[i] == '>' && T[i-1] == '\n')) {
+        ++i;
+    }
+    return i;
 }
 
-parasail_file_stat_t* parasail_stat_fasta_buffer(const char *T, off_t size)
+/* first FASTQ header at or after i; quality lines may also begin with
+ * '@', but only a header is followed two lines later by '+' */
+static off_t next_fastq_record(const char *T, off_t i, off_t size)
 {
-    off_t i = 0;
-    unsigned long seq = 0;
-    unsigned long c = 0;
-    unsigned long c_tot = 0;
-    stats_t stats;
-    parasail_file_stat_t *pfs = NULL;
+    while (i < size) {
+        if (T[i] == '@' && T[i-1] == '\n') {
+            off_t j = i;
+            int line = 0;
+            while (j < size && line < 2) {
+                if (T[j++] == '\n') {
+                    ++line;
+                }
+            }
+            if (j < size && T[j] == '+') {
+                return i;
+            }
+        }
+        ++i;
+    }
+    return size;
+}
 
-    stats_clear(&stats);
+static void stat_fasta_chunk(const char *T, off_t size, chunk_t *chunk)
+{
+    off_t i = chunk->begin;
+    off_t end = chunk->end;
+    unsigned long c = 0;
 
-    if (NULL == T) {
-        fprintf(stderr, "parasail_stat_fasta_buffer given NULL pointer\n");
-        exit(EXIT_FAILURE);
+    if (i >= end) {
+        chunk->stop = end;
+        return;
     }
 
-    /* first line is always first sequence ID */
+    /* every chunk begins with a sequence ID */
     if (T[i] != '>') {
-        fprintf(stderr, "poorly formatted FASTA file\n");
-        exit(EXIT_FAILURE);
+        chunk->error = CHUNK_BAD_FASTA;
+        chunk->error_at = i;
+        return;
     }
 
     i = skip_line(T, i);
     ++i;
 
     /* count that first sequence */
-    ++seq;
+    ++chunk->sequences;
 
-    /* read rest of file */
-    while (i<size) {
+    /* read rest of chunk */
+    while (i<end) {
         if (T[i] == '>') {
             /* encountered a new sequence */
-            ++seq;
-            stats_sample_value(&stats, c);
+            ++chunk->sequences;
+            stats_sample_value(&chunk->stats, c);
             c = 0;
             i = skip_line(T, i);
         }
         else if (isalpha(T[i])) {
             ++c;
-            ++c_tot;
+            ++chunk->characters;
         }
         else if (T[i] == '\n' || T[i] == '\r') {
             /* ignore newline */
             /* for the case of "\r\n" or "\n\r" */
-            if (i+1<size && (T[i+1] == '\n' || T[i+1] == '\r')) {
+            if (i+1<end && (T[i+1] == '\n' || T[i+1] == '\r')) {
                 ++i;
             }
         }
-        else if (isprint(T[i])) {
-            fprintf(stderr, "error: non-alpha character ('%c')\n", T[i]);
-            exit(EXIT_FAILURE);
-        }
         else {
-            fprintf(stderr, "error: non-printing character ('%d')\n", T[i]);
-            exit(EXIT_FAILURE);
+            chunk->error = isprint(T[i]) ? CHUNK_NON_ALPHA : CHUNK_NON_PRINT;
+            chunk->error_at = i;
+            return;
         }
         ++i;
     }
 
-    /* still should have one sequence in the pipe */
-    if (0 == c) {
-        fprintf(stderr, "error: empty sequence at end of input\n");
-        exit(EXIT_FAILURE);
-    }
-    stats_sample_value(&stats, c);
-
-    pfs = (parasail_file_stat_t*)malloc(sizeof(parasail_file_stat_t));
-    if (NULL == pfs) {
-        fprintf(stderr, "Cannont allocate parasail_file_stat_t");
-        perror("malloc");
-        exit(EXIT_FAILURE);
-    }
-
-    pfs->sequences = seq;
-    pfs->characters = c_tot;
-    pfs->shortest = (unsigned long)stats._min;
-    pfs->longest = (unsigned long)stats._max;
-    pfs->mean = (float)stats._mean;
-    pfs->stddev = (float)stats_stddev(&stats);
-
-    return pfs;
-}
-
-/*
- * Line 1 begins with a '@' character and is followed by a sequence
- * identifier and an optional description (like a FASTA title line).
- *
- * Line 2 is the raw sequence letters.
- *
- * Line 3 begins with a '+' character and is optionally followed by the
- * same sequence identifier (and any description) again.
- *
- * Line 4 encodes the quality values for the sequence in Line 2, and
- * must contain the same number of symbols as letters in the sequence.
- */
-parasail_file_stat_t* parasail_stat_fastq(const parasail_file_t *pf)
-{
-    if (NULL == pf) {
-        fprintf(stderr, "parasail_stat_fastq given NULL pointer\n");
-        exit(EXIT_FAILURE);
+    /* the last sequence of the input must not be empty */
+    if (0 == c && end == size) {
+        chunk->error = CHUNK_EMPTY_LAST;
+        return;
     }
-
-    return parasail_stat_fastq_buffer(pf->buf, pf->size);
+    stats_sample_value(&chunk->stats, c);
+    chunk->stop = end;
 }
 
-parasail_file_stat_t* parasail_stat_fastq_buffer(const char *T, off_t size)
+static void stat_fastq_chunk(const char *T, off_t UNUSED(size), chunk_t *chunk)
 {
-    int first = 1;
-    off_t i = 0;
-    unsigned long seq = 0;
+    off_t i = chunk->begin;
+    off_t end = chunk->end;
     unsigned long c = 0;
-    unsigned long c_tot = 0;
-    unsigned long line = 0;
-    stats_t stats;
-    parasail_file_stat_t *pfs = NULL;
-
-    stats_clear(&stats);
-
-    if (NULL == T) {
-        fprintf(stderr, "parasail_stat_fastq_buffer given NULL pointer\n");
-        exit(EXIT_FAILURE);
-    }
 
-    /* read file */
-    while (i<size) {
+    /* read chunk */
+    while (i<end) {
         if (T[i] != '@') {
-            fprintf(stderr, "poorly formatted FASTQ file\n");
-            fprintf(stderr, "line %lu\n", line);
-            exit(EXIT_FAILURE);
+            chunk->error = CHUNK_BAD_FASTQ;
+            chunk->error_at = i;
+            return;
         }
 
         /* encountered a new sequence */
-        ++seq;
-        if (first) {
-            first = 0;
-        }
-        else {
-            stats_sample_value(&stats, c);
-        }
+        ++chunk->sequences;
         c = 0;
 
         i = skip_line(T, i);
 
         /* go to next line */
         ++i;
-        ++line;
+        ++chunk->lines;
 
         /* rest of next line is the sequence */
         while (T[i] != '\n' && T[i] != '\r') {
@@ -407,36 +409,154 @@ parasail_file_stat_t* parasail_stat_fastq_buffer(const char *T, off_t size)
         }
 
         /* for the case of "\r\n" or "\n\r" */
-        if (i+1<size && (T[i+1] == '\n' || T[i+1] == '\r')) {
+        if (i+1<end && (T[i+1] == '\n' || T[i+1] == '\r')) {
             ++i;
         }
 
-        stats_sample_value(&stats, c);
+        stats_sample_value(&chunk->stats, c);
+        chunk->characters += c;
 
         /* go to next line */
         ++i;
-        ++line;
+        ++chunk->lines;
 
         if (T[i] != '+') {
-            fprintf(stderr, "poorly formatted FASTQ file\n");
-            fprintf(stderr, "line %lu\n", line);
-            exit(EXIT_FAILURE);
+            chunk->error = CHUNK_BAD_FASTQ;
+            chunk->error_at = i;
+            return;
         }
 
         i = skip_line(T, i);
 
         /* go to next line */
         ++i;
-        ++line;
+        ++chunk->lines;
 
         /* rest of next line are the quality control values */
         i = skip_line(T, i);
 
         /* go to next line */
         ++i;
-        ++line;
+        ++chunk->lines;
+    }
+
+    chunk->stop = i;
+}
+
+static void stat_chunks(const char *T, off_t size, int fastq,
+        chunk_t *chunks, int count)
+{
+    int c = 0;
+
+    for (c=0; c<count; ++c) {
+        off_t begin = (off_t)(size/count*c);
+        if (c > 0) {
+            if (begin < chunks[c-1].begin) {
+                begin = chunks[c-1].begin;
+            }
+            begin = fastq ? next_fastq_record(T, begin, size)
+                          : next_fasta_record(T, begin, size);
+        }
+        chunks[c].begin = begin;
+        if (c > 0) {
+            chunks[c-1].end = begin;
+        }
+        chunks[c].stop = -1;
+        chunks[c].sequences = 0;
+        chunks[c].characters = 0;
+        chunks[c].lines = 0;
+        chunks[c].error = CHUNK_OK;
+        chunks[c].error_at = 0;
+        stats_clear(&chunks[c].stats);
+    }
+    chunks[count-1].end = size;
+
+#pragma omp parallel for schedule(dynamic,1)
+    for (c=0; c<count; ++c) {
+        if (fastq) {
+            stat_fastq_chunk(T, size, &chunks[c]);
+        }
+        else {
+            stat_fasta_chunk(T, size, &chunks[c]);
+        }
+    }
+}
+
+/* Scans T into chunks, returning their number. Exits on the first
+ * formatting error in file order, as the serial scan would. */
+static chunk_t* scan_chunks(const char *T, off_t size, int fastq, int *count)
+{
+    chunk_t *chunks = NULL;
+    unsigned long lines = 0;
+    int c = 0;
+
+    *count = chunk_count(size);
+    chunks = (chunk_t*)malloc(sizeof(chunk_t) * (*count));
+    if (NULL == chunks) {
+        fprintf(stderr, "Cannont allocate chunks");
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    stat_chunks(T, size, fastq, chunks, *count);
+
+    for (c=0; c<*count; ++c) {
+        /* a header guessed inside a record, scan it all serially */
+        if (c > 0 && chunks[c-1].stop != chunks[c].begin) {
+            *count = 1;
+            stat_chunks(T, size, fastq, chunks, *count);
+            c = -1;
+            lines = 0;
+            continue;
+        }
+        switch (chunks[c].error) {
+            case CHUNK_OK:
+                break;
+            case CHUNK_BAD_FASTA:
+                fprintf(stderr, "poorly formatted FASTA file\n");
+                exit(EXIT_FAILURE);
+            case CHUNK_NON_ALPHA:
+                fprintf(stderr, "error: non-alpha character ('%c')\n",
+                        T[chunks[c].error_at]);
+                exit(EXIT_FAILURE);
+            case CHUNK_NON_PRINT:
+                fprintf(stderr, "error: non-printing character ('%d')\n",
+                        T[chunks[c].error_at]);
+                exit(EXIT_FAILURE);
+            case CHUNK_EMPTY_LAST:
+                fprintf(stderr, "error: empty sequence at end of input\n");
+                exit(EXIT_FAILURE);
+            case CHUNK_BAD_FASTQ:
+                fprintf(stderr, "poorly formatted FASTQ file\n");
+                fprintf(stderr, "line %lu\n", lines + chunks[c].lines);
+                exit(EXIT_FAILURE);
+        }
+        lines += chunks[c].lines;
     }
 
+    return chunks;
+}
+
+static parasail_file_stat_t* stat_buffer(const char *T, off_t size, int fastq)
+{
+    chunk_t *chunks = NULL;
+    int count = 0;
+    int c = 0;
+    unsigned long seq = 0;
+    unsigned long c_tot = 0;
+    stats_t stats;
+    parasail_file_stat_t *pfs = NULL;
+
+    stats_clear(&stats);
+
+    chunks = scan_chunks(T, size, fastq, &count);
+    for (c=0; c<count; ++c) {
+        seq += chunks[c].sequences;
+        c_tot += chunks[c].characters;
+        stats_merge(&stats, &chunks[c].stats);
+    }
+    free(chunks);
+
     pfs = (parasail_file_stat_t*)malloc(sizeof(parasail_file_stat_t));
     if (NULL == pfs) {
         fprintf(stderr, "Cannont allocate parasail_file_stat_t");
@@ -454,6 +574,64 @@ parasail_file_stat_t* parasail_stat_fastq_buffer(const char *T, off_t size)
     return pfs;
 }
 
+parasail_file_stat_t* parasail_stat_fasta(const parasail_file_t *pf)
+{
+    if (NULL == pf) {
+        fprintf(stderr, "parasail_stat_fasta given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return parasail_stat_fasta_buffer(pf->buf, pf->size);
+}
+
+parasail_file_stat_t* parasail_stat_fasta_buffer(const char *T, off_t size)
+{
+    if (NULL == T) {
+        fprintf(stderr, "parasail_stat_fasta_buffer given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* first line is always first sequence ID */
+    if (T[0] != '>') {
+        fprintf(stderr, "poorly formatted FASTA file\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return stat_buffer(T, size, 0);
+}
+
+/*
+ * Line 1 begins with a '@' character and is followed by a sequence
+ * identifier and an optional description (like a FASTA title line).
+ *
+ * Line 2 is the raw sequence letters.
+ *
+ * Line 3 begins with a '+' character and is optionally followed by the
+ * same sequence identifier (and any description) again.
+ *
+ * Line 4 encodes the quality values for the sequence in Line 2, and
+ * must contain the same number of symbols as letters in the sequence.
+ */
+parasail_file_stat_t* parasail_stat_fastq(const parasail_file_t *pf)
+{
+    if (NULL == pf) {
+        fprintf(stderr, "parasail_stat_fastq given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return parasail_stat_fastq_buffer(pf->buf, pf->size);
+}
+
+parasail_file_stat_t* parasail_stat_fastq_buffer(const char *T, off_t size)
+{
+    if (NULL == T) {
+        fprintf(stderr, "parasail_stat_fastq_buffer given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return stat_buffer(T, size, 1);
+}
+
 char * parasail_read(const parasail_file_t *pf, long * size)
 {
     char * buffer = (char*)malloc(sizeof(char) * (pf->size+1));
@@ -514,53 +692,25 @@ char * parasail_pack_buffer(const char *buf, off_t size, long * packed_size)
     return packed;
 }
 
-char * parasail_pack_fasta(const parasail_file_t *pf, long * packed_size)
-{
-    if (NULL == pf) {
-        fprintf(stderr, "parasail_pack_fasta given NULL pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    if (NULL == packed_size) {
-        fprintf(stderr, "parasail_pack_fasta given NULL size pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    return parasail_pack_fasta_buffer(pf->buf, pf->size, packed_size);
-}
-
-char * parasail_pack_fasta_buffer(const char *T, off_t size, long * packed_size)
+static void pack_fasta_chunk(const char *T, const chunk_t *chunk, char *P)
 {
-    parasail_file_stat_t *pfs = NULL;
-    off_t i = 0;
+    off_t i = chunk->begin;
+    off_t end = chunk->end;
     off_t w = 0;
-    char *P = NULL;
 
-    if (NULL == T) {
-        fprintf(stderr, "parasail_pack_fasta_buffer given NULL pointer\n");
-        exit(EXIT_FAILURE);
+    if (i >= end) {
+        return;
     }
 
-    if (NULL == packed_size) {
-        fprintf(stderr, "parasail_pack_fasta_buffer given NULL size pointer\n");
-        exit(EXIT_FAILURE);
+    /* sequences are separated, the very first one needs no separator */
+    if (i > 0) {
+        P[w++] = '$';
     }
-
-    pfs = parasail_stat_fasta_buffer(T, size);
-
-    P = (char*)malloc(sizeof(char) * (pfs->characters+pfs->sequences+1));
-
-    /* first line is always first sequence ID */
-    if (T[i] != '>') {
-        fprintf(stderr, "poorly formatted FASTA file\n");
-        exit(EXIT_FAILURE);
-    }
-
     i = skip_line(T, i);
     ++i;
 
-    /* read rest of file */
-    while (i<size) {
+    /* read rest of chunk, which scan_chunks() found to be well formed */
+    while (i<end) {
         if (T[i] == '>') {
             /* encountered a new sequence */
             P[w++] = '$';
@@ -572,80 +722,25 @@ char * parasail_pack_fasta_buffer(const char *T, off_t size, long * packed_size)
         else if (T[i] == '\n' || T[i] == '\r') {
             /* ignore newline */
             /* for the case of "\r\n" or "\n\r" */
-            if (i+1<size && (T[i+1] == '\n' || T[i+1] == '\r')) {
+            if (i+1<end && (T[i+1] == '\n' || T[i+1] == '\r')) {
                 ++i;
             }
         }
-        else if (isprint(T[i])) {
-            fprintf(stderr, "error: non-alpha character ('%c')\n", T[i]);
-            exit(EXIT_FAILURE);
-        }
-        else {
-            fprintf(stderr, "error: non-printing character ('%d')\n", T[i]);
-            exit(EXIT_FAILURE);
-        }
         ++i;
     }
-
-    free(pfs);
-
-    P[w++] = '$';
-    P[w] = '\0';
-    *packed_size = w;
-    return P;
-}
-
-char * parasail_pack_fastq(const parasail_file_t *pf, long * size)
-{
-    if (NULL == pf) {
-        fprintf(stderr, "parasail_pack_fastq given NULL pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    if (NULL == size) {
-        fprintf(stderr, "parasail_pack_fastq given NULL size pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    return parasail_pack_fastq_buffer(pf->buf, pf->size, size);
 }
 
-char * parasail_pack_fastq_buffer(const char *T, off_t size, long * packed_size)
+static void pack_fastq_chunk(const char *T, const chunk_t *chunk, char *P)
 {
-    char *P = NULL;
-    int first = 1;
-    off_t i = 0;
+    off_t i = chunk->begin;
+    off_t end = chunk->end;
     off_t w = 0;
-    unsigned long line = 0;
-    parasail_file_stat_t *pfs = NULL;
-
-    if (NULL == T) {
-        fprintf(stderr, "parasail_pack_fastq_buffer given NULL pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    if (NULL == packed_size) {
-        fprintf(stderr, "parasail_pack_fastq_buffer given NULL size pointer\n");
-        exit(EXIT_FAILURE);
-    }
-
-    pfs = parasail_stat_fastq_buffer(T, size);
-
-    P = (char*)malloc(sizeof(char) * (pfs->characters+pfs->sequences+1));
-
-    /* read file */
-    while (i<size) {
-        if (T[i] != '@') {
-            fprintf(stderr, "poorly formatted FASTQ file\n");
-            fprintf(stderr, "line %lu\n", line);
-            exit(EXIT_FAILURE);
-        }
 
-        /* encountered a new sequence */
-        if (first) {
-            first = 0;
-        }
-        else {
+    /* read chunk, which scan_chunks() found to be well formed */
+    while (i<end) {
+        /* encountered a new sequence, the very first one needs no
+         * separator */
+        if (i > 0) {
             P[w++] = '$';
         }
 
@@ -653,7 +748,6 @@ char * parasail_pack_fastq_buffer(const char *T, off_t size, long * packed_size)
 
         /* go to next line */
         ++i;
-        ++line;
 
         /* rest of next line is the sequence */
         while (T[i] != '\n' && T[i] != '\r') {
@@ -662,35 +756,74 @@ char * parasail_pack_fastq_buffer(const char *T, off_t size, long * packed_size)
         }
 
         /* for the case of "\r\n" or "\n\r" */
-        if (i+1<size && (T[i+1] == '\n' || T[i+1] == '\r')) {
+        if (i+1<end && (T[i+1] == '\n' || T[i+1] == '\r')) {
             ++i;
         }
 
         /* go to next line */
         ++i;
-        ++line;
-
-        if (T[i] != '+') {
-            fprintf(stderr, "poorly formatted FASTQ file\n");
-            fprintf(stderr, "line %lu\n", line);
-            exit(EXIT_FAILURE);
-        }
 
+        /* skip the '+' line */
         i = skip_line(T, i);
 
         /* go to next line */
         ++i;
-        ++line;
 
         /* rest of next line are the quality control values */
         i = skip_line(T, i);
 
         /* go to next line */
         ++i;
-        ++line;
+    }
+}
+
+/* each chunk packs into its own slice of P, found by a prefix sum over
+ * the chunk sizes */
+static char* pack_buffer(const char *T, off_t size, int fastq, long *packed_size)
+{
+    chunk_t *chunks = NULL;
+    off_t *offsets = NULL;
+    int count = 0;
+    int c = 0;
+    off_t w = 0;
+    char *P = NULL;
+
+    chunks = scan_chunks(T, size, fastq, &count);
+
+    offsets = (off_t*)malloc(sizeof(off_t) * count);
+    if (NULL == offsets) {
+        fprintf(stderr, "Cannont allocate chunk offsets");
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    for (c=0; c<count; ++c) {
+        offsets[c] = w;
+        w += chunks[c].characters + chunks[c].sequences;
+        if (chunks[c].begin == 0 && chunks[c].sequences > 0) {
+            /* no separator before the first sequence */
+            --w;
+        }
+    }
+
+    P = (char*)malloc(sizeof(char) * (w+2));
+    if (NULL == P) {
+        fprintf(stderr, "Cannont allocate packed buffer");
+        perror("malloc");
+        exit(EXIT_FAILURE);
     }
 
-    free(pfs);
+#pragma omp parallel for schedule(dynamic,1)
+    for (c=0; c<count; ++c) {
+        if (fastq) {
+            pack_fastq_chunk(T, &chunks[c], P+offsets[c]);
+        }
+        else {
+            pack_fasta_chunk(T, &chunks[c], P+offsets[c]);
+        }
+    }
+
+    free(offsets);
+    free(chunks);
 
     P[w++] = '$';
     P[w] = '\0';
@@ -698,6 +831,72 @@ char * parasail_pack_fastq_buffer(const char *T, off_t size, long * packed_size)
     return P;
 }
 
+char * parasail_pack_fasta(const parasail_file_t *pf, long * packed_size)
+{
+    if (NULL == pf) {
+        fprintf(stderr, "parasail_pack_fasta given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (NULL == packed_size) {
+        fprintf(stderr, "parasail_pack_fasta given NULL size pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return parasail_pack_fasta_buffer(pf->buf, pf->size, packed_size);
+}
+
+char * parasail_pack_fasta_buffer(const char *T, off_t size, long * packed_size)
+{
+    if (NULL == T) {
+        fprintf(stderr, "parasail_pack_fasta_buffer given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (NULL == packed_size) {
+        fprintf(stderr, "parasail_pack_fasta_buffer given NULL size pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* first line is always first sequence ID */
+    if (T[0] != '>') {
+        fprintf(stderr, "poorly formatted FASTA file\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return pack_buffer(T, size, 0, packed_size);
+}
+
+char * parasail_pack_fastq(const parasail_file_t *pf, long * size)
+{
+    if (NULL == pf) {
+        fprintf(stderr, "parasail_pack_fastq given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (NULL == size) {
+        fprintf(stderr, "parasail_pack_fastq given NULL size pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return parasail_pack_fastq_buffer(pf->buf, pf->size, size);
+}
+
+char * parasail_pack_fastq_buffer(const char *T, off_t size, long * packed_size)
+{
+    if (NULL == T) {
+        fprintf(stderr, "parasail_pack_fastq_buffer given NULL pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (NULL == packed_size) {
+        fprintf(stderr, "parasail_pack_fastq_buffer given NULL size pointer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return pack_buffer(T, size, 1, packed_size);
+}
+
 /* increments i until T[i] points non-number, returns number */
 #define TOKEN_MAX 10
 inline static off_t get_num(const char *T, off_t i, int *result)
@@ -340,6 +340,111 @@ parasail_result_t* parasail_nw_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -865,6 +970,111 @@ parasail_result_t* parasail_nw_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -1390,6 +1600,111 @@ parasail_result_t* parasail_nw_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -1915,6 +2230,111 @@ parasail_result_t* parasail_nw_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -2440,6 +2860,111 @@ parasail_result_t* parasail_nw_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -2965,6 +3490,111 @@ parasail_result_t* parasail_nw_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -3490,6 +4120,111 @@ parasail_result_t* parasail_nw_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -4015,6 +4750,111 @@ parasail_result_t* parasail_nw_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -4540,6 +5380,111 @@ parasail_result_t* parasail_nw_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -5065,6 +6010,111 @@ parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -5590,6 +6640,111 @@ parasail_result_t* parasail_nw_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -6115,6 +7270,111 @@ parasail_result_t* parasail_nw_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -6640,6 +7900,111 @@ parasail_result_t* parasail_nw_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -7165,6 +8530,111 @@ parasail_result_t* parasail_nw_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -7690,6 +9160,111 @@ parasail_result_t* parasail_nw_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -8215,6 +9790,111 @@ parasail_result_t* parasail_nw_stats_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -8740,6 +10420,111 @@ parasail_result_t* parasail_nw_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -9265,6 +11050,111 @@ parasail_result_t* parasail_nw_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -9790,6 +11680,111 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -10315,6 +12310,111 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -10840,6 +12940,111 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -11365,6 +13570,111 @@ parasail_result_t* parasail_sg_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -11890,6 +14200,111 @@ parasail_result_t* parasail_sg_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -12415,6 +14830,111 @@ parasail_result_t* parasail_sg_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -12940,6 +15460,111 @@ parasail_result_t* parasail_sg_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -13465,6 +16090,111 @@ parasail_result_t* parasail_sg_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -13990,6 +16720,111 @@ parasail_result_t* parasail_sg_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -14515,6 +17350,111 @@ parasail_result_t* parasail_sg_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -15040,6 +17980,111 @@ parasail_result_t* parasail_sg_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -15565,6 +18610,111 @@ parasail_result_t* parasail_sg_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -16090,6 +19240,111 @@ parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -16615,6 +19870,111 @@ parasail_result_t* parasail_sg_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -17140,6 +20500,111 @@ parasail_result_t* parasail_sg_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -17665,6 +21130,111 @@ parasail_result_t* parasail_sg_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -18190,6 +21760,111 @@ parasail_result_t* parasail_sg_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -18715,6 +22390,111 @@ parasail_result_t* parasail_sg_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -19240,6 +23020,111 @@ parasail_result_t* parasail_sg_stats_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -19765,6 +23650,111 @@ parasail_result_t* parasail_sg_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -20290,6 +24280,111 @@ parasail_result_t* parasail_sg_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -20815,6 +24910,111 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -21340,6 +25540,111 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -21865,6 +26170,111 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -22390,6 +26800,111 @@ parasail_result_t* parasail_sw_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -22915,6 +27430,111 @@ parasail_result_t* parasail_sw_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -23440,6 +28060,111 @@ parasail_result_t* parasail_sw_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -23965,6 +28690,111 @@ parasail_result_t* parasail_sw_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -24490,6 +29320,111 @@ parasail_result_t* parasail_sw_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -25015,6 +29950,111 @@ parasail_result_t* parasail_sw_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -25540,6 +30580,111 @@ parasail_result_t* parasail_sw_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -26065,6 +31210,111 @@ parasail_result_t* parasail_sw_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -26590,6 +31840,111 @@ parasail_result_t* parasail_sw_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -27115,6 +32470,111 @@ parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -27640,6 +33100,111 @@ parasail_result_t* parasail_sw_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -28165,6 +33730,111 @@ parasail_result_t* parasail_sw_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -28690,6 +34360,111 @@ parasail_result_t* parasail_sw_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -29215,6 +34990,111 @@ parasail_result_t* parasail_sw_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -29740,6 +35620,111 @@ parasail_result_t* parasail_sw_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -30265,6 +36250,111 @@ parasail_result_t* parasail_sw_stats_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -30790,6 +36880,111 @@ parasail_result_t* parasail_sw_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -31315,6 +37510,111 @@ parasail_result_t* parasail_sw_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -31840,6 +38140,111 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -32365,6 +38770,111 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -32890,6 +39400,111 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_64(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -33370,6 +39985,96 @@ parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -33820,6 +40525,96 @@ parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -34270,6 +41065,96 @@ parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -34720,6 +41605,96 @@ parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -35170,6 +42145,96 @@ parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -35620,6 +42685,96 @@ parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -36070,6 +43225,96 @@ parasail_result_t* parasail_nw_trace_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -36520,6 +43765,96 @@ parasail_result_t* parasail_nw_trace_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -36970,6 +44305,96 @@ parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -37420,6 +44845,96 @@ parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -37870,6 +45385,96 @@ parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -38320,6 +45925,96 @@ parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -38770,6 +46465,96 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -39220,6 +47005,96 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -39670,6 +47545,96 @@ parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -40120,6 +48085,96 @@ parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -40570,6 +48625,96 @@ parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -41020,6 +49165,96 @@ parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -41470,6 +49705,96 @@ parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -41920,6 +50245,96 @@ parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -42370,6 +50785,96 @@ parasail_result_t* parasail_sg_trace_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -42820,6 +51325,96 @@ parasail_result_t* parasail_sg_trace_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -43270,6 +51865,96 @@ parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -43720,6 +52405,96 @@ parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -44170,6 +52945,96 @@ parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -44620,6 +53485,96 @@ parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -45070,6 +54025,96 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -45520,6 +54565,96 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -45970,6 +55105,96 @@ parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -46420,6 +55645,96 @@ parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -46870,6 +56185,96 @@ parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -47320,6 +56725,96 @@ parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -47770,6 +57265,96 @@ parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -48220,6 +57805,96 @@ parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -48670,6 +58345,96 @@ parasail_result_t* parasail_sw_trace_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -49120,6 +58885,96 @@ parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -49570,6 +59425,96 @@ parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -50020,6 +59965,96 @@ parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -50470,6 +60505,96 @@ parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -50920,6 +61045,96 @@ parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -51370,6 +61585,96 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
 #if HAVE_ALTIVEC
 #else
 extern
@@ -51694,235 +61999,12627 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_16(
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_64(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_trace_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_trace_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_table_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_trace_blocked_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_nw_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sg_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t* parasail_sw_rowcol_wavefront_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_avx_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2 || HAVE_SSE41
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_512_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_512_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_512_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_512_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_avx_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_altivec_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_neon_128_64(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_profile_t* parasail_profile_create_stats_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse2_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse2_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse2_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx512bw_512_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx512bw_512_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx512bw_512_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_altivec_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_altivec_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_altivec_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_neon_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_neon_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_neon_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse2_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse2_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse2_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse41_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse41_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse41_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx2_256_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx2_256_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx2_256_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx512bw_512_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx512bw_512_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx512bw_512_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX512BW
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_altivec_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_altivec_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_altivec_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_ALTIVEC
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_neon_128_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_neon_128_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_neon_128_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_NEON
+#else
+extern
+parasail_result_t** parasail_sw_batch_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_SSE41
+#else
+extern
+parasail_result_t* parasail_nw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
+#else
+extern
+parasail_result_t* parasail_nw_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
+{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif
+
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_neon_128_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_sse41_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_sse41_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_sse41_128_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_avx2_256_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_avx2_256_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_avx2_256_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_64(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
@@ -51931,16 +74628,20 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_64(
 #if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_32(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_neon_128_32(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
@@ -51949,16 +74650,20 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_32(
 #if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_16(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_neon_128_16(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
@@ -51967,16 +74672,20 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_16(
 #if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_8(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_neon_128_8(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
@@ -51985,16 +74694,20 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_8(
 #if HAVE_NEON
 #else
 extern
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_trace_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t* matrix)
 {
-    UNUSED(profile);
+    UNUSED(s1);
+    UNUSED(s1Len);
     UNUSED(s2);
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
@@ -52003,10 +74716,10 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_32(
+parasail_result_t* parasail_sg_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52015,6 +74728,7 @@ parasail_result_t* parasail_sw_blocked_sse41_128_32(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52024,10 +74738,10 @@ parasail_result_t* parasail_sw_blocked_sse41_128_32(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_blocked_sse41_128_16(
+parasail_result_t* parasail_sg_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52036,6 +74750,7 @@ parasail_result_t* parasail_sw_blocked_sse41_128_16(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52045,10 +74760,10 @@ parasail_result_t* parasail_sw_blocked_sse41_128_16(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
+parasail_result_t* parasail_sg_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52057,6 +74772,7 @@ parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52066,10 +74782,10 @@ parasail_result_t* parasail_sw_table_blocked_sse41_128_32(
 #if HAVE_SSE41
 #else
 extern
-parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
+parasail_result_t* parasail_sg_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52078,19 +74794,20 @@ parasail_result_t* parasail_sw_table_blocked_sse41_128_16(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
+parasail_result_t* parasail_sg_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52099,19 +74816,20 @@ parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_32(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
+parasail_result_t* parasail_sg_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52120,19 +74838,20 @@ parasail_result_t* parasail_sw_rowcol_blocked_sse41_128_16(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_trace_blocked_sse41_128_32(
+parasail_result_t* parasail_sg_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52141,19 +74860,20 @@ parasail_result_t* parasail_sw_trace_blocked_sse41_128_32(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_result_t* parasail_sw_trace_blocked_sse41_128_16(
+parasail_result_t* parasail_sg_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
@@ -52162,126 +74882,183 @@ parasail_result_t* parasail_sw_trace_blocked_sse41_128_16(
     UNUSED(s2Len);
     UNUSED(open);
     UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_sse_128_64(
+parasail_result_t* parasail_sg_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_sse_128_32(
+parasail_result_t* parasail_sg_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_sse_128_16(
+parasail_result_t* parasail_sg_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_sse_128_8(
+parasail_result_t* parasail_sg_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_sse_128_sat(
+parasail_result_t* parasail_sg_trace_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_avx_256_64(
+parasail_result_t* parasail_sg_trace_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_avx_256_32(
+parasail_result_t* parasail_sg_trace_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_avx_256_16(
+parasail_result_t* parasail_sg_trace_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52291,12 +75068,19 @@ parasail_profile_t* parasail_profile_create_avx_256_16(
 #if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_avx_256_8(
+parasail_result_t* parasail_sg_trace_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52306,87 +75090,129 @@ parasail_profile_t* parasail_profile_create_avx_256_8(
 #if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_avx_256_sat(
+parasail_result_t* parasail_sg_trace_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_altivec_128_64(
+parasail_result_t* parasail_sg_trace_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_altivec_128_32(
+parasail_result_t* parasail_sg_trace_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_altivec_128_16(
+parasail_result_t* parasail_sg_trace_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_altivec_128_8(
+parasail_result_t* parasail_sg_trace_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_altivec_128_sat(
+parasail_result_t* parasail_sg_trace_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52396,312 +75222,459 @@ parasail_profile_t* parasail_profile_create_altivec_128_sat(
 #if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_neon_128_64(
+parasail_result_t* parasail_sg_trace_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_neon_128_32(
+parasail_result_t* parasail_sw_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_neon_128_16(
+parasail_result_t* parasail_sw_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_neon_128_8(
+parasail_result_t* parasail_sw_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_neon_128_sat(
+parasail_result_t* parasail_sw_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_64(
+parasail_result_t* parasail_sw_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_32(
+parasail_result_t* parasail_sw_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_16(
+parasail_result_t* parasail_sw_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_8(
+parasail_result_t* parasail_sw_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_SSE2 || HAVE_SSE41
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_sse_128_sat(
+parasail_result_t* parasail_sw_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_64(
+parasail_result_t* parasail_sw_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_32(
+parasail_result_t* parasail_sw_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_16(
+parasail_result_t* parasail_sw_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_8(
+parasail_result_t* parasail_sw_trace_banded_sse41_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_AVX2
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_avx_256_sat(
+parasail_result_t* parasail_sw_trace_banded_sse41_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_altivec_128_64(
+parasail_result_t* parasail_sw_trace_banded_sse41_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_SSE41
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_altivec_128_32(
+parasail_result_t* parasail_sw_trace_banded_sse41_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_altivec_128_16(
+parasail_result_t* parasail_sw_trace_banded_avx2_256_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_altivec_128_8(
+parasail_result_t* parasail_sw_trace_banded_avx2_256_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_ALTIVEC
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_altivec_128_sat(
+parasail_result_t* parasail_sw_trace_banded_avx2_256_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
 }
 #endif
 
-#if HAVE_NEON
+#if HAVE_AVX2
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_neon_128_64(
+parasail_result_t* parasail_sw_trace_banded_avx2_256_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52711,12 +75684,19 @@ parasail_profile_t* parasail_profile_create_stats_neon_128_64(
 #if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_neon_128_32(
+parasail_result_t* parasail_sw_trace_banded_neon_128_32(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52726,12 +75706,19 @@ parasail_profile_t* parasail_profile_create_stats_neon_128_32(
 #if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_neon_128_16(
+parasail_result_t* parasail_sw_trace_banded_neon_128_16(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52741,12 +75728,19 @@ parasail_profile_t* parasail_profile_create_stats_neon_128_16(
 #if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_neon_128_8(
+parasail_result_t* parasail_sw_trace_banded_neon_128_8(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
@@ -52756,12 +75750,19 @@ parasail_profile_t* parasail_profile_create_stats_neon_128_8(
 #if HAVE_NEON
 #else
 extern
-parasail_profile_t* parasail_profile_create_stats_neon_128_sat(
+parasail_result_t* parasail_sw_trace_banded_neon_128_sat(
         const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
         const parasail_matrix_t* matrix)
 {
     UNUSED(s1);
     UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
     UNUSED(matrix);
     errno = ENOSYS;
     return NULL;
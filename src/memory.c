@@ -125,6 +125,57 @@ void parasail_memset_int64_t(int64_t *b, int64_t c, size_t len)
     }
 }
 
+/* widest vector unit of any supported ISA (AVX-512) */
+#define PARASAIL_WORKSPACE_ALIGNMENT 64
+
+parasail_workspace_t* parasail_workspace_new()
+{
+    parasail_workspace_t *workspace = NULL;
+
+    workspace = (parasail_workspace_t*)malloc(sizeof(parasail_workspace_t));
+    assert(workspace);
+
+    workspace->buffer = NULL;
+    workspace->size = 0;
+
+    return workspace;
+}
+
+void parasail_workspace_free(parasail_workspace_t *workspace)
+{
+    if (NULL == workspace) {
+        return;
+    }
+    parasail_workspace_release(workspace);
+    free(workspace);
+}
+
+void* parasail_workspace_reserve(parasail_workspace_t *workspace, size_t size)
+{
+    if (size > workspace->size) {
+        /* grow geometrically so a slowly increasing length does not
+         * reallocate on every call; contents are not preserved */
+        size_t capacity = workspace->size * 2;
+        if (capacity < size) {
+            capacity = size;
+        }
+        parasail_workspace_release(workspace);
+        workspace->buffer = parasail_memalign(
+                PARASAIL_WORKSPACE_ALIGNMENT, capacity);
+        workspace->size = capacity;
+    }
+    return workspace->buffer;
+}
+
+void parasail_workspace_release(parasail_workspace_t *workspace)
+{
+    if (NULL != workspace->buffer) {
+        parasail_free(workspace->buffer);
+    }
+    workspace->buffer = NULL;
+    workspace->size = 0;
+}
+
 parasail_result_t* parasail_result_new()
 {
     /* declare all variables */
@@ -137,6 +188,7 @@ parasail_result_t* parasail_result_new()
     result->end_query = 0;
     result->end_ref = 0;
     result->flag = 0;
+    result->stop_ref = -1;
     result->extra = NULL;
 
     return result;
@@ -253,6 +305,8 @@ parasail_result_t* parasail_result_new_trace(const int a, const int b, const siz
     assert(result->trace->trace_table);
     result->trace->trace_ins_table = NULL;
     result->trace->trace_del_table = NULL;
+    result->trace->band = 0;
+    result->trace->band_start = NULL;
 
     return result;
 }
@@ -341,12 +395,28 @@ void parasail_result_free(parasail_result_t *result)
             parasail_free(result->trace->trace_ins_table);
         if (NULL != result->trace->trace_del_table)
             parasail_free(result->trace->trace_del_table);
+        if (NULL != result->trace->band_start)
+            free(result->trace->band_start);
         free(result->trace);
     }
 
     free(result);
 }
 
+void parasail_result_batch_free(parasail_result_t **results, int count)
+{
+    int i = 0;
+
+    /* validate inputs */
+    assert(NULL != results);
+
+    for (i=0; i<count; ++i) {
+        parasail_result_free(results[i]);
+    }
+
+    free(results);
+}
+
 void parasail_version(int *major, int *minor, int *patch)
 {
     *major = PARASAIL_VERSION_MAJOR;
@@ -500,6 +570,9 @@ parasail_profile_t* parasail_profile_new(
     profile->profile64.similar = NULL;
     profile->free = NULL;
     profile->stop = INT32_MAX;
+    profile->xdrop = 0;
+    profile->zdrop = 0;
+    profile->min_score = INT32_MIN;
 
     return profile;
 }
@@ -549,6 +622,137 @@ void parasail_profile_free(parasail_profile_t *profile)
     free(profile);
 }
 
+int parasail_encode_codes(unsigned char *codes,
+        const char *s, int length,
+        const parasail_matrix_t *matrix, int bits)
+{
+    const int limit = 1 << bits;
+    const int per_byte = 8 / bits;
+    int i = 0;
+
+    memset(codes, 0, parasail_encoded_size(length, bits));
+    for (i=0; i<length; ++i) {
+        const int code = matrix->mapper[(unsigned char)s[i]];
+        if (code >= limit) {
+            return i;
+        }
+        codes[i/per_byte] |= (unsigned char)(code << (i%per_byte*bits));
+    }
+
+    return -1;
+}
+
+int parasail_match_mismatch(const parasail_matrix_t *matrix,
+        const char *s1, int s1Len, const char *s2, int s2Len,
+        int *match, int *mismatch)
+{
+    uint64_t used = 0;
+    int have_match = 0;
+    int have_mismatch = 0;
+    int i = 0;
+    int j = 0;
+
+    if (matrix->size > 64) {
+        return 0;
+    }
+    for (i=0; i<s1Len; ++i) {
+        used |= UINT64_C(1) << matrix->mapper[(unsigned char)s1[i]];
+    }
+    for (i=0; i<s2Len; ++i) {
+        used |= UINT64_C(1) << matrix->mapper[(unsigned char)s2[i]];
+    }
+
+    *match = 0;
+    *mismatch = 0;
+    for (i=0; i<matrix->size; ++i) {
+        if (!(used & (UINT64_C(1) << i))) {
+            continue;
+        }
+        for (j=0; j<matrix->size; ++j) {
+            int value = 0;
+            if (!(used & (UINT64_C(1) << j))) {
+                continue;
+            }
+            value = matrix->matrix[i*matrix->size + j];
+            if (i == j) {
+                if (have_match && value != *match) {
+                    return 0;
+                }
+                *match = value;
+                have_match = 1;
+            }
+            else {
+                if (have_mismatch && value != *mismatch) {
+                    return 0;
+                }
+                *mismatch = value;
+                have_mismatch = 1;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/* a profile beyond this no longer stays in a typical L2 cache next to the
+ * H and E columns */
+static size_t profile_budget = 256*1024;
+
+void parasail_set_profile_budget(size_t bytes)
+{
+    profile_budget = bytes;
+}
+
+int parasail_lookup_scores(const parasail_matrix_t *matrix,
+        size_t profile_size)
+{
+    return profile_size > profile_budget
+        && matrix->size <= 32
+        && matrix->min >= INT8_MIN
+        && matrix->max <= INT8_MAX;
+}
+
+parasail_encoded_t* parasail_encode(
+        const char *s, const int length,
+        const parasail_matrix_t *matrix, const int bits)
+{
+    parasail_encoded_t *encoded = NULL;
+    int bad = 0;
+
+    if (2 != bits && 4 != bits && 8 != bits) {
+        fprintf(stderr, "encoding must use 2, 4, or 8 bits, not %d\n", bits);
+        return NULL;
+    }
+
+    encoded = (parasail_encoded_t*)malloc(sizeof(parasail_encoded_t));
+    assert(encoded);
+    /* one spare byte so that an empty sequence still allocates */
+    encoded->codes = (unsigned char*)malloc(
+            parasail_encoded_size(length, bits) + 1);
+    assert(encoded->codes);
+    encoded->length = length;
+    encoded->bits = bits;
+
+    bad = parasail_encode_codes(encoded->codes, s, length, matrix, bits);
+    if (bad >= 0) {
+        fprintf(stderr, "residue '%c' of matrix '%s' does not fit in %d bits\n",
+                s[bad], matrix->name, bits);
+        parasail_encoded_free(encoded);
+        return NULL;
+    }
+
+    return encoded;
+}
+
+void parasail_encoded_free(parasail_encoded_t *encoded)
+{
+    if (NULL == encoded) {
+        return;
+    }
+    free(encoded->codes);
+    free(encoded);
+}
+
 char* parasail_reverse(const char *s, size_t length)
 {
     char *r = NULL;
@@ -598,6 +802,16 @@ int parasail_result_is_saturated(const parasail_result_t * const restrict result
     return result->flag & PARASAIL_FLAG_SATURATED;
 }
 
+int parasail_result_is_xdrop(const parasail_result_t * const restrict result)
+{
+    return result->flag & PARASAIL_FLAG_XDROP;
+}
+
+int parasail_result_is_pruned(const parasail_result_t * const restrict result)
+{
+    return result->flag & PARASAIL_FLAG_PRUNED;
+}
+
 int parasail_result_is_banded(const parasail_result_t * const restrict result)
 {
     return result->flag & PARASAIL_FLAG_BANDED;
@@ -623,6 +837,16 @@ int parasail_result_is_blocked(const parasail_result_t * const restrict result)
     return result->flag & PARASAIL_FLAG_BLOCKED;
 }
 
+int parasail_result_is_batch(const parasail_result_t * const restrict result)
+{
+    return result->flag & PARASAIL_FLAG_BATCH;
+}
+
+int parasail_result_is_linear(const parasail_result_t * const restrict result)
+{
+    return result->flag & PARASAIL_FLAG_LINEAR;
+}
+
 int parasail_result_is_stats(const parasail_result_t * const restrict result)
 {
     return result->flag & PARASAIL_FLAG_STATS;
@@ -83,6 +83,15 @@ parasail_result_t* ENAME(
         }
     }
 #endif
+#ifdef PARASAIL_ROWCOL
+    /* fill the last row and column with zeros */
+    for (j=0; j<s2Len; ++j) {
+        result->rowcols->score_row[j] = 0;
+    }
+    for (i=0; i<s1Len; ++i) {
+        result->rowcols->score_col[i] = 0;
+    }
+#endif
 
     /* initialize H */
     /* initialize E */
@@ -130,6 +139,14 @@ parasail_result_t* ENAME(
             H[i] = MAX(H[i], H_dag);
 #ifdef PARASAIL_TABLE
             result->tables->score_table[pos*s2Len + j] = H[i];
+#endif
+#ifdef PARASAIL_ROWCOL
+            if (pos == s1Len-1) {
+                result->rowcols->score_row[j] = H[i];
+            }
+            if (j == s2Len-1) {
+                result->rowcols->score_col[pos] = H[i];
+            }
 #endif
         }
         colOff += 1;
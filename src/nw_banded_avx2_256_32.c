@@ -0,0 +1,229 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+
+#if HAVE_AVX2_MM256_INSERT_EPI32
+#define _mm256_insert_epi32_rpl _mm256_insert_epi32
+#else
+static inline __m256i _mm256_insert_epi32_rpl(__m256i a, int32_t i, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI32
+#define _mm256_extract_epi32_rpl _mm256_extract_epi32
+#else
+static inline int32_t _mm256_extract_epi32_rpl(__m256i a, int imm) {
+    __m256i_32_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
+
+#define _mm256_srli_si256_rpl(a,imm) _mm256_or_si256(_mm256_slli_si256(_mm256_permute2x128_si256(a, a, _MM_SHUFFLE(3,0,0,1)), 16-imm), _mm256_srli_si256(a, imm))
+
+
+#define FNAME parasail_nw_banded_avx2_256_32
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const int32_t lo = MIN(0, s2Len-s1Len) - k;
+    const int32_t hi = MAX(0, s2Len-s1Len) + k;
+    int32_t * const restrict s1 = parasail_memalign_int32_t(32, s1Len+PAD);
+    int32_t * const restrict s2B= parasail_memalign_int32_t(32, s2Len+PAD2);
+    int32_t * const restrict _H_pr = parasail_memalign_int32_t(32, s2Len+PAD2);
+    int32_t * const restrict _F_pr = parasail_memalign_int32_t(32, s2Len+PAD2);
+    int32_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int32_t * const restrict H_pr = _H_pr+PAD;
+    int32_t * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new();
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int32_t score = NEG_INF;
+    __m256i vNegInf = _mm256_set1_epi32(NEG_INF);
+    __m256i vOpen = _mm256_set1_epi32(open);
+    __m256i vGap  = _mm256_set1_epi32(gap);
+    __m256i vZero = _mm256_set1_epi32(0);
+    __m256i vK = _mm256_set_epi32(0,1,2,3,4,5,6,7);
+    __m256i v2K = _mm256_add_epi32(vK, vK);
+    
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? MAX(-open - j*gap, NEG_INF) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const int32_t jbeg = MAX(0, i+lo);
+        const int32_t jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const int32_t kLast = s1Len-1-i;
+        __m256i vNH = vNegInf;
+        __m256i vWH = vNegInf;
+        __m256i vE = vNegInf;
+        __m256i vF = vNegInf;
+        __m256i vRowOut = _mm256_cmpgt_epi32(vK, _mm256_set1_epi32(CLAMP(kLast)));
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        vNH = _mm256_insert_epi32_rpl(vNH, H_pr[jbeg-1], 7);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = _mm256_insert_epi32_rpl(vWH, MAX(-open - i*gap, NEG_INF), 7);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            __m256i vMat;
+            __m256i vNWH = vNH;
+            __m256i vOut = vZero;
+            vNH = _mm256_srli_si256_rpl(vWH, 4);
+            vNH = _mm256_insert_epi32_rpl(vNH, H_pr[j], 7);
+            vF = _mm256_srli_si256_rpl(vF, 4);
+            vF = _mm256_insert_epi32_rpl(vF, F_pr[j], 7);
+            vF = _mm256_max_epi32(
+                    _mm256_sub_epi32(vNH, vOpen),
+                    _mm256_sub_epi32(vF, vGap));
+            vE = _mm256_max_epi32(
+                    _mm256_sub_epi32(vWH, vOpen),
+                    _mm256_sub_epi32(vE, vGap));
+            vMat = _mm256_set_epi32(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]]
+                    );
+            vNWH = _mm256_add_epi32(vNWH, vMat);
+            vWH = _mm256_max_epi32(vNWH, vE);
+            vWH = _mm256_max_epi32(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                __m256i cond = _mm256_cmpeq_epi32(vK, _mm256_set1_epi32(CLAMP(j+1)));
+                __m256i condEF;
+                vOut = _mm256_or_si256(
+                        _mm256_or_si256(
+                            _mm256_cmpgt_epi32(v2K, _mm256_set1_epi32(CLAMP(j-i-lo))),
+                            _mm256_cmplt_epi32_rpl(v2K, _mm256_set1_epi32(CLAMP(j-i-hi)))),
+                        _mm256_or_si256(
+                            _mm256_or_si256(
+                                _mm256_cmplt_epi32_rpl(vK, _mm256_set1_epi32(CLAMP(j-s2Len+1))),
+                                _mm256_cmpgt_epi32(vK, _mm256_set1_epi32(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = _mm256_or_si256(cond, vOut);
+                vWH = _mm256_blendv_epi8(vWH, _mm256_set1_epi32(MAX(-open - (i+j+1)*gap, NEG_INF)), cond);
+                vWH = _mm256_blendv_epi8(vWH, vNegInf, vOut);
+                vE = _mm256_blendv_epi8(vE, vNegInf, condEF);
+                vF = _mm256_blendv_epi8(vF, vNegInf, condEF);
+            }
+            
+            H_pr[j-7] = (int32_t)_mm256_extract_epi32_rpl(vWH,0);
+            F_pr[j-7] = (int32_t)_mm256_extract_epi32_rpl(vF,0);
+            /* the last cell of the table is in the last stripe */
+            if (kLast <= PAD && j == s2Len-1+kLast) {
+                int32_t lanes[8];
+                memcpy(lanes, &vWH, sizeof(lanes));
+                score = lanes[PAD-kLast];
+            }
+        }
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_8;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
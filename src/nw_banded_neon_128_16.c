@@ -0,0 +1,222 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF INT16_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+
+
+#define FNAME parasail_nw_banded_neon_128_16
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const int32_t lo = MIN(0, s2Len-s1Len) - k;
+    const int32_t hi = MAX(0, s2Len-s1Len) + k;
+    int16_t * const restrict s1 = parasail_memalign_int16_t(16, s1Len+PAD);
+    int16_t * const restrict s2B= parasail_memalign_int16_t(16, s2Len+PAD2);
+    int16_t * const restrict _H_pr = parasail_memalign_int16_t(16, s2Len+PAD2);
+    int16_t * const restrict _F_pr = parasail_memalign_int16_t(16, s2Len+PAD2);
+    int16_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int16_t * const restrict H_pr = _H_pr+PAD;
+    int16_t * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new();
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int16_t score = NEG_INF;
+    simde__m128i vNegInf = simde_mm_set1_epi16(NEG_INF);
+    simde__m128i vOpen = simde_mm_set1_epi16(open);
+    simde__m128i vGap  = simde_mm_set1_epi16(gap);
+    simde__m128i vZero = simde_mm_set1_epi16(0);
+    simde__m128i vK = simde_mm_set_epi16(0,1,2,3,4,5,6,7);
+    simde__m128i v2K = simde_mm_adds_epi16(vK, vK);
+    simde__m128i vNegLimit = simde_mm_set1_epi16(INT16_MIN);
+    simde__m128i vPosLimit = simde_mm_set1_epi16(INT16_MAX);
+    simde__m128i vSaturationCheckMin = vPosLimit;
+    simde__m128i vSaturationCheckMax = vNegLimit;
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? MAX(-open - j*gap, NEG_INF) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const int32_t jbeg = MAX(0, i+lo);
+        const int32_t jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const int32_t kLast = s1Len-1-i;
+        simde__m128i vNH = vNegInf;
+        simde__m128i vWH = vNegInf;
+        simde__m128i vE = vNegInf;
+        simde__m128i vF = vNegInf;
+        simde__m128i vRowOut = simde_mm_cmpgt_epi16(vK, simde_mm_set1_epi16(CLAMP(kLast)));
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        vNH = simde_mm_insert_epi16(vNH, H_pr[jbeg-1], 7);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = simde_mm_insert_epi16(vWH, MAX(-open - i*gap, NEG_INF), 7);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            simde__m128i vMat;
+            simde__m128i vNWH = vNH;
+            simde__m128i vOut = vZero;
+            vNH = simde_mm_srli_si128(vWH, 2);
+            vNH = simde_mm_insert_epi16(vNH, H_pr[j], 7);
+            vF = simde_mm_srli_si128(vF, 2);
+            vF = simde_mm_insert_epi16(vF, F_pr[j], 7);
+            vF = simde_mm_max_epi16(
+                    simde_mm_subs_epi16(vNH, vOpen),
+                    simde_mm_subs_epi16(vF, vGap));
+            vE = simde_mm_max_epi16(
+                    simde_mm_subs_epi16(vWH, vOpen),
+                    simde_mm_subs_epi16(vE, vGap));
+            vMat = simde_mm_set_epi16(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]]
+                    );
+            vNWH = simde_mm_adds_epi16(vNWH, vMat);
+            vWH = simde_mm_max_epi16(vNWH, vE);
+            vWH = simde_mm_max_epi16(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                simde__m128i cond = simde_mm_cmpeq_epi16(vK, simde_mm_set1_epi16(CLAMP(j+1)));
+                simde__m128i condEF;
+                vOut = simde_mm_or_si128(
+                        simde_mm_or_si128(
+                            simde_mm_cmpgt_epi16(v2K, simde_mm_set1_epi16(CLAMP(j-i-lo))),
+                            simde_mm_cmplt_epi16(v2K, simde_mm_set1_epi16(CLAMP(j-i-hi)))),
+                        simde_mm_or_si128(
+                            simde_mm_or_si128(
+                                simde_mm_cmplt_epi16(vK, simde_mm_set1_epi16(CLAMP(j-s2Len+1))),
+                                simde_mm_cmpgt_epi16(vK, simde_mm_set1_epi16(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = simde_mm_or_si128(cond, vOut);
+                vWH = simde_mm_blendv_epi8(vWH, simde_mm_set1_epi16(MAX(-open - (i+j+1)*gap, NEG_INF)), cond);
+                vWH = simde_mm_blendv_epi8(vWH, vNegInf, vOut);
+                vE = simde_mm_blendv_epi8(vE, vNegInf, condEF);
+                vF = simde_mm_blendv_epi8(vF, vNegInf, condEF);
+            }
+            /* check for saturation */
+            {
+                vSaturationCheckMax = simde_mm_max_epi16(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = simde_mm_blendv_epi8(
+                        simde_mm_min_epi16(vSaturationCheckMin, vWH),
+                        vSaturationCheckMin, vOut);
+            }
+            H_pr[j-7] = (int16_t)simde_mm_extract_epi16(vWH,0);
+            F_pr[j-7] = (int16_t)simde_mm_extract_epi16(vF,0);
+            /* the last cell of the table is in the last stripe */
+            if (kLast <= PAD && j == s2Len-1+kLast) {
+                int16_t lanes[8];
+                memcpy(lanes, &vWH, sizeof(lanes));
+                score = lanes[PAD-kLast];
+            }
+        }
+    }
+
+    if (simde_mm_movemask_epi8(simde_mm_or_si128(
+            simde_mm_cmpeq_epi16(vSaturationCheckMin, vNegLimit),
+            simde_mm_cmpeq_epi16(vSaturationCheckMax, vPosLimit)))
+            || -open - (int64_t)MAX(MIN(hi,s2Len),MIN(-lo,s1Len))*gap
+                <= INT16_MIN) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
@@ -0,0 +1,518 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT16_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#if HAVE_AVX2_MM256_INSERT_EPI16
+#define _mm256_insert_epi16_rpl _mm256_insert_epi16
+#else
+static inline __m256i _mm256_insert_epi16_rpl(__m256i a, int16_t i, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI16
+#define _mm256_extract_epi16_rpl _mm256_extract_epi16
+#else
+static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
+    __m256i_16_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store(
+        int *array,
+        __m256i vH,
+        int32_t r,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    int16_t values[16];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<16 && r+lane<s1Len; ++lane) {
+        array[1LL*(r+lane)*s2Len + j] = values[lane];
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        __m256i vH,
+        int32_t r,
+        int32_t s1Len)
+{
+    int16_t values[16];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<16 && r+lane<s1Len; ++lane) {
+        col[r+lane] = values[lane];
+    }
+}
+#endif
+
+/* a block of query rows, lane k of vector v holds row r0+v*N+k; its H
+ * and E columns and the corner above them carry the block from one
+ * tile of database columns to the next */
+typedef struct block {
+    __m256i *vProfile;
+    __m256i *pvH;
+    __m256i *pvE;
+    int32_t r0;
+    int32_t V;
+    int16_t H_corner;
+    int score;
+    __m256i vSaturationCheckMin;
+    __m256i vSaturationCheckMax;
+} block_t;
+
+static void block_init(
+        block_t * const restrict blk,
+        const int16_t * const restrict s1,
+        const int s1Len,
+        const int32_t r0, const int32_t V,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    int32_t i = 0;
+    int32_t k = 0;
+    int32_t v = 0;
+
+    blk->r0 = r0;
+    blk->V = V;
+    blk->H_corner = 0 == r0 ? 0 : MAX(-open-(int64_t)gap*(r0-1), NEG_INF);
+    blk->score = NEG_INF;
+    blk->vSaturationCheckMin = _mm256_set1_epi16(INT16_MAX);
+    blk->vSaturationCheckMax = _mm256_set1_epi16(INT16_MIN);
+
+    /* block profile, padded rows score 0 */
+    for (k=0; k<n; ++k) {
+        for (v=0; v<V; ++v) {
+            int16_t t[16];
+            for (i=0; i<N; ++i) {
+                const int32_t r = r0+v*N+i;
+                t[i] = r >= s1Len ? 0 : matrix->matrix[n*k+s1[r]];
+            }
+            memcpy(&blk->vProfile[k*V+v], t, sizeof(t));
+        }
+    }
+
+    /* the column left of the block */
+    for (v=0; v<V; ++v) {
+        int16_t h[16];
+        int16_t e[16];
+        for (i=0; i<N; ++i) {
+            int64_t tmp = -open-(int64_t)gap*(r0+v*N+i);
+            h[i] = tmp < NEG_INF ? NEG_INF : tmp;
+            tmp = tmp - open;
+            e[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+        memcpy(&blk->pvH[v], h, sizeof(h));
+        memcpy(&blk->pvE[v], e, sizeof(e));
+    }
+}
+
+/* database columns [j0,j1) of a block, Hrow and Frow hold the last row
+ * of the block above on entry and the last row of this block on exit */
+static void block_tile(
+        block_t * const restrict blk,
+        const int16_t * const restrict s2,
+        const int32_t j0, const int32_t j1,
+        int16_t * const restrict Hrow,
+        int16_t * const restrict Frow,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        parasail_result_t * const restrict result)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t r0 = blk->r0;
+    const int32_t V = blk->V;
+    const __m256i * const restrict vProfile = blk->vProfile;
+    __m256i * const restrict pvH = blk->pvH;
+    __m256i * const restrict pvE = blk->pvE;
+    int32_t j = 0;
+    int32_t v = 0;
+    int16_t H_corner = blk->H_corner;
+    int score = blk->score;
+    __m256i vOpen = _mm256_set1_epi16(open);
+    __m256i vGap  = _mm256_set1_epi16(gap);
+    __m256i vFDecay1 = _mm256_set_epi16(-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,NEG_INF);
+    __m256i vFDecay2 = _mm256_set_epi16(-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,NEG_INF,NEG_INF);
+    __m256i vFDecay4 = _mm256_set_epi16(-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,-4*gap,NEG_INF,NEG_INF,NEG_INF,NEG_INF);
+    __m256i vFDecay8 = _mm256_set_epi16(-8*gap,-8*gap,-8*gap,-8*gap,-8*gap,-8*gap,-8*gap,-8*gap,NEG_INF,NEG_INF,NEG_INF,NEG_INF,NEG_INF,NEG_INF,NEG_INF,NEG_INF);
+    __m256i vSaturationCheckMin = blk->vSaturationCheckMin;
+    __m256i vSaturationCheckMax = blk->vSaturationCheckMax;
+    __m256i vNoPad = _mm256_setzero_si256();
+    __m256i vPad = _mm256_cmpgt_epi16(
+            _mm256_set_epi16(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0),
+            _mm256_set1_epi16((s1Len-1)%N));
+
+    for (j=j0; j<j1; ++j) {
+        const __m256i *pvP = vProfile + s2[j]*V;
+        const int16_t H_next = Hrow[j];
+        int16_t cD = H_corner;
+        int16_t cF = Frow[j];
+        __m256i vH = _mm256_setzero_si256();
+        for (v=0; v<V; ++v) {
+            __m256i vHp = _mm256_load_si256(pvH+v);
+            __m256i vE = _mm256_load_si256(pvE+v);
+            __m256i vHo;
+            __m256i vF;
+            /* lane k takes its diagonal from lane k-1, lane 0 from
+             * the last lane of the previous vector */
+            vH = _mm256_insert_epi16_rpl(_mm256_slli_si256_rpl(vHp, 2), cD, 0);
+            cD = (int16_t)_mm256_extract_epi16_rpl(vHp, 15);
+            vH = _mm256_adds_epi16(vH, _mm256_load_si256(pvP+v));
+            vH = _mm256_max_epi16(vH, vE);
+            /* F opens from the row above and extends down the
+             * lanes, resolved exactly by a prefix scan */
+            vHo = _mm256_subs_epi16(vH, vOpen);
+            vF = _mm256_insert_epi16_rpl(_mm256_slli_si256_rpl(vHo, 2), cF, 0);
+            vF = _mm256_max_epi16(vF, _mm256_adds_epi16(_mm256_slli_si256_rpl(vF, 2), vFDecay1));
+                vF = _mm256_max_epi16(vF, _mm256_adds_epi16(_mm256_slli_si256_rpl(vF, 4), vFDecay2));
+                vF = _mm256_max_epi16(vF, _mm256_adds_epi16(_mm256_slli_si256_rpl(vF, 8), vFDecay4));
+                vF = _mm256_max_epi16(vF, _mm256_adds_epi16(_mm256_slli_si256_rpl(vF, 16), vFDecay8));
+            vH = _mm256_max_epi16(vH, vF);
+            vHo = _mm256_subs_epi16(vH, vOpen);
+            cF = (int16_t)_mm256_extract_epi16_rpl(
+                    _mm256_max_epi16(vHo, _mm256_subs_epi16(vF, vGap)), 15);
+            /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_blendv_epi8(
+                        _mm256_min_epi16(vSaturationCheckMin, vH),
+                        vSaturationCheckMin,
+                        r0+(v+1)*N > s1Len ? vPad : vNoPad);
+            }
+            _mm256_store_si256(pvH+v, vH);
+            _mm256_store_si256(pvE+v, _mm256_max_epi16(vHo, _mm256_subs_epi16(vE, vGap)));
+#ifdef PARASAIL_TABLE
+            arr_store(result->tables->score_table, vH, r0+v*N, s1Len, j, s2Len);
+#endif
+        }
+        /* the last lane of the last vector is the row above the
+         * next block */
+        Hrow[j] = (int16_t)_mm256_extract_epi16_rpl(vH, 15);
+        Frow[j] = cF;
+        H_corner = H_next;
+#ifdef PARASAIL_ROWCOL
+        /* the last row of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            int16_t values[16];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            result->rowcols->score_row[j] = values[(s1Len-1)%N];
+        }
+#endif
+    }
+    if (j1 == s2Len) {
+        /* the last cell of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            int16_t values[16];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            score = values[(s1Len-1)%N];
+        }
+#ifdef PARASAIL_ROWCOL
+        for (v=0; v<V; ++v) {
+            arr_store_col(result->rowcols->score_col, pvH[v], r0+v*N, s1Len);
+        }
+#endif
+    }
+
+    blk->H_corner = H_corner;
+    blk->score = score;
+    blk->vSaturationCheckMin = vSaturationCheckMin;
+    blk->vSaturationCheckMax = vSaturationCheckMax;
+}
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_blocked_avx2_256_16
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_blocked_avx2_256_16
+#define WNAME parasail_nw_rowcol_wavefront_avx2_256_16
+#else
+#define FNAME parasail_nw_blocked_avx2_256_16
+#define WNAME parasail_nw_wavefront_avx2_256_16
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+    /* each block of query rows keeps its profile and its H and E
+     * columns within the cache budget */
+    const int32_t blockLen = MIN(segLen,
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(__m256i))));
+    int16_t * const restrict s1 = parasail_memalign_int16_t(32, s1Len);
+    int16_t * const restrict s2 = parasail_memalign_int16_t(32, s2Len);
+    int16_t * const restrict Hrow = parasail_memalign_int16_t(32, s2Len);
+    int16_t * const restrict Frow = parasail_memalign_int16_t(32, s2Len);
+    block_t block;
+    block_t * const restrict blk = &block;
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t r0 = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi16(INT16_MIN);
+    __m256i vPosLimit = _mm256_set1_epi16(INT16_MAX);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    blk->vProfile = parasail_memalign(32, sizeof(__m256i)*n*blockLen);
+    blk->pvH = parasail_memalign(32, sizeof(__m256i)*blockLen);
+    blk->pvE = parasail_memalign(32, sizeof(__m256i)*blockLen);
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+    /* iterate over blocks of query rows, each over the whole database
+     * sequence */
+    for (r0=0; r0<s1Len; r0+=blockLen*N) {
+        block_init(blk, s1, s1Len, r0, MIN(blockLen, segLen - r0/N),
+                open, gap, matrix);
+        block_tile(blk, s2, 0, s2Len, Hrow, Frow, s1Len, s2Len,
+                open, gap, result);
+        /* the last block leaves the last cell of the table */
+        score = blk->score;
+        vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, blk->vSaturationCheckMin);
+        vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, blk->vSaturationCheckMax);
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi16(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi16(vSaturationCheckMax, vPosLimit)))
+            || -open - (int64_t)MAX(s1Len,s2Len)*gap <= INT16_MIN) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blk->pvE);
+    parasail_free(blk->pvH);
+    parasail_free(blk->vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+#ifdef WNAME
+parasail_result_t* WNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+#ifdef _OPENMP
+    /* called from within a parallel region the wavefront runs on the
+     * calling thread alone */
+    const int32_t threads = omp_in_parallel() ? 1 : omp_get_max_threads();
+#else
+    const int32_t threads = 1;
+#endif
+    /* at least one block of query rows per thread, none larger than
+     * the cache budget */
+    const int32_t blockLen = MIN(MIN(segLen, (segLen + threads - 1) / threads),
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(__m256i))));
+    const int32_t nblocks = (segLen + blockLen - 1) / blockLen;
+    /* a few tiles of database columns per thread keep the wavefront
+     * full without paying a barrier for every few columns */
+    const int32_t tileLen = MAX(PARASAIL_WAVEFRONT_TILE,
+            (s2Len + 4*threads - 1) / (4*threads));
+    const int32_t ntiles = (s2Len + tileLen - 1) / tileLen;
+    int16_t * const restrict s1 = parasail_memalign_int16_t(32, s1Len);
+    int16_t * const restrict s2 = parasail_memalign_int16_t(32, s2Len);
+    int16_t * const restrict Hrow = parasail_memalign_int16_t(32, s2Len);
+    int16_t * const restrict Frow = parasail_memalign_int16_t(32, s2Len);
+    __m256i * const restrict vProfile = parasail_memalign(32, sizeof(__m256i)*n*blockLen*nblocks);
+    __m256i * const restrict pvH = parasail_memalign(32, sizeof(__m256i)*blockLen*nblocks);
+    __m256i * const restrict pvE = parasail_memalign(32, sizeof(__m256i)*blockLen*nblocks);
+    block_t * const restrict blocks = parasail_memalign(32, sizeof(block_t)*nblocks);
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t b = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi16(INT16_MIN);
+    __m256i vPosLimit = _mm256_set1_epi16(INT16_MAX);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+    {
+        int32_t d = 0;
+        int32_t t = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (t=0; t<nblocks; ++t) {
+            blocks[t].vProfile = vProfile + n*blockLen*t;
+            blocks[t].pvH = pvH + blockLen*t;
+            blocks[t].pvE = pvE + blockLen*t;
+            block_init(&blocks[t], s1, s1Len, t*blockLen*N,
+                    MIN(blockLen, segLen - t*blockLen), open, gap, matrix);
+        }
+
+        /* tile (t,c) needs (t-1,c) for the row above it and (t,c-1)
+         * for the columns left of it, so the tiles of an anti-diagonal
+         * run together and the barrier closing each one orders them */
+        for (d=0; d<nblocks+ntiles-1; ++d) {
+            const int32_t first = MAX(0, d-ntiles+1);
+            const int32_t last = MIN(d, nblocks-1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+            for (t=first; t<=last; ++t) {
+                const int32_t j0 = (d-t)*tileLen;
+                block_tile(&blocks[t], s2, j0, MIN(j0+tileLen, s2Len),
+                        Hrow, Frow, s1Len, s2Len, open, gap, result);
+            }
+        }
+    }
+
+    for (b=0; b<nblocks; ++b) {
+        const block_t * const restrict blk = &blocks[b];
+        /* the last cell of the table is in the last block */
+        if (b == nblocks-1) {
+            score = blk->score;
+        }
+        vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, blk->vSaturationCheckMin);
+        vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, blk->vSaturationCheckMax);
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi16(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi16(vSaturationCheckMax, vPosLimit)))
+            || -open - (int64_t)MAX(s1Len,s2Len)*gap <= INT16_MIN) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blocks);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+#endif
+
@@ -0,0 +1,447 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store(
+        int *array,
+        simde__m128i vH,
+        int32_t r,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    int32_t values[4];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<4 && r+lane<s1Len; ++lane) {
+        array[1LL*(r+lane)*s2Len + j] = values[lane];
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        simde__m128i vH,
+        int32_t r,
+        int32_t s1Len)
+{
+    int32_t values[4];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<4 && r+lane<s1Len; ++lane) {
+        col[r+lane] = values[lane];
+    }
+}
+#endif
+
+/* a block of query rows, lane k of vector v holds row r0+v*N+k; its H
+ * and E columns and the corner above them carry the block from one
+ * tile of database columns to the next */
+typedef struct block {
+    simde__m128i *vProfile;
+    simde__m128i *pvH;
+    simde__m128i *pvE;
+    int32_t r0;
+    int32_t V;
+    int32_t H_corner;
+    int score;
+} block_t;
+
+static void block_init(
+        block_t * const restrict blk,
+        const int32_t * const restrict s1,
+        const int s1Len,
+        const int32_t r0, const int32_t V,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 4; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    int32_t i = 0;
+    int32_t k = 0;
+    int32_t v = 0;
+
+    blk->r0 = r0;
+    blk->V = V;
+    blk->H_corner = 0 == r0 ? 0 : MAX(-open-(int64_t)gap*(r0-1), NEG_INF);
+    blk->score = NEG_INF;
+
+    /* block profile, padded rows score 0 */
+    for (k=0; k<n; ++k) {
+        for (v=0; v<V; ++v) {
+            int32_t t[4];
+            for (i=0; i<N; ++i) {
+                const int32_t r = r0+v*N+i;
+                t[i] = r >= s1Len ? 0 : matrix->matrix[n*k+s1[r]];
+            }
+            memcpy(&blk->vProfile[k*V+v], t, sizeof(t));
+        }
+    }
+
+    /* the column left of the block */
+    for (v=0; v<V; ++v) {
+        int32_t h[4];
+        int32_t e[4];
+        for (i=0; i<N; ++i) {
+            int64_t tmp = -open-(int64_t)gap*(r0+v*N+i);
+            h[i] = tmp < NEG_INF ? NEG_INF : tmp;
+            tmp = tmp - open;
+            e[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+        memcpy(&blk->pvH[v], h, sizeof(h));
+        memcpy(&blk->pvE[v], e, sizeof(e));
+    }
+}
+
+/* database columns [j0,j1) of a block, Hrow and Frow hold the last row
+ * of the block above on entry and the last row of this block on exit */
+static void block_tile(
+        block_t * const restrict blk,
+        const int32_t * const restrict s2,
+        const int32_t j0, const int32_t j1,
+        int32_t * const restrict Hrow,
+        int32_t * const restrict Frow,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        parasail_result_t * const restrict result)
+{
+    const int32_t N = 4; /* number of values in vector */
+    const int32_t r0 = blk->r0;
+    const int32_t V = blk->V;
+    const simde__m128i * const restrict vProfile = blk->vProfile;
+    simde__m128i * const restrict pvH = blk->pvH;
+    simde__m128i * const restrict pvE = blk->pvE;
+    int32_t j = 0;
+    int32_t v = 0;
+    int32_t H_corner = blk->H_corner;
+    int score = blk->score;
+    simde__m128i vOpen = simde_mm_set1_epi32(open);
+    simde__m128i vGap  = simde_mm_set1_epi32(gap);
+    simde__m128i vFDecay1 = simde_mm_set_epi32(-1*gap,-1*gap,-1*gap,NEG_INF);
+    simde__m128i vFDecay2 = simde_mm_set_epi32(-2*gap,-2*gap,NEG_INF,NEG_INF);
+    
+
+    for (j=j0; j<j1; ++j) {
+        const simde__m128i *pvP = vProfile + s2[j]*V;
+        const int32_t H_next = Hrow[j];
+        int32_t cD = H_corner;
+        int32_t cF = Frow[j];
+        simde__m128i vH = simde_mm_setzero_si128();
+        for (v=0; v<V; ++v) {
+            simde__m128i vHp = simde_mm_load_si128(pvH+v);
+            simde__m128i vE = simde_mm_load_si128(pvE+v);
+            simde__m128i vHo;
+            simde__m128i vF;
+            /* lane k takes its diagonal from lane k-1, lane 0 from
+             * the last lane of the previous vector */
+            vH = simde_mm_insert_epi32(simde_mm_slli_si128(vHp, 4), cD, 0);
+            cD = (int32_t)simde_mm_extract_epi32(vHp, 3);
+            vH = simde_mm_add_epi32(vH, simde_mm_load_si128(pvP+v));
+            vH = simde_mm_max_epi32(vH, vE);
+            /* F opens from the row above and extends down the
+             * lanes, resolved exactly by a prefix scan */
+            vHo = simde_mm_sub_epi32(vH, vOpen);
+            vF = simde_mm_insert_epi32(simde_mm_slli_si128(vHo, 4), cF, 0);
+            vF = simde_mm_max_epi32(vF, simde_mm_add_epi32(simde_mm_slli_si128(vF, 4), vFDecay1));
+                vF = simde_mm_max_epi32(vF, simde_mm_add_epi32(simde_mm_slli_si128(vF, 8), vFDecay2));
+            vH = simde_mm_max_epi32(vH, vF);
+            vHo = simde_mm_sub_epi32(vH, vOpen);
+            cF = (int32_t)simde_mm_extract_epi32(
+                    simde_mm_max_epi32(vHo, simde_mm_sub_epi32(vF, vGap)), 3);
+            
+            simde_mm_store_si128(pvH+v, vH);
+            simde_mm_store_si128(pvE+v, simde_mm_max_epi32(vHo, simde_mm_sub_epi32(vE, vGap)));
+#ifdef PARASAIL_TABLE
+            arr_store(result->tables->score_table, vH, r0+v*N, s1Len, j, s2Len);
+#endif
+        }
+        /* the last lane of the last vector is the row above the
+         * next block */
+        Hrow[j] = (int32_t)simde_mm_extract_epi32(vH, 3);
+        Frow[j] = cF;
+        H_corner = H_next;
+#ifdef PARASAIL_ROWCOL
+        /* the last row of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            int32_t values[4];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            result->rowcols->score_row[j] = values[(s1Len-1)%N];
+        }
+#endif
+    }
+    if (j1 == s2Len) {
+        /* the last cell of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            int32_t values[4];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            score = values[(s1Len-1)%N];
+        }
+#ifdef PARASAIL_ROWCOL
+        for (v=0; v<V; ++v) {
+            arr_store_col(result->rowcols->score_col, pvH[v], r0+v*N, s1Len);
+        }
+#endif
+    }
+
+    blk->H_corner = H_corner;
+    blk->score = score;
+}
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_nw_table_blocked_neon_128_32
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_nw_rowcol_blocked_neon_128_32
+#define WNAME parasail_nw_rowcol_wavefront_neon_128_32
+#else
+#define FNAME parasail_nw_blocked_neon_128_32
+#define WNAME parasail_nw_wavefront_neon_128_32
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 4; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+    /* each block of query rows keeps its profile and its H and E
+     * columns within the cache budget */
+    const int32_t blockLen = MIN(segLen,
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(simde__m128i))));
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len);
+    int32_t * const restrict s2 = parasail_memalign_int32_t(16, s2Len);
+    int32_t * const restrict Hrow = parasail_memalign_int32_t(16, s2Len);
+    int32_t * const restrict Frow = parasail_memalign_int32_t(16, s2Len);
+    block_t block;
+    block_t * const restrict blk = &block;
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t r0 = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int score = NEG_INF;
+    
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    blk->vProfile = parasail_memalign(16, sizeof(simde__m128i)*n*blockLen);
+    blk->pvH = parasail_memalign(16, sizeof(simde__m128i)*blockLen);
+    blk->pvE = parasail_memalign(16, sizeof(simde__m128i)*blockLen);
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+    /* iterate over blocks of query rows, each over the whole database
+     * sequence */
+    for (r0=0; r0<s1Len; r0+=blockLen*N) {
+        block_init(blk, s1, s1Len, r0, MIN(blockLen, segLen - r0/N),
+                open, gap, matrix);
+        block_tile(blk, s2, 0, s2Len, Hrow, Frow, s1Len, s2Len,
+                open, gap, result);
+        /* the last block leaves the last cell of the table */
+        score = blk->score;
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blk->pvE);
+    parasail_free(blk->pvH);
+    parasail_free(blk->vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+#ifdef WNAME
+parasail_result_t* WNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 4; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+#ifdef _OPENMP
+    /* called from within a parallel region the wavefront runs on the
+     * calling thread alone */
+    const int32_t threads = omp_in_parallel() ? 1 : omp_get_max_threads();
+#else
+    const int32_t threads = 1;
+#endif
+    /* at least one block of query rows per thread, none larger than
+     * the cache budget */
+    const int32_t blockLen = MIN(MIN(segLen, (segLen + threads - 1) / threads),
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(simde__m128i))));
+    const int32_t nblocks = (segLen + blockLen - 1) / blockLen;
+    /* a few tiles of database columns per thread keep the wavefront
+     * full without paying a barrier for every few columns */
+    const int32_t tileLen = MAX(PARASAIL_WAVEFRONT_TILE,
+            (s2Len + 4*threads - 1) / (4*threads));
+    const int32_t ntiles = (s2Len + tileLen - 1) / tileLen;
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len);
+    int32_t * const restrict s2 = parasail_memalign_int32_t(16, s2Len);
+    int32_t * const restrict Hrow = parasail_memalign_int32_t(16, s2Len);
+    int32_t * const restrict Frow = parasail_memalign_int32_t(16, s2Len);
+    simde__m128i * const restrict vProfile = parasail_memalign(16, sizeof(simde__m128i)*n*blockLen*nblocks);
+    simde__m128i * const restrict pvH = parasail_memalign(16, sizeof(simde__m128i)*blockLen*nblocks);
+    simde__m128i * const restrict pvE = parasail_memalign(16, sizeof(simde__m128i)*blockLen*nblocks);
+    block_t * const restrict blocks = parasail_memalign(16, sizeof(block_t)*nblocks);
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t b = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int score = NEG_INF;
+    
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+    {
+        int32_t d = 0;
+        int32_t t = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (t=0; t<nblocks; ++t) {
+            blocks[t].vProfile = vProfile + n*blockLen*t;
+            blocks[t].pvH = pvH + blockLen*t;
+            blocks[t].pvE = pvE + blockLen*t;
+            block_init(&blocks[t], s1, s1Len, t*blockLen*N,
+                    MIN(blockLen, segLen - t*blockLen), open, gap, matrix);
+        }
+
+        /* tile (t,c) needs (t-1,c) for the row above it and (t,c-1)
+         * for the columns left of it, so the tiles of an anti-diagonal
+         * run together and the barrier closing each one orders them */
+        for (d=0; d<nblocks+ntiles-1; ++d) {
+            const int32_t first = MAX(0, d-ntiles+1);
+            const int32_t last = MIN(d, nblocks-1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+            for (t=first; t<=last; ++t) {
+                const int32_t j0 = (d-t)*tileLen;
+                block_tile(&blocks[t], s2, j0, MIN(j0+tileLen, s2Len),
+                        Hrow, Frow, s1Len, s2Len, open, gap, result);
+            }
+        }
+    }
+
+    for (b=0; b<nblocks; ++b) {
+        const block_t * const restrict blk = &blocks[b];
+        /* the last cell of the table is in the last block */
+        if (b == nblocks-1) {
+            score = blk->score;
+        }
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blocks);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+#endif
+
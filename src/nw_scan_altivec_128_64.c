@@ -54,6 +54,9 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_scan_altivec_128_64
 #define PNAME parasail_nw_scan_profile_altivec_128_64
+#define WNAME parasail_nw_scan_profile_altivec_128_64_ws
+#define ENAME parasail_nw_scan_profile_altivec_128_64_enc
+#define CNAME parasail_nw_scan_profile_altivec_128_64_core
 #endif
 #endif
 
@@ -68,10 +71,62 @@ parasail_result_t* FNAME(
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -85,11 +140,21 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict pvP = (vec128i*)profile->profile64.score;
+#ifdef WNAME
+    vec128i* const pvWork = (vec128i*)parasail_workspace_reserve(
+            workspace, sizeof(vec128i)*4*segLen + sizeof(int64_t)*(s2Len+1));
+    vec128i* const restrict pvE = pvWork;
+    vec128i* const restrict pvHt = pvWork + segLen;
+    vec128i* const restrict pvH = pvWork + 2*segLen;
+    vec128i* const restrict pvGapper = pvWork + 3*segLen;
+    int64_t* const restrict boundary = (int64_t*)(pvWork + 4*segLen);
+#else
     vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
     int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
     vec128i* const restrict pvHt= parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvH = parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvGapper = parasail_memalign_vec128i(16, segLen);
+#endif
     vec128i vGapO = _mm_set1_epi64(open);
     vec128i vGapE = _mm_set1_epi64(gap);
     const int64_t NEG_LIMIT = (-open < matrix->min ?
@@ -108,9 +173,11 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     vNegInfFront = _mm_insert_epi64(vNegInfFront, NEG_LIMIT, 0);
@@ -169,7 +236,13 @@ parasail_result_t* PNAME(
         vHp = _mm_load_si128(pvH+(segLen-1));
         vHp = _mm_slli_si128(vHp, 8);
         vHp = _mm_insert_epi64(vHp, boundary[j], 0);
+#ifdef WNAME
+        pvW = pvP + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j))*segLen;
+#else
         pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+#endif
         vHt = _mm_sub_epi64(vNegLimit, pvGapper[0]);
         vF = vNegLimit;
         for (i=0; i<segLen; ++i) {
@@ -265,11 +338,13 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
     parasail_free(pvE);
+#endif
 
     return result;
 }
@@ -107,6 +107,9 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_scan_avx2_256_16
 #define PNAME parasail_nw_scan_profile_avx2_256_16
+#define WNAME parasail_nw_scan_profile_avx2_256_16_ws
+#define ENAME parasail_nw_scan_profile_avx2_256_16_enc
+#define CNAME parasail_nw_scan_profile_avx2_256_16_core
 #endif
 #endif
 
@@ -121,10 +124,62 @@ parasail_result_t* FNAME(
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -138,11 +193,21 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict pvP = (__m256i*)profile->profile16.score;
+#ifdef WNAME
+    __m256i* const pvWork = (__m256i*)parasail_workspace_reserve(
+            workspace, sizeof(__m256i)*4*segLen + sizeof(int16_t)*(s2Len+1));
+    __m256i* const restrict pvE = pvWork;
+    __m256i* const restrict pvHt = pvWork + segLen;
+    __m256i* const restrict pvH = pvWork + 2*segLen;
+    __m256i* const restrict pvGapper = pvWork + 3*segLen;
+    int16_t* const restrict boundary = (int16_t*)(pvWork + 4*segLen);
+#else
     __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
     int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
     __m256i* const restrict pvHt= parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvH = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvGapper = parasail_memalign___m256i(32, segLen);
+#endif
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -161,9 +226,11 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     vNegInfFront = _mm256_insert_epi16_rpl(vNegInfFront, NEG_LIMIT, 0);
@@ -222,7 +289,13 @@ parasail_result_t* PNAME(
         vHp = _mm256_load_si256(pvH+(segLen-1));
         vHp = _mm256_slli_si256_rpl(vHp, 2);
         vHp = _mm256_insert_epi16_rpl(vHp, boundary[j], 0);
+#ifdef WNAME
+        pvW = pvP + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j))*segLen;
+#else
         pvW = pvP + matrix->mapper[(unsigned char)s2[j]]*segLen;
+#endif
         vHt = _mm256_sub_epi16(vNegLimit, pvGapper[0]);
         vF = vNegLimit;
         for (i=0; i<segLen; ++i) {
@@ -318,11 +391,13 @@ parasail_result_t* PNAME(
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvGapper);
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
     parasail_free(pvE);
+#endif
 
     return result;
 }
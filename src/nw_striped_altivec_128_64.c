@@ -55,24 +55,323 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_altivec_128_64
 #define PNAME parasail_nw_striped_profile_altivec_128_64
+#define WNAME parasail_nw_striped_profile_altivec_128_64_ws
+#define ENAME parasail_nw_striped_profile_altivec_128_64_enc
+#define CNAME parasail_nw_striped_profile_altivec_128_64_core
 #endif
 #endif
 
+/* Match and mismatch scores need no query profile: the codes of the
+ * query residues, striped like the profile, are compared to the code of
+ * each database residue and the compare selects the score. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t segWidth = 2; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const int32_t last_lane = (s1Len - 1) / segLen;
+    const int32_t tail = (s1Len - 1) % segLen + 1;
+    vec128i* const restrict pvQuery = parasail_memalign_vec128i(16, segLen+4);
+    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
+    vec128i vGapO = _mm_set1_epi64(open);
+    vec128i vGapE = _mm_set1_epi64(gap);
+    vec128i vNegInf = _mm_set1_epi64(NEG_INF);
+    vec128i vMatch;
+    vec128i vMismatch;
+    vec128i vMatchHead;
+    vec128i vMismatchHead;
+    vec128i vMatchTail;
+    vec128i vMismatchTail;
+    int64_t score = NEG_INF;
+    
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        int64_t *q = (int64_t*)pvQuery;
+        int64_t *lane = (int64_t*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (int64_t)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = _mm_load_si128(pvQuery + segLen);
+        vMismatchHead = _mm_load_si128(pvQuery + segLen + 1);
+        vMatchTail = _mm_load_si128(pvQuery + segLen + 2);
+        vMismatchTail = _mm_load_si128(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            vec128i_64_t h;
+            vec128i_64_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT64_MIN ? INT64_MIN : tmp;
+            }
+            _mm_store_si128(&pvHStore[index], h.m);
+            _mm_store_si128(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT64_MIN ? INT64_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        vec128i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        vec128i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 8);
+
+        /* code of the database residue in every lane */
+        const vec128i vCode = _mm_set1_epi64(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        vec128i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = _mm_insert_epi64(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = _mm_add_epi64(vH, _mm_blendv_epi8(vMismatch, vMatch,
+                        _mm_cmpeq_epi64(_mm_load_si128(pvQuery + i), vCode)));
+            vE = _mm_load_si128(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm_max_epi64(vH, vE);
+            vH = _mm_max_epi64(vH, vF);
+            /* Save vH values. */
+            _mm_store_si128(pvHStore + i, vH);
+            
+#ifdef PARASAIL_TABLE
+            arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm_sub_epi64(vH, vGapO);
+            vE = _mm_sub_epi64(vE, vGapE);
+            vE = _mm_max_epi64(vE, vH);
+            _mm_store_si128(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm_sub_epi64(vF, vGapE);
+            vF = _mm_max_epi64(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm_load_si128(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int64_t tmp2 = tmp < INT64_MIN ? INT64_MIN : tmp;
+            vF = _mm_slli_si128(vF, 8);
+            vF = _mm_insert_epi64(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm_load_si128(pvHStore + i);
+                vH = _mm_max_epi64(vH,vF);
+                _mm_store_si128(pvHStore + i, vH);
+                
+#ifdef PARASAIL_TABLE
+                arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm_sub_epi64(vH, vGapO);
+                vF = _mm_sub_epi64(vF, vGapE);
+                if (! _mm_movemask_epi8(_mm_cmpgt_epi64(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm_load_si128(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm_slli_si128(vH, 8);
+            }
+            result->rowcols->score_row[j] = (int64_t) _mm_extract_epi64 (vH, 1);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        vec128i vH = _mm_load_si128(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        vec128i vH = _mm_load_si128(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm_slli_si128 (vH, 8);
+        }
+        score = (int64_t) _mm_extract_epi64 (vH, 1);
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_64 | PARASAIL_FLAG_LANES_2;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_altivec_128_64(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+
+    profile = parasail_profile_create_altivec_128_64(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -86,10 +385,19 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict vProfile = (vec128i*)profile->profile64.score;
+#ifdef WNAME
+    vec128i* const pvWork = (vec128i*)parasail_workspace_reserve(
+            workspace, sizeof(vec128i)*3*segLen + sizeof(int64_t)*(s2Len+1));
+    vec128i* restrict pvHStore = pvWork;
+    vec128i* restrict pvHLoad = pvWork + segLen;
+    vec128i* const restrict pvE = pvWork + 2*segLen;
+    int64_t* const restrict boundary = (int64_t*)(pvWork + 3*segLen);
+#else
     vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
     vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
     int64_t* const restrict boundary = parasail_memalign_int64_t(16, s2Len+1);
+#endif
     vec128i vGapO = _mm_set1_epi64(open);
     vec128i vGapE = _mm_set1_epi64(gap);
     vec128i vNegInf = _mm_set1_epi64(NEG_INF);
@@ -100,9 +408,11 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -144,7 +454,13 @@ parasail_result_t* PNAME(
         vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 8);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const vec128i* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const vec128i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         vec128i* pv = pvHLoad;
@@ -250,10 +566,12 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
@@ -39,6 +39,10 @@ static inline int8_t _mm256_extract_epi8_rpl(__m256i a, int imm) {
 }
 #endif
 
+static inline __m256i _mm256_lookup_epi8_rpl(__m256i lo, __m256i hi, __m256i ilo, __m256i ihi) {
+    return _mm256_or_si256(_mm256_shuffle_epi8(lo, ilo), _mm256_shuffle_epi8(hi, ihi));
+}
+
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 
@@ -138,24 +142,604 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_avx2_256_8
 #define PNAME parasail_nw_striped_profile_avx2_256_8
+#define WNAME parasail_nw_striped_profile_avx2_256_8_ws
+#define ENAME parasail_nw_striped_profile_avx2_256_8_enc
+#define CNAME parasail_nw_striped_profile_avx2_256_8_core
+#endif
+#endif
+
+/* Match and mismatch scores need no query profile: the codes of the
+ * query residues, striped like the profile, are compared to the code of
+ * each database residue and the compare selects the score. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const int32_t last_lane = (s1Len - 1) / segLen;
+    const int32_t tail = (s1Len - 1) % segLen + 1;
+    __m256i* const restrict pvQuery = parasail_memalign___m256i(32, segLen+4);
+    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    int8_t* const restrict boundary = parasail_memalign_int8_t(32, s2Len+1);
+    __m256i vGapO = _mm256_set1_epi8(open);
+    __m256i vGapE = _mm256_set1_epi8(gap);
+    __m256i vNegInf = _mm256_set1_epi8(NEG_INF);
+    __m256i vMatch;
+    __m256i vMismatch;
+    __m256i vMatchHead;
+    __m256i vMismatchHead;
+    __m256i vMatchTail;
+    __m256i vMismatchTail;
+    int8_t score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi8(INT8_MIN);
+    __m256i vPosLimit = _mm256_set1_epi8(INT8_MAX);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
 #endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        int8_t *q = (int8_t*)pvQuery;
+        int8_t *lane = (int8_t*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (int8_t)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = _mm256_load_si256(pvQuery + segLen);
+        vMismatchHead = _mm256_load_si256(pvQuery + segLen + 1);
+        vMatchTail = _mm256_load_si256(pvQuery + segLen + 2);
+        vMismatchTail = _mm256_load_si256(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m256i_8_t h;
+            __m256i_8_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+            }
+            _mm256_store_si256(&pvHStore[index], h.m);
+            _mm256_store_si256(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT8_MIN ? INT8_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        __m256i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 1);
+
+        /* code of the database residue in every lane */
+        const __m256i vCode = _mm256_set1_epi8(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        __m256i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = _mm256_insert_epi8_rpl(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = _mm256_adds_epi8(vH, _mm256_blendv_epi8(vMismatch, vMatch,
+                        _mm256_cmpeq_epi8(_mm256_load_si256(pvQuery + i), vCode)));
+            vE = _mm256_load_si256(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm256_max_epi8(vH, vE);
+            vH = _mm256_max_epi8(vH, vF);
+            /* Save vH values. */
+            _mm256_store_si256(pvHStore + i, vH);
+            /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vE);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vF);
+            }
+#ifdef PARASAIL_TABLE
+            arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
 #endif
 
+            /* Update vE value. */
+            vH = _mm256_subs_epi8(vH, vGapO);
+            vE = _mm256_subs_epi8(vE, vGapE);
+            vE = _mm256_max_epi8(vE, vH);
+            _mm256_store_si256(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm256_subs_epi8(vF, vGapE);
+            vF = _mm256_max_epi8(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm256_load_si256(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int8_t tmp2 = tmp < INT8_MIN ? INT8_MIN : tmp;
+            vF = _mm256_slli_si256_rpl(vF, 1);
+            vF = _mm256_insert_epi8_rpl(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm256_load_si256(pvHStore + i);
+                vH = _mm256_max_epi8(vH,vF);
+                _mm256_store_si256(pvHStore + i, vH);
+                /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vE);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vF);
+            }
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm256_subs_epi8(vH, vGapO);
+                vF = _mm256_subs_epi8(vF, vGapE);
+                if (! _mm256_movemask_epi8(_mm256_cmpgt_epi8(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm256_load_si256(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm256_slli_si256_rpl(vH, 1);
+            }
+            result->rowcols->score_row[j] = (int8_t) _mm256_extract_epi8_rpl (vH, 31);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m256i vH = _mm256_load_si256(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m256i vH = _mm256_load_si256(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm256_slli_si256_rpl (vH, 1);
+        }
+        score = (int8_t) _mm256_extract_epi8_rpl (vH, 31);
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi8(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi8(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_32;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+/* Long queries make the profile too big for the cache; this variant keeps
+ * two 16-byte score tables per residue and the striped query codes as
+ * shuffle indexes, and looks each score up in the tables of the database
+ * residue. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t segWidth = 32; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m256i* const restrict pvTable = parasail_memalign___m256i(32, 2*matrix->size);
+    __m256i* const restrict pvIndex = parasail_memalign___m256i(32, 2*segLen);
+    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    int8_t* const restrict boundary = parasail_memalign_int8_t(32, s2Len+1);
+    __m256i vGapO = _mm256_set1_epi8(open);
+    __m256i vGapE = _mm256_set1_epi8(gap);
+    __m256i vNegInf = _mm256_set1_epi8(NEG_INF);
+    int8_t score = NEG_INF;
+    __m256i vNegLimit = _mm256_set1_epi8(INT8_MIN);
+    __m256i vPosLimit = _mm256_set1_epi8(INT8_MAX);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<32; ++i) {
+                int32_t lo = i % 16;
+                int32_t hi = lo + 16;
+                table[2*k*32 + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*32 + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*32; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                int32_t byte = (k+1)*1 - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*32 + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*32 + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            __m256i_8_t h;
+            __m256i_8_t e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+                tmp = tmp - open;
+                e.v[segNum] = tmp < INT8_MIN ? INT8_MIN : tmp;
+            }
+            _mm256_store_si256(&pvHStore[index], h.m);
+            _mm256_store_si256(&pvE[index], e.m);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT8_MIN ? INT8_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        __m256i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 1);
+
+        /* score tables of the database residue */
+        const __m256i* vTable = pvTable + 2*matrix->mapper[(unsigned char)s2[j]];
+        const __m256i vTableLo = _mm256_load_si256(vTable);
+        const __m256i vTableHi = _mm256_load_si256(vTable + 1);
+
+        /* Swap the 2 H buffers. */
+        __m256i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = _mm256_insert_epi8_rpl(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_adds_epi8(vH, _mm256_lookup_epi8_rpl(vTableLo, vTableHi,
+                        _mm256_load_si256(pvIndex + 2*i), _mm256_load_si256(pvIndex + 2*i + 1)));
+            vE = _mm256_load_si256(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm256_max_epi8(vH, vE);
+            vH = _mm256_max_epi8(vH, vF);
+            /* Save vH values. */
+            _mm256_store_si256(pvHStore + i, vH);
+            /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vE);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vF);
+            }
+#ifdef PARASAIL_TABLE
+            arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm256_subs_epi8(vH, vGapO);
+            vE = _mm256_subs_epi8(vE, vGapE);
+            vE = _mm256_max_epi8(vE, vH);
+            _mm256_store_si256(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm256_subs_epi8(vF, vGapE);
+            vF = _mm256_max_epi8(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm256_load_si256(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int8_t tmp2 = tmp < INT8_MIN ? INT8_MIN : tmp;
+            vF = _mm256_slli_si256_rpl(vF, 1);
+            vF = _mm256_insert_epi8_rpl(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm256_load_si256(pvHStore + i);
+                vH = _mm256_max_epi8(vH,vF);
+                _mm256_store_si256(pvHStore + i, vH);
+                /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vH);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vE);
+                vSaturationCheckMin = _mm256_min_epi8(vSaturationCheckMin, vF);
+            }
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm256_subs_epi8(vH, vGapO);
+                vF = _mm256_subs_epi8(vF, vGapE);
+                if (! _mm256_movemask_epi8(_mm256_cmpgt_epi8(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = _mm256_load_si256(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = _mm256_slli_si256_rpl(vH, 1);
+            }
+            result->rowcols->score_row[j] = (int8_t) _mm256_extract_epi8_rpl (vH, 31);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        __m256i vH = _mm256_load_si256(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        __m256i vH = _mm256_load_si256(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = _mm256_slli_si256_rpl (vH, 1);
+        }
+        score = (int8_t) _mm256_extract_epi8_rpl (vH, 31);
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi8(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi8(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_32;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+    if (parasail_lookup_scores(matrix, sizeof(__m256i)*matrix->size
+                *((s1Len + 32 - 1) / 32))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -169,10 +753,19 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict vProfile = (__m256i*)profile->profile8.score;
+#ifdef WNAME
+    __m256i* const pvWork = (__m256i*)parasail_workspace_reserve(
+            workspace, sizeof(__m256i)*3*segLen + sizeof(int8_t)*(s2Len+1));
+    __m256i* restrict pvHStore = pvWork;
+    __m256i* restrict pvHLoad = pvWork + segLen;
+    __m256i* const restrict pvE = pvWork + 2*segLen;
+    int8_t* const restrict boundary = (int8_t*)(pvWork + 3*segLen);
+#else
     __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
     __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
     int8_t* const restrict boundary = parasail_memalign_int8_t(32, s2Len+1);
+#endif
     __m256i vGapO = _mm256_set1_epi8(open);
     __m256i vGapE = _mm256_set1_epi8(gap);
     __m256i vNegInf = _mm256_set1_epi8(NEG_INF);
@@ -186,9 +779,11 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -230,7 +825,13 @@ parasail_result_t* PNAME(
         __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 1);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const __m256i* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const __m256i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         __m256i* pv = pvHLoad;
@@ -355,10 +956,12 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
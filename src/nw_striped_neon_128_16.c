@@ -18,6 +18,11 @@
 
 #define NEG_INF (INT16_MIN/(int16_t)(2))
 
+static inline simde__m128i _mm_lookup_epi16_rpl(simde__m128i lo, simde__m128i hi, simde__m128i ilo, simde__m128i ihi) {
+    return simde_mm_srai_epi16(
+            simde_mm_or_si128(simde_mm_shuffle_epi8(lo, ilo), simde_mm_shuffle_epi8(hi, ihi)), 8);
+}
+
 
 #ifdef PARASAIL_TABLE
 static inline void arr_store_si128(
@@ -67,24 +72,560 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_nw_striped_neon_128_16
 #define PNAME parasail_nw_striped_profile_neon_128_16
+#define WNAME parasail_nw_striped_profile_neon_128_16_ws
+#define ENAME parasail_nw_striped_profile_neon_128_16_enc
+#define CNAME parasail_nw_striped_profile_neon_128_16_core
 #endif
 #endif
 
+/* Match and mismatch scores need no query profile: the codes of the
+ * query residues, striped like the profile, are compared to the code of
+ * each database residue and the compare selects the score. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const int32_t last_lane = (s1Len - 1) / segLen;
+    const int32_t tail = (s1Len - 1) % segLen + 1;
+    simde__m128i* const restrict pvQuery = parasail_memalign_simde__m128i(16, segLen+4);
+    simde__m128i* restrict pvHStore = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* restrict pvHLoad =  parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvE = parasail_memalign_simde__m128i(16, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
+    simde__m128i vGapO = simde_mm_set1_epi16(open);
+    simde__m128i vGapE = simde_mm_set1_epi16(gap);
+    simde__m128i vNegInf = simde_mm_set1_epi16(NEG_INF);
+    simde__m128i vMatch;
+    simde__m128i vMismatch;
+    simde__m128i vMatchHead;
+    simde__m128i vMismatchHead;
+    simde__m128i vMatchTail;
+    simde__m128i vMismatchTail;
+    int16_t score = NEG_INF;
+    
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        int16_t *q = (int16_t*)pvQuery;
+        int16_t *lane = (int16_t*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (int16_t)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = simde_mm_load_si128(pvQuery + segLen);
+        vMismatchHead = simde_mm_load_si128(pvQuery + segLen + 1);
+        vMatchTail = simde_mm_load_si128(pvQuery + segLen + 2);
+        vMismatchTail = simde_mm_load_si128(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            simde__m128i h;
+            simde__m128i e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.i16[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.i16[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            simde_mm_store_si128(&pvHStore[index], h);
+            simde_mm_store_si128(&pvE[index], e);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        simde__m128i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        simde__m128i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        simde__m128i vH = simde_mm_slli_si128(pvHStore[segLen - 1], 2);
+
+        /* code of the database residue in every lane */
+        const simde__m128i vCode = simde_mm_set1_epi16(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        simde__m128i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = simde_mm_insert_epi16(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = simde_mm_add_epi16(vH, simde_mm_blendv_epi8(vMismatch, vMatch,
+                        simde_mm_cmpeq_epi16(simde_mm_load_si128(pvQuery + i), vCode)));
+            vE = simde_mm_load_si128(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = simde_mm_max_epi16(vH, vE);
+            vH = simde_mm_max_epi16(vH, vF);
+            /* Save vH values. */
+            simde_mm_store_si128(pvHStore + i, vH);
+            
+#ifdef PARASAIL_TABLE
+            arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = simde_mm_sub_epi16(vH, vGapO);
+            vE = simde_mm_sub_epi16(vE, vGapE);
+            vE = simde_mm_max_epi16(vE, vH);
+            simde_mm_store_si128(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = simde_mm_sub_epi16(vF, vGapE);
+            vF = simde_mm_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = simde_mm_load_si128(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int16_t tmp2 = tmp < INT16_MIN ? INT16_MIN : tmp;
+            vF = simde_mm_slli_si128(vF, 2);
+            vF = simde_mm_insert_epi16(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = simde_mm_load_si128(pvHStore + i);
+                vH = simde_mm_max_epi16(vH,vF);
+                simde_mm_store_si128(pvHStore + i, vH);
+                
+#ifdef PARASAIL_TABLE
+                arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = simde_mm_sub_epi16(vH, vGapO);
+                vF = simde_mm_sub_epi16(vF, vGapE);
+                if (! simde_mm_movemask_epi8(simde_mm_cmpgt_epi16(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = simde_mm_load_si128(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = simde_mm_slli_si128(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) simde_mm_extract_epi16 (vH, 7);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        simde__m128i vH = simde_mm_load_si128(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        simde__m128i vH = simde_mm_load_si128(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = simde_mm_slli_si128 (vH, 2);
+        }
+        score = (int16_t) simde_mm_extract_epi16 (vH, 7);
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+/* Long queries make the profile too big for the cache; this variant keeps
+ * two 16-byte score tables per residue and the striped query codes as
+ * shuffle indexes, and looks each score up in the tables of the database
+ * residue. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    simde__m128i* const restrict pvTable = parasail_memalign_simde__m128i(16, 2*matrix->size);
+    simde__m128i* const restrict pvIndex = parasail_memalign_simde__m128i(16, 2*segLen);
+    simde__m128i* restrict pvHStore = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* restrict pvHLoad =  parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvE = parasail_memalign_simde__m128i(16, segLen);
+    int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
+    simde__m128i vGapO = simde_mm_set1_epi16(open);
+    simde__m128i vGapE = simde_mm_set1_epi16(gap);
+    simde__m128i vNegInf = simde_mm_set1_epi16(NEG_INF);
+    int16_t score = NEG_INF;
+    
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<16; ++i) {
+                int32_t lo = i % 16;
+                int32_t hi = lo + 16;
+                table[2*k*16 + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*16 + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*16; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                int32_t byte = (k+1)*2 - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*16 + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*16 + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* initialize H and E */
+    {
+        int32_t index = 0;
+        for (i=0; i<segLen; ++i) {
+            int32_t segNum = 0;
+            simde__m128i h;
+            simde__m128i e;
+            for (segNum=0; segNum<segWidth; ++segNum) {
+                int64_t tmp = -open-gap*(segNum*segLen+i);
+                h.i16[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+                tmp = tmp - open;
+                e.i16[segNum] = tmp < INT16_MIN ? INT16_MIN : tmp;
+            }
+            simde_mm_store_si128(&pvHStore[index], h);
+            simde_mm_store_si128(&pvE[index], e);
+            ++index;
+        }
+    }
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT16_MIN ? INT16_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        simde__m128i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        simde__m128i vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        simde__m128i vH = simde_mm_slli_si128(pvHStore[segLen - 1], 2);
+
+        /* score tables of the database residue */
+        const simde__m128i* vTable = pvTable + 2*matrix->mapper[(unsigned char)s2[j]];
+        const simde__m128i vTableLo = simde_mm_load_si128(vTable);
+        const simde__m128i vTableHi = simde_mm_load_si128(vTable + 1);
+
+        /* Swap the 2 H buffers. */
+        simde__m128i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = simde_mm_insert_epi16(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = simde_mm_add_epi16(vH, _mm_lookup_epi16_rpl(vTableLo, vTableHi,
+                        simde_mm_load_si128(pvIndex + 2*i), simde_mm_load_si128(pvIndex + 2*i + 1)));
+            vE = simde_mm_load_si128(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = simde_mm_max_epi16(vH, vE);
+            vH = simde_mm_max_epi16(vH, vF);
+            /* Save vH values. */
+            simde_mm_store_si128(pvHStore + i, vH);
+            
+#ifdef PARASAIL_TABLE
+            arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = simde_mm_sub_epi16(vH, vGapO);
+            vE = simde_mm_sub_epi16(vE, vGapE);
+            vE = simde_mm_max_epi16(vE, vH);
+            simde_mm_store_si128(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = simde_mm_sub_epi16(vF, vGapE);
+            vF = simde_mm_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = simde_mm_load_si128(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            int16_t tmp2 = tmp < INT16_MIN ? INT16_MIN : tmp;
+            vF = simde_mm_slli_si128(vF, 2);
+            vF = simde_mm_insert_epi16(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = simde_mm_load_si128(pvHStore + i);
+                vH = simde_mm_max_epi16(vH,vF);
+                simde_mm_store_si128(pvHStore + i, vH);
+                
+#ifdef PARASAIL_TABLE
+                arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = simde_mm_sub_epi16(vH, vGapO);
+                vF = simde_mm_sub_epi16(vF, vGapE);
+                if (! simde_mm_movemask_epi8(simde_mm_cmpgt_epi16(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = simde_mm_load_si128(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = simde_mm_slli_si128(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) simde_mm_extract_epi16 (vH, 7);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        simde__m128i vH = simde_mm_load_si128(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        simde__m128i vH = simde_mm_load_si128(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = simde_mm_slli_si128 (vH, 2);
+        }
+        score = (int16_t) simde_mm_extract_epi16 (vH, 7);
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_neon_128_16(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+    if (parasail_lookup_scores(matrix, sizeof(simde__m128i)*matrix->size
+                *((s1Len + 8 - 1) / 8))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    profile = parasail_profile_create_neon_128_16(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -98,10 +639,19 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     simde__m128i* const restrict vProfile = (simde__m128i*)profile->profile16.score;
+#ifdef WNAME
+    simde__m128i* const pvWork = (simde__m128i*)parasail_workspace_reserve(
+            workspace, sizeof(simde__m128i)*3*segLen + sizeof(int16_t)*(s2Len+1));
+    simde__m128i* restrict pvHStore = pvWork;
+    simde__m128i* restrict pvHLoad = pvWork + segLen;
+    simde__m128i* const restrict pvE = pvWork + 2*segLen;
+    int16_t* const restrict boundary = (int16_t*)(pvWork + 3*segLen);
+#else
     simde__m128i* restrict pvHStore = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* restrict pvHLoad =  parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvE = parasail_memalign_simde__m128i(16, segLen);
     int16_t* const restrict boundary = parasail_memalign_int16_t(16, s2Len+1);
+#endif
     simde__m128i vGapO = simde_mm_set1_epi16(open);
     simde__m128i vGapE = simde_mm_set1_epi16(gap);
     simde__m128i vNegInf = simde_mm_set1_epi16(NEG_INF);
@@ -112,9 +662,11 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -156,7 +708,13 @@ parasail_result_t* PNAME(
         simde__m128i vH = simde_mm_slli_si128(pvHStore[segLen - 1], 2);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const simde__m128i* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const simde__m128i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         simde__m128i* pv = pvHLoad;
@@ -262,10 +820,12 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
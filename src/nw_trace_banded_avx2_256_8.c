@@ -0,0 +1,465 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_avx.h"
+
+#define NEG_INF INT8_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+
+#if HAVE_AVX2_MM256_INSERT_EPI8
+#define _mm256_insert_epi8_rpl _mm256_insert_epi8
+#else
+static inline __m256i _mm256_insert_epi8_rpl(__m256i a, int8_t i, int imm) {
+    __m256i_8_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+#endif
+
+#if HAVE_AVX2_MM256_EXTRACT_EPI8
+#define _mm256_extract_epi8_rpl _mm256_extract_epi8
+#else
+static inline int8_t _mm256_extract_epi8_rpl(__m256i a, int imm) {
+    __m256i_8_t A;
+    A.m = a;
+    return A.v[imm];
+}
+#endif
+
+#define _mm256_cmplt_epi8_rpl(a,b) _mm256_cmpgt_epi8(b,a)
+
+#define _mm256_srli_si256_rpl(a,imm) _mm256_or_si256(_mm256_slli_si256(_mm256_permute2x128_si256(a, a, _MM_SHUFFLE(3,0,0,1)), 16-imm), _mm256_srli_si256(a, imm))
+
+
+static inline void arr_store_si256(
+        int8_t *array,
+        __m256i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len,
+        int32_t lo,
+        int32_t hi,
+        int32_t W)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len
+            && lo <= j-i-0 && j-i-0 <= hi) {
+        array[1LL*(i+0)*W + (j-i-0-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 31);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len
+            && lo <= j-i-2 && j-i-2 <= hi) {
+        array[1LL*(i+1)*W + (j-i-2-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 30);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len
+            && lo <= j-i-4 && j-i-4 <= hi) {
+        array[1LL*(i+2)*W + (j-i-4-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 29);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len
+            && lo <= j-i-6 && j-i-6 <= hi) {
+        array[1LL*(i+3)*W + (j-i-6-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 28);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len
+            && lo <= j-i-8 && j-i-8 <= hi) {
+        array[1LL*(i+4)*W + (j-i-8-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 27);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len
+            && lo <= j-i-10 && j-i-10 <= hi) {
+        array[1LL*(i+5)*W + (j-i-10-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 26);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len
+            && lo <= j-i-12 && j-i-12 <= hi) {
+        array[1LL*(i+6)*W + (j-i-12-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 25);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len
+            && lo <= j-i-14 && j-i-14 <= hi) {
+        array[1LL*(i+7)*W + (j-i-14-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 24);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len
+            && lo <= j-i-16 && j-i-16 <= hi) {
+        array[1LL*(i+8)*W + (j-i-16-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 23);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len
+            && lo <= j-i-18 && j-i-18 <= hi) {
+        array[1LL*(i+9)*W + (j-i-18-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 22);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len
+            && lo <= j-i-20 && j-i-20 <= hi) {
+        array[1LL*(i+10)*W + (j-i-20-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 21);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len
+            && lo <= j-i-22 && j-i-22 <= hi) {
+        array[1LL*(i+11)*W + (j-i-22-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 20);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len
+            && lo <= j-i-24 && j-i-24 <= hi) {
+        array[1LL*(i+12)*W + (j-i-24-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 19);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len
+            && lo <= j-i-26 && j-i-26 <= hi) {
+        array[1LL*(i+13)*W + (j-i-26-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 18);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len
+            && lo <= j-i-28 && j-i-28 <= hi) {
+        array[1LL*(i+14)*W + (j-i-28-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 17);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len
+            && lo <= j-i-30 && j-i-30 <= hi) {
+        array[1LL*(i+15)*W + (j-i-30-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 16);
+    }
+    if (0 <= i+16 && i+16 < s1Len && 0 <= j-16 && j-16 < s2Len
+            && lo <= j-i-32 && j-i-32 <= hi) {
+        array[1LL*(i+16)*W + (j-i-32-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 15);
+    }
+    if (0 <= i+17 && i+17 < s1Len && 0 <= j-17 && j-17 < s2Len
+            && lo <= j-i-34 && j-i-34 <= hi) {
+        array[1LL*(i+17)*W + (j-i-34-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 14);
+    }
+    if (0 <= i+18 && i+18 < s1Len && 0 <= j-18 && j-18 < s2Len
+            && lo <= j-i-36 && j-i-36 <= hi) {
+        array[1LL*(i+18)*W + (j-i-36-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 13);
+    }
+    if (0 <= i+19 && i+19 < s1Len && 0 <= j-19 && j-19 < s2Len
+            && lo <= j-i-38 && j-i-38 <= hi) {
+        array[1LL*(i+19)*W + (j-i-38-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 12);
+    }
+    if (0 <= i+20 && i+20 < s1Len && 0 <= j-20 && j-20 < s2Len
+            && lo <= j-i-40 && j-i-40 <= hi) {
+        array[1LL*(i+20)*W + (j-i-40-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 11);
+    }
+    if (0 <= i+21 && i+21 < s1Len && 0 <= j-21 && j-21 < s2Len
+            && lo <= j-i-42 && j-i-42 <= hi) {
+        array[1LL*(i+21)*W + (j-i-42-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 10);
+    }
+    if (0 <= i+22 && i+22 < s1Len && 0 <= j-22 && j-22 < s2Len
+            && lo <= j-i-44 && j-i-44 <= hi) {
+        array[1LL*(i+22)*W + (j-i-44-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 9);
+    }
+    if (0 <= i+23 && i+23 < s1Len && 0 <= j-23 && j-23 < s2Len
+            && lo <= j-i-46 && j-i-46 <= hi) {
+        array[1LL*(i+23)*W + (j-i-46-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 8);
+    }
+    if (0 <= i+24 && i+24 < s1Len && 0 <= j-24 && j-24 < s2Len
+            && lo <= j-i-48 && j-i-48 <= hi) {
+        array[1LL*(i+24)*W + (j-i-48-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 7);
+    }
+    if (0 <= i+25 && i+25 < s1Len && 0 <= j-25 && j-25 < s2Len
+            && lo <= j-i-50 && j-i-50 <= hi) {
+        array[1LL*(i+25)*W + (j-i-50-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 6);
+    }
+    if (0 <= i+26 && i+26 < s1Len && 0 <= j-26 && j-26 < s2Len
+            && lo <= j-i-52 && j-i-52 <= hi) {
+        array[1LL*(i+26)*W + (j-i-52-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 5);
+    }
+    if (0 <= i+27 && i+27 < s1Len && 0 <= j-27 && j-27 < s2Len
+            && lo <= j-i-54 && j-i-54 <= hi) {
+        array[1LL*(i+27)*W + (j-i-54-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 4);
+    }
+    if (0 <= i+28 && i+28 < s1Len && 0 <= j-28 && j-28 < s2Len
+            && lo <= j-i-56 && j-i-56 <= hi) {
+        array[1LL*(i+28)*W + (j-i-56-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 3);
+    }
+    if (0 <= i+29 && i+29 < s1Len && 0 <= j-29 && j-29 < s2Len
+            && lo <= j-i-58 && j-i-58 <= hi) {
+        array[1LL*(i+29)*W + (j-i-58-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 2);
+    }
+    if (0 <= i+30 && i+30 < s1Len && 0 <= j-30 && j-30 < s2Len
+            && lo <= j-i-60 && j-i-60 <= hi) {
+        array[1LL*(i+30)*W + (j-i-60-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 1);
+    }
+    if (0 <= i+31 && i+31 < s1Len && 0 <= j-31 && j-31 < s2Len
+            && lo <= j-i-62 && j-i-62 <= hi) {
+        array[1LL*(i+31)*W + (j-i-62-lo)] = (int8_t)_mm256_extract_epi8_rpl(vWH, 0);
+    }
+}
+
+#define FNAME parasail_nw_trace_banded_avx2_256_8
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 32; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const int32_t lo = MIN(0, s2Len-s1Len) - k;
+    const int32_t hi = MAX(0, s2Len-s1Len) + k;
+    const int32_t W = hi - lo + 1;
+    int8_t * const restrict s1 = parasail_memalign_int8_t(32, s1Len+PAD);
+    int8_t * const restrict s2B= parasail_memalign_int8_t(32, s2Len+PAD2);
+    int8_t * const restrict _H_pr = parasail_memalign_int8_t(32, s2Len+PAD2);
+    int8_t * const restrict _F_pr = parasail_memalign_int8_t(32, s2Len+PAD2);
+    int8_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int8_t * const restrict H_pr = _H_pr+PAD;
+    int8_t * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new_trace(s1Len, W, 32, sizeof(int8_t));
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int8_t score = NEG_INF;
+    __m256i vNegInf = _mm256_set1_epi8(NEG_INF);
+    __m256i vOpen = _mm256_set1_epi8(open);
+    __m256i vGap  = _mm256_set1_epi8(gap);
+    __m256i vZero = _mm256_set1_epi8(0);
+    __m256i vK = _mm256_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31);
+    __m256i v2K = _mm256_adds_epi8(vK, vK);
+    __m256i vTDiag = _mm256_set1_epi8(PARASAIL_DIAG);
+    __m256i vTIns = _mm256_set1_epi8(PARASAIL_INS);
+    __m256i vTDel = _mm256_set1_epi8(PARASAIL_DEL);
+    __m256i vTDiagE = _mm256_set1_epi8(PARASAIL_DIAG_E);
+    __m256i vTInsE = _mm256_set1_epi8(PARASAIL_INS_E);
+    __m256i vTDiagF = _mm256_set1_epi8(PARASAIL_DIAG_F);
+    __m256i vTDelF = _mm256_set1_epi8(PARASAIL_DEL_F);
+    __m256i vNegLimit = _mm256_set1_epi8(INT8_MIN);
+    __m256i vPosLimit = _mm256_set1_epi8(INT8_MAX);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? MAX(-open - j*gap, NEG_INF) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const int32_t jbeg = MAX(0, i+lo);
+        const int32_t jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const int32_t kLast = s1Len-1-i;
+        __m256i vNH = vNegInf;
+        __m256i vWH = vNegInf;
+        __m256i vE = vNegInf;
+        __m256i vE_opn = vNegInf;
+        __m256i vE_ext = vNegInf;
+        __m256i vF = vNegInf;
+        __m256i vF_opn = vNegInf;
+        __m256i vF_ext = vNegInf;
+        __m256i vRowOut = _mm256_cmpgt_epi8(vK, _mm256_set1_epi8(CLAMP(kLast)));
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        const int * const restrict matrow16 = &matrix->matrix[matrix->size*s1[i+16]];
+        const int * const restrict matrow17 = &matrix->matrix[matrix->size*s1[i+17]];
+        const int * const restrict matrow18 = &matrix->matrix[matrix->size*s1[i+18]];
+        const int * const restrict matrow19 = &matrix->matrix[matrix->size*s1[i+19]];
+        const int * const restrict matrow20 = &matrix->matrix[matrix->size*s1[i+20]];
+        const int * const restrict matrow21 = &matrix->matrix[matrix->size*s1[i+21]];
+        const int * const restrict matrow22 = &matrix->matrix[matrix->size*s1[i+22]];
+        const int * const restrict matrow23 = &matrix->matrix[matrix->size*s1[i+23]];
+        const int * const restrict matrow24 = &matrix->matrix[matrix->size*s1[i+24]];
+        const int * const restrict matrow25 = &matrix->matrix[matrix->size*s1[i+25]];
+        const int * const restrict matrow26 = &matrix->matrix[matrix->size*s1[i+26]];
+        const int * const restrict matrow27 = &matrix->matrix[matrix->size*s1[i+27]];
+        const int * const restrict matrow28 = &matrix->matrix[matrix->size*s1[i+28]];
+        const int * const restrict matrow29 = &matrix->matrix[matrix->size*s1[i+29]];
+        const int * const restrict matrow30 = &matrix->matrix[matrix->size*s1[i+30]];
+        const int * const restrict matrow31 = &matrix->matrix[matrix->size*s1[i+31]];
+        vNH = _mm256_insert_epi8_rpl(vNH, H_pr[jbeg-1], 31);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = _mm256_insert_epi8_rpl(vWH, MAX(-open - i*gap, NEG_INF), 31);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            __m256i vMat;
+            __m256i vNWH = vNH;
+            __m256i vOut = vZero;
+            vNH = _mm256_srli_si256_rpl(vWH, 1);
+            vNH = _mm256_insert_epi8_rpl(vNH, H_pr[j], 31);
+            vF = _mm256_srli_si256_rpl(vF, 1);
+            vF = _mm256_insert_epi8_rpl(vF, F_pr[j], 31);
+            vF_opn = _mm256_subs_epi8(vNH, vOpen);
+            vF_ext = _mm256_subs_epi8(vF, vGap);
+            vF = _mm256_max_epi8(vF_opn, vF_ext);
+            vE_opn = _mm256_subs_epi8(vWH, vOpen);
+            vE_ext = _mm256_subs_epi8(vE, vGap);
+            vE = _mm256_max_epi8(vE_opn, vE_ext);
+            vMat = _mm256_set_epi8(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]],
+                    matrow16[s2[j-16]],
+                    matrow17[s2[j-17]],
+                    matrow18[s2[j-18]],
+                    matrow19[s2[j-19]],
+                    matrow20[s2[j-20]],
+                    matrow21[s2[j-21]],
+                    matrow22[s2[j-22]],
+                    matrow23[s2[j-23]],
+                    matrow24[s2[j-24]],
+                    matrow25[s2[j-25]],
+                    matrow26[s2[j-26]],
+                    matrow27[s2[j-27]],
+                    matrow28[s2[j-28]],
+                    matrow29[s2[j-29]],
+                    matrow30[s2[j-30]],
+                    matrow31[s2[j-31]]
+                    );
+            vNWH = _mm256_adds_epi8(vNWH, vMat);
+            vWH = _mm256_max_epi8(vNWH, vE);
+            vWH = _mm256_max_epi8(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                __m256i cond = _mm256_cmpeq_epi8(vK, _mm256_set1_epi8(CLAMP(j+1)));
+                __m256i condEF;
+                vOut = _mm256_or_si256(
+                        _mm256_or_si256(
+                            _mm256_cmpgt_epi8(v2K, _mm256_set1_epi8(CLAMP(j-i-lo))),
+                            _mm256_cmplt_epi8_rpl(v2K, _mm256_set1_epi8(CLAMP(j-i-hi)))),
+                        _mm256_or_si256(
+                            _mm256_or_si256(
+                                _mm256_cmplt_epi8_rpl(vK, _mm256_set1_epi8(CLAMP(j-s2Len+1))),
+                                _mm256_cmpgt_epi8(vK, _mm256_set1_epi8(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = _mm256_or_si256(cond, vOut);
+                vWH = _mm256_blendv_epi8(vWH, _mm256_set1_epi8(MAX(-open - (i+j+1)*gap, NEG_INF)), cond);
+                vWH = _mm256_blendv_epi8(vWH, vNegInf, vOut);
+                vE = _mm256_blendv_epi8(vE, vNegInf, condEF);
+                vF = _mm256_blendv_epi8(vF, vNegInf, condEF);
+            }
+            /* check for saturation */
+            {
+                vSaturationCheckMax = _mm256_max_epi8(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = _mm256_blendv_epi8(
+                        _mm256_min_epi8(vSaturationCheckMin, vWH),
+                        vSaturationCheckMin, vOut);
+            }
+            /* trace table */
+            {
+                __m256i case1 = _mm256_cmpeq_epi8(vWH, vNWH);
+                __m256i case2 = _mm256_cmpeq_epi8(vWH, vF);
+                __m256i vT = _mm256_blendv_epi8(
+                        _mm256_blendv_epi8(vTIns, vTDel, case2),
+                        vTDiag,
+                        case1);
+                __m256i condE = _mm256_cmpgt_epi8(vE_opn, vE_ext);
+                __m256i condF = _mm256_cmpgt_epi8(vF_opn, vF_ext);
+                __m256i vET = _mm256_blendv_epi8(vTInsE, vTDiagE, condE);
+                __m256i vFT = _mm256_blendv_epi8(vTDelF, vTDiagF, condF);
+                vT = _mm256_or_si256(vT, vET);
+                vT = _mm256_or_si256(vT, vFT);
+                arr_store_si256(result->trace->trace_table, vT, i, s1Len, j, s2Len, lo, hi, W);
+            }
+            H_pr[j-31] = (int8_t)_mm256_extract_epi8_rpl(vWH,0);
+            F_pr[j-31] = (int8_t)_mm256_extract_epi8_rpl(vF,0);
+            /* the last cell of the table is in the last stripe */
+            if (kLast <= PAD && j == s2Len-1+kLast) {
+                int8_t lanes[32];
+                memcpy(lanes, &vWH, sizeof(lanes));
+                score = lanes[PAD-kLast];
+            }
+        }
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi8(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi8(vSaturationCheckMax, vPosLimit)))
+            || -open - (int64_t)MAX(MIN(hi,s2Len),MIN(-lo,s1Len))*gap
+                <= INT8_MIN) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->trace->band = k;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_TRACE | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_32;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
@@ -0,0 +1,344 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF INT8_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+
+
+static inline void arr_store_si128(
+        int8_t *array,
+        simde__m128i vWH,
+        int32_t i,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len,
+        int32_t lo,
+        int32_t hi,
+        int32_t W)
+{
+    if (0 <= i+0 && i+0 < s1Len && 0 <= j-0 && j-0 < s2Len
+            && lo <= j-i-0 && j-i-0 <= hi) {
+        array[1LL*(i+0)*W + (j-i-0-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 15);
+    }
+    if (0 <= i+1 && i+1 < s1Len && 0 <= j-1 && j-1 < s2Len
+            && lo <= j-i-2 && j-i-2 <= hi) {
+        array[1LL*(i+1)*W + (j-i-2-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 14);
+    }
+    if (0 <= i+2 && i+2 < s1Len && 0 <= j-2 && j-2 < s2Len
+            && lo <= j-i-4 && j-i-4 <= hi) {
+        array[1LL*(i+2)*W + (j-i-4-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 13);
+    }
+    if (0 <= i+3 && i+3 < s1Len && 0 <= j-3 && j-3 < s2Len
+            && lo <= j-i-6 && j-i-6 <= hi) {
+        array[1LL*(i+3)*W + (j-i-6-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 12);
+    }
+    if (0 <= i+4 && i+4 < s1Len && 0 <= j-4 && j-4 < s2Len
+            && lo <= j-i-8 && j-i-8 <= hi) {
+        array[1LL*(i+4)*W + (j-i-8-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 11);
+    }
+    if (0 <= i+5 && i+5 < s1Len && 0 <= j-5 && j-5 < s2Len
+            && lo <= j-i-10 && j-i-10 <= hi) {
+        array[1LL*(i+5)*W + (j-i-10-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 10);
+    }
+    if (0 <= i+6 && i+6 < s1Len && 0 <= j-6 && j-6 < s2Len
+            && lo <= j-i-12 && j-i-12 <= hi) {
+        array[1LL*(i+6)*W + (j-i-12-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 9);
+    }
+    if (0 <= i+7 && i+7 < s1Len && 0 <= j-7 && j-7 < s2Len
+            && lo <= j-i-14 && j-i-14 <= hi) {
+        array[1LL*(i+7)*W + (j-i-14-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 8);
+    }
+    if (0 <= i+8 && i+8 < s1Len && 0 <= j-8 && j-8 < s2Len
+            && lo <= j-i-16 && j-i-16 <= hi) {
+        array[1LL*(i+8)*W + (j-i-16-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 7);
+    }
+    if (0 <= i+9 && i+9 < s1Len && 0 <= j-9 && j-9 < s2Len
+            && lo <= j-i-18 && j-i-18 <= hi) {
+        array[1LL*(i+9)*W + (j-i-18-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 6);
+    }
+    if (0 <= i+10 && i+10 < s1Len && 0 <= j-10 && j-10 < s2Len
+            && lo <= j-i-20 && j-i-20 <= hi) {
+        array[1LL*(i+10)*W + (j-i-20-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 5);
+    }
+    if (0 <= i+11 && i+11 < s1Len && 0 <= j-11 && j-11 < s2Len
+            && lo <= j-i-22 && j-i-22 <= hi) {
+        array[1LL*(i+11)*W + (j-i-22-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 4);
+    }
+    if (0 <= i+12 && i+12 < s1Len && 0 <= j-12 && j-12 < s2Len
+            && lo <= j-i-24 && j-i-24 <= hi) {
+        array[1LL*(i+12)*W + (j-i-24-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 3);
+    }
+    if (0 <= i+13 && i+13 < s1Len && 0 <= j-13 && j-13 < s2Len
+            && lo <= j-i-26 && j-i-26 <= hi) {
+        array[1LL*(i+13)*W + (j-i-26-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 2);
+    }
+    if (0 <= i+14 && i+14 < s1Len && 0 <= j-14 && j-14 < s2Len
+            && lo <= j-i-28 && j-i-28 <= hi) {
+        array[1LL*(i+14)*W + (j-i-28-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 1);
+    }
+    if (0 <= i+15 && i+15 < s1Len && 0 <= j-15 && j-15 < s2Len
+            && lo <= j-i-30 && j-i-30 <= hi) {
+        array[1LL*(i+15)*W + (j-i-30-lo)] = (int8_t)simde_mm_extract_epi8(vWH, 0);
+    }
+}
+
+#define FNAME parasail_nw_trace_banded_neon_128_8
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 16; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const int32_t lo = MIN(0, s2Len-s1Len) - k;
+    const int32_t hi = MAX(0, s2Len-s1Len) + k;
+    const int32_t W = hi - lo + 1;
+    int8_t * const restrict s1 = parasail_memalign_int8_t(16, s1Len+PAD);
+    int8_t * const restrict s2B= parasail_memalign_int8_t(16, s2Len+PAD2);
+    int8_t * const restrict _H_pr = parasail_memalign_int8_t(16, s2Len+PAD2);
+    int8_t * const restrict _F_pr = parasail_memalign_int8_t(16, s2Len+PAD2);
+    int8_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int8_t * const restrict H_pr = _H_pr+PAD;
+    int8_t * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new_trace(s1Len, W, 16, sizeof(int8_t));
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len-1;
+    int32_t end_ref = s2Len-1;
+    int8_t score = NEG_INF;
+    simde__m128i vNegInf = simde_mm_set1_epi8(NEG_INF);
+    simde__m128i vOpen = simde_mm_set1_epi8(open);
+    simde__m128i vGap  = simde_mm_set1_epi8(gap);
+    simde__m128i vZero = simde_mm_set1_epi8(0);
+    simde__m128i vK = simde_mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    simde__m128i v2K = simde_mm_adds_epi8(vK, vK);
+    simde__m128i vTDiag = simde_mm_set1_epi8(PARASAIL_DIAG);
+    simde__m128i vTIns = simde_mm_set1_epi8(PARASAIL_INS);
+    simde__m128i vTDel = simde_mm_set1_epi8(PARASAIL_DEL);
+    simde__m128i vTDiagE = simde_mm_set1_epi8(PARASAIL_DIAG_E);
+    simde__m128i vTInsE = simde_mm_set1_epi8(PARASAIL_INS_E);
+    simde__m128i vTDiagF = simde_mm_set1_epi8(PARASAIL_DIAG_F);
+    simde__m128i vTDelF = simde_mm_set1_epi8(PARASAIL_DEL_F);
+    simde__m128i vNegLimit = simde_mm_set1_epi8(INT8_MIN);
+    simde__m128i vPosLimit = simde_mm_set1_epi8(INT8_MAX);
+    simde__m128i vSaturationCheckMin = vPosLimit;
+    simde__m128i vSaturationCheckMax = vNegLimit;
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? MAX(-open - j*gap, NEG_INF) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const int32_t jbeg = MAX(0, i+lo);
+        const int32_t jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const int32_t kLast = s1Len-1-i;
+        simde__m128i vNH = vNegInf;
+        simde__m128i vWH = vNegInf;
+        simde__m128i vE = vNegInf;
+        simde__m128i vE_opn = vNegInf;
+        simde__m128i vE_ext = vNegInf;
+        simde__m128i vF = vNegInf;
+        simde__m128i vF_opn = vNegInf;
+        simde__m128i vF_ext = vNegInf;
+        simde__m128i vRowOut = simde_mm_cmpgt_epi8(vK, simde_mm_set1_epi8(CLAMP(kLast)));
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        const int * const restrict matrow4 = &matrix->matrix[matrix->size*s1[i+4]];
+        const int * const restrict matrow5 = &matrix->matrix[matrix->size*s1[i+5]];
+        const int * const restrict matrow6 = &matrix->matrix[matrix->size*s1[i+6]];
+        const int * const restrict matrow7 = &matrix->matrix[matrix->size*s1[i+7]];
+        const int * const restrict matrow8 = &matrix->matrix[matrix->size*s1[i+8]];
+        const int * const restrict matrow9 = &matrix->matrix[matrix->size*s1[i+9]];
+        const int * const restrict matrow10 = &matrix->matrix[matrix->size*s1[i+10]];
+        const int * const restrict matrow11 = &matrix->matrix[matrix->size*s1[i+11]];
+        const int * const restrict matrow12 = &matrix->matrix[matrix->size*s1[i+12]];
+        const int * const restrict matrow13 = &matrix->matrix[matrix->size*s1[i+13]];
+        const int * const restrict matrow14 = &matrix->matrix[matrix->size*s1[i+14]];
+        const int * const restrict matrow15 = &matrix->matrix[matrix->size*s1[i+15]];
+        vNH = simde_mm_insert_epi8(vNH, H_pr[jbeg-1], 15);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = simde_mm_insert_epi8(vWH, MAX(-open - i*gap, NEG_INF), 15);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            simde__m128i vMat;
+            simde__m128i vNWH = vNH;
+            simde__m128i vOut = vZero;
+            vNH = simde_mm_srli_si128(vWH, 1);
+            vNH = simde_mm_insert_epi8(vNH, H_pr[j], 15);
+            vF = simde_mm_srli_si128(vF, 1);
+            vF = simde_mm_insert_epi8(vF, F_pr[j], 15);
+            vF_opn = simde_mm_subs_epi8(vNH, vOpen);
+            vF_ext = simde_mm_subs_epi8(vF, vGap);
+            vF = simde_mm_max_epi8(vF_opn, vF_ext);
+            vE_opn = simde_mm_subs_epi8(vWH, vOpen);
+            vE_ext = simde_mm_subs_epi8(vE, vGap);
+            vE = simde_mm_max_epi8(vE_opn, vE_ext);
+            vMat = simde_mm_set_epi8(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]],
+                    matrow4[s2[j-4]],
+                    matrow5[s2[j-5]],
+                    matrow6[s2[j-6]],
+                    matrow7[s2[j-7]],
+                    matrow8[s2[j-8]],
+                    matrow9[s2[j-9]],
+                    matrow10[s2[j-10]],
+                    matrow11[s2[j-11]],
+                    matrow12[s2[j-12]],
+                    matrow13[s2[j-13]],
+                    matrow14[s2[j-14]],
+                    matrow15[s2[j-15]]
+                    );
+            vNWH = simde_mm_adds_epi8(vNWH, vMat);
+            vWH = simde_mm_max_epi8(vNWH, vE);
+            vWH = simde_mm_max_epi8(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                simde__m128i cond = simde_mm_cmpeq_epi8(vK, simde_mm_set1_epi8(CLAMP(j+1)));
+                simde__m128i condEF;
+                vOut = simde_mm_or_si128(
+                        simde_mm_or_si128(
+                            simde_mm_cmpgt_epi8(v2K, simde_mm_set1_epi8(CLAMP(j-i-lo))),
+                            simde_mm_cmplt_epi8(v2K, simde_mm_set1_epi8(CLAMP(j-i-hi)))),
+                        simde_mm_or_si128(
+                            simde_mm_or_si128(
+                                simde_mm_cmplt_epi8(vK, simde_mm_set1_epi8(CLAMP(j-s2Len+1))),
+                                simde_mm_cmpgt_epi8(vK, simde_mm_set1_epi8(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = simde_mm_or_si128(cond, vOut);
+                vWH = simde_mm_blendv_epi8(vWH, simde_mm_set1_epi8(MAX(-open - (i+j+1)*gap, NEG_INF)), cond);
+                vWH = simde_mm_blendv_epi8(vWH, vNegInf, vOut);
+                vE = simde_mm_blendv_epi8(vE, vNegInf, condEF);
+                vF = simde_mm_blendv_epi8(vF, vNegInf, condEF);
+            }
+            /* check for saturation */
+            {
+                vSaturationCheckMax = simde_mm_max_epi8(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = simde_mm_blendv_epi8(
+                        simde_mm_min_epi8(vSaturationCheckMin, vWH),
+                        vSaturationCheckMin, vOut);
+            }
+            /* trace table */
+            {
+                simde__m128i case1 = simde_mm_cmpeq_epi8(vWH, vNWH);
+                simde__m128i case2 = simde_mm_cmpeq_epi8(vWH, vF);
+                simde__m128i vT = simde_mm_blendv_epi8(
+                        simde_mm_blendv_epi8(vTIns, vTDel, case2),
+                        vTDiag,
+                        case1);
+                simde__m128i condE = simde_mm_cmpgt_epi8(vE_opn, vE_ext);
+                simde__m128i condF = simde_mm_cmpgt_epi8(vF_opn, vF_ext);
+                simde__m128i vET = simde_mm_blendv_epi8(vTInsE, vTDiagE, condE);
+                simde__m128i vFT = simde_mm_blendv_epi8(vTDelF, vTDiagF, condF);
+                vT = simde_mm_or_si128(vT, vET);
+                vT = simde_mm_or_si128(vT, vFT);
+                arr_store_si128(result->trace->trace_table, vT, i, s1Len, j, s2Len, lo, hi, W);
+            }
+            H_pr[j-15] = (int8_t)simde_mm_extract_epi8(vWH,0);
+            F_pr[j-15] = (int8_t)simde_mm_extract_epi8(vF,0);
+            /* the last cell of the table is in the last stripe */
+            if (kLast <= PAD && j == s2Len-1+kLast) {
+                int8_t lanes[16];
+                memcpy(lanes, &vWH, sizeof(lanes));
+                score = lanes[PAD-kLast];
+            }
+        }
+    }
+
+    if (simde_mm_movemask_epi8(simde_mm_or_si128(
+            simde_mm_cmpeq_epi8(vSaturationCheckMin, vNegLimit),
+            simde_mm_cmpeq_epi8(vSaturationCheckMax, vPosLimit)))
+            || -open - (int64_t)MAX(MIN(hi,s2Len),MIN(-lo,s1Len))*gap
+                <= INT8_MIN) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT8_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->trace->band = k;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_TRACE | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_8 | PARASAIL_FLAG_LANES_16;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 
@@ -17,24 +18,23 @@
 #include "parasail/internal_altivec.h"
 
 
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, vec128i v) {
+    int k;
+    for (k=0; k<4; ++k) {
+        p[k] = (int8_t)_mm_extract_epi32(v, k);
+    }
+}
+
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        vec128i *array,
+        int8_t *array,
         vec128i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    _mm_store_si128(array + (1LL*d*seglen+t), vH);
-}
-
-static inline vec128i arr_load(
-        vec128i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return _mm_load_si128(array + (1LL*d*seglen+t));
+    _mm_store_trace_epi32_rpl(array + (1LL*d*seglen+t)*4, vH);
 }
 
 #define FNAME parasail_nw_trace_scan_altivec_128_32
@@ -69,6 +69,7 @@ parasail_result_t* PNAME(
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict pvP  = (vec128i*)profile->profile32.score;
     vec128i* const restrict pvE  = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvET = parasail_memalign_vec128i(16, segLen);
     int32_t* const restrict boundary = parasail_memalign_int32_t(16, s2Len+1);
     vec128i* const restrict pvHt = parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvH  = parasail_memalign_vec128i(16, segLen);
@@ -86,7 +87,7 @@ parasail_result_t* PNAME(
     vec128i vSaturationCheckMax = vNegLimit;
     vec128i vNegInfFront = vZero;
     vec128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(vec128i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 16, sizeof(int8_t));
     vec128i vTIns  = _mm_set1_epi32(PARASAIL_INS);
     vec128i vTDel  = _mm_set1_epi32(PARASAIL_DEL);
     vec128i vTDiag = _mm_set1_epi32(PARASAIL_DIAG);
@@ -173,7 +174,7 @@ parasail_result_t* PNAME(
             vE_ext = _mm_sub_epi32(vE, vGapE);
             case1 = _mm_cmpgt_epi32(vE_opn, vE_ext);
             vET = _mm_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            _mm_store_si128(pvET+i, vET);
             vE = _mm_max_epi32(vE_opn, vE_ext);
             vSaturationCheckMin = _mm_min_epi32(vSaturationCheckMin, vE);
             vGapper = _mm_add_epi32(vHt, vGapper);
@@ -203,7 +204,7 @@ parasail_result_t* PNAME(
         vF = _mm_add_epi32(vF, vNegInfFront);
         vH = _mm_max_epi32(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = _mm_load_si128(pvET+i);
             vHp = _mm_load_si128(pvH+i);
             vHt = _mm_load_si128(pvHt+i);
             vF_opn = _mm_sub_epi32(vH, vGapO);
@@ -256,6 +257,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 
@@ -17,24 +18,20 @@
 #include "parasail/internal_altivec.h"
 
 
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, vec128i v) {
+    _mm_store_si128((vec128i*)p, v);
+}
+
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        vec128i *array,
+        int8_t *array,
         vec128i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    _mm_store_si128(array + (1LL*d*seglen+t), vH);
-}
-
-static inline vec128i arr_load(
-        vec128i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return _mm_load_si128(array + (1LL*d*seglen+t));
+    _mm_store_trace_epi8_rpl(array + (1LL*d*seglen+t)*16, vH);
 }
 
 #define FNAME parasail_nw_trace_scan_altivec_128_8
@@ -69,6 +66,7 @@ parasail_result_t* PNAME(
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict pvP  = (vec128i*)profile->profile8.score;
     vec128i* const restrict pvE  = parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvET = parasail_memalign_vec128i(16, segLen);
     int8_t* const restrict boundary = parasail_memalign_int8_t(16, s2Len+1);
     vec128i* const restrict pvHt = parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvH  = parasail_memalign_vec128i(16, segLen);
@@ -86,7 +84,7 @@ parasail_result_t* PNAME(
     vec128i vSaturationCheckMax = vNegLimit;
     vec128i vNegInfFront = vZero;
     vec128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(vec128i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 16, sizeof(int8_t));
     vec128i vTIns  = _mm_set1_epi8(PARASAIL_INS);
     vec128i vTDel  = _mm_set1_epi8(PARASAIL_DEL);
     vec128i vTDiag = _mm_set1_epi8(PARASAIL_DIAG);
@@ -173,7 +171,7 @@ parasail_result_t* PNAME(
             vE_ext = _mm_subs_epi8(vE, vGapE);
             case1 = _mm_cmpgt_epi8(vE_opn, vE_ext);
             vET = _mm_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            _mm_store_si128(pvET+i, vET);
             vE = _mm_max_epi8(vE_opn, vE_ext);
             vSaturationCheckMin = _mm_min_epi8(vSaturationCheckMin, vE);
             vGapper = _mm_adds_epi8(vHt, vGapper);
@@ -203,7 +201,7 @@ parasail_result_t* PNAME(
         vF = _mm_adds_epi8(vF, vNegInfFront);
         vH = _mm_max_epi8(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = _mm_load_si128(pvET+i);
             vHp = _mm_load_si128(pvH+i);
             vHt = _mm_load_si128(pvHt+i);
             vF_opn = _mm_subs_epi8(vH, vGapO);
@@ -256,6 +254,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -40,26 +41,25 @@ static inline int32_t _mm256_extract_epi32_rpl(__m256i a, int imm) {
 
 #define _mm256_cmplt_epi32_rpl(a,b) _mm256_cmpgt_epi32(b,a)
 
+static inline void _mm256_store_trace_epi32_rpl(int8_t *p, __m256i v) {
+    v = _mm256_packs_epi32(v, v);
+    v = _mm256_packs_epi16(v, v);
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0,4,0,4,0,4,0,4));
+    _mm_storel_epi64((__m128i*)p, _mm256_castsi256_si128(v));
+}
+
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        __m256i *array,
+        int8_t *array,
         __m256i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    _mm256_store_si256(array + (1LL*d*seglen+t), vH);
-}
-
-static inline __m256i arr_load(
-        __m256i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return _mm256_load_si256(array + (1LL*d*seglen+t));
+    _mm256_store_trace_epi32_rpl(array + (1LL*d*seglen+t)*8, vH);
 }
 
 #define FNAME parasail_nw_trace_scan_avx2_256_32
@@ -94,6 +94,7 @@ parasail_result_t* PNAME(
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict pvP  = (__m256i*)profile->profile32.score;
     __m256i* const restrict pvE  = parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvET = parasail_memalign___m256i(32, segLen);
     int32_t* const restrict boundary = parasail_memalign_int32_t(32, s2Len+1);
     __m256i* const restrict pvHt = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvH  = parasail_memalign___m256i(32, segLen);
@@ -111,7 +112,7 @@ parasail_result_t* PNAME(
     __m256i vSaturationCheckMax = vNegLimit;
     __m256i vNegInfFront = vZero;
     __m256i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 32, sizeof(__m256i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 32, sizeof(int8_t));
     __m256i vTIns  = _mm256_set1_epi32(PARASAIL_INS);
     __m256i vTDel  = _mm256_set1_epi32(PARASAIL_DEL);
     __m256i vTDiag = _mm256_set1_epi32(PARASAIL_DIAG);
@@ -198,7 +199,7 @@ parasail_result_t* PNAME(
             vE_ext = _mm256_sub_epi32(vE, vGapE);
             case1 = _mm256_cmpgt_epi32(vE_opn, vE_ext);
             vET = _mm256_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            _mm256_store_si256(pvET+i, vET);
             vE = _mm256_max_epi32(vE_opn, vE_ext);
             vSaturationCheckMin = _mm256_min_epi32(vSaturationCheckMin, vE);
             vGapper = _mm256_add_epi32(vHt, vGapper);
@@ -228,7 +229,7 @@ parasail_result_t* PNAME(
         vF = _mm256_add_epi32(vF, vNegInfFront);
         vH = _mm256_max_epi32(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = _mm256_load_si256(pvET+i);
             vHp = _mm256_load_si256(pvH+i);
             vHt = _mm256_load_si256(pvHt+i);
             vF_opn = _mm256_sub_epi32(vH, vGapO);
@@ -281,6 +282,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
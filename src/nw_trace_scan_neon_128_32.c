@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 
@@ -17,24 +18,24 @@
 #include "parasail/internal_neon.h"
 
 
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, simde__m128i v) {
+    int32_t t;
+    v = simde_mm_packs_epi32(v, v);
+    v = simde_mm_packs_epi16(v, v);
+    t = simde_mm_cvtsi128_si32(v);
+    memcpy(p, &t, sizeof(t));
+}
+
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        simde__m128i *array,
+        int8_t *array,
         simde__m128i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    simde_mm_store_si128(array + (1LL*d*seglen+t), vH);
-}
-
-static inline simde__m128i arr_load(
-        simde__m128i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return simde_mm_load_si128(array + (1LL*d*seglen+t));
+    _mm_store_trace_epi32_rpl(array + (1LL*d*seglen+t)*4, vH);
 }
 
 #define FNAME parasail_nw_trace_scan_neon_128_32
@@ -69,6 +70,7 @@ parasail_result_t* PNAME(
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     simde__m128i* const restrict pvP  = (simde__m128i*)profile->profile32.score;
     simde__m128i* const restrict pvE  = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvET = parasail_memalign_simde__m128i(16, segLen);
     int32_t* const restrict boundary = parasail_memalign_int32_t(16, s2Len+1);
     simde__m128i* const restrict pvHt = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvH  = parasail_memalign_simde__m128i(16, segLen);
@@ -86,7 +88,7 @@ parasail_result_t* PNAME(
     simde__m128i vSaturationCheckMax = vNegLimit;
     simde__m128i vNegInfFront = vZero;
     simde__m128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(simde__m128i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 16, sizeof(int8_t));
     simde__m128i vTIns  = simde_mm_set1_epi32(PARASAIL_INS);
     simde__m128i vTDel  = simde_mm_set1_epi32(PARASAIL_DEL);
     simde__m128i vTDiag = simde_mm_set1_epi32(PARASAIL_DIAG);
@@ -173,7 +175,7 @@ parasail_result_t* PNAME(
             vE_ext = simde_mm_sub_epi32(vE, vGapE);
             case1 = simde_mm_cmpgt_epi32(vE_opn, vE_ext);
             vET = simde_mm_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            simde_mm_store_si128(pvET+i, vET);
             vE = simde_mm_max_epi32(vE_opn, vE_ext);
             vSaturationCheckMin = simde_mm_min_epi32(vSaturationCheckMin, vE);
             vGapper = simde_mm_add_epi32(vHt, vGapper);
@@ -203,7 +205,7 @@ parasail_result_t* PNAME(
         vF = simde_mm_add_epi32(vF, vNegInfFront);
         vH = simde_mm_max_epi32(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = simde_mm_load_si128(pvET+i);
             vHp = simde_mm_load_si128(pvH+i);
             vHt = simde_mm_load_si128(pvHt+i);
             vF_opn = simde_mm_sub_epi32(vH, vGapO);
@@ -256,6 +258,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 
@@ -17,24 +18,20 @@
 #include "parasail/internal_neon.h"
 
 
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, simde__m128i v) {
+    simde_mm_storeu_si128((simde__m128i*)p, v);
+}
+
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        simde__m128i *array,
+        int8_t *array,
         simde__m128i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    simde_mm_store_si128(array + (1LL*d*seglen+t), vH);
-}
-
-static inline simde__m128i arr_load(
-        simde__m128i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return simde_mm_load_si128(array + (1LL*d*seglen+t));
+    _mm_store_trace_epi8_rpl(array + (1LL*d*seglen+t)*16, vH);
 }
 
 #define FNAME parasail_nw_trace_scan_neon_128_8
@@ -69,6 +66,7 @@ parasail_result_t* PNAME(
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     simde__m128i* const restrict pvP  = (simde__m128i*)profile->profile8.score;
     simde__m128i* const restrict pvE  = parasail_memalign_simde__m128i(16, segLen);
+    simde__m128i* const restrict pvET = parasail_memalign_simde__m128i(16, segLen);
     int8_t* const restrict boundary = parasail_memalign_int8_t(16, s2Len+1);
     simde__m128i* const restrict pvHt = parasail_memalign_simde__m128i(16, segLen);
     simde__m128i* const restrict pvH  = parasail_memalign_simde__m128i(16, segLen);
@@ -86,7 +84,7 @@ parasail_result_t* PNAME(
     simde__m128i vSaturationCheckMax = vNegLimit;
     simde__m128i vNegInfFront = vZero;
     simde__m128i vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 16, sizeof(simde__m128i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 16, sizeof(int8_t));
     simde__m128i vTIns  = simde_mm_set1_epi8(PARASAIL_INS);
     simde__m128i vTDel  = simde_mm_set1_epi8(PARASAIL_DEL);
     simde__m128i vTDiag = simde_mm_set1_epi8(PARASAIL_DIAG);
@@ -173,7 +171,7 @@ parasail_result_t* PNAME(
             vE_ext = simde_mm_subs_epi8(vE, vGapE);
             case1 = simde_mm_cmpgt_epi8(vE_opn, vE_ext);
             vET = simde_mm_blendv_epi8(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            simde_mm_store_si128(pvET+i, vET);
             vE = simde_mm_max_epi8(vE_opn, vE_ext);
             vSaturationCheckMin = simde_mm_min_epi8(vSaturationCheckMin, vE);
             vGapper = simde_mm_adds_epi8(vHt, vGapper);
@@ -203,7 +201,7 @@ parasail_result_t* PNAME(
         vF = simde_mm_adds_epi8(vF, vNegInfFront);
         vH = simde_mm_max_epi8(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = simde_mm_load_si128(pvET+i);
             vHp = simde_mm_load_si128(pvH+i);
             vHt = simde_mm_load_si128(pvHt+i);
             vF_opn = simde_mm_subs_epi8(vH, vGapO);
@@ -256,6 +254,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <immintrin.h>
 
@@ -20,6 +21,12 @@
 
 #define NEG_INF (INT16_MIN/(int16_t)(2))
 
+static inline void _mm256_store_trace_epi16_rpl(int8_t *p, __m256i v) {
+    v = _mm256_packs_epi16(v, v);
+    v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3,1,2,0));
+    _mm_storeu_si128((__m128i*)p, _mm256_castsi256_si128(v));
+}
+
 #if HAVE_AVX2_MM256_INSERT_EPI16
 #define _mm256_insert_epi16_rpl _mm256_insert_epi16
 #else
@@ -44,23 +51,15 @@ static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        __m256i *array,
+        int8_t *array,
         __m256i vH,
         int32_t t,
         int32_t seglen,
         int32_t d)
 {
-    _mm256_store_si256(array + (1LL*d*seglen+t), vH);
-}
-
-static inline __m256i arr_load(
-        __m256i *array,
-        int32_t t,
-        int32_t seglen,
-        int32_t d)
-{
-    return _mm256_load_si256(array + (1LL*d*seglen+t));
+    _mm256_store_trace_epi16_rpl(array + (1LL*d*seglen+t)*16, vH);
 }
 
 #define FNAME parasail_nw_trace_striped_avx2_256_16
@@ -100,13 +99,15 @@ parasail_result_t* PNAME(
     __m256i* restrict pvEaStore = parasail_memalign___m256i(32, segLen);
     __m256i* restrict pvEaLoad = parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvHT = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvTCol = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvTNext = parasail_memalign___m256i(32, segLen);
     int16_t* const restrict boundary = parasail_memalign_int16_t(32, s2Len+1);
     __m256i vGapO = _mm256_set1_epi16(open);
     __m256i vGapE = _mm256_set1_epi16(gap);
     __m256i vNegInf = _mm256_set1_epi16(NEG_INF);
     int16_t score = NEG_INF;
     
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, 32, sizeof(__m256i));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, 32, sizeof(int8_t));
     __m256i vTIns  = _mm256_set1_epi16(PARASAIL_INS);
     __m256i vTDel  = _mm256_set1_epi16(PARASAIL_DEL);
     __m256i vTDiag = _mm256_set1_epi16(PARASAIL_DIAG);
@@ -147,7 +148,7 @@ parasail_result_t* PNAME(
     }
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        _mm256_store_si256(pvTCol + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -194,7 +195,7 @@ parasail_result_t* PNAME(
             
 
             {
-                __m256i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                __m256i vTAll = _mm256_load_si256(pvTCol + i);
                 __m256i case1 = _mm256_cmpeq_epi16(vH, vH_dag);
                 __m256i case2 = _mm256_cmpeq_epi16(vH, vF);
                 __m256i vT = _mm256_blendv_epi8(
@@ -202,7 +203,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 _mm256_store_si256(pvHT + i, vT);
                 vT = _mm256_or_si256(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                _mm256_store_si256(pvTCol + i, vT);
             }
 
             vEF_opn = _mm256_sub_epi16(vH, vGapO);
@@ -219,7 +220,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vEa_ext);
                     __m256i vT = _mm256_blendv_epi8(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    _mm256_store_si256(pvTNext + i, vT);
                 }
             }
 
@@ -227,11 +228,11 @@ parasail_result_t* PNAME(
             vF_ext = _mm256_sub_epi16(vF, vGapE);
             vF = _mm256_max_epi16(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                __m256i vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                __m256i vTAll = _mm256_load_si256(pvTCol + i+1);
                 __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vF_ext);
                 __m256i vT = _mm256_blendv_epi8(vTDelF, vTDiagF, cond);
                 vT = _mm256_or_si256(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                _mm256_store_si256(pvTCol + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -274,22 +275,22 @@ parasail_result_t* PNAME(
                     case1 = _mm256_cmpeq_epi16(vH, vHp);
                     case2 = _mm256_cmpeq_epi16(vH, vF);
                     cond = _mm256_andnot_si256(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = _mm256_load_si256(pvTCol + i);
                     vT = _mm256_load_si256(pvHT + i);
                     vT = _mm256_blendv_epi8(vT, vTDel, cond);
                     _mm256_store_si256(pvHT + i, vT);
                     vTAll = _mm256_and_si256(vTAll, vTMask);
                     vTAll = _mm256_or_si256(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm256_store_si256(pvTCol + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    __m256i vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    __m256i vTAll = _mm256_load_si256(pvTCol + i);
                     __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vFa_ext);
                     __m256i vT = _mm256_blendv_epi8(vTDelF, vTDiagF, cond);
                     vTAll = _mm256_and_si256(vTAll, vFTMask);
                     vTAll = _mm256_or_si256(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    _mm256_store_si256(pvTCol + i, vTAll);
                 }
                 vEF_opn = _mm256_sub_epi16(vH, vGapO);
                 vF_ext = _mm256_sub_epi16(vF, vGapE);
@@ -301,7 +302,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         __m256i cond = _mm256_cmpgt_epi16(vEF_opn, vEa_ext);
                         __m256i vT = _mm256_blendv_epi8(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        _mm256_store_si256(pvTNext + i, vT);
                     }
                 }
                 if (! _mm256_movemask_epi8(
@@ -317,8 +318,11 @@ parasail_result_t* PNAME(
             }
         }
 end:
-        {
+        /* the column is final, narrow its trace bits into the table */
+        for (i=0; i<segLen; ++i) {
+            arr_store(result->trace->trace_table, _mm256_load_si256(pvTCol + i), i, segLen, j);
         }
+        SWAP(pvTCol, pvTNext)
     }
 
     /* extract last value from the last column */
@@ -340,6 +344,8 @@ end:
         | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
 
     parasail_free(boundary);
+    parasail_free(pvTNext);
+    parasail_free(pvTCol);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
     parasail_free(pvEaStore);
@@ -7,11 +7,18 @@
  */
 #include "config.h"
 
+#include <ctype.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif
 
 #if defined(_MSC_VER)
 #include <io.h>
@@ -21,81 +28,913 @@
 #define READ_FUNCTION read
 #endif
 
-#include <kseq.h>
-
-#if HAVE_ZLIB
-#include <zlib.h>
-KSEQ_INIT(gzFile, gzread)
-#else
-KSEQ_INIT(int, READ_FUNCTION)
+#ifdef _OPENMP
+#include <omp.h>
 #endif
 
 #include "parasail.h"
 #include "parasail/io.h"
+#include "parasail/memory.h"
 #include "parasail/stats.h"
 
-static char* strdup_rpl(const char *str)
+#if HAVE_ZLIB
+#include <zlib.h>
+
+/* Compressed input is inflated ahead of the parser into a ring of
+ * slots, one unit of input per slot. The blocks of a BGZF file are
+ * independent gzip members, so several threads each inflate a batch of
+ * blocks at once. A plain gzip stream, or uncompressed stdin, is read
+ * ahead by one thread while the parser consumes the previous unit. */
+#define INFLATE_SLOTS_MAX 64
+#define BGZF_BATCH 16           /* BGZF blocks per unit */
+#define STREAM_UNIT (1<<20)     /* bytes per unit otherwise */
+#define RAW_SIZE (1<<18)        /* holds the largest BGZF block */
+
+enum input_kind {
+    INPUT_PLAIN,
+    INPUT_GZIP,
+    INPUT_BGZF
+};
+
+typedef struct slot {
+    unsigned char *raw;         /* BGZF blocks still to inflate */
+    size_t raw_size;
+    size_t raw_capacity;
+    char *data;
+    size_t size;
+    size_t capacity;
+    long index;
+    int full;
+} slot_t;
+
+typedef struct inflater {
+    int fd;
+    int own_fd;
+    int kind;
+    /* input read from fd but not yet handed out */
+    unsigned char *in;
+    size_t in_pos;
+    size_t in_end;
+    int in_eof;
+    z_stream z;
+    int z_active;
+    int z_done;
+    slot_t slots[INFLATE_SLOTS_MAX];
+    int nslots;
+    int producers;
+    int threaded;
+    int stop;
+    long claimed;               /* units handed to producers */
+    long consumed;              /* units finished by the parser */
+    long last;                  /* number of units, -1 until known */
+    size_t pos;                 /* parser position in current unit */
+} inflater_t;
+
+static void slot_reserve(char **buf, size_t *capacity, size_t size)
 {
-    size_t l = strlen(str);
-    char *s = (char*)calloc(l + 1, sizeof(char));
-    if(!s) {
-        return NULL;
+    if (size > *capacity) {
+        char *new_buf = NULL;
+        size_t new_capacity = *capacity ? *capacity : 1;
+        while (new_capacity < size) {
+            new_capacity *= 2;
+        }
+        new_buf = (char*)realloc(*buf, new_capacity);
+        if (NULL == new_buf) {
+            perror("realloc");
+            exit(1);
+        }
+        *buf = new_buf;
+        *capacity = new_capacity;
     }
-    (void)memcpy(s, str, l);
-    return s;
 }
 
-parasail_sequences_t* parasail_sequences_from_file(const char *filename)
+/* true if at least need bytes of input are buffered */
+static int inflater_fill(inflater_t *inf, size_t need)
 {
-#if HAVE_ZLIB
-    gzFile fp;
+    if (inf->in_end - inf->in_pos >= need) {
+        return 1;
+    }
+    memmove(inf->in, inf->in + inf->in_pos, inf->in_end - inf->in_pos);
+    inf->in_end -= inf->in_pos;
+    inf->in_pos = 0;
+    while (!inf->in_eof && inf->in_end < need) {
+        int n = READ_FUNCTION(inf->fd, inf->in + inf->in_end, RAW_SIZE - inf->in_end);
+        if (n < 0) {
+            perror("read");
+            exit(1);
+        }
+        if (0 == n) {
+            inf->in_eof = 1;
+        }
+        inf->in_end += n;
+    }
+    return inf->in_end - inf->in_pos >= need;
+}
+
+/* size of the BGZF block at p with n bytes available, 0 if p does not
+ * begin a BGZF block header */
+static size_t bgzf_block_size(const unsigned char *p, size_t n)
+{
+    size_t xlen = 0;
+    size_t i = 0;
+
+    if (n < 12 || 0x1f != p[0] || 0x8b != p[1] || 8 != p[2] || !(p[3] & 4)) {
+        return 0;
+    }
+    xlen = p[10] | (p[11] << 8);
+    if (n < 12 + xlen) {
+        return 0;
+    }
+    /* look for the 'BC' subfield holding the block size less one */
+    for (i=12; i+4<=12+xlen; i+=4+(p[i+2] | (p[i+3] << 8))) {
+        if ('B' == p[i] && 'C' == p[i+1] && 2 == (p[i+2] | (p[i+3] << 8))
+                && i+6 <= 12+xlen) {
+            return (size_t)(p[i+4] | (p[i+5] << 8)) + 1;
+        }
+    }
+    return 0;
+}
+
+static inflater_t* inflater_open(int fd, int own_fd)
+{
+    inflater_t *inf = (inflater_t*)calloc(1, sizeof(inflater_t));
+    if (NULL == inf) {
+        perror("calloc");
+        exit(1);
+    }
+    inf->in = (unsigned char*)malloc(RAW_SIZE);
+    if (NULL == inf->in) {
+        perror("malloc");
+        exit(1);
+    }
+    inf->fd = fd;
+    inf->own_fd = own_fd;
+    inf->last = -1;
+    inf->nslots = 1;
+
+    inflater_fill(inf, 18);
+    if (inf->in_end >= 2 && 0x1f == inf->in[0] && 0x8b == inf->in[1]) {
+        inflater_fill(inf, 12 + (inf->in_end >= 12 ? (inf->in[10] | (inf->in[11] << 8)) : 0));
+        inf->kind = bgzf_block_size(inf->in, inf->in_end) ? INPUT_BGZF : INPUT_GZIP;
+    }
+    else {
+        inf->kind = INPUT_PLAIN;
+    }
+    if (INPUT_GZIP == inf->kind) {
+        if (Z_OK != inflateInit2(&inf->z, 16+MAX_WBITS)) {
+            fprintf(stderr, "inflateInit2: %s\n", inf->z.msg ? inf->z.msg : "failed");
+            exit(1);
+        }
+        inf->z_active = 1;
+    }
+
+#ifdef _OPENMP
+    if (omp_get_max_threads() > 1) {
+        inf->producers = INPUT_BGZF == inf->kind ? omp_get_max_threads()-1 : 1;
+        inf->nslots = 2*inf->producers + 2;
+        if (inf->nslots > INFLATE_SLOTS_MAX) {
+            inf->nslots = INFLATE_SLOTS_MAX;
+        }
+    }
+#endif
+
+    return inf;
+}
+
+static void inflater_close(inflater_t *inf)
+{
+    int i;
+    for (i=0; i<INFLATE_SLOTS_MAX; ++i) {
+        free(inf->slots[i].raw);
+        free(inf->slots[i].data);
+    }
+    if (inf->z_active) {
+        inflateEnd(&inf->z);
+    }
+    if (inf->own_fd) {
+        close(inf->fd);
+    }
+    free(inf->in);
+    free(inf);
+}
+
+/* Takes the next unit of input for slot, in input order. BGZF blocks
+ * are only copied here; everything else is produced in full. Returns 0
+ * at the end of the input. */
+static int unit_claim(inflater_t *inf, slot_t *slot)
+{
+    slot->size = 0;
+    slot->raw_size = 0;
+
+    if (INPUT_BGZF == inf->kind) {
+        int blocks = 0;
+        for (blocks=0; blocks<BGZF_BATCH; ++blocks) {
+            size_t bsize = 0;
+            if (!inflater_fill(inf, 1)) {
+                break;
+            }
+            inflater_fill(inf, 18);
+            inflater_fill(inf, 12 + (inf->in_end - inf->in_pos >= 12 ?
+                        (inf->in[inf->in_pos+10] | (inf->in[inf->in_pos+11] << 8)) : 0));
+            bsize = bgzf_block_size(inf->in + inf->in_pos, inf->in_end - inf->in_pos);
+            if (0 == bsize) {
+                fprintf(stderr, "BGZF input contains a block without a size\n");
+                exit(1);
+            }
+            if (!inflater_fill(inf, bsize)) {
+                /* truncated, like gzread, stop at the last whole block */
+                inf->in_pos = inf->in_end;
+                break;
+            }
+            slot_reserve((char**)&slot->raw, &slot->raw_capacity, slot->raw_size + bsize);
+            memcpy(slot->raw + slot->raw_size, inf->in + inf->in_pos, bsize);
+            slot->raw_size += bsize;
+            inf->in_pos += bsize;
+        }
+        return slot->raw_size > 0;
+    }
+    else if (INPUT_GZIP == inf->kind) {
+        slot_reserve(&slot->data, &slot->capacity, STREAM_UNIT);
+        while (!inf->z_done && slot->size < STREAM_UNIT) {
+            size_t in_pos = 0;
+            size_t size = slot->size;
+            int ret = 0;
+            inflater_fill(inf, 1);
+            in_pos = inf->in_pos;
+            inf->z.next_in = inf->in + inf->in_pos;
+            inf->z.avail_in = (uInt)(inf->in_end - inf->in_pos);
+            inf->z.next_out = (Bytef*)slot->data + slot->size;
+            inf->z.avail_out = (uInt)(STREAM_UNIT - slot->size);
+            ret = inflate(&inf->z, Z_NO_FLUSH);
+            inf->in_pos = inf->in_end - inf->z.avail_in;
+            slot->size = STREAM_UNIT - inf->z.avail_out;
+            if (Z_STREAM_END == ret) {
+                /* another member may follow, anything else is ignored */
+                if (inflater_fill(inf, 2) && 0x1f == inf->in[inf->in_pos]
+                        && 0x8b == inf->in[inf->in_pos+1]) {
+                    inflateReset(&inf->z);
+                }
+                else {
+                    inf->z_done = 1;
+                }
+            }
+            else if (Z_OK != ret && Z_BUF_ERROR != ret) {
+                fprintf(stderr, "inflate: %s\n", inf->z.msg ? inf->z.msg : "failed");
+                exit(1);
+            }
+            else if (size == slot->size && in_pos == inf->in_pos) {
+                /* truncated, like gzread, keep what was inflated */
+                inf->z_done = 1;
+            }
+        }
+        return slot->size > 0;
+    }
+    else {
+        slot_reserve(&slot->data, &slot->capacity, STREAM_UNIT);
+        while (slot->size < STREAM_UNIT && inflater_fill(inf, 1)) {
+            size_t n = inf->in_end - inf->in_pos;
+            if (n > STREAM_UNIT - slot->size) {
+                n = STREAM_UNIT - slot->size;
+            }
+            memcpy(slot->data + slot->size, inf->in + inf->in_pos, n);
+            slot->size += n;
+            inf->in_pos += n;
+        }
+        return slot->size > 0;
+    }
+}
+
+/* inflates the BGZF blocks copied by unit_claim() */
+static void unit_finish(slot_t *slot)
+{
+    z_stream z;
+    size_t offset = 0;
+
+    if (0 == slot->raw_size) {
+        return;
+    }
+
+    memset(&z, 0, sizeof(z));
+    if (Z_OK != inflateInit2(&z, -MAX_WBITS)) {
+        fprintf(stderr, "inflateInit2: %s\n", z.msg ? z.msg : "failed");
+        exit(1);
+    }
+    while (offset < slot->raw_size) {
+        const unsigned char *block = slot->raw + offset;
+        size_t bsize = bgzf_block_size(block, slot->raw_size - offset);
+        size_t xlen = block[10] | (block[11] << 8);
+        const unsigned char *trailer = block + bsize - 8;
+        uLong crc = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((uLong)trailer[3] << 24);
+        size_t isize = trailer[4] | (trailer[5] << 8) | (trailer[6] << 16) | ((size_t)trailer[7] << 24);
+        int ret = 0;
+
+        slot_reserve(&slot->data, &slot->capacity, slot->size + isize + 1);
+        inflateReset(&z);
+        z.next_in = (Bytef*)block + 12 + xlen;
+        z.avail_in = (uInt)(bsize - 12 - xlen - 8);
+        z.next_out = (Bytef*)slot->data + slot->size;
+        z.avail_out = (uInt)(isize + 1);
+        ret = inflate(&z, Z_FINISH);
+        if (Z_STREAM_END != ret || z.total_out != isize
+                || crc != crc32(crc32(0L, Z_NULL, 0), (Bytef*)slot->data + slot->size, (uInt)isize)) {
+            fprintf(stderr, "inflate: corrupt BGZF block\n");
+            exit(1);
+        }
+        slot->size += isize;
+        offset += bsize;
+    }
+    inflateEnd(&z);
+}
+
+/* the unit the parser reads next, NULL at the end of the input */
+static slot_t* inflater_next(inflater_t *inf)
+{
+    slot_t *slot = &inf->slots[inf->consumed % inf->nslots];
+
+    if (!inf->threaded) {
+        if (!slot->full) {
+            if (inf->last >= 0 || !unit_claim(inf, slot)) {
+                inf->last = inf->consumed;
+                return NULL;
+            }
+            unit_finish(slot);
+            slot->index = inf->consumed;
+            slot->full = 1;
+        }
+        return slot;
+    }
+
+    for (;;) {
+        int ready = 0;
+        int ended = 0;
+#pragma omp critical(parasail_inflate_slot)
+        {
+            ready = slot->full && slot->index == inf->consumed;
+            ended = inf->last >= 0 && inf->consumed >= inf->last;
+        }
+        if (ready) {
+            return slot;
+        }
+        if (ended) {
+            return NULL;
+        }
+    }
+}
+
+static void inflater_release(inflater_t *inf, slot_t *slot)
+{
+    inf->pos = 0;
+#pragma omp critical(parasail_inflate_slot)
+    {
+        slot->full = 0;
+        ++inf->consumed;
+    }
+}
+
+static int inflater_read(inflater_t *inf, void *buf, int len)
+{
+    slot_t *slot = NULL;
+    size_t n = 0;
+
+    for (;;) {
+        slot = inflater_next(inf);
+        if (NULL == slot) {
+            return 0;
+        }
+        if (inf->pos < slot->size) {
+            break;
+        }
+        inflater_release(inf, slot);
+    }
+    n = slot->size - inf->pos;
+    if (n > (size_t)len) {
+        n = len;
+    }
+    memcpy(buf, slot->data + inf->pos, n);
+    inf->pos += n;
+    return (int)n;
+}
+
+/* body of each producer thread, runs until the input ends or the
+ * parser stops */
+static void inflater_produce(inflater_t *inf)
+{
+    for (;;) {
+        slot_t *slot = NULL;
+        int done = 0;
+#pragma omp critical(parasail_inflate_claim)
+        {
+            long index = 0;
+            int room = 0;
+#pragma omp critical(parasail_inflate_slot)
+            {
+                done = inf->stop || inf->last >= 0;
+                index = inf->claimed;
+                room = inf->claimed - inf->consumed < inf->nslots;
+            }
+            if (!done && room) {
+                slot = &inf->slots[index % inf->nslots];
+                if (unit_claim(inf, slot)) {
+                    slot->index = index;
+#pragma omp critical(parasail_inflate_slot)
+                    ++inf->claimed;
+                }
+                else {
+#pragma omp critical(parasail_inflate_slot)
+                    inf->last = index;
+                    slot = NULL;
+                    done = 1;
+                }
+            }
+        }
+        if (done) {
+            break;
+        }
+        if (NULL != slot) {
+            unit_finish(slot);
+#pragma omp critical(parasail_inflate_slot)
+            slot->full = 1;
+        }
+    }
+}
+
+static void inflater_stop(inflater_t *inf)
+{
+#pragma omp critical(parasail_inflate_slot)
+    inf->stop = 1;
+}
+
+#include <kseq.h>
+KSEQ_INIT(inflater_t*, inflater_read)
 #else
-    FILE* fp;
-    int is_stdin = 0;
+#include <kseq.h>
+KSEQ_INIT(int, READ_FUNCTION)
 #endif
-    kseq_t *seq = NULL;
-    int l = 0;
+
+/* offsets of one record's strings within the arena */
+typedef struct record {
+    size_t name;
+    size_t comment;
+    size_t seq;
+    size_t qual;
+} record_t;
+
+typedef struct builder {
+    parasail_sequence_t *sequences;
+    record_t *records;
+    unsigned long count;
+    unsigned long capacity;
+} builder_t;
+
+static void builder_init(builder_t *b)
+{
+    b->count = 0;
+    b->capacity = 1000;
+    b->sequences = (parasail_sequence_t*)malloc(sizeof(parasail_sequence_t) * b->capacity);
+    b->records = (record_t*)malloc(sizeof(record_t) * b->capacity);
+    if (NULL == b->sequences || NULL == b->records) {
+        perror("malloc");
+        exit(1);
+    }
+}
+
+/* the record's strings must already be in the arena at the offsets given */
+static void builder_add(builder_t *b, const record_t *r,
+        size_t name_l, size_t comment_l, size_t seq_l, size_t qual_l)
+{
+    parasail_sequence_t *sequence = &b->sequences[b->count];
+    sequence->name.l = name_l;
+    sequence->comment.l = comment_l;
+    sequence->seq.l = seq_l;
+    sequence->qual.l = qual_l;
+    sequence->name.s = NULL;
+    sequence->comment.s = NULL;
+    sequence->seq.s = NULL;
+    sequence->qual.s = NULL;
+    b->records[b->count] = *r;
+    ++b->count;
+
+    /* allocate more space for sequences if we ran out */
+    if (b->count >= b->capacity) {
+        parasail_sequence_t *new_sequences = NULL;
+        record_t *new_records = NULL;
+        b->capacity *= 2;
+        errno = 0;
+        new_sequences = (parasail_sequence_t*)realloc(b->sequences, sizeof(parasail_sequence_t) * b->capacity);
+        new_records = (record_t*)realloc(b->records, sizeof(record_t) * b->capacity);
+        if (NULL == new_sequences || NULL == new_records) {
+            perror("realloc");
+            exit(1);
+        }
+        b->sequences = new_sequences;
+        b->records = new_records;
+        errno = 0;
+    }
+}
+
+/* move the records of src to the end of b */
+static void builder_append(builder_t *b, builder_t *src)
+{
+    if (b->count + src->count >= b->capacity) {
+        parasail_sequence_t *new_sequences = NULL;
+        record_t *new_records = NULL;
+        b->capacity = b->count + src->count + 1;
+        new_sequences = (parasail_sequence_t*)realloc(b->sequences, sizeof(parasail_sequence_t) * b->capacity);
+        new_records = (record_t*)realloc(b->records, sizeof(record_t) * b->capacity);
+        if (NULL == new_sequences || NULL == new_records) {
+            perror("realloc");
+            exit(1);
+        }
+        b->sequences = new_sequences;
+        b->records = new_records;
+    }
+    memcpy(&b->sequences[b->count], src->sequences, sizeof(parasail_sequence_t) * src->count);
+    memcpy(&b->records[b->count], src->records, sizeof(record_t) * src->count);
+    b->count += src->count;
+    free(src->sequences);
+    free(src->records);
+}
+
+/* point every non-empty string into the arena, which no longer moves */
+static parasail_sequences_t* builder_finish(builder_t *b,
+        char *arena, size_t arena_size, int arena_mapped)
+{
     parasail_sequences_t *retval = NULL;
-    parasail_sequence_t *sequences = NULL;
-    unsigned long count = 0;
-    unsigned long capacity = 1000;
+    unsigned long i;
     size_t chars = 0;
     stats_t stats;
 
-    stats_clear(&stats);
-
     retval = (parasail_sequences_t*)malloc(sizeof(parasail_sequences_t));
     if (NULL == retval) {
         perror("malloc");
         exit(1);
     }
-    sequences = (parasail_sequence_t*)malloc(sizeof(parasail_sequence_t) * capacity);
-    if (NULL == sequences) {
+
+    stats_clear(&stats);
+    for (i=0; i<b->count; ++i) {
+        parasail_sequence_t *sequence = &b->sequences[i];
+        stats_sample_value(&stats, sequence->seq.l);
+        chars += sequence->seq.l;
+        if (sequence->name.l)    sequence->name.s    = arena + b->records[i].name;
+        if (sequence->comment.l) sequence->comment.s = arena + b->records[i].comment;
+        if (sequence->seq.l)     sequence->seq.s     = arena + b->records[i].seq;
+        if (sequence->qual.l)    sequence->qual.s    = arena + b->records[i].qual;
+    }
+    free(b->records);
+
+    retval->seqs = b->sequences;
+    retval->l = b->count;
+    retval->characters = chars;
+    retval->shortest = stats._min;
+    retval->longest = stats._max;
+    retval->mean = stats._mean;
+    retval->stddev = stats_stddev(&stats);
+    retval->arena = arena;
+    retval->arena_size = arena_size;
+    retval->arena_mapped = arena_mapped;
+
+    return retval;
+}
+
+#if defined(HAVE_SYS_MMAN_H)
+/* A copy-on-write mapping of the input that is parsed in place. The
+ * strings of each record are compacted towards the front of the buffer
+ * at w and NUL terminated there. Every record consumes its header
+ * character and the delimiter after each string without writing them,
+ * which leaves room for the terminators, so w never passes r. */
+typedef struct mapped_stream {
+    char *buf;
+    size_t size;
+    size_t r;
+    size_t w;
+    int last_char;
+} mapped_stream_t;
+
+static int ms_getc(mapped_stream_t *ms)
+{
+    return ms->r < ms->size ? (unsigned char)ms->buf[ms->r++] : -1;
+}
+
+/* mirrors ks_getuntil2() of kseq.h, appending to the string that began
+ * at start and ends at w */
+static int ms_getuntil(mapped_stream_t *ms, int line, size_t start, int *dret)
+{
+    int gotany = 0;
+    if (dret) *dret = 0;
+    while (ms->r < ms->size) {
+        char c = ms->buf[ms->r++];
+        gotany = 1;
+        if (line ? '\n' == c : isspace((unsigned char)c)) {
+            if (dret) *dret = (unsigned char)c;
+            break;
+        }
+        ms->buf[ms->w++] = c;
+    }
+    if (!gotany) return -1;
+    if (line && ms->w-start > 1 && '\r' == ms->buf[ms->w-1]) --ms->w;
+    return (int)(ms->w-start);
+}
+
+/* terminate a string that began at start, empty strings stay unset */
+static size_t ms_finish(mapped_stream_t *ms, size_t start)
+{
+    size_t l = ms->w - start;
+    if (l) {
+        ms->buf[ms->w++] = '\0';
+    }
+    return l;
+}
+
+/* mirrors kseq_read() of kseq.h */
+static int ms_read(mapped_stream_t *ms, record_t *r,
+        size_t *name_l, size_t *comment_l, size_t *seq_l, size_t *qual_l)
+{
+    int c;
+    if (0 == ms->last_char) {
+        while ((c = ms_getc(ms)) >= 0 && c != '>' && c != '@');
+        if (c < 0) return c;
+        ms->last_char = c;
+    }
+    *comment_l = *seq_l = *qual_l = 0;
+    r->name = ms->w;
+    if (ms_getuntil(ms, 0, r->name, &c) < 0) return -1;
+    *name_l = ms_finish(ms, r->name);
+    r->comment = ms->w;
+    if (c != '\n') ms_getuntil(ms, 1, r->comment, NULL);
+    *comment_l = ms_finish(ms, r->comment);
+    r->seq = ms->w;
+    while ((c = ms_getc(ms)) >= 0 && c != '>' && c != '+' && c != '@') {
+        if (c == '\n') continue;
+        ms->buf[ms->w++] = (char)c;
+        ms_getuntil(ms, 1, r->seq, NULL);
+    }
+    if (c == '>' || c == '@') ms->last_char = c;
+    *seq_l = ms_finish(ms, r->seq);
+    r->qual = ms->w;
+    if (c != '+') return (int)*seq_l;
+    while ((c = ms_getc(ms)) >= 0 && c != '\n');
+    if (c == -1) return -2;
+    while (ms_getuntil(ms, 1, r->qual, NULL) >= 0 && ms->w-r->qual < *seq_l);
+    ms->last_char = 0;
+    *qual_l = ms_finish(ms, r->qual);
+    if (*seq_l != *qual_l) return -2;
+    return (int)*seq_l;
+}
+
+/* Parses the records starting in [begin,end) of the mapping, which
+ * must begin at a record or the start of the file. Returns the last
+ * ms_read() status; -1 means the chunk ended cleanly between records. */
+static int parse_chunk(char *buf, size_t begin, size_t end, builder_t *b)
+{
+    mapped_stream_t ms;
+    record_t r;
+    size_t name_l, comment_l, seq_l, qual_l;
+    int status = 0;
+
+    ms.buf = buf;
+    ms.size = end;
+    ms.r = begin;
+    ms.w = begin;
+    ms.last_char = 0;
+    builder_init(b);
+    while ((status = ms_read(&ms, &r, &name_l, &comment_l, &seq_l, &qual_l)) >= 0) {
+        builder_add(b, &r, name_l, comment_l, seq_l, qual_l);
+    }
+
+    return status;
+}
+
+/* smallest piece of a mapped file worth a thread of its own */
+#define CHUNK_MIN_SIZE (4L<<20)
+
+/* A line beginning with '>' starts a FASTA record. Quality lines may
+ * begin with '@', so a FASTQ header must also be followed two lines
+ * later by '+'. This is only a guess, which parse_chunks() verifies. */
+static int is_record_start(const char *buf, size_t p, size_t size)
+{
+    size_t lines = 0;
+
+    if ('\n' != buf[p-1]) {
+        return 0;
+    }
+    if ('>' == buf[p]) {
+        return 1;
+    }
+    if ('@' != buf[p]) {
+        return 0;
+    }
+    while (p < size && lines < 2) {
+        if ('\n' == buf[p++]) {
+            ++lines;
+        }
+    }
+    return p < size && '+' == buf[p];
+}
+
+/* Parses the mapping in chunks split at the guessed record starts. A
+ * chunk that runs out of input inside a record means a split
+ * landed inside a FASTQ quality string; the mapping is then restored
+ * and parsed serially. Returns 0 in that case. */
+static int parse_chunks(char *buf, size_t size, int count, builder_t *b)
+{
+    builder_t *parts = NULL;
+    size_t *bounds = NULL;
+    int *status = NULL;
+    int c = 0;
+    int ok = 1;
+
+    parts = (builder_t*)malloc(sizeof(builder_t) * count);
+    bounds = (size_t*)malloc(sizeof(size_t) * (count+1));
+    status = (int*)malloc(sizeof(int) * count);
+    if (NULL == parts || NULL == bounds || NULL == status) {
         perror("malloc");
         exit(1);
     }
 
+    bounds[0] = 0;
+    for (c=1; c<count; ++c) {
+        size_t p = size/count*c;
+        if (p < bounds[c-1]) {
+            p = bounds[c-1];
+        }
+        while (p < size && !is_record_start(buf, p, size)) {
+            ++p;
+        }
+        bounds[c] = p;
+    }
+    bounds[count] = size;
+
+#pragma omp parallel for schedule(dynamic,1)
+    for (c=0; c<count; ++c) {
+        status[c] = parse_chunk(buf, bounds[c], bounds[c+1], &parts[c]);
+    }
+
+    for (c=0; c<count-1; ++c) {
+        if (-1 != status[c]) {
+            ok = 0;
+        }
+    }
+
+    *b = parts[0];
+    for (c=1; c<count; ++c) {
+        if (ok) {
+            builder_append(b, &parts[c]);
+        }
+        else {
+            free(parts[c].sequences);
+            free(parts[c].records);
+        }
+    }
+    if (!ok) {
+        free(b->sequences);
+        free(b->records);
+    }
+
+    free(status);
+    free(bounds);
+    free(parts);
+
+    return ok;
+}
+
+/* NULL if the file cannot be mapped or is compressed */
+static parasail_sequences_t* sequences_from_mapping(const char *filename)
+{
+    int fd = -1;
+    int count = 1;
+    struct stat fs;
+    char *buf = NULL;
+    builder_t b;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (0 != fstat(fd, &fs) || !S_ISREG(fs.st_mode) || 0 == fs.st_size) {
+        close(fd);
+        return NULL;
+    }
+    buf = (char*)mmap(NULL, fs.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == buf) {
+        close(fd);
+        return NULL;
+    }
+    if (fs.st_size >= 2 && '\x1f' == buf[0] && '\x8b' == buf[1]) {
+        /* gzip, leave it to kseq */
+        munmap(buf, fs.st_size);
+        close(fd);
+        return NULL;
+    }
+
+#ifdef _OPENMP
+    count = omp_get_max_threads();
+#endif
+    if (fs.st_size/CHUNK_MIN_SIZE < count) {
+        count = (int)(fs.st_size/CHUNK_MIN_SIZE);
+    }
+    if (count > 1 && !parse_chunks(buf, fs.st_size, count, &b)) {
+        /* the chunks have already compacted the mapping in place */
+        munmap(buf, fs.st_size);
+        buf = (char*)mmap(NULL, fs.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == buf) {
+            perror("mmap");
+            exit(1);
+        }
+        count = 1;
+    }
+    if (count <= 1) {
+        parse_chunk(buf, 0, fs.st_size, &b);
+    }
+    close(fd);
+
+    return builder_finish(&b, buf, fs.st_size, 1);
+}
+#endif
+
+/* append a kseq string and its terminator to the arena */
+static size_t arena_append(char **arena, size_t *size, size_t *capacity,
+        const kstring_t *str)
+{
+    size_t offset = *size;
+    if (0 == str->l) {
+        return offset;
+    }
+    if (*size + str->l + 1 > *capacity) {
+        char *new_arena = NULL;
+        while (*size + str->l + 1 > *capacity) {
+            *capacity *= 2;
+        }
+        new_arena = (char*)realloc(*arena, *capacity);
+        if (NULL == new_arena) {
+            perror("realloc");
+            exit(1);
+        }
+        *arena = new_arena;
+    }
+    memcpy(*arena + *size, str->s, str->l);
+    (*arena)[*size + str->l] = '\0';
+    *size += str->l + 1;
+    return offset;
+}
+
+typedef struct heap_arena {
+    char *buf;
+    size_t size;
+    size_t capacity;
+} heap_arena_t;
+
+/* parse every record of seq into b, copying the strings to arena */
+static void parse_records(kseq_t *seq, builder_t *b, heap_arena_t *arena)
+{
+    record_t r;
+
+    while (kseq_read(seq) >= 0) {
+        r.name = arena_append(&arena->buf, &arena->size, &arena->capacity, &seq->name);
+        r.comment = arena_append(&arena->buf, &arena->size, &arena->capacity, &seq->comment);
+        r.seq = arena_append(&arena->buf, &arena->size, &arena->capacity, &seq->seq);
+        r.qual = arena_append(&arena->buf, &arena->size, &arena->capacity, &seq->qual);
+        builder_add(b, &r, seq->name.l, seq->comment.l, seq->seq.l, seq->qual.l);
+    }
+}
+
+parasail_sequences_t* parasail_sequences_from_file(const char *filename)
+{
+#if HAVE_ZLIB
+    inflater_t *fp = NULL;
+#else
+    FILE* fp;
+    int is_stdin = 0;
+#endif
+    kseq_t *seq = NULL;
+    heap_arena_t arena;
+    builder_t b;
+
     /* check for stdin instead of a normal filename */
     if (0 == strncmp("stdin", filename, 5)) {
 #if HAVE_ZLIB
-        fp = gzdopen(fileno(stdin), "r");
-        if (fp == Z_NULL) {
-            perror("gzdopen");
-            exit(1);
-        }
+        fp = inflater_open(fileno(stdin), 0);
 #else
         fp = stdin;
         is_stdin = 1;
 #endif
     }
     else {
+#if defined(HAVE_SYS_MMAN_H)
+        parasail_sequences_t *mapped = sequences_from_mapping(filename);
+        if (NULL != mapped) {
+            return mapped;
+        }
+#endif
         /* open the file */
         errno = 0;
 #if HAVE_ZLIB
-        fp = gzopen(filename, "r");
-        if (fp == Z_NULL) {
-            perror("gzopen");
-            exit(1);
+        {
+            int fd = open(filename, O_RDONLY);
+            if (fd < 0) {
+                perror("open");
+                exit(1);
+            }
+            fp = inflater_open(fd, 1);
         }
 #else
         fp = fopen(filename, "r");
@@ -105,6 +944,15 @@ parasail_sequences_t* parasail_sequences_from_file(const char *filename)
         }
 #endif
     }
+
+    arena.size = 0;
+    arena.capacity = 1<<20;
+    arena.buf = (char*)malloc(arena.capacity);
+    if (NULL == arena.buf) {
+        perror("malloc");
+        exit(1);
+    }
+    builder_init(&b);
     
     /* initialize kseq structures */
 #if HAVE_ZLIB
@@ -114,93 +962,142 @@ parasail_sequences_t* parasail_sequences_from_file(const char *filename)
 #endif
 
     /* parse file */
-    while ((l = kseq_read(seq)) >= 0) {
-        errno = 0;
-        sequences[count].name.l = seq->name.l;
-        sequences[count].comment.l = seq->comment.l;
-        sequences[count].seq.l = seq->seq.l;
-        sequences[count].qual.l = seq->qual.l;
-        sequences[count].name.s = NULL;
-        sequences[count].comment.s = NULL;
-        sequences[count].seq.s = NULL;
-        sequences[count].qual.s = NULL;
-
-        stats_sample_value(&stats, seq->seq.l);
-        chars += seq->seq.l;
-
-        if (sequences[count].name.l) {
-            sequences[count].name.s = strdup_rpl(seq->name.s);
-            if (NULL == sequences[count].name.s) {
-                perror("strdup name");
-                exit(1);
-            }
-        }
-        if (sequences[count].comment.l) {
-            sequences[count].comment.s = strdup_rpl(seq->comment.s);
-            if (NULL == sequences[count].comment.s) {
-                perror("strdup comment");
-                exit(1);
-            }
-        }
-        if (sequences[count].seq.l) {
-            sequences[count].seq.s = strdup_rpl(seq->seq.s);
-            if (NULL == sequences[count].seq.s) {
-                perror("strdup seq");
-                exit(1);
-            }
-        }
-        if (sequences[count].qual.l) {
-            sequences[count].qual.s = strdup_rpl(seq->qual.s);
-            if (NULL == sequences[count].qual.s) {
-                perror("strdup qual");
-                exit(1);
+#if HAVE_ZLIB && defined(_OPENMP)
+    if (fp->producers > 0) {
+        /* thread 0 parses while the others inflate ahead of it */
+#pragma omp parallel num_threads(fp->producers+1)
+        {
+            if (0 == omp_get_thread_num()) {
+                fp->threaded = omp_get_num_threads() > 1;
+                parse_records(seq, &b, &arena);
+                inflater_stop(fp);
             }
-        }
-        ++count;
-
-        /* allocate more space for sequences if we ran out */
-        if (count >= capacity) {
-            parasail_sequence_t *new_sequences = NULL;
-            capacity *= 2;
-            errno = 0;
-            new_sequences = (parasail_sequence_t*)realloc(sequences, sizeof(parasail_sequence_t) * capacity);
-            if (NULL == new_sequences) {
-                perror("realloc");
-                exit(1);
+            else {
+                inflater_produce(fp);
             }
-            sequences = new_sequences;
-            errno = 0;
         }
     }
+    else
+#endif
+    {
+        parse_records(seq, &b, &arena);
+    }
     kseq_destroy(seq);
 #if HAVE_ZLIB
-    gzclose(fp);
+    inflater_close(fp);
 #else
     if (!is_stdin) {
         fclose(fp);
     }
 #endif
 
-    retval->seqs = sequences;
-    retval->l = count;
-    retval->characters = chars;
-    retval->shortest = stats._min;
-    retval->longest = stats._max;
-    retval->mean = stats._mean;
-    retval->stddev = stats_stddev(&stats);
-
-    return retval;
+    return builder_finish(&b, arena.buf, arena.size, 0);
 }
 
 void parasail_sequences_free(parasail_sequences_t *sequences)
 {
-    size_t i;
-    for (i=0; i<sequences->l; ++i) {
-        if (sequences->seqs[i].name.s)    free(sequences->seqs[i].name.s);
-        if (sequences->seqs[i].comment.s) free(sequences->seqs[i].comment.s);
-        if (sequences->seqs[i].seq.s)     free(sequences->seqs[i].seq.s);
-        if (sequences->seqs[i].qual.s)    free(sequences->seqs[i].qual.s);
+    if (NULL == sequences->arena) {
+        /* strings allocated one at a time by the caller */
+        size_t i;
+        for (i=0; i<sequences->l; ++i) {
+            if (sequences->seqs[i].name.s)    free(sequences->seqs[i].name.s);
+            if (sequences->seqs[i].comment.s) free(sequences->seqs[i].comment.s);
+            if (sequences->seqs[i].seq.s)     free(sequences->seqs[i].seq.s);
+            if (sequences->seqs[i].qual.s)    free(sequences->seqs[i].qual.s);
+        }
+    }
+#if defined(HAVE_SYS_MMAN_H)
+    else if (sequences->arena_mapped) {
+        munmap(sequences->arena, sequences->arena_size);
+    }
+#endif
+    else {
+        free(sequences->arena);
+    }
+    free(sequences->seqs);
+    free(sequences);
+}
+
+parasail_encoded_sequences_t* parasail_sequences_encode(
+        const parasail_sequences_t *sequences,
+        const parasail_matrix_t *matrix, int bits)
+{
+    parasail_encoded_sequences_t *encoded = NULL;
+    const long count = (long)sequences->l;
+    long bad = count;
+    int bad_residue = 0;
+    size_t offset = 0;
+    long i = 0;
+
+    if (2 != bits && 4 != bits && 8 != bits) {
+        fprintf(stderr, "encoding must use 2, 4, or 8 bits, not %d\n", bits);
+        exit(1);
+    }
+
+    encoded = (parasail_encoded_sequences_t*)malloc(sizeof(parasail_encoded_sequences_t));
+    if (NULL == encoded) {
+        perror("malloc");
+        exit(1);
     }
+    encoded->l = sequences->l;
+    encoded->size = 0;
+    for (i=0; i<count; ++i) {
+        encoded->size += parasail_encoded_size((int)sequences->seqs[i].seq.l, bits);
+    }
+    encoded->seqs = (parasail_encoded_t*)malloc(sizeof(parasail_encoded_t) * (count+1));
+    encoded->codes = (unsigned char*)malloc(encoded->size + 1);
+    if (NULL == encoded->seqs || NULL == encoded->codes) {
+        perror("malloc");
+        exit(1);
+    }
+    for (i=0; i<count; ++i) {
+        int length = (int)sequences->seqs[i].seq.l;
+        encoded->seqs[i].codes = encoded->codes + offset;
+        encoded->seqs[i].length = length;
+        encoded->seqs[i].bits = bits;
+        offset += parasail_encoded_size(length, bits);
+    }
+
+#pragma omp parallel for schedule(dynamic,64)
+    for (i=0; i<count; ++i) {
+        int residue = parasail_encode_codes(encoded->seqs[i].codes,
+                sequences->seqs[i].seq.s, encoded->seqs[i].length,
+                matrix, bits);
+        if (residue >= 0) {
+#pragma omp critical(parasail_encode_bad)
+            if (i < bad) {
+                bad = i;
+                bad_residue = residue;
+            }
+        }
+    }
+
+    if (bad < count) {
+        fprintf(stderr, "sequence %ld: residue '%c' of matrix '%s' does not fit in %d bits\n",
+                bad+1, sequences->seqs[bad].seq.s[bad_residue],
+                matrix->name, bits);
+        exit(1);
+    }
+
+    return encoded;
+}
+
+parasail_encoded_sequences_t* parasail_encoded_sequences_from_file(
+        const char *fname, const parasail_matrix_t *matrix, int bits)
+{
+    parasail_sequences_t *sequences = NULL;
+    parasail_encoded_sequences_t *encoded = NULL;
+
+    sequences = parasail_sequences_from_file(fname);
+    encoded = parasail_sequences_encode(sequences, matrix, bits);
+    parasail_sequences_free(sequences);
+
+    return encoded;
+}
+
+void parasail_encoded_sequences_free(parasail_encoded_sequences_t *sequences)
+{
+    free(sequences->codes);
     free(sequences->seqs);
     free(sequences);
 }
@@ -12,6 +12,8 @@
 #include <string.h>
 
 #include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
 
 
 
@@ -106,6 +108,29 @@ parasail_result_t* parasail_nw_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -244,6 +269,29 @@ parasail_result_t* parasail_nw_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -382,6 +430,29 @@ parasail_result_t* parasail_nw_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -520,6 +591,29 @@ parasail_result_t* parasail_nw_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -658,6 +752,29 @@ parasail_result_t* parasail_nw_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -796,6 +913,29 @@ parasail_result_t* parasail_nw_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -934,6 +1074,29 @@ parasail_result_t* parasail_nw_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1072,6 +1235,29 @@ parasail_result_t* parasail_nw_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1210,6 +1396,29 @@ parasail_result_t* parasail_nw_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1348,6 +1557,29 @@ parasail_result_t* parasail_nw_stats_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1486,6 +1718,29 @@ parasail_result_t* parasail_nw_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1624,6 +1879,29 @@ parasail_result_t* parasail_nw_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1762,6 +2040,29 @@ parasail_result_t* parasail_nw_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -1900,6 +2201,29 @@ parasail_result_t* parasail_nw_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2038,8 +2362,8 @@ parasail_result_t* parasail_nw_rowcol_diag_avx2_256_sat(
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_rowcol_diag_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_rowcol_diag_avx512bw_512_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -2047,10 +2371,33 @@ parasail_result_t* parasail_nw_rowcol_diag_altivec_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_diag_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_nw_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_diag_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_nw_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_rowcol_diag_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_rowcol_diag_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_rowcol_diag_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
@@ -2176,6 +2523,29 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2314,6 +2684,29 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2452,6 +2845,29 @@ parasail_result_t* parasail_nw_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_stats_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_stats_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_stats_rowcol_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2590,6 +3006,29 @@ parasail_result_t* parasail_nw_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_trace_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_trace_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2728,6 +3167,29 @@ parasail_result_t* parasail_nw_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_trace_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_trace_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -2866,6 +3328,29 @@ parasail_result_t* parasail_nw_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_nw_trace_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_nw_trace_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_nw_trace_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3004,6 +3489,29 @@ parasail_result_t* parasail_sg_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3142,6 +3650,29 @@ parasail_result_t* parasail_sg_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3280,6 +3811,29 @@ parasail_result_t* parasail_sg_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3418,6 +3972,29 @@ parasail_result_t* parasail_sg_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3556,6 +4133,29 @@ parasail_result_t* parasail_sg_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3694,6 +4294,29 @@ parasail_result_t* parasail_sg_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3832,6 +4455,29 @@ parasail_result_t* parasail_sg_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -3970,6 +4616,29 @@ parasail_result_t* parasail_sg_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4108,6 +4777,29 @@ parasail_result_t* parasail_sg_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4246,6 +4938,29 @@ parasail_result_t* parasail_sg_stats_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4384,6 +5099,29 @@ parasail_result_t* parasail_sg_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4522,6 +5260,29 @@ parasail_result_t* parasail_sg_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4660,6 +5421,29 @@ parasail_result_t* parasail_sg_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4798,6 +5582,29 @@ parasail_result_t* parasail_sg_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -4936,6 +5743,29 @@ parasail_result_t* parasail_sg_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_rowcol_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5074,6 +5904,29 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5212,6 +6065,29 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5350,6 +6226,29 @@ parasail_result_t* parasail_sg_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_stats_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_stats_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_stats_rowcol_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5488,6 +6387,29 @@ parasail_result_t* parasail_sg_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_trace_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_trace_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5626,6 +6548,29 @@ parasail_result_t* parasail_sg_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_trace_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_trace_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5764,6 +6709,29 @@ parasail_result_t* parasail_sg_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sg_trace_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sg_trace_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sg_trace_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -5902,8 +6870,8 @@ parasail_result_t* parasail_sw_scan_avx2_256_sat(
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_scan_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_scan_avx512bw_512_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -5911,129 +6879,14 @@ parasail_result_t* parasail_sw_scan_altivec_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_sw_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_altivec_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
-
-#if HAVE_NEON
-parasail_result_t* parasail_sw_scan_neon_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-
-    result = parasail_sw_scan_neon_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_neon_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_scan_neon_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
-
-
-parasail_result_t* parasail_sw_striped_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-
-    result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_striped_sse2_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-
-    result = parasail_sw_striped_sse2_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse2_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse2_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
-
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_striped_sse41_128_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-
-    result = parasail_sw_striped_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-
-    return result;
-}
-#endif
-
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_striped_avx2_256_sat(
-        const char * const restrict s1, const int s1Len,
-        const char * const restrict s2, const int s2Len,
-        const int open, const int gap,
-        const parasail_matrix_t *matrix)
-{
-    parasail_result_t * result = NULL;
-
-    result = parasail_sw_striped_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, matrix);
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, matrix);
-    }
-    if (parasail_result_is_saturated(result)) {
-        parasail_result_free(result);
-        result = parasail_sw_striped_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
 
     return result;
@@ -6041,7 +6894,7 @@ parasail_result_t* parasail_sw_striped_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_striped_altivec_128_sat(
+parasail_result_t* parasail_sw_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -6049,14 +6902,14 @@ parasail_result_t* parasail_sw_striped_altivec_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_sw_scan_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_altivec_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_altivec_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
 
     return result;
@@ -6064,7 +6917,7 @@ parasail_result_t* parasail_sw_striped_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sw_striped_neon_128_sat(
+parasail_result_t* parasail_sw_scan_neon_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -6072,14 +6925,14 @@ parasail_result_t* parasail_sw_striped_neon_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_neon_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_sw_scan_neon_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_neon_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_neon_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_neon_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_scan_neon_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
 
     return result;
@@ -6178,6 +7031,29 @@ parasail_result_t* parasail_sw_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -6316,6 +7192,29 @@ parasail_result_t* parasail_sw_stats_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -6454,6 +7353,29 @@ parasail_result_t* parasail_sw_stats_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -6592,6 +7514,29 @@ parasail_result_t* parasail_sw_stats_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -6730,6 +7675,29 @@ parasail_result_t* parasail_sw_table_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_table_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -6868,6 +7836,29 @@ parasail_result_t* parasail_sw_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7006,6 +7997,29 @@ parasail_result_t* parasail_sw_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7144,8 +8158,8 @@ parasail_result_t* parasail_sw_stats_table_scan_avx2_256_sat(
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_table_scan_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_table_scan_avx512bw_512_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -7153,22 +8167,22 @@ parasail_result_t* parasail_sw_stats_table_scan_altivec_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_sw_stats_table_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_stats_table_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_altivec_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_stats_table_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_stats_table_scan_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_table_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap,
@@ -7176,10 +8190,33 @@ parasail_result_t* parasail_sw_stats_table_scan_neon_128_sat(
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_neon_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    result = parasail_sw_stats_table_scan_altivec_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_neon_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+        result = parasail_sw_stats_table_scan_altivec_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_altivec_128_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_table_scan_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_neon_128_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_neon_128_16(s1, s1Len, s2, s2Len, open, gap, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
@@ -7282,6 +8319,29 @@ parasail_result_t* parasail_sw_stats_table_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_table_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_table_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7420,6 +8480,29 @@ parasail_result_t* parasail_sw_stats_table_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_table_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_table_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7558,6 +8641,29 @@ parasail_result_t* parasail_sw_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7696,6 +8802,29 @@ parasail_result_t* parasail_sw_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7834,6 +8963,29 @@ parasail_result_t* parasail_sw_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_rowcol_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -7972,6 +9124,29 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_rowcol_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_rowcol_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8110,6 +9285,29 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_rowcol_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_rowcol_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8248,6 +9446,29 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_rowcol_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_stats_rowcol_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8386,6 +9607,29 @@ parasail_result_t* parasail_sw_trace_scan_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_trace_scan_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_trace_scan_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8524,6 +9768,29 @@ parasail_result_t* parasail_sw_trace_striped_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_trace_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_trace_striped_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8662,6 +9929,29 @@ parasail_result_t* parasail_sw_trace_diag_avx2_256_sat(
 }
 #endif
 
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_trace_diag_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_diag_avx512bw_512_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_diag_avx512bw_512_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_diag_avx512bw_512_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+#endif
+
 #if HAVE_ALTIVEC
 parasail_result_t* parasail_sw_trace_diag_altivec_128_sat(
         const char * const restrict s1, const int s1Len,
@@ -8709,241 +9999,252 @@ parasail_result_t* parasail_sw_trace_diag_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_nw_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_nw_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_scan_profile_sse2_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_scan_profile_sse41_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_NEON
+parasail_result_t* parasail_nw_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_scan_profile_altivec_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+parasail_result_t* parasail_nw_trace_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_scan_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_trace_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_trace_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_striped_profile_sse2_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_NEON
+parasail_result_t* parasail_nw_trace_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_striped_profile_sse41_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+parasail_result_t* parasail_sg_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
-        const parasail_profile_t * const restrict profile,
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_striped_profile_altivec_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
@@ -8951,21 +10252,22 @@ parasail_result_t* parasail_nw_striped_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_nw_striped_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
@@ -8973,241 +10275,252 @@ parasail_result_t* parasail_nw_striped_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_nw_stats_scan_profile_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sg_trace_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_trace_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_trace_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_NEON
+parasail_result_t* parasail_sg_trace_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_scan_profile_altivec_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+parasail_result_t* parasail_sw_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_stats_scan_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_striped_profile_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_NEON
+parasail_result_t* parasail_sw_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat(
-        const parasail_profile_t * const restrict profile,
+
+parasail_result_t* parasail_sw_trace_banded_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_trace_banded_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
-        const parasail_profile_t * const restrict profile,
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_trace_banded_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_trace_banded_sse41_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_sse41_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_sse41_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_striped_profile_altivec_128_sat(
-        const parasail_profile_t * const restrict profile,
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_trace_banded_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_trace_banded_avx2_256_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_avx2_256_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_avx2_256_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
@@ -9215,21 +10528,22 @@ parasail_result_t* parasail_nw_stats_striped_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_nw_stats_striped_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
+parasail_result_t* parasail_sw_trace_banded_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
-        const int open, const int gap)
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_trace_banded_neon_128_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_neon_128_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_trace_banded_neon_128_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
     }
 
     return result;
@@ -9237,21 +10551,21 @@ parasail_result_t* parasail_nw_stats_striped_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_nw_table_scan_profile_sat(
+parasail_result_t* parasail_nw_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -9259,21 +10573,21 @@ parasail_result_t* parasail_nw_table_scan_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -9281,21 +10595,21 @@ parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat(
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -9303,813 +10617,813 @@ parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_table_scan_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_table_scan_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_table_striped_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_table_striped_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_table_striped_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat(
+
+parasail_result_t* parasail_nw_stats_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_table_scan_profile_altivec_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_stats_table_scan_profile_neon_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_stats_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_stats_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
+
+parasail_result_t* parasail_nw_stats_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_table_striped_profile_altivec_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_stats_table_striped_profile_neon_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_stats_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_stats_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_rowcol_scan_profile_altivec_128_sat(
+
+parasail_result_t* parasail_nw_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_rowcol_scan_profile_neon_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_table_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_table_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_rowcol_striped_profile_neon_128_sat(
+
+parasail_result_t* parasail_nw_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_table_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10117,21 +11431,21 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_altivec_128_sat(
+parasail_result_t* parasail_nw_table_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10139,21 +11453,21 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_nw_stats_rowcol_scan_profile_neon_128_sat(
+parasail_result_t* parasail_nw_table_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10161,21 +11475,21 @@ parasail_result_t* parasail_nw_stats_rowcol_scan_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10183,21 +11497,21 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10205,21 +11519,21 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -10227,813 +11541,813 @@ parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_stats_rowcol_striped_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_stats_table_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_trace_scan_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_stats_table_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_trace_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_stats_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_trace_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_trace_scan_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_trace_scan_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_trace_scan_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_table_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_nw_trace_striped_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_stats_table_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_nw_trace_striped_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_stats_table_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_nw_trace_striped_profile_sse41_128_sat(
+
+parasail_result_t* parasail_nw_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_nw_trace_striped_profile_avx2_256_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_nw_trace_striped_profile_altivec_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_nw_trace_striped_profile_neon_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_nw_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_nw_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_scan_profile_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_rowcol_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_scan_profile_sse2_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_rowcol_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_scan_profile_sse41_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_rowcol_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
+
+parasail_result_t* parasail_nw_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_scan_profile_altivec_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_scan_profile_neon_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_striped_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_striped_profile_sse2_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_rowcol_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_striped_profile_sse41_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_rowcol_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_rowcol_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_striped_profile_altivec_128_sat(
+
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_striped_profile_neon_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_scan_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_scan_profile_altivec_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_stats_rowcol_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_stats_scan_profile_neon_128_sat(
+
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_sg_stats_striped_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11041,21 +12355,21 @@ parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_striped_profile_altivec_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11063,21 +12377,21 @@ parasail_result_t* parasail_sg_stats_striped_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sg_stats_striped_profile_neon_128_sat(
+parasail_result_t* parasail_nw_stats_rowcol_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11085,21 +12399,21 @@ parasail_result_t* parasail_sg_stats_striped_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_sg_table_scan_profile_sat(
+parasail_result_t* parasail_nw_trace_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11107,21 +12421,21 @@ parasail_result_t* parasail_sg_table_scan_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_trace_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11129,21 +12443,21 @@ parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat(
+parasail_result_t* parasail_nw_trace_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11151,813 +12465,813 @@ parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_nw_trace_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_table_scan_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_trace_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_table_scan_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_trace_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_table_striped_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_trace_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_nw_trace_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_trace_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_trace_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_table_striped_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_trace_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_table_striped_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_trace_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_trace_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_nw_trace_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_nw_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_nw_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat(
+
+parasail_result_t* parasail_sg_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_table_scan_profile_altivec_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_stats_table_scan_profile_neon_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
+
+parasail_result_t* parasail_sg_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_table_striped_profile_altivec_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_stats_table_striped_profile_neon_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_rowcol_scan_profile_altivec_128_sat(
+
+parasail_result_t* parasail_sg_stats_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_rowcol_scan_profile_neon_128_sat(
-        const parasail_profile_t * const restrict profile,
-        const char * const restrict s2, const int s2Len,
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_stats_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_stats_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_rowcol_striped_profile_neon_128_sat(
+
+parasail_result_t* parasail_sg_stats_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11965,21 +13279,21 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -11987,21 +13301,21 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_sat(
+parasail_result_t* parasail_sg_stats_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12009,21 +13323,21 @@ parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12031,21 +13345,21 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12053,21 +13367,21 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat(
+parasail_result_t* parasail_sg_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12075,813 +13389,813 @@ parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_stats_rowcol_striped_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_table_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_trace_scan_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_table_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_trace_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_trace_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_trace_scan_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_trace_scan_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_trace_scan_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_table_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sg_trace_striped_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_table_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sg_trace_striped_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_table_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sg_trace_striped_profile_sse41_128_sat(
+
+parasail_result_t* parasail_sg_stats_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sg_trace_striped_profile_avx2_256_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sg_trace_striped_profile_altivec_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sg_trace_striped_profile_neon_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sg_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sg_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_scan_profile_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_scan_profile_sse2_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_stats_table_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_scan_profile_sse41_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_stats_table_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
+
+parasail_result_t* parasail_sg_stats_table_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_scan_profile_altivec_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_scan_profile_neon_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_striped_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_striped_profile_sse2_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_table_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_striped_profile_sse41_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_stats_table_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_stats_table_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_striped_profile_altivec_128_sat(
+
+parasail_result_t* parasail_sg_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_striped_profile_neon_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_stats_scan_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_rowcol_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_rowcol_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_scan_profile_altivec_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_rowcol_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_stats_scan_profile_neon_128_sat(
+
+parasail_result_t* parasail_sg_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_sw_stats_striped_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_rowcol_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12889,21 +14203,21 @@ parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_striped_profile_altivec_128_sat(
+parasail_result_t* parasail_sg_rowcol_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12911,21 +14225,21 @@ parasail_result_t* parasail_sw_stats_striped_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sw_stats_striped_profile_neon_128_sat(
+parasail_result_t* parasail_sg_rowcol_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12933,21 +14247,21 @@ parasail_result_t* parasail_sw_stats_striped_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_sw_table_scan_profile_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12955,21 +14269,21 @@ parasail_result_t* parasail_sw_table_scan_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12977,21 +14291,21 @@ parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -12999,813 +14313,813 @@ parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_table_scan_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_table_scan_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_table_striped_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_stats_rowcol_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_table_striped_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_table_striped_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_stats_rowcol_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat(
+
+parasail_result_t* parasail_sg_trace_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_trace_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_trace_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_trace_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_trace_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_trace_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_trace_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
+
+parasail_result_t* parasail_sg_trace_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_table_striped_profile_altivec_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_trace_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_stats_table_striped_profile_neon_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_trace_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_trace_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_trace_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_trace_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sg_trace_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sg_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sg_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_rowcol_scan_profile_altivec_128_sat(
+
+parasail_result_t* parasail_sw_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_rowcol_scan_profile_neon_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sw_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_rowcol_striped_profile_neon_128_sat(
+
+parasail_result_t* parasail_sw_stats_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
 
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13813,21 +15127,21 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_altivec_128_sat(
+parasail_result_t* parasail_sw_stats_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13835,21 +15149,21 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sw_stats_rowcol_scan_profile_neon_128_sat(
+parasail_result_t* parasail_sw_stats_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13857,21 +15171,21 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_neon_128_sat(
 #endif
 
 
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+parasail_result_t* parasail_sw_stats_striped_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13879,21 +15193,21 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
 
 
 #if HAVE_SSE2
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat(
+parasail_result_t* parasail_sw_stats_striped_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13901,21 +15215,21 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
+parasail_result_t* parasail_sw_stats_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -13923,241 +15237,285 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sw_stats_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_striped_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_trace_scan_profile_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_stats_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_stats_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
 
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_trace_scan_profile_sse2_128_sat(
+parasail_result_t* parasail_sw_table_scan_profile_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
-#endif
 
-#if HAVE_SSE41
-parasail_result_t* parasail_sw_trace_scan_profile_sse41_128_sat(
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_table_scan_profile_sse2_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_AVX2
-parasail_result_t* parasail_sw_trace_scan_profile_avx2_256_sat(
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_table_scan_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_trace_scan_profile_altivec_128_sat(
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_table_scan_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-#if HAVE_NEON
-parasail_result_t* parasail_sw_trace_scan_profile_neon_128_sat(
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_table_scan_profile_avx512bw_512_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
-
-parasail_result_t* parasail_sw_trace_striped_profile_sat(
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_table_scan_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
+#endif
 
-
-#if HAVE_SSE2
-parasail_result_t* parasail_sw_trace_striped_profile_sse2_128_sat(
+#if HAVE_NEON
+parasail_result_t* parasail_sw_table_scan_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_table_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -14165,21 +15523,21 @@ parasail_result_t* parasail_sw_trace_striped_profile_sse2_128_sat(
 #endif
 
 #if HAVE_SSE41
-parasail_result_t* parasail_sw_trace_striped_profile_sse41_128_sat(
+parasail_result_t* parasail_sw_table_striped_profile_sse41_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -14187,21 +15545,43 @@ parasail_result_t* parasail_sw_trace_striped_profile_sse41_128_sat(
 #endif
 
 #if HAVE_AVX2
-parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
+parasail_result_t* parasail_sw_table_striped_profile_avx2_256_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -14209,21 +15589,21 @@ parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
 #endif
 
 #if HAVE_ALTIVEC
-parasail_result_t* parasail_sw_trace_striped_profile_altivec_128_sat(
+parasail_result_t* parasail_sw_table_striped_profile_altivec_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
@@ -14231,24 +15611,3525 @@ parasail_result_t* parasail_sw_trace_striped_profile_altivec_128_sat(
 #endif
 
 #if HAVE_NEON
-parasail_result_t* parasail_sw_trace_striped_profile_neon_128_sat(
+parasail_result_t* parasail_sw_table_striped_profile_neon_128_sat(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
     parasail_result_t * result = NULL;
 
-    result = parasail_sw_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    result = parasail_sw_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
     }
     if (parasail_result_is_saturated(result)) {
         parasail_result_free(result);
-        result = parasail_sw_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+        result = parasail_sw_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_table_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_table_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_table_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_table_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_table_scan_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
     }
 
     return result;
 }
 #endif
 
+
+parasail_result_t* parasail_sw_stats_table_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_table_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_table_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_table_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_table_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_table_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_table_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_rowcol_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_rowcol_scan_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_rowcol_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_rowcol_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_rowcol_scan_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_stats_rowcol_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_stats_rowcol_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_stats_rowcol_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_trace_scan_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_trace_scan_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_trace_scan_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_trace_scan_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_trace_scan_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_trace_scan_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_trace_scan_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_scan_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_scan_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_trace_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_trace_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_sse2_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_sse2_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_sse2_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_trace_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_sse41_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_sse41_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_sse41_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_trace_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_avx2_256_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_avx2_256_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_trace_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_avx512bw_512_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_avx512bw_512_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_avx512bw_512_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_trace_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_altivec_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_altivec_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_trace_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+    result = parasail_sw_trace_striped_profile_neon_128_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_neon_128_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_trace_striped_profile_neon_128_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_nw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_sse2_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse2_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse2_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_sse2_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse2_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse2_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_sse41_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse41_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse41_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_sse41_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse41_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_sse41_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_avx2_256_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx2_256_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx2_256_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_avx2_256_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx2_256_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx2_256_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_avx512bw_512_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx512bw_512_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx512bw_512_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_avx512bw_512_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx512bw_512_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_avx512bw_512_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_altivec_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_altivec_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_altivec_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_altivec_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_altivec_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_altivec_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_nw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_neon_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_neon_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_neon_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_scan_profile_neon_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_neon_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_scan_profile_neon_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_nw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_sse2_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse2_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse2_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_sse2_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse2_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse2_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_sse41_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse41_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse41_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_sse41_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse41_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_sse41_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_avx2_256_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx2_256_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx2_256_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_avx2_256_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx2_256_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx2_256_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_avx512bw_512_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx512bw_512_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx512bw_512_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_avx512bw_512_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx512bw_512_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_avx512bw_512_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_altivec_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_altivec_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_altivec_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_altivec_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_altivec_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_altivec_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_nw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_neon_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_neon_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_neon_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_nw_striped_profile_neon_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_neon_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_nw_striped_profile_neon_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_sse2_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse2_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse2_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_sse2_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse2_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse2_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_sse41_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse41_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse41_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_sse41_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse41_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_sse41_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_avx2_256_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx2_256_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx2_256_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_avx2_256_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx2_256_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx2_256_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_avx512bw_512_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx512bw_512_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx512bw_512_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_avx512bw_512_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx512bw_512_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_avx512bw_512_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_altivec_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_altivec_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_altivec_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_altivec_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_altivec_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_altivec_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sg_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_neon_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_neon_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_neon_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_scan_profile_neon_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_neon_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_scan_profile_neon_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sg_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_sse2_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse2_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse2_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_sse2_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse2_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse2_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_sse41_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse41_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse41_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_sse41_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse41_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_sse41_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_avx2_256_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx2_256_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx2_256_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_avx2_256_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx2_256_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx2_256_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_avx512bw_512_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx512bw_512_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx512bw_512_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_avx512bw_512_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx512bw_512_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_avx512bw_512_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_altivec_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_altivec_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_altivec_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_altivec_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_altivec_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_altivec_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sg_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_neon_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_neon_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_neon_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sg_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sg_striped_profile_neon_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_neon_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sg_striped_profile_neon_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+
+parasail_result_t* parasail_sw_scan_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_sse2_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse2_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse2_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_sse2_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse2_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse2_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_sse41_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse41_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse41_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_sse41_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse41_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_sse41_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_avx2_256_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx2_256_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx2_256_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_avx2_256_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx2_256_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx2_256_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_avx512bw_512_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx512bw_512_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx512bw_512_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_avx512bw_512_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx512bw_512_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_avx512bw_512_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_altivec_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_altivec_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_altivec_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_altivec_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_altivec_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_altivec_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t* parasail_sw_scan_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_neon_128_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_neon_128_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_neon_128_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_scan_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    parasail_sw_scan_profile_neon_128_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_neon_128_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_scan_profile_neon_128_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+#endif
+
+
+typedef parasail_result_t* parasail_ppfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result,
+        parasail_promote_t * const restrict promote);
+
+static parasail_sat_hook_t *sat_hook = NULL;
+static void *sat_hook_data = NULL;
+
+void parasail_set_sat_hook(parasail_sat_hook_t *hook, void *data)
+{
+    sat_hook = hook;
+    sat_hook_data = data;
+}
+
+/* Align using the 8, 16, then 32-bit kernels in functions, each one
+ * resuming where the previous one saturated.  Profile widths missing
+ * from profile are created using creators.  If encoded is not NULL it
+ * is aligned instead of s2. */
+static parasail_result_t* sat_promote(
+        parasail_ppfunction_t * const * functions,
+        parasail_pcreator_t * const * creators,
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    static const int bits[3] = {8, 16, 32};
+    const void *scores[3] = {
+        profile->profile8.score,
+        profile->profile16.score,
+        profile->profile32.score};
+    parasail_promote_t promote = {-1, 0, NULL, NULL};
+    int k = 0;
+
+    for (k=0; k<3; ++k) {
+        parasail_profile_t *created = NULL;
+        if (k > 0 && NULL != sat_hook && promote.column >= 0) {
+            sat_hook(bits[k-1], bits[k],
+                    (long long)(promote.column+1)*profile->s1Len,
+                    sat_hook_data);
+        }
+        if (NULL == scores[k]) {
+            created = creators[k](profile->s1, profile->s1Len, profile->matrix);
+        }
+        functions[k](created ? created : profile,
+                s2, s2Len, encoded, open, gap, workspace, result, &promote);
+        if (NULL != created) {
+            parasail_profile_free(created);
+        }
+        if (!parasail_result_is_saturated(result)) {
+            break;
+        }
+    }
+
+    free(promote.E);
+    free(promote.H);
+
+    return result;
+}
+
+#if HAVE_SSE2
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse2_128_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse2_128_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse2_128_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_sse2_128_promote[3] = {
+    parasail_sw_striped_profile_sse2_128_8_promote,
+    parasail_sw_striped_profile_sse2_128_16_promote,
+    parasail_sw_striped_profile_sse2_128_32_promote};
+
+static parasail_pcreator_t * const sw_striped_sse2_128_creators[3] = {
+    parasail_profile_create_sse_128_8,
+    parasail_profile_create_sse_128_16,
+    parasail_profile_create_sse_128_32};
+
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_sse2_128_promote, sw_striped_sse2_128_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_sse2_128_promote, sw_striped_sse2_128_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_sse2_128_promote, sw_striped_sse2_128_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_sse2_128_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+#if HAVE_SSE41
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse41_128_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse41_128_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_sse41_128_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_sse41_128_promote[3] = {
+    parasail_sw_striped_profile_sse41_128_8_promote,
+    parasail_sw_striped_profile_sse41_128_16_promote,
+    parasail_sw_striped_profile_sse41_128_32_promote};
+
+static parasail_pcreator_t * const sw_striped_sse41_128_creators[3] = {
+    parasail_profile_create_sse_128_8,
+    parasail_profile_create_sse_128_16,
+    parasail_profile_create_sse_128_32};
+
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_sse41_128_promote, sw_striped_sse41_128_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_sse41_128_promote, sw_striped_sse41_128_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_sse41_128_promote, sw_striped_sse41_128_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_sse_128_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_sse41_128_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+#if HAVE_AVX2
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx2_256_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx2_256_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx2_256_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_avx2_256_promote[3] = {
+    parasail_sw_striped_profile_avx2_256_8_promote,
+    parasail_sw_striped_profile_avx2_256_16_promote,
+    parasail_sw_striped_profile_avx2_256_32_promote};
+
+static parasail_pcreator_t * const sw_striped_avx2_256_creators[3] = {
+    parasail_profile_create_avx_256_8,
+    parasail_profile_create_avx_256_16,
+    parasail_profile_create_avx_256_32};
+
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_avx2_256_promote, sw_striped_avx2_256_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_avx2_256_promote, sw_striped_avx2_256_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_avx2_256_promote, sw_striped_avx2_256_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx_256_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_avx2_256_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+#if HAVE_AVX512BW
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx512bw_512_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx512bw_512_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_avx512bw_512_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_avx512bw_512_promote[3] = {
+    parasail_sw_striped_profile_avx512bw_512_8_promote,
+    parasail_sw_striped_profile_avx512bw_512_16_promote,
+    parasail_sw_striped_profile_avx512bw_512_32_promote};
+
+static parasail_pcreator_t * const sw_striped_avx512bw_512_creators[3] = {
+    parasail_profile_create_avx_512_8,
+    parasail_profile_create_avx_512_16,
+    parasail_profile_create_avx_512_32};
+
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_avx512bw_512_promote, sw_striped_avx512bw_512_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_avx512bw_512_promote, sw_striped_avx512bw_512_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_avx512bw_512_promote, sw_striped_avx512bw_512_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_avx_512_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_avx512bw_512_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+#if HAVE_ALTIVEC
+extern parasail_ppfunction_t parasail_sw_striped_profile_altivec_128_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_altivec_128_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_altivec_128_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_altivec_128_promote[3] = {
+    parasail_sw_striped_profile_altivec_128_8_promote,
+    parasail_sw_striped_profile_altivec_128_16_promote,
+    parasail_sw_striped_profile_altivec_128_32_promote};
+
+static parasail_pcreator_t * const sw_striped_altivec_128_creators[3] = {
+    parasail_profile_create_altivec_128_8,
+    parasail_profile_create_altivec_128_16,
+    parasail_profile_create_altivec_128_32};
+
+parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_altivec_128_promote, sw_striped_altivec_128_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_altivec_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_altivec_128_promote, sw_striped_altivec_128_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_altivec_128_promote, sw_striped_altivec_128_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_altivec_128_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_altivec_128_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+#if HAVE_NEON
+extern parasail_ppfunction_t parasail_sw_striped_profile_neon_128_8_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_neon_128_16_promote;
+extern parasail_ppfunction_t parasail_sw_striped_profile_neon_128_32_promote;
+
+static parasail_ppfunction_t * const sw_striped_neon_128_promote[3] = {
+    parasail_sw_striped_profile_neon_128_8_promote,
+    parasail_sw_striped_profile_neon_128_16_promote,
+    parasail_sw_striped_profile_neon_128_32_promote};
+
+static parasail_pcreator_t * const sw_striped_neon_128_creators[3] = {
+    parasail_profile_create_neon_128_8,
+    parasail_profile_create_neon_128_16,
+    parasail_profile_create_neon_128_32};
+
+parasail_result_t* parasail_sw_striped_profile_neon_128_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_neon_128_promote, sw_striped_neon_128_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_neon_128_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(sw_striped_neon_128_promote, sw_striped_neon_128_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(sw_striped_neon_128_promote, sw_striped_neon_128_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_create_neon_128_8(s1, s1Len, matrix);
+    parasail_result_t *result = parasail_sw_striped_profile_neon_128_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+#endif
+
+parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        return parasail_sw_striped_avx512bw_512_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_avx2_256_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_sse41_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_sse2_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        return parasail_sw_striped_altivec_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        return parasail_sw_striped_neon_128_sat(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif
+
+    result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        return parasail_sw_striped_profile_avx512bw_512_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_profile_avx2_256_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_profile_sse41_128_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_profile_sse2_128_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        return parasail_sw_striped_profile_altivec_128_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        return parasail_sw_striped_profile_neon_128_sat(profile, s2, s2Len, open, gap);
+    }
+#endif
+
+    result = parasail_sw_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        return parasail_sw_striped_profile_avx512bw_512_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_profile_avx2_256_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_profile_sse41_128_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_profile_sse2_128_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        return parasail_sw_striped_profile_altivec_128_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        return parasail_sw_striped_profile_neon_128_sat_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+#endif
+
+    parasail_sw_striped_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        return parasail_sw_striped_profile_avx512bw_512_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        return parasail_sw_striped_profile_avx2_256_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        return parasail_sw_striped_profile_sse41_128_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        return parasail_sw_striped_profile_sse2_128_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        return parasail_sw_striped_profile_altivec_128_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        return parasail_sw_striped_profile_neon_128_sat_enc(profile, s2, open, gap, workspace, result);
+    }
+#endif
+
+    parasail_sw_striped_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+
+/* Replace the saturated results of a batch with results recomputed by
+ * function, which should use a wider element. */
+static void batch_resat(
+        parasail_bpfunction_t *function,
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        parasail_result_t **results)
+{
+    int i = 0;
+    int n = 0;
+    const char **sub_s2s = NULL;
+    int *sub_s2Lens = NULL;
+    int *index = NULL;
+    parasail_result_t **sub_results = NULL;
+
+    if (NULL == results) {
+        return;
+    }
+
+    for (i=0; i<count; ++i) {
+        if (parasail_result_is_saturated(results[i])) {
+            ++n;
+        }
+    }
+    if (0 == n) {
+        return;
+    }
+
+    sub_s2s = (const char **)malloc(sizeof(const char *)*n);
+    sub_s2Lens = (int *)malloc(sizeof(int)*n);
+    index = (int *)malloc(sizeof(int)*n);
+    n = 0;
+    for (i=0; i<count; ++i) {
+        if (parasail_result_is_saturated(results[i])) {
+            sub_s2s[n] = s2s[i];
+            sub_s2Lens[n] = s2Lens[i];
+            index[n] = i;
+            ++n;
+        }
+    }
+
+    sub_results = function(profile, sub_s2s, sub_s2Lens, n, open, gap);
+    for (i=0; i<n; ++i) {
+        parasail_result_free(results[index[i]]);
+        results[index[i]] = sub_results[i];
+    }
+
+    free(sub_results);
+    free(index);
+    free(sub_s2Lens);
+    free(sub_s2s);
+}
+
+
+parasail_result_t** parasail_sw_batch_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+
+
+#if HAVE_SSE2
+parasail_result_t** parasail_sw_batch_profile_sse2_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_sse2_128_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_sse2_128_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_sse2_128_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_sse2_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_sse2_128_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
+#if HAVE_SSE41
+parasail_result_t** parasail_sw_batch_profile_sse41_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_sse41_128_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_sse41_128_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_sse41_128_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_sse41_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_sse41_128_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
+#if HAVE_AVX2
+parasail_result_t** parasail_sw_batch_profile_avx2_256_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_avx2_256_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_avx2_256_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_avx2_256_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_avx2_256_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_avx2_256_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
+#if HAVE_AVX512BW
+parasail_result_t** parasail_sw_batch_profile_avx512bw_512_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_avx512bw_512_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_avx512bw_512_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_avx512bw_512_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_avx512bw_512_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_avx512bw_512_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
+#if HAVE_ALTIVEC
+parasail_result_t** parasail_sw_batch_profile_altivec_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_altivec_128_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_altivec_128_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_altivec_128_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_altivec_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_altivec_128_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
+#if HAVE_NEON
+parasail_result_t** parasail_sw_batch_profile_neon_128_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = parasail_sw_batch_profile_neon_128_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(parasail_sw_batch_profile_neon_128_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(parasail_sw_batch_profile_neon_128_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_neon_128_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = parasail_sw_batch_profile_neon_128_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+#endif
+
@@ -0,0 +1,218 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+
+
+#define FNAME parasail_sg_banded_neon_128_32
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int32_t N = 4; /* number of values in vector */
+    const int32_t PAD = N-1;
+    const int32_t PAD2 = PAD*2;
+    const int32_t s1Len_PAD = s1Len+PAD;
+    const int32_t s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const int32_t lo = MIN(0, s2Len-s1Len) - k;
+    const int32_t hi = MAX(0, s2Len-s1Len) + k;
+    int32_t * const restrict s1 = parasail_memalign_int32_t(16, s1Len+PAD);
+    int32_t * const restrict s2B= parasail_memalign_int32_t(16, s2Len+PAD2);
+    int32_t * const restrict _H_pr = parasail_memalign_int32_t(16, s2Len+PAD2);
+    int32_t * const restrict _F_pr = parasail_memalign_int32_t(16, s2Len+PAD2);
+    int32_t * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    int32_t * const restrict H_pr = _H_pr+PAD;
+    int32_t * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new();
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t end_query = s1Len;
+    int32_t end_ref = s2Len;
+    int32_t score = NEG_INF;
+    simde__m128i vNegInf = simde_mm_set1_epi32(NEG_INF);
+    simde__m128i vOpen = simde_mm_set1_epi32(open);
+    simde__m128i vGap  = simde_mm_set1_epi32(gap);
+    simde__m128i vZero = simde_mm_set1_epi32(0);
+    simde__m128i vK = simde_mm_set_epi32(0,1,2,3);
+    simde__m128i v2K = simde_mm_add_epi32(vK, vK);
+    
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? 0 : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const int32_t jbeg = MAX(0, i+lo);
+        const int32_t jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const int32_t kLast = s1Len-1-i;
+        simde__m128i vNH = vNegInf;
+        simde__m128i vWH = vNegInf;
+        simde__m128i vE = vNegInf;
+        simde__m128i vF = vNegInf;
+        simde__m128i vRowOut = simde_mm_cmpgt_epi32(vK, simde_mm_set1_epi32(CLAMP(kLast)));
+        const int * const restrict matrow0 = &matrix->matrix[matrix->size*s1[i+0]];
+        const int * const restrict matrow1 = &matrix->matrix[matrix->size*s1[i+1]];
+        const int * const restrict matrow2 = &matrix->matrix[matrix->size*s1[i+2]];
+        const int * const restrict matrow3 = &matrix->matrix[matrix->size*s1[i+3]];
+        vNH = simde_mm_insert_epi32(vNH, H_pr[jbeg-1], 3);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = simde_mm_insert_epi32(vWH, 0, 3);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            simde__m128i vMat;
+            simde__m128i vNWH = vNH;
+            simde__m128i vOut = vZero;
+            vNH = simde_mm_srli_si128(vWH, 4);
+            vNH = simde_mm_insert_epi32(vNH, H_pr[j], 3);
+            vF = simde_mm_srli_si128(vF, 4);
+            vF = simde_mm_insert_epi32(vF, F_pr[j], 3);
+            vF = simde_mm_max_epi32(
+                    simde_mm_sub_epi32(vNH, vOpen),
+                    simde_mm_sub_epi32(vF, vGap));
+            vE = simde_mm_max_epi32(
+                    simde_mm_sub_epi32(vWH, vOpen),
+                    simde_mm_sub_epi32(vE, vGap));
+            vMat = simde_mm_set_epi32(
+                    matrow0[s2[j-0]],
+                    matrow1[s2[j-1]],
+                    matrow2[s2[j-2]],
+                    matrow3[s2[j-3]]
+                    );
+            vNWH = simde_mm_add_epi32(vNWH, vMat);
+            vWH = simde_mm_max_epi32(vNWH, vE);
+            vWH = simde_mm_max_epi32(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                simde__m128i cond = simde_mm_cmpeq_epi32(vK, simde_mm_set1_epi32(CLAMP(j+1)));
+                simde__m128i condEF;
+                vOut = simde_mm_or_si128(
+                        simde_mm_or_si128(
+                            simde_mm_cmpgt_epi32(v2K, simde_mm_set1_epi32(CLAMP(j-i-lo))),
+                            simde_mm_cmplt_epi32(v2K, simde_mm_set1_epi32(CLAMP(j-i-hi)))),
+                        simde_mm_or_si128(
+                            simde_mm_or_si128(
+                                simde_mm_cmplt_epi32(vK, simde_mm_set1_epi32(CLAMP(j-s2Len+1))),
+                                simde_mm_cmpgt_epi32(vK, simde_mm_set1_epi32(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = simde_mm_or_si128(cond, vOut);
+                vWH = simde_mm_andnot_si128(cond, vWH);
+                vWH = simde_mm_blendv_epi8(vWH, vNegInf, vOut);
+                vE = simde_mm_blendv_epi8(vE, vNegInf, condEF);
+                vF = simde_mm_blendv_epi8(vF, vNegInf, condEF);
+            }
+            
+            H_pr[j-3] = (int32_t)simde_mm_extract_epi32(vWH,0);
+            F_pr[j-3] = (int32_t)simde_mm_extract_epi32(vF,0);
+            /* the lanes in the last column and the last row are
+             * candidates for the end of the alignment, prefer the
+             * smallest end_ref, then the smallest end_query */
+            if (j >= s2Len-1 || kLast <= PAD) {
+                int32_t lanes[2];
+                int32_t c = 0;
+                int32_t values[4];
+                memcpy(values, &vWH, sizeof(values));
+                lanes[0] = j-(s2Len-1);
+                lanes[1] = kLast;
+                for (c=0; c<2; ++c) {
+                    const int32_t lane = lanes[c];
+                    const int32_t ei = i+lane;
+                    const int32_t ej = j-lane;
+                    if (lane < 0 || lane > PAD || ei >= s1Len
+                            || ej < 0 || ej >= s2Len
+                            || ej-ei < lo || ej-ei > hi) {
+                        continue;
+                    }
+                    if (values[PAD-lane] > score
+                            || (values[PAD-lane] == score && (ej < end_ref
+                                    || (ej == end_ref && ei < end_query)))) {
+                        score = values[PAD-lane];
+                        end_query = ei;
+                        end_ref = ej;
+                    }
+                }
+            }
+        }
+    }
+
+    
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
+
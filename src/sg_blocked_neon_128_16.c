@@ -0,0 +1,522 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF INT16_MIN
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store(
+        int *array,
+        simde__m128i vH,
+        int32_t r,
+        int32_t s1Len,
+        int32_t j,
+        int32_t s2Len)
+{
+    int16_t values[8];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<8 && r+lane<s1Len; ++lane) {
+        array[1LL*(r+lane)*s2Len + j] = values[lane];
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        simde__m128i vH,
+        int32_t r,
+        int32_t s1Len)
+{
+    int16_t values[8];
+    int32_t lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<8 && r+lane<s1Len; ++lane) {
+        col[r+lane] = values[lane];
+    }
+}
+#endif
+
+/* a block of query rows, lane k of vector v holds row r0+v*N+k; its H
+ * and E columns and the corner above them carry the block from one
+ * tile of database columns to the next */
+typedef struct block {
+    simde__m128i *vProfile;
+    simde__m128i *pvH;
+    simde__m128i *pvE;
+    int32_t r0;
+    int32_t V;
+    int16_t H_corner;
+    int score;
+    int32_t end_query;
+    int32_t end_ref;
+    simde__m128i vSaturationCheckMin;
+    simde__m128i vSaturationCheckMax;
+} block_t;
+
+static void block_init(
+        block_t * const restrict blk,
+        const int16_t * const restrict s1,
+        const int s1Len, const int s2Len,
+        const int32_t r0, const int32_t V,
+        const int open, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    int32_t i = 0;
+    int32_t k = 0;
+    int32_t v = 0;
+
+    blk->r0 = r0;
+    blk->V = V;
+    blk->H_corner = 0;
+    blk->score = NEG_INF;
+    blk->end_query = s1Len;
+    blk->end_ref = s2Len;
+    blk->vSaturationCheckMin = simde_mm_set1_epi16(INT16_MAX);
+    blk->vSaturationCheckMax = simde_mm_set1_epi16(INT16_MIN);
+
+    /* block profile, padded rows score 0 */
+    for (k=0; k<n; ++k) {
+        for (v=0; v<V; ++v) {
+            int16_t t[8];
+            for (i=0; i<N; ++i) {
+                const int32_t r = r0+v*N+i;
+                t[i] = r >= s1Len ? 0 : matrix->matrix[n*k+s1[r]];
+            }
+            memcpy(&blk->vProfile[k*V+v], t, sizeof(t));
+        }
+    }
+
+    /* the column left of the block */
+    for (v=0; v<V; ++v) {
+        int16_t h[8];
+        int16_t e[8];
+        for (i=0; i<N; ++i) {
+            h[i] = 0;
+            e[i] = -open;
+        }
+        memcpy(&blk->pvH[v], h, sizeof(h));
+        memcpy(&blk->pvE[v], e, sizeof(e));
+    }
+}
+
+/* database columns [j0,j1) of a block, Hrow and Frow hold the last row
+ * of the block above on entry and the last row of this block on exit */
+static void block_tile(
+        block_t * const restrict blk,
+        const int16_t * const restrict s2,
+        const int32_t j0, const int32_t j1,
+        int16_t * const restrict Hrow,
+        int16_t * const restrict Frow,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        parasail_result_t * const restrict result)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t r0 = blk->r0;
+    const int32_t V = blk->V;
+    const simde__m128i * const restrict vProfile = blk->vProfile;
+    simde__m128i * const restrict pvH = blk->pvH;
+    simde__m128i * const restrict pvE = blk->pvE;
+    int32_t j = 0;
+    int32_t v = 0;
+    int16_t H_corner = blk->H_corner;
+    int32_t end_query = blk->end_query;
+    int32_t end_ref = blk->end_ref;
+    int score = blk->score;
+    simde__m128i vOpen = simde_mm_set1_epi16(open);
+    simde__m128i vGap  = simde_mm_set1_epi16(gap);
+    simde__m128i vFDecay1 = simde_mm_set_epi16(-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,-1*gap,NEG_INF);
+    simde__m128i vFDecay2 = simde_mm_set_epi16(-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,-2*gap,NEG_INF,NEG_INF);
+    simde__m128i vFDecay4 = simde_mm_set_epi16(-4*gap,-4*gap,-4*gap,-4*gap,NEG_INF,NEG_INF,NEG_INF,NEG_INF);
+    simde__m128i vSaturationCheckMin = blk->vSaturationCheckMin;
+    simde__m128i vSaturationCheckMax = blk->vSaturationCheckMax;
+    simde__m128i vNoPad = simde_mm_setzero_si128();
+    simde__m128i vPad = simde_mm_cmpgt_epi16(
+            simde_mm_set_epi16(7,6,5,4,3,2,1,0),
+            simde_mm_set1_epi16((s1Len-1)%N));
+
+    for (j=j0; j<j1; ++j) {
+        const simde__m128i *pvP = vProfile + s2[j]*V;
+        const int16_t H_next = Hrow[j];
+        int16_t cD = H_corner;
+        int16_t cF = Frow[j];
+        simde__m128i vH = simde_mm_setzero_si128();
+        for (v=0; v<V; ++v) {
+            simde__m128i vHp = simde_mm_load_si128(pvH+v);
+            simde__m128i vE = simde_mm_load_si128(pvE+v);
+            simde__m128i vHo;
+            simde__m128i vF;
+            /* lane k takes its diagonal from lane k-1, lane 0 from
+             * the last lane of the previous vector */
+            vH = simde_mm_insert_epi16(simde_mm_slli_si128(vHp, 2), cD, 0);
+            cD = (int16_t)simde_mm_extract_epi16(vHp, 7);
+            vH = simde_mm_adds_epi16(vH, simde_mm_load_si128(pvP+v));
+            vH = simde_mm_max_epi16(vH, vE);
+            /* F opens from the row above and extends down the
+             * lanes, resolved exactly by a prefix scan */
+            vHo = simde_mm_subs_epi16(vH, vOpen);
+            vF = simde_mm_insert_epi16(simde_mm_slli_si128(vHo, 2), cF, 0);
+            vF = simde_mm_max_epi16(vF, simde_mm_adds_epi16(simde_mm_slli_si128(vF, 2), vFDecay1));
+                vF = simde_mm_max_epi16(vF, simde_mm_adds_epi16(simde_mm_slli_si128(vF, 4), vFDecay2));
+                vF = simde_mm_max_epi16(vF, simde_mm_adds_epi16(simde_mm_slli_si128(vF, 8), vFDecay4));
+            vH = simde_mm_max_epi16(vH, vF);
+            vHo = simde_mm_subs_epi16(vH, vOpen);
+            cF = (int16_t)simde_mm_extract_epi16(
+                    simde_mm_max_epi16(vHo, simde_mm_subs_epi16(vF, vGap)), 7);
+            /* check for saturation */
+            {
+                vSaturationCheckMax = simde_mm_max_epi16(vSaturationCheckMax, vH);
+                vSaturationCheckMin = simde_mm_blendv_epi8(
+                        simde_mm_min_epi16(vSaturationCheckMin, vH),
+                        vSaturationCheckMin,
+                        r0+(v+1)*N > s1Len ? vPad : vNoPad);
+            }
+            simde_mm_store_si128(pvH+v, vH);
+            simde_mm_store_si128(pvE+v, simde_mm_max_epi16(vHo, simde_mm_subs_epi16(vE, vGap)));
+#ifdef PARASAIL_TABLE
+            arr_store(result->tables->score_table, vH, r0+v*N, s1Len, j, s2Len);
+#endif
+        }
+        /* the last lane of the last vector is the row above the
+         * next block */
+        Hrow[j] = (int16_t)simde_mm_extract_epi16(vH, 7);
+        Frow[j] = cF;
+        H_corner = H_next;
+        /* the last row of the table is in the last block, its cells
+         * are candidates for the end of the alignment */
+        if (r0+V*N >= s1Len) {
+            int16_t values[8];
+            int16_t value;
+            memcpy(values, &pvH[V-1], sizeof(values));
+            value = values[(s1Len-1)%N];
+            if (value > score || (value == score && j < end_ref)) {
+                score = value;
+                end_query = s1Len-1;
+                end_ref = j;
+            }
+#ifdef PARASAIL_ROWCOL
+            result->rowcols->score_row[j] = value;
+#endif
+        }
+    }
+    /* the last column of the block, prefer the smallest end_ref, then
+     * the smallest end_query */
+    if (j1 == s2Len) {
+        int32_t i = 0;
+        for (v=0; v<V; ++v) {
+            int16_t values[8];
+            memcpy(values, &pvH[v], sizeof(values));
+            for (i=0; i<N && r0+v*N+i<s1Len; ++i) {
+                if (values[i] > score || (values[i] == score
+                            && (s2Len-1 < end_ref || (s2Len-1 == end_ref
+                                    && r0+v*N+i < end_query)))) {
+                    score = values[i];
+                    end_query = r0+v*N+i;
+                    end_ref = s2Len-1;
+                }
+            }
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, pvH[v], r0+v*N, s1Len);
+#endif
+        }
+    }
+
+    blk->H_corner = H_corner;
+    blk->score = score;
+    blk->end_query = end_query;
+    blk->end_ref = end_ref;
+    blk->vSaturationCheckMin = vSaturationCheckMin;
+    blk->vSaturationCheckMax = vSaturationCheckMax;
+}
+
+/* the best of the blocks, prefer the smallest end_ref, then the
+ * smallest end_query */
+static inline void block_best(
+        const block_t * const restrict blk,
+        int * const restrict score,
+        int32_t * const restrict end_query,
+        int32_t * const restrict end_ref)
+{
+    if (blk->score > *score || (blk->score == *score
+                && (blk->end_ref < *end_ref || (blk->end_ref == *end_ref
+                        && blk->end_query < *end_query)))) {
+        *score = blk->score;
+        *end_query = blk->end_query;
+        *end_ref = blk->end_ref;
+    }
+}
+
+#ifdef PARASAIL_TABLE
+#define FNAME parasail_sg_table_blocked_neon_128_16
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME parasail_sg_rowcol_blocked_neon_128_16
+#define WNAME parasail_sg_rowcol_wavefront_neon_128_16
+#else
+#define FNAME parasail_sg_blocked_neon_128_16
+#define WNAME parasail_sg_wavefront_neon_128_16
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+    /* each block of query rows keeps its profile and its H and E
+     * columns within the cache budget */
+    const int32_t blockLen = MIN(segLen,
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(simde__m128i))));
+    int16_t * const restrict s1 = parasail_memalign_int16_t(16, s1Len);
+    int16_t * const restrict s2 = parasail_memalign_int16_t(16, s2Len);
+    int16_t * const restrict Hrow = parasail_memalign_int16_t(16, s2Len);
+    int16_t * const restrict Frow = parasail_memalign_int16_t(16, s2Len);
+    block_t block;
+    block_t * const restrict blk = &block;
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t r0 = 0;
+    int32_t end_query = s1Len;
+    int32_t end_ref = s2Len;
+    int score = NEG_INF;
+    simde__m128i vNegLimit = simde_mm_set1_epi16(INT16_MIN);
+    simde__m128i vPosLimit = simde_mm_set1_epi16(INT16_MAX);
+    simde__m128i vSaturationCheckMin = vPosLimit;
+    simde__m128i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    blk->vProfile = parasail_memalign(16, sizeof(simde__m128i)*n*blockLen);
+    blk->pvH = parasail_memalign(16, sizeof(simde__m128i)*blockLen);
+    blk->pvE = parasail_memalign(16, sizeof(simde__m128i)*blockLen);
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        Hrow[j] = 0;
+        Frow[j] = -open;
+    }
+
+    /* iterate over blocks of query rows, each over the whole database
+     * sequence */
+    for (r0=0; r0<s1Len; r0+=blockLen*N) {
+        block_init(blk, s1, s1Len, s2Len, r0, MIN(blockLen, segLen - r0/N),
+                open, matrix);
+        block_tile(blk, s2, 0, s2Len, Hrow, Frow, s1Len, s2Len,
+                open, gap, result);
+        block_best(blk, &score, &end_query, &end_ref);
+        vSaturationCheckMin = simde_mm_min_epi16(vSaturationCheckMin, blk->vSaturationCheckMin);
+        vSaturationCheckMax = simde_mm_max_epi16(vSaturationCheckMax, blk->vSaturationCheckMax);
+    }
+
+    if (simde_mm_movemask_epi8(simde_mm_or_si128(
+            simde_mm_cmpeq_epi16(vSaturationCheckMin, vNegLimit),
+            simde_mm_cmpeq_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blk->pvE);
+    parasail_free(blk->pvH);
+    parasail_free(blk->vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+#ifdef WNAME
+parasail_result_t* WNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int32_t N = 8; /* number of values in vector */
+    const int32_t n = matrix->size; /* number of residues in matrix */
+    const int32_t segLen = (s1Len + N - 1) / N;
+#ifdef _OPENMP
+    /* called from within a parallel region the wavefront runs on the
+     * calling thread alone */
+    const int32_t threads = omp_in_parallel() ? 1 : omp_get_max_threads();
+#else
+    const int32_t threads = 1;
+#endif
+    /* at least one block of query rows per thread, none larger than
+     * the cache budget */
+    const int32_t blockLen = MIN(MIN(segLen, (segLen + threads - 1) / threads),
+            MAX(1, PARASAIL_BLOCKED_CACHE / (int32_t)((n+2)*sizeof(simde__m128i))));
+    const int32_t nblocks = (segLen + blockLen - 1) / blockLen;
+    /* a few tiles of database columns per thread keep the wavefront
+     * full without paying a barrier for every few columns */
+    const int32_t tileLen = MAX(PARASAIL_WAVEFRONT_TILE,
+            (s2Len + 4*threads - 1) / (4*threads));
+    const int32_t ntiles = (s2Len + tileLen - 1) / tileLen;
+    int16_t * const restrict s1 = parasail_memalign_int16_t(16, s1Len);
+    int16_t * const restrict s2 = parasail_memalign_int16_t(16, s2Len);
+    int16_t * const restrict Hrow = parasail_memalign_int16_t(16, s2Len);
+    int16_t * const restrict Frow = parasail_memalign_int16_t(16, s2Len);
+    simde__m128i * const restrict vProfile = parasail_memalign(16, sizeof(simde__m128i)*n*blockLen*nblocks);
+    simde__m128i * const restrict pvH = parasail_memalign(16, sizeof(simde__m128i)*blockLen*nblocks);
+    simde__m128i * const restrict pvE = parasail_memalign(16, sizeof(simde__m128i)*blockLen*nblocks);
+    block_t * const restrict blocks = parasail_memalign(16, sizeof(block_t)*nblocks);
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t b = 0;
+    int32_t end_query = s1Len;
+    int32_t end_ref = s2Len;
+    int score = NEG_INF;
+    simde__m128i vNegLimit = simde_mm_set1_epi16(INT16_MIN);
+    simde__m128i vPosLimit = simde_mm_set1_epi16(INT16_MAX);
+    simde__m128i vSaturationCheckMin = vPosLimit;
+    simde__m128i vSaturationCheckMax = vNegLimit;
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        Hrow[j] = 0;
+        Frow[j] = -open;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+    {
+        int32_t d = 0;
+        int32_t t = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (t=0; t<nblocks; ++t) {
+            blocks[t].vProfile = vProfile + n*blockLen*t;
+            blocks[t].pvH = pvH + blockLen*t;
+            blocks[t].pvE = pvE + blockLen*t;
+            block_init(&blocks[t], s1, s1Len, s2Len, t*blockLen*N,
+                    MIN(blockLen, segLen - t*blockLen), open, matrix);
+        }
+
+        /* tile (t,c) needs (t-1,c) for the row above it and (t,c-1)
+         * for the columns left of it, so the tiles of an anti-diagonal
+         * run together and the barrier closing each one orders them */
+        for (d=0; d<nblocks+ntiles-1; ++d) {
+            const int32_t first = MAX(0, d-ntiles+1);
+            const int32_t last = MIN(d, nblocks-1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+            for (t=first; t<=last; ++t) {
+                const int32_t j0 = (d-t)*tileLen;
+                block_tile(&blocks[t], s2, j0, MIN(j0+tileLen, s2Len),
+                        Hrow, Frow, s1Len, s2Len, open, gap, result);
+            }
+        }
+    }
+
+    for (b=0; b<nblocks; ++b) {
+        const block_t * const restrict blk = &blocks[b];
+        block_best(blk, &score, &end_query, &end_ref);
+        vSaturationCheckMin = simde_mm_min_epi16(vSaturationCheckMin, blk->vSaturationCheckMin);
+        vSaturationCheckMax = simde_mm_max_epi16(vSaturationCheckMax, blk->vSaturationCheckMax);
+    }
+
+    if (simde_mm_movemask_epi8(simde_mm_or_si128(
+            simde_mm_cmpeq_epi16(vSaturationCheckMin, vNegLimit),
+            simde_mm_cmpeq_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT16_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blocks);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+#endif
+
@@ -108,6 +108,9 @@ STATIC parasail_result_t* PNAME(
     int32_t end_ref = 0;
     const int s1Len = profile->s1Len;
     const parasail_matrix_t *matrix = profile->matrix;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
     const int32_t segWidth = 8; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     const int32_t offset = (s1Len - 1) % segLen;
@@ -407,6 +410,39 @@ end:
         result->stats->rowcols->similar_row[j] = (int16_t) _mm_extract_epi16 (vHS, 7);
         result->stats->rowcols->length_row[j] = (int16_t) _mm_extract_epi16 (vHL, 7);
 #endif
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        if (INT32_MIN != min_score && gain < min_score) {
+            /* the lanes past the end of the query are padding */
+            const int32_t last_lane = (s1Len - 1) / segLen;
+            const int32_t last_seg = (s1Len - 1) % segLen;
+            const vec128i vPadLo = _mm_cmpgt_epi16(
+                    _mm_set1_epi16(segWidth - 1 - last_lane),
+                    _mm_set_epi16(0,1,2,3,4,5,6,7));
+            const vec128i vPadHi = _mm_cmpgt_epi16(
+                    _mm_set1_epi16(segWidth - last_lane),
+                    _mm_set_epi16(0,1,2,3,4,5,6,7));
+            vec128i vColMax = vNegLimit;
+            int16_t col_score;
+            int16_t row_score;
+            for (i=0; i<segLen; ++i) {
+                vec128i vC = _mm_load_si128(pvHStore + i);
+                vC = _mm_blendv_epi8(vC, vNegLimit, i > last_seg ? vPadHi : vPadLo);
+                vColMax = _mm_max_epi16(vColMax, vC);
+            }
+            col_score = _mm_hmax_epi16(vColMax);
+            /* the last row so far is the position lane of vMaxH */
+            row_score = _mm_hmax_epi16(_mm_blendv_epi8(vNegLimit, vMaxH, vPosMask));
+            if (row_score < min_score
+                    && (col_score > 0 ? col_score : 0) + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+                result->stop_ref = j;
+                break;
+            }
+        }
     }
 
     {
@@ -423,8 +459,9 @@ end:
         length = (int16_t)_mm_extract_epi16(vMaxHL, 7);
     }
 
-    /* max of last column */
-    if (INT32_MAX == profile->stop || 0 == profile->stop)
+    /* max of last column, unless the pair was pruned before it */
+    if ((INT32_MAX == profile->stop || 0 == profile->stop)
+            && !(result->flag & PARASAIL_FLAG_PRUNED))
     {
         int16_t score_last;
         vMaxH = vNegLimit;
@@ -482,8 +519,11 @@ end:
         }
     }
 
+    /* vF starts each column at NEG_LIMIT, so a score that falls below
+     * the limit is clamped to it rather than going under; reaching the
+     * limit therefore counts as saturating too. */
     if (_mm_movemask_epi8(_mm_or_si128(
-            _mm_cmplt_epi16(vSaturationCheckMin, vNegLimit),
+            _mm_cmpeq_epi16(_mm_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
             _mm_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
         result->flag |= PARASAIL_FLAG_SATURATED;
         score = 0;
@@ -542,7 +582,8 @@ parasail_result_t* INAME(
 
     /* find the end loc first with the faster implementation */
     parasail_result_t *result = parasail_sg_striped_profile_altivec_128_16(profile, s2, s2Len, open, gap);
-    if (!parasail_result_is_saturated(result)) {
+    if (!parasail_result_is_saturated(result)
+            && !parasail_result_is_pruned(result)) {
         int s1Len_new = 0;
         int s2Len_new = 0;
         parasail_result_t *result_final = NULL;
@@ -553,12 +594,16 @@ parasail_result_t* INAME(
 
         if (s1Len_new == profile->s1Len) {
             /* special 'stop' value tells stats function not to
-             * consider last column results */
+             * consider last column results, and the faster pass has
+             * already checked min_score */
             int stop_save = profile->stop;
+            int min_score_save = profile->min_score;
             ((parasail_profile_t*)profile)->stop = 1;
+            ((parasail_profile_t*)profile)->min_score = INT32_MIN;
             result_final = PNAME(
                     profile, s2, s2Len_new, open, gap);
             ((parasail_profile_t*)profile)->stop = stop_save;
+            ((parasail_profile_t*)profile)->min_score = min_score_save;
         }
         else {
             parasail_profile_t *profile_final = NULL;
@@ -18,6 +18,27 @@
 
 
 
+/* smallest query position of the striped column holding value */
+static inline int32_t find_row(
+        const int16_t *t,
+        int16_t value,
+        int32_t s1Len,
+        int32_t segLen,
+        int32_t segWidth)
+{
+    int32_t row = s1Len - 1;
+    int32_t i = 0;
+    for (i=0; i<segLen*segWidth; ++i) {
+        if (t[i] == value) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
 #ifdef PARASAIL_TABLE
 static inline void arr_store_si128(
         int *array,
@@ -66,24 +87,339 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_sg_striped_altivec_128_16
 #define PNAME parasail_sg_striped_profile_altivec_128_16
+#define WNAME parasail_sg_striped_profile_altivec_128_16_ws
+#define ENAME parasail_sg_striped_profile_altivec_128_16_enc
+#define CNAME parasail_sg_striped_profile_altivec_128_16_core
+#endif
+#endif
+
+/* Same as PNAME without a profile: the striped query codes are compared
+ * to the code of each database residue to select match or mismatch. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const int32_t last_lane = (s1Len - 1) / segLen;
+    const int32_t tail = (s1Len - 1) % segLen + 1;
+    vec128i* const restrict pvQuery = parasail_memalign_vec128i(16, segLen+4);
+    vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
+    vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+    const vec128i vGapO = _mm_set1_epi16(open);
+    const vec128i vGapE = _mm_set1_epi16(gap);
+    vec128i vMatch;
+    vec128i vMismatch;
+    vec128i vMatchHead;
+    vec128i vMismatchHead;
+    vec128i vMatchTail;
+    vec128i vMismatchTail;
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    int16_t score = NEG_LIMIT;
+    vec128i vNegLimit = _mm_set1_epi16(NEG_LIMIT);
+    vec128i vPosLimit = _mm_set1_epi16(POS_LIMIT);
+    vec128i vSaturationCheckMin = vPosLimit;
+    vec128i vSaturationCheckMax = vNegLimit;
+    vec128i vMaxH = vNegLimit;
+    vec128i vPosMask = _mm_cmpeq_epi16(_mm_set1_epi16(position),
+            _mm_set_epi16(0,1,2,3,4,5,6,7));
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        int16_t *q = (int16_t*)pvQuery;
+        int16_t *lane = (int16_t*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (int16_t)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = _mm_load_si128(pvQuery + segLen);
+        vMismatchHead = _mm_load_si128(pvQuery + segLen + 1);
+        vMatchTail = _mm_load_si128(pvQuery + segLen + 2);
+        vMismatchTail = _mm_load_si128(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    parasail_memset_vec128i(pvHStore, _mm_set1_epi16(0), segLen);
+    parasail_memset_vec128i(pvE, _mm_set1_epi16(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        vec128i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        vec128i vF = vNegLimit;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 2);
+
+        /* code of the database residue in every lane */
+        const vec128i vCode = _mm_set1_epi16(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        vec128i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = _mm_add_epi16(vH, _mm_blendv_epi8(vMismatch, vMatch,
+                        _mm_cmpeq_epi16(_mm_load_si128(pvQuery + i), vCode)));
+            vE = _mm_load_si128(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm_max_epi16(vH, vE);
+            vH = _mm_max_epi16(vH, vF);
+            /* Save vH values. */
+            _mm_store_si128(pvHStore + i, vH);
+            vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm_sub_epi16(vH, vGapO);
+            vE = _mm_sub_epi16(vE, vGapE);
+            vE = _mm_max_epi16(vE, vH);
+            _mm_store_si128(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm_sub_epi16(vF, vGapE);
+            vF = _mm_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm_load_si128(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = _mm_slli_si128(vF, 2);
+            vF = _mm_insert_epi16(vF, -open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm_load_si128(pvHStore + i);
+                vH = _mm_max_epi16(vH,vF);
+                _mm_store_si128(pvHStore + i, vH);
+                vSaturationCheckMin = _mm_min_epi16(vSaturationCheckMin, vH);
+                vSaturationCheckMax = _mm_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si128(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm_sub_epi16(vH, vGapO);
+                vF = _mm_sub_epi16(vF, vGapE);
+                if (! _mm_movemask_epi8(_mm_cmpgt_epi16(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+            /* extract vector containing last value from the column */
+            vec128i vCompare;
+            vH = _mm_load_si128(pvHStore + offset);
+            vCompare = _mm_and_si128(vPosMask, _mm_cmpgt_epi16(vH, vMaxH));
+            vMaxH = _mm_max_epi16(vH, vMaxH);
+            if (_mm_movemask_epi8(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = _mm_slli_si128(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) _mm_extract_epi16 (vH, 7);
+#endif
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = _mm_slli_si128(vMaxH, 2);
+        }
+        score = (int16_t) _mm_extract_epi16(vMaxH, 7);
+    }
+
+    /* max of last column */
+    {
+        int16_t score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            vec128i vH = _mm_load_si128(pvHStore + i);
+            vMaxH = _mm_max_epi16(vH, vMaxH);
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, vH, i, segLen);
+#endif
+        }
+
+        /* max in vec */
+        score_last = _mm_hmax_epi16(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                int16_t *t = (int16_t*)pvHStore;
+                int32_t column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        int32_t temp = i / segWidth + i % segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (_mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi16(_mm_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
+            _mm_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
 #endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_altivec_128_16(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+
+    profile = parasail_profile_create_altivec_128_16(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -97,9 +433,17 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     vec128i* const restrict vProfile = (vec128i*)profile->profile16.score;
+#ifdef WNAME
+    vec128i* const pvWork = (vec128i*)parasail_workspace_reserve(
+            workspace, sizeof(vec128i)*3*segLen);
+    vec128i* restrict pvHStore = pvWork;
+    vec128i* restrict pvHLoad = pvWork + segLen;
+    vec128i* const restrict pvE = pvWork + 2*segLen;
+#else
     vec128i* restrict pvHStore = parasail_memalign_vec128i(16, segLen);
     vec128i* restrict pvHLoad =  parasail_memalign_vec128i(16, segLen);
     vec128i* const restrict pvE = parasail_memalign_vec128i(16, segLen);
+#endif
     const vec128i vGapO = _mm_set1_epi16(open);
     const vec128i vGapE = _mm_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -113,14 +457,25 @@ parasail_result_t* PNAME(
     vec128i vMaxH = vNegLimit;
     vec128i vPosMask = _mm_cmpeq_epi16(_mm_set1_epi16(position),
             _mm_set_epi16(0,1,2,3,4,5,6,7));
+    const int xdrop = profile->xdrop;
+    const int zdrop = profile->zdrop;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
+    int prune = 0;
+    int64_t best = INT64_MIN;
+    int32_t best_query = 0;
+    int32_t best_ref = 0;
 #ifdef PARASAIL_TABLE
     parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -138,7 +493,13 @@ parasail_result_t* PNAME(
         vec128i vH = _mm_slli_si128(pvHStore[segLen - 1], 2);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const vec128i* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const vec128i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         vec128i* pv = pvHLoad;
@@ -213,6 +574,66 @@ end:
             result->rowcols->score_row[j] = (int16_t) _mm_extract_epi16 (vH, 7);
 #endif
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        prune = INT32_MIN != min_score && gain < min_score;
+
+        /* X-drop: stop once every cell of the column has fallen more
+         * than xdrop below the best cell so far.  Z-drop also forgives
+         * the gap between the column's best cell and the best cell.
+         * The alignment then ends in the last row of the columns seen. */
+        if (0 < xdrop || 0 < zdrop || prune) {
+            /* the lanes past the end of the query are padding */
+            const int32_t last_lane = (s1Len - 1) / segLen;
+            const int32_t last_seg = (s1Len - 1) % segLen;
+            const vec128i vPadLo = _mm_cmpgt_epi16(
+                    _mm_set1_epi16(segWidth - 1 - last_lane),
+                    _mm_set_epi16(0,1,2,3,4,5,6,7));
+            const vec128i vPadHi = _mm_cmpgt_epi16(
+                    _mm_set1_epi16(segWidth - last_lane),
+                    _mm_set_epi16(0,1,2,3,4,5,6,7));
+            vec128i vColMax = vNegLimit;
+            int16_t col_score;
+            int16_t row_score;
+            for (i=0; i<segLen; ++i) {
+                vec128i vC = _mm_load_si128(pvHStore + i);
+                vC = _mm_blendv_epi8(vC, vNegLimit, i > last_seg ? vPadHi : vPadLo);
+                vColMax = _mm_max_epi16(vColMax, vC);
+            }
+            col_score = _mm_hmax_epi16(vColMax);
+            row_score = _mm_hmax_epi16(_mm_blendv_epi8(vNegLimit, vMaxH, vPosMask));
+            if (prune && row_score < min_score
+                    && (col_score > 0 ? col_score : 0) + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+            }
+            else if (col_score > best) {
+                best = col_score;
+                best_ref = j;
+                if (0 < zdrop) {
+                    best_query = find_row((int16_t*)pvHStore, col_score, s1Len, segLen, segWidth);
+                }
+            }
+            else {
+                int64_t drop = best - col_score;
+                if (0 < xdrop && drop > xdrop) {
+                    result->flag |= PARASAIL_FLAG_XDROP;
+                }
+                else if (0 < zdrop && drop > zdrop) {
+                    int32_t col_query = find_row((int16_t*)pvHStore, col_score, s1Len, segLen, segWidth);
+                    int32_t diff = (col_query - best_query) - (j - best_ref);
+                    if (drop > zdrop + (int64_t)gap*(diff < 0 ? -diff : diff)) {
+                        result->flag |= PARASAIL_FLAG_XDROP;
+                    }
+                }
+            }
+            if (result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED)) {
+                result->stop_ref = j;
+                break;
+            }
+        }
     }
 
     /* max last value from all columns */
@@ -223,8 +644,8 @@ end:
         score = (int16_t) _mm_extract_epi16(vMaxH, 7);
     }
 
-    /* max of last column */
-    {
+    /* max of last column, unless the alignment stopped before it */
+    if (!(result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED))) {
         int16_t score_last;
         vMaxH = vNegLimit;
 
@@ -258,8 +679,11 @@ end:
         }
     }
 
+    /* vF starts each column at NEG_LIMIT, so a score that falls below
+     * the limit is clamped to it rather than going under; reaching the
+     * limit therefore counts as saturating too. */
     if (_mm_movemask_epi8(_mm_or_si128(
-            _mm_cmplt_epi16(vSaturationCheckMin, vNegLimit),
+            _mm_cmpeq_epi16(_mm_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
             _mm_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
         result->flag |= PARASAIL_FLAG_SATURATED;
         score = 0;
@@ -279,9 +703,11 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
@@ -17,8 +17,6 @@
 #include "parasail/internal_avx.h"
 
 
-#define _mm256_cmplt_epi16_rpl(a,b) _mm256_cmpgt_epi16(b,a)
-
 #if HAVE_AVX2_MM256_INSERT_EPI16
 #define _mm256_insert_epi16_rpl _mm256_insert_epi16
 #else
@@ -40,6 +38,11 @@ static inline int16_t _mm256_extract_epi16_rpl(__m256i a, int imm) {
 }
 #endif
 
+static inline __m256i _mm256_lookup_epi16_rpl(__m256i lo, __m256i hi, __m256i ilo, __m256i ihi) {
+    return _mm256_srai_epi16(
+            _mm256_or_si256(_mm256_shuffle_epi8(lo, ilo), _mm256_shuffle_epi8(hi, ihi)), 8);
+}
+
 #define _mm256_slli_si256_rpl(a,imm) _mm256_alignr_epi8(a, _mm256_permute2x128_si256(a, a, _MM_SHUFFLE(0,0,3,0)), 16-imm)
 
 static inline int16_t _mm256_hmax_epi16_rpl(__m256i a) {
@@ -51,6 +54,27 @@ static inline int16_t _mm256_hmax_epi16_rpl(__m256i a) {
 }
 
 
+/* smallest query position of the striped column holding value */
+static inline int32_t find_row(
+        const int16_t *t,
+        int16_t value,
+        int32_t s1Len,
+        int32_t segLen,
+        int32_t segWidth)
+{
+    int32_t row = s1Len - 1;
+    int32_t i = 0;
+    for (i=0; i<segLen*segWidth; ++i) {
+        if (t[i] == value) {
+            int32_t temp = i / segWidth + i % segWidth * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
 #ifdef PARASAIL_TABLE
 static inline void arr_store_si256(
         int *array,
@@ -115,24 +139,592 @@ static inline void arr_store_col(
 #else
 #define FNAME parasail_sg_striped_avx2_256_16
 #define PNAME parasail_sg_striped_profile_avx2_256_16
+#define WNAME parasail_sg_striped_profile_avx2_256_16_ws
+#define ENAME parasail_sg_striped_profile_avx2_256_16_enc
+#define CNAME parasail_sg_striped_profile_avx2_256_16_core
+#endif
+#endif
+
+/* Same as PNAME without a profile: the striped query codes are compared
+ * to the code of each database residue to select match or mismatch. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const int32_t last_lane = (s1Len - 1) / segLen;
+    const int32_t tail = (s1Len - 1) % segLen + 1;
+    __m256i* const restrict pvQuery = parasail_memalign___m256i(32, segLen+4);
+    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    const __m256i vGapO = _mm256_set1_epi16(open);
+    const __m256i vGapE = _mm256_set1_epi16(gap);
+    __m256i vMatch;
+    __m256i vMismatch;
+    __m256i vMatchHead;
+    __m256i vMismatchHead;
+    __m256i vMatchTail;
+    __m256i vMismatchTail;
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    int16_t score = NEG_LIMIT;
+    __m256i vNegLimit = _mm256_set1_epi16(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi16(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    __m256i vMaxH = vNegLimit;
+    __m256i vPosMask = _mm256_cmpeq_epi16(_mm256_set1_epi16(position),
+            _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        int16_t *q = (int16_t*)pvQuery;
+        int16_t *lane = (int16_t*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (int16_t)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = _mm256_load_si256(pvQuery + segLen);
+        vMismatchHead = _mm256_load_si256(pvQuery + segLen + 1);
+        vMatchTail = _mm256_load_si256(pvQuery + segLen + 2);
+        vMismatchTail = _mm256_load_si256(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    parasail_memset___m256i(pvHStore, _mm256_set1_epi16(0), segLen);
+    parasail_memset___m256i(pvE, _mm256_set1_epi16(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        __m256i vF = vNegLimit;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 2);
+
+        /* code of the database residue in every lane */
+        const __m256i vCode = _mm256_set1_epi16(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        __m256i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = _mm256_add_epi16(vH, _mm256_blendv_epi8(vMismatch, vMatch,
+                        _mm256_cmpeq_epi16(_mm256_load_si256(pvQuery + i), vCode)));
+            vE = _mm256_load_si256(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm256_max_epi16(vH, vE);
+            vH = _mm256_max_epi16(vH, vF);
+            /* Save vH values. */
+            _mm256_store_si256(pvHStore + i, vH);
+            vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm256_sub_epi16(vH, vGapO);
+            vE = _mm256_sub_epi16(vE, vGapE);
+            vE = _mm256_max_epi16(vE, vH);
+            _mm256_store_si256(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm256_sub_epi16(vF, vGapE);
+            vF = _mm256_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm256_load_si256(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = _mm256_slli_si256_rpl(vF, 2);
+            vF = _mm256_insert_epi16_rpl(vF, -open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm256_load_si256(pvHStore + i);
+                vH = _mm256_max_epi16(vH,vF);
+                _mm256_store_si256(pvHStore + i, vH);
+                vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
+                vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm256_sub_epi16(vH, vGapO);
+                vF = _mm256_sub_epi16(vF, vGapE);
+                if (! _mm256_movemask_epi8(_mm256_cmpgt_epi16(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+            /* extract vector containing last value from the column */
+            __m256i vCompare;
+            vH = _mm256_load_si256(pvHStore + offset);
+            vCompare = _mm256_and_si256(vPosMask, _mm256_cmpgt_epi16(vH, vMaxH));
+            vMaxH = _mm256_max_epi16(vH, vMaxH);
+            if (_mm256_movemask_epi8(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = _mm256_slli_si256_rpl(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) _mm256_extract_epi16_rpl (vH, 15);
+#endif
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = _mm256_slli_si256_rpl(vMaxH, 2);
+        }
+        score = (int16_t) _mm256_extract_epi16_rpl(vMaxH, 15);
+    }
+
+    /* max of last column */
+    {
+        int16_t score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            __m256i vH = _mm256_load_si256(pvHStore + i);
+            vMaxH = _mm256_max_epi16(vH, vMaxH);
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, vH, i, segLen);
+#endif
+        }
+
+        /* max in vec */
+        score_last = _mm256_hmax_epi16_rpl(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                int16_t *t = (int16_t*)pvHStore;
+                int32_t column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        int32_t temp = i / segWidth + i % segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi16(_mm256_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
+            _mm256_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+/* Same as match_mismatch for any matrix of at most 32 residues with
+ * byte scores: a shuffle of the database residue's row of scores,
+ * indexed by the striped query codes, stands in for the profile. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    int32_t k = 0;
+    int32_t end_query = 0;
+    int32_t end_ref = 0;
+    const int32_t segWidth = 16; /* number of values in vector unit */
+    const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
+    const int32_t offset = (s1Len - 1) % segLen;
+    const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
+    __m256i* const restrict pvTable = parasail_memalign___m256i(32, 2*matrix->size);
+    __m256i* const restrict pvIndex = parasail_memalign___m256i(32, 2*segLen);
+    __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
+    __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
+    __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+    const __m256i vGapO = _mm256_set1_epi16(open);
+    const __m256i vGapE = _mm256_set1_epi16(gap);
+    const int16_t NEG_LIMIT = (-open < matrix->min ?
+        INT16_MIN + open : INT16_MIN - matrix->min) + 1;
+    const int16_t POS_LIMIT = INT16_MAX - matrix->max - 1;
+    int16_t score = NEG_LIMIT;
+    __m256i vNegLimit = _mm256_set1_epi16(NEG_LIMIT);
+    __m256i vPosLimit = _mm256_set1_epi16(POS_LIMIT);
+    __m256i vSaturationCheckMin = vPosLimit;
+    __m256i vSaturationCheckMax = vNegLimit;
+    __m256i vMaxH = vNegLimit;
+    __m256i vPosMask = _mm256_cmpeq_epi16(_mm256_set1_epi16(position),
+            _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
 #endif
 #endif
 
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<32; ++i) {
+                int32_t lo = i % 16;
+                int32_t hi = lo + 16;
+                table[2*k*32 + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*32 + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*32; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                int32_t t = k*segLen + i;
+                int32_t byte = (k+1)*2 - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*32 + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*32 + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* initialize H and E */
+    parasail_memset___m256i(pvHStore, _mm256_set1_epi16(0), segLen);
+    parasail_memset___m256i(pvE, _mm256_set1_epi16(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        __m256i vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        __m256i vF = vNegLimit;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 2);
+
+        /* score tables of the database residue */
+        const __m256i* vTable = pvTable + 2*matrix->mapper[(unsigned char)s2[j]];
+        const __m256i vTableLo = _mm256_load_si256(vTable);
+        const __m256i vTableHi = _mm256_load_si256(vTable + 1);
+
+        /* Swap the 2 H buffers. */
+        __m256i* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = _mm256_add_epi16(vH, _mm256_lookup_epi16_rpl(vTableLo, vTableHi,
+                        _mm256_load_si256(pvIndex + 2*i), _mm256_load_si256(pvIndex + 2*i + 1)));
+            vE = _mm256_load_si256(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = _mm256_max_epi16(vH, vE);
+            vH = _mm256_max_epi16(vH, vF);
+            /* Save vH values. */
+            _mm256_store_si256(pvHStore + i, vH);
+            vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
+            vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = _mm256_sub_epi16(vH, vGapO);
+            vE = _mm256_sub_epi16(vE, vGapE);
+            vE = _mm256_max_epi16(vE, vH);
+            _mm256_store_si256(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = _mm256_sub_epi16(vF, vGapE);
+            vF = _mm256_max_epi16(vF, vH);
+
+            /* Load the next vH. */
+            vH = _mm256_load_si256(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = _mm256_slli_si256_rpl(vF, 2);
+            vF = _mm256_insert_epi16_rpl(vF, -open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = _mm256_load_si256(pvHStore + i);
+                vH = _mm256_max_epi16(vH,vF);
+                _mm256_store_si256(pvHStore + i, vH);
+                vSaturationCheckMin = _mm256_min_epi16(vSaturationCheckMin, vH);
+                vSaturationCheckMax = _mm256_max_epi16(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si256(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = _mm256_sub_epi16(vH, vGapO);
+                vF = _mm256_sub_epi16(vF, vGapE);
+                if (! _mm256_movemask_epi8(_mm256_cmpgt_epi16(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+            /* extract vector containing last value from the column */
+            __m256i vCompare;
+            vH = _mm256_load_si256(pvHStore + offset);
+            vCompare = _mm256_and_si256(vPosMask, _mm256_cmpgt_epi16(vH, vMaxH));
+            vMaxH = _mm256_max_epi16(vH, vMaxH);
+            if (_mm256_movemask_epi8(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = _mm256_slli_si256_rpl(vH, 2);
+            }
+            result->rowcols->score_row[j] = (int16_t) _mm256_extract_epi16_rpl (vH, 15);
+#endif
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = _mm256_slli_si256_rpl(vMaxH, 2);
+        }
+        score = (int16_t) _mm256_extract_epi16_rpl(vMaxH, 15);
+    }
+
+    /* max of last column */
+    {
+        int16_t score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            __m256i vH = _mm256_load_si256(pvHStore + i);
+            vMaxH = _mm256_max_epi16(vH, vMaxH);
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, vH, i, segLen);
+#endif
+        }
+
+        /* max in vec */
+        score_last = _mm256_hmax_epi16_rpl(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                int16_t *t = (int16_t*)pvHStore;
+                int32_t column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        int32_t temp = i / segWidth + i % segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_cmpeq_epi16(_mm256_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
+            _mm256_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_16;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_avx_256_16(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+    if (parasail_lookup_scores(matrix, sizeof(__m256i)*matrix->size
+                *((s1Len + 16 - 1) / 16))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    profile = parasail_profile_create_avx_256_16(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     int32_t i = 0;
     int32_t j = 0;
@@ -146,9 +738,17 @@ parasail_result_t* PNAME(
     const int32_t offset = (s1Len - 1) % segLen;
     const int32_t position = (segWidth - 1) - (s1Len - 1) / segLen;
     __m256i* const restrict vProfile = (__m256i*)profile->profile16.score;
+#ifdef WNAME
+    __m256i* const pvWork = (__m256i*)parasail_workspace_reserve(
+            workspace, sizeof(__m256i)*3*segLen);
+    __m256i* restrict pvHStore = pvWork;
+    __m256i* restrict pvHLoad = pvWork + segLen;
+    __m256i* const restrict pvE = pvWork + 2*segLen;
+#else
     __m256i* restrict pvHStore = parasail_memalign___m256i(32, segLen);
     __m256i* restrict pvHLoad =  parasail_memalign___m256i(32, segLen);
     __m256i* const restrict pvE = parasail_memalign___m256i(32, segLen);
+#endif
     const __m256i vGapO = _mm256_set1_epi16(open);
     const __m256i vGapE = _mm256_set1_epi16(gap);
     const int16_t NEG_LIMIT = (-open < matrix->min ?
@@ -162,14 +762,25 @@ parasail_result_t* PNAME(
     __m256i vMaxH = vNegLimit;
     __m256i vPosMask = _mm256_cmpeq_epi16(_mm256_set1_epi16(position),
             _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+    const int xdrop = profile->xdrop;
+    const int zdrop = profile->zdrop;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
+    int prune = 0;
+    int64_t best = INT64_MIN;
+    int32_t best_query = 0;
+    int32_t best_ref = 0;
 #ifdef PARASAIL_TABLE
     parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -187,7 +798,13 @@ parasail_result_t* PNAME(
         __m256i vH = _mm256_slli_si256_rpl(pvHStore[segLen - 1], 2);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const __m256i* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const __m256i* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         __m256i* pv = pvHLoad;
@@ -262,6 +879,66 @@ end:
             result->rowcols->score_row[j] = (int16_t) _mm256_extract_epi16_rpl (vH, 15);
 #endif
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        prune = INT32_MIN != min_score && gain < min_score;
+
+        /* X-drop: stop once every cell of the column has fallen more
+         * than xdrop below the best cell so far.  Z-drop also forgives
+         * the gap between the column's best cell and the best cell.
+         * The alignment then ends in the last row of the columns seen. */
+        if (0 < xdrop || 0 < zdrop || prune) {
+            /* the lanes past the end of the query are padding */
+            const int32_t last_lane = (s1Len - 1) / segLen;
+            const int32_t last_seg = (s1Len - 1) % segLen;
+            const __m256i vPadLo = _mm256_cmpgt_epi16(
+                    _mm256_set1_epi16(segWidth - 1 - last_lane),
+                    _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+            const __m256i vPadHi = _mm256_cmpgt_epi16(
+                    _mm256_set1_epi16(segWidth - last_lane),
+                    _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+            __m256i vColMax = vNegLimit;
+            int16_t col_score;
+            int16_t row_score;
+            for (i=0; i<segLen; ++i) {
+                __m256i vC = _mm256_load_si256(pvHStore + i);
+                vC = _mm256_blendv_epi8(vC, vNegLimit, i > last_seg ? vPadHi : vPadLo);
+                vColMax = _mm256_max_epi16(vColMax, vC);
+            }
+            col_score = _mm256_hmax_epi16_rpl(vColMax);
+            row_score = _mm256_hmax_epi16_rpl(_mm256_blendv_epi8(vNegLimit, vMaxH, vPosMask));
+            if (prune && row_score < min_score
+                    && (col_score > 0 ? col_score : 0) + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+            }
+            else if (col_score > best) {
+                best = col_score;
+                best_ref = j;
+                if (0 < zdrop) {
+                    best_query = find_row((int16_t*)pvHStore, col_score, s1Len, segLen, segWidth);
+                }
+            }
+            else {
+                int64_t drop = best - col_score;
+                if (0 < xdrop && drop > xdrop) {
+                    result->flag |= PARASAIL_FLAG_XDROP;
+                }
+                else if (0 < zdrop && drop > zdrop) {
+                    int32_t col_query = find_row((int16_t*)pvHStore, col_score, s1Len, segLen, segWidth);
+                    int32_t diff = (col_query - best_query) - (j - best_ref);
+                    if (drop > zdrop + (int64_t)gap*(diff < 0 ? -diff : diff)) {
+                        result->flag |= PARASAIL_FLAG_XDROP;
+                    }
+                }
+            }
+            if (result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED)) {
+                result->stop_ref = j;
+                break;
+            }
+        }
     }
 
     /* max last value from all columns */
@@ -272,8 +949,8 @@ end:
         score = (int16_t) _mm256_extract_epi16_rpl(vMaxH, 15);
     }
 
-    /* max of last column */
-    {
+    /* max of last column, unless the alignment stopped before it */
+    if (!(result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED))) {
         int16_t score_last;
         vMaxH = vNegLimit;
 
@@ -307,8 +984,11 @@ end:
         }
     }
 
+    /* vF starts each column at NEG_LIMIT, so a score that falls below
+     * the limit is clamped to it rather than going under; reaching the
+     * limit therefore counts as saturating too. */
     if (_mm256_movemask_epi8(_mm256_or_si256(
-            _mm256_cmplt_epi16_rpl(vSaturationCheckMin, vNegLimit),
+            _mm256_cmpeq_epi16(_mm256_min_epi16(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
             _mm256_cmpgt_epi16(vSaturationCheckMax, vPosLimit)))) {
         result->flag |= PARASAIL_FLAG_SATURATED;
         score = 0;
@@ -328,9 +1008,11 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
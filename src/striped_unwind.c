@@ -74,6 +74,31 @@ int* parasail_striped_unwind(
     assert((result->flag & PARASAIL_FLAG_STRIPED)
             || result->flag & PARASAIL_FLAG_SCAN);
 
+    /* trace tables hold one byte per cell at every vector width */
+    if (result->flag & PARASAIL_FLAG_TRACE) {
+        int segWidth = 0;
+        if (result->flag & PARASAIL_FLAG_LANES_2) {
+            segWidth = 2;
+        }
+        else if (result->flag & PARASAIL_FLAG_LANES_4) {
+            segWidth = 4;
+        }
+        else if (result->flag & PARASAIL_FLAG_LANES_8) {
+            segWidth = 8;
+        }
+        else if (result->flag & PARASAIL_FLAG_LANES_16) {
+            segWidth = 16;
+        }
+        else if (result->flag & PARASAIL_FLAG_LANES_32) {
+            segWidth = 32;
+        }
+        else if (result->flag & PARASAIL_FLAG_LANES_64) {
+            segWidth = 64;
+        }
+        assert(segWidth);
+        return parasail_striped_unwind_8(lena, lenb, segWidth, array);
+    }
+
     if (result->flag & PARASAIL_FLAG_LANES_1) {
         assert(0);
     }
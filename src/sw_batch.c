@@ -0,0 +1,46 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+parasail_result_t** parasail_sw_batch(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_result_t **results = NULL;
+    int i = 0;
+
+    if (count <= 0) {
+        return NULL;
+    }
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+    for (i=0; i<count; ++i) {
+        results[i] = parasail_sw(s1, s1Len, s2s[i], s2Lens[i], open, gap, matrix);
+        results[i]->flag |= PARASAIL_FLAG_BATCH;
+    }
+
+    return results;
+}
+
+parasail_result_t** parasail_sw_batch_profile(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    return parasail_sw_batch(profile->s1, profile->s1Len,
+            s2s, s2Lens, count, open, gap, profile->matrix);
+}
@@ -0,0 +1,252 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_altivec.h"
+
+#define NEG_INF (INT16_MIN/(int16_t)(2))
+
+
+#define FNAME parasail_sw_batch_altivec_128_16
+#define PNAME parasail_sw_batch_profile_altivec_128_16
+
+parasail_result_t** FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = PNAME(profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+
+/* Inter-sequence (SWIPE-style) local alignment of one query against
+ * many database sequences.  Each vector lane holds a different
+ * database sequence and advances one residue per outer iteration; a
+ * lane is refilled with the next database sequence as soon as its
+ * current one is finished.  The query profile is only used for its
+ * query and substitution matrix, so any profile may be passed. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t a = 0;
+    int32_t l = 0;
+    int32_t next = 0;
+    int32_t active = 0;
+    const char * const restrict s1 = profile->s1;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 8; /* number of values in vector unit */
+    const int32_t n = matrix->size;
+    int32_t * const restrict s1Idx = parasail_memalign_int32_t(16, s1Len);
+    vec128i* const restrict pvH = parasail_memalign_vec128i(16, s1Len);
+    vec128i* const restrict pvE = parasail_memalign_vec128i(16, s1Len);
+    vec128i* const restrict pvScore = parasail_memalign_vec128i(16, n);
+    vec128i* const restrict pvLane = parasail_memalign_vec128i(16, 1);
+    int16_t * const restrict score = (int16_t*)pvScore;
+    int16_t * const restrict lane = (int16_t*)pvLane;
+    vec128i vGapO = _mm_set1_epi16(open);
+    vec128i vGapE = _mm_set1_epi16(gap);
+    vec128i vZero = _mm_setzero_si128();
+    vec128i vNegInf = _mm_set1_epi16(NEG_INF);
+    vec128i vBest = vZero;
+    int16_t maxp = INT16_MAX - (int16_t)(matrix->max+1);
+    int32_t seq[8];
+    int32_t pos[8];
+    int32_t end_query[8];
+    int32_t end_ref[8];
+    int16_t best[8];
+    parasail_result_t **results = NULL;
+
+    if (count <= 0) {
+        parasail_free(pvLane);
+        parasail_free(pvScore);
+        parasail_free(pvE);
+        parasail_free(pvH);
+        parasail_free(s1Idx);
+        return NULL;
+    }
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+
+    for (i=0; i<s1Len; ++i) {
+        s1Idx[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+
+    for (l=0; l<segWidth; ++l) {
+        seq[l] = -1;
+        pos[l] = 0;
+        end_query[l] = 0;
+        end_ref[l] = 0;
+        best[l] = 0;
+    }
+
+    /* initialize H and E */
+    parasail_memset_vec128i(pvH, vZero, s1Len);
+    parasail_memset_vec128i(pvE, vNegInf, s1Len);
+
+    /* outer loop over the columns of all database sequences */
+    while (1) {
+        vec128i vE;
+        vec128i vF;
+        vec128i vH;
+        vec128i vHUp;
+        vec128i vHDiag;
+        vec128i vMaxH;
+        int refill = 0;
+
+        /* retire finished lanes and refill them */
+        active = 0;
+        for (l=0; l<segWidth; ++l) {
+            while (seq[l] < 0 || pos[l] == s2Lens[seq[l]]) {
+                if (seq[l] >= 0) {
+                    parasail_result_t *result = parasail_result_new();
+                    if (best[l] > maxp) {
+                        result->flag |= PARASAIL_FLAG_SATURATED;
+                        result->score = INT16_MAX;
+                        result->end_query = 0;
+                        result->end_ref = 0;
+                    }
+                    else {
+                        result->score = best[l];
+                        result->end_query = end_query[l];
+                        result->end_ref = end_ref[l];
+                    }
+                    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_BATCH
+                        | PARASAIL_FLAG_BITS_16 | PARASAIL_FLAG_LANES_8;
+                    results[seq[l]] = result;
+                    seq[l] = -1;
+                }
+                if (next == count) {
+                    break;
+                }
+                seq[l] = next++;
+                pos[l] = 0;
+                end_query[l] = 0;
+                end_ref[l] = 0;
+                best[l] = 0;
+                refill = 1;
+                /* a new sequence starts from an empty column */
+                for (i=0; i<s1Len; ++i) {
+                    ((int16_t*)(pvH+i))[l] = 0;
+                    ((int16_t*)(pvE+i))[l] = NEG_INF;
+                }
+            }
+            if (seq[l] >= 0) {
+                ++active;
+            }
+        }
+        if (0 == active) {
+            break;
+        }
+        if (refill) {
+            for (l=0; l<segWidth; ++l) {
+                lane[l] = best[l];
+            }
+            vBest = _mm_load_si128(pvLane);
+        }
+
+        /* score of every query letter against each lane's residue;
+         * idle lanes score NEG_INF so they never improve */
+        for (l=0; l<segWidth; ++l) {
+            if (seq[l] >= 0) {
+                const int d = matrix->mapper[(unsigned char)s2s[seq[l]][pos[l]]];
+                for (a=0; a<n; ++a) {
+                    score[a*segWidth + l] = (int16_t)matrix->matrix[a*n + d];
+                }
+            }
+            else {
+                for (a=0; a<n; ++a) {
+                    score[a*segWidth + l] = NEG_INF;
+                }
+            }
+        }
+
+        vF = vNegInf;
+        vHUp = vZero;
+        vHDiag = vZero;
+        vMaxH = vZero;
+
+        /* inner loop over query sequence */
+        for (i=0; i<s1Len; ++i) {
+            vec128i vHLeft = _mm_load_si128(pvH + i);
+            vE = _mm_load_si128(pvE + i);
+            vE = _mm_max_epi16(
+                    _mm_subs_epi16(vE, vGapE),
+                    _mm_subs_epi16(vHLeft, vGapO));
+            vF = _mm_max_epi16(
+                    _mm_subs_epi16(vF, vGapE),
+                    _mm_subs_epi16(vHUp, vGapO));
+            vH = _mm_adds_epi16(vHDiag, _mm_load_si128(pvScore + s1Idx[i]));
+            vH = _mm_max_epi16(vH, vE);
+            vH = _mm_max_epi16(vH, vF);
+            vH = _mm_max_epi16(vH, vZero);
+            _mm_store_si128(pvH + i, vH);
+            _mm_store_si128(pvE + i, vE);
+            vMaxH = _mm_max_epi16(vMaxH, vH);
+            vHDiag = vHLeft;
+            vHUp = vH;
+        }
+
+        /* a lane improved; its end_query is the first row holding the
+         * new best score in this column */
+        if (_mm_movemask_epi8(_mm_cmpgt_epi16(vMaxH, vBest))) {
+            vec128i vPending = _mm_cmpgt_epi16(vMaxH, vBest);
+            vBest = _mm_max_epi16(vBest, vMaxH);
+            _mm_store_si128(pvLane, vBest);
+            for (l=0; l<segWidth; ++l) {
+                best[l] = lane[l];
+            }
+            for (i=0; i<s1Len; ++i) {
+                vec128i vHit = _mm_and_si128(vPending,
+                        _mm_cmpeq_epi16(_mm_load_si128(pvH + i), vBest));
+                if (_mm_movemask_epi8(vHit)) {
+                    _mm_store_si128(pvLane, vHit);
+                    for (l=0; l<segWidth; ++l) {
+                        if (lane[l]) {
+                            end_query[l] = i;
+                            end_ref[l] = pos[l];
+                        }
+                    }
+                    vPending = _mm_andnot_si128(vHit, vPending);
+                    if (!_mm_movemask_epi8(vPending)) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (l=0; l<segWidth; ++l) {
+            if (seq[l] >= 0) {
+                ++pos[l];
+            }
+        }
+    }
+
+    parasail_free(pvLane);
+    parasail_free(pvScore);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(s1Idx);
+
+    return results;
+}
+
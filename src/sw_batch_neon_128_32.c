@@ -0,0 +1,252 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_neon.h"
+
+#define NEG_INF (INT32_MIN/(int32_t)(2))
+
+
+#define FNAME parasail_sw_batch_neon_128_32
+#define PNAME parasail_sw_batch_profile_neon_128_32
+
+parasail_result_t** FNAME(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = PNAME(profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+
+/* Inter-sequence (SWIPE-style) local alignment of one query against
+ * many database sequences.  Each vector lane holds a different
+ * database sequence and advances one residue per outer iteration; a
+ * lane is refilled with the next database sequence as soon as its
+ * current one is finished.  The query profile is only used for its
+ * query and substitution matrix, so any profile may be passed. */
+parasail_result_t** PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    int32_t i = 0;
+    int32_t a = 0;
+    int32_t l = 0;
+    int32_t next = 0;
+    int32_t active = 0;
+    const char * const restrict s1 = profile->s1;
+    const int s1Len = profile->s1Len;
+    const parasail_matrix_t *matrix = profile->matrix;
+    const int32_t segWidth = 4; /* number of values in vector unit */
+    const int32_t n = matrix->size;
+    int32_t * const restrict s1Idx = parasail_memalign_int32_t(16, s1Len);
+    simde__m128i* const restrict pvH = parasail_memalign_simde__m128i(16, s1Len);
+    simde__m128i* const restrict pvE = parasail_memalign_simde__m128i(16, s1Len);
+    simde__m128i* const restrict pvScore = parasail_memalign_simde__m128i(16, n);
+    simde__m128i* const restrict pvLane = parasail_memalign_simde__m128i(16, 1);
+    int32_t * const restrict score = (int32_t*)pvScore;
+    int32_t * const restrict lane = (int32_t*)pvLane;
+    simde__m128i vGapO = simde_mm_set1_epi32(open);
+    simde__m128i vGapE = simde_mm_set1_epi32(gap);
+    simde__m128i vZero = simde_mm_setzero_si128();
+    simde__m128i vNegInf = simde_mm_set1_epi32(NEG_INF);
+    simde__m128i vBest = vZero;
+    int32_t maxp = INT32_MAX - (int32_t)(matrix->max+1);
+    int32_t seq[4];
+    int32_t pos[4];
+    int32_t end_query[4];
+    int32_t end_ref[4];
+    int32_t best[4];
+    parasail_result_t **results = NULL;
+
+    if (count <= 0) {
+        parasail_free(pvLane);
+        parasail_free(pvScore);
+        parasail_free(pvE);
+        parasail_free(pvH);
+        parasail_free(s1Idx);
+        return NULL;
+    }
+
+    results = (parasail_result_t**)malloc(sizeof(parasail_result_t*)*count);
+
+    for (i=0; i<s1Len; ++i) {
+        s1Idx[i] = matrix->mapper[(unsigned char)s1[i]];
+    }
+
+    for (l=0; l<segWidth; ++l) {
+        seq[l] = -1;
+        pos[l] = 0;
+        end_query[l] = 0;
+        end_ref[l] = 0;
+        best[l] = 0;
+    }
+
+    /* initialize H and E */
+    parasail_memset_simde__m128i(pvH, vZero, s1Len);
+    parasail_memset_simde__m128i(pvE, vNegInf, s1Len);
+
+    /* outer loop over the columns of all database sequences */
+    while (1) {
+        simde__m128i vE;
+        simde__m128i vF;
+        simde__m128i vH;
+        simde__m128i vHUp;
+        simde__m128i vHDiag;
+        simde__m128i vMaxH;
+        int refill = 0;
+
+        /* retire finished lanes and refill them */
+        active = 0;
+        for (l=0; l<segWidth; ++l) {
+            while (seq[l] < 0 || pos[l] == s2Lens[seq[l]]) {
+                if (seq[l] >= 0) {
+                    parasail_result_t *result = parasail_result_new();
+                    if (best[l] > maxp) {
+                        result->flag |= PARASAIL_FLAG_SATURATED;
+                        result->score = INT32_MAX;
+                        result->end_query = 0;
+                        result->end_ref = 0;
+                    }
+                    else {
+                        result->score = best[l];
+                        result->end_query = end_query[l];
+                        result->end_ref = end_ref[l];
+                    }
+                    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_BATCH
+                        | PARASAIL_FLAG_BITS_32 | PARASAIL_FLAG_LANES_4;
+                    results[seq[l]] = result;
+                    seq[l] = -1;
+                }
+                if (next == count) {
+                    break;
+                }
+                seq[l] = next++;
+                pos[l] = 0;
+                end_query[l] = 0;
+                end_ref[l] = 0;
+                best[l] = 0;
+                refill = 1;
+                /* a new sequence starts from an empty column */
+                for (i=0; i<s1Len; ++i) {
+                    ((int32_t*)(pvH+i))[l] = 0;
+                    ((int32_t*)(pvE+i))[l] = NEG_INF;
+                }
+            }
+            if (seq[l] >= 0) {
+                ++active;
+            }
+        }
+        if (0 == active) {
+            break;
+        }
+        if (refill) {
+            for (l=0; l<segWidth; ++l) {
+                lane[l] = best[l];
+            }
+            vBest = simde_mm_load_si128(pvLane);
+        }
+
+        /* score of every query letter against each lane's residue;
+         * idle lanes score NEG_INF so they never improve */
+        for (l=0; l<segWidth; ++l) {
+            if (seq[l] >= 0) {
+                const int d = matrix->mapper[(unsigned char)s2s[seq[l]][pos[l]]];
+                for (a=0; a<n; ++a) {
+                    score[a*segWidth + l] = (int32_t)matrix->matrix[a*n + d];
+                }
+            }
+            else {
+                for (a=0; a<n; ++a) {
+                    score[a*segWidth + l] = NEG_INF;
+                }
+            }
+        }
+
+        vF = vNegInf;
+        vHUp = vZero;
+        vHDiag = vZero;
+        vMaxH = vZero;
+
+        /* inner loop over query sequence */
+        for (i=0; i<s1Len; ++i) {
+            simde__m128i vHLeft = simde_mm_load_si128(pvH + i);
+            vE = simde_mm_load_si128(pvE + i);
+            vE = simde_mm_max_epi32(
+                    simde_mm_sub_epi32(vE, vGapE),
+                    simde_mm_sub_epi32(vHLeft, vGapO));
+            vF = simde_mm_max_epi32(
+                    simde_mm_sub_epi32(vF, vGapE),
+                    simde_mm_sub_epi32(vHUp, vGapO));
+            vH = simde_mm_add_epi32(vHDiag, simde_mm_load_si128(pvScore + s1Idx[i]));
+            vH = simde_mm_max_epi32(vH, vE);
+            vH = simde_mm_max_epi32(vH, vF);
+            vH = simde_mm_max_epi32(vH, vZero);
+            simde_mm_store_si128(pvH + i, vH);
+            simde_mm_store_si128(pvE + i, vE);
+            vMaxH = simde_mm_max_epi32(vMaxH, vH);
+            vHDiag = vHLeft;
+            vHUp = vH;
+        }
+
+        /* a lane improved; its end_query is the first row holding the
+         * new best score in this column */
+        if (simde_mm_movemask_epi8(simde_mm_cmpgt_epi32(vMaxH, vBest))) {
+            simde__m128i vPending = simde_mm_cmpgt_epi32(vMaxH, vBest);
+            vBest = simde_mm_max_epi32(vBest, vMaxH);
+            simde_mm_store_si128(pvLane, vBest);
+            for (l=0; l<segWidth; ++l) {
+                best[l] = lane[l];
+            }
+            for (i=0; i<s1Len; ++i) {
+                simde__m128i vHit = simde_mm_and_si128(vPending,
+                        simde_mm_cmpeq_epi32(simde_mm_load_si128(pvH + i), vBest));
+                if (simde_mm_movemask_epi8(vHit)) {
+                    simde_mm_store_si128(pvLane, vHit);
+                    for (l=0; l<segWidth; ++l) {
+                        if (lane[l]) {
+                            end_query[l] = i;
+                            end_ref[l] = pos[l];
+                        }
+                    }
+                    vPending = simde_mm_andnot_si128(vHit, vPending);
+                    if (!simde_mm_movemask_epi8(vPending)) {
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (l=0; l<segWidth; ++l) {
+            if (seq[l] >= 0) {
+                ++pos[l];
+            }
+        }
+    }
+
+    parasail_free(pvLane);
+    parasail_free(pvScore);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(s1Idx);
+
+    return results;
+}
+
@@ -305,6 +305,12 @@ parasail_result_t* parasail_sw_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_64_pointer = parasail_sw_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_64_pointer = parasail_sw_scan_avx2_256_64;
@@ -347,6 +353,12 @@ parasail_result_t* parasail_sw_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_32_pointer = parasail_sw_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_32_pointer = parasail_sw_scan_avx2_256_32;
@@ -389,6 +401,12 @@ parasail_result_t* parasail_sw_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_16_pointer = parasail_sw_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_16_pointer = parasail_sw_scan_avx2_256_16;
@@ -431,6 +449,12 @@ parasail_result_t* parasail_sw_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_8_pointer = parasail_sw_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_8_pointer = parasail_sw_scan_avx2_256_8;
@@ -473,6 +497,12 @@ parasail_result_t* parasail_sw_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_64_pointer = parasail_sw_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_64_pointer = parasail_sw_striped_avx2_256_64;
@@ -515,6 +545,12 @@ parasail_result_t* parasail_sw_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_32_pointer = parasail_sw_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_32_pointer = parasail_sw_striped_avx2_256_32;
@@ -557,6 +593,12 @@ parasail_result_t* parasail_sw_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_16_pointer = parasail_sw_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_16_pointer = parasail_sw_striped_avx2_256_16;
@@ -599,6 +641,12 @@ parasail_result_t* parasail_sw_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_8_pointer = parasail_sw_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_8_pointer = parasail_sw_striped_avx2_256_8;
@@ -641,6 +689,12 @@ parasail_result_t* parasail_sw_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_diag_64_pointer = parasail_sw_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_diag_64_pointer = parasail_sw_diag_avx2_256_64;
@@ -683,6 +737,12 @@ parasail_result_t* parasail_sw_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_diag_32_pointer = parasail_sw_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_diag_32_pointer = parasail_sw_diag_avx2_256_32;
@@ -725,6 +785,12 @@ parasail_result_t* parasail_sw_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_diag_16_pointer = parasail_sw_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_diag_16_pointer = parasail_sw_diag_avx2_256_16;
@@ -767,6 +833,12 @@ parasail_result_t* parasail_sw_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_diag_8_pointer = parasail_sw_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_diag_8_pointer = parasail_sw_diag_avx2_256_8;
@@ -809,6 +881,12 @@ parasail_result_t* parasail_sw_stats_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_64_pointer = parasail_sw_stats_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_64_pointer = parasail_sw_stats_scan_avx2_256_64;
@@ -851,6 +929,12 @@ parasail_result_t* parasail_sw_stats_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_32_pointer = parasail_sw_stats_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_32_pointer = parasail_sw_stats_scan_avx2_256_32;
@@ -893,6 +977,12 @@ parasail_result_t* parasail_sw_stats_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_16_pointer = parasail_sw_stats_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_16_pointer = parasail_sw_stats_scan_avx2_256_16;
@@ -935,6 +1025,12 @@ parasail_result_t* parasail_sw_stats_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_8_pointer = parasail_sw_stats_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_8_pointer = parasail_sw_stats_scan_avx2_256_8;
@@ -977,6 +1073,12 @@ parasail_result_t* parasail_sw_stats_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_64_pointer = parasail_sw_stats_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_64_pointer = parasail_sw_stats_striped_avx2_256_64;
@@ -1019,6 +1121,12 @@ parasail_result_t* parasail_sw_stats_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_32_pointer = parasail_sw_stats_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_32_pointer = parasail_sw_stats_striped_avx2_256_32;
@@ -1061,6 +1169,12 @@ parasail_result_t* parasail_sw_stats_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_16_pointer = parasail_sw_stats_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_16_pointer = parasail_sw_stats_striped_avx2_256_16;
@@ -1103,6 +1217,12 @@ parasail_result_t* parasail_sw_stats_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_8_pointer = parasail_sw_stats_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_8_pointer = parasail_sw_stats_striped_avx2_256_8;
@@ -1145,6 +1265,12 @@ parasail_result_t* parasail_sw_stats_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_diag_64_pointer = parasail_sw_stats_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_diag_64_pointer = parasail_sw_stats_diag_avx2_256_64;
@@ -1187,6 +1313,12 @@ parasail_result_t* parasail_sw_stats_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_diag_32_pointer = parasail_sw_stats_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_diag_32_pointer = parasail_sw_stats_diag_avx2_256_32;
@@ -1229,6 +1361,12 @@ parasail_result_t* parasail_sw_stats_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_diag_16_pointer = parasail_sw_stats_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_diag_16_pointer = parasail_sw_stats_diag_avx2_256_16;
@@ -1271,6 +1409,12 @@ parasail_result_t* parasail_sw_stats_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_diag_8_pointer = parasail_sw_stats_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_diag_8_pointer = parasail_sw_stats_diag_avx2_256_8;
@@ -1313,6 +1457,12 @@ parasail_result_t* parasail_sw_table_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_64_pointer = parasail_sw_table_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_64_pointer = parasail_sw_table_scan_avx2_256_64;
@@ -1355,6 +1505,12 @@ parasail_result_t* parasail_sw_table_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_32_pointer = parasail_sw_table_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_32_pointer = parasail_sw_table_scan_avx2_256_32;
@@ -1397,6 +1553,12 @@ parasail_result_t* parasail_sw_table_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_16_pointer = parasail_sw_table_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_16_pointer = parasail_sw_table_scan_avx2_256_16;
@@ -1439,6 +1601,12 @@ parasail_result_t* parasail_sw_table_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_8_pointer = parasail_sw_table_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_8_pointer = parasail_sw_table_scan_avx2_256_8;
@@ -1481,6 +1649,12 @@ parasail_result_t* parasail_sw_table_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_64_pointer = parasail_sw_table_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_64_pointer = parasail_sw_table_striped_avx2_256_64;
@@ -1523,6 +1697,12 @@ parasail_result_t* parasail_sw_table_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_32_pointer = parasail_sw_table_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_32_pointer = parasail_sw_table_striped_avx2_256_32;
@@ -1565,6 +1745,12 @@ parasail_result_t* parasail_sw_table_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_16_pointer = parasail_sw_table_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_16_pointer = parasail_sw_table_striped_avx2_256_16;
@@ -1607,6 +1793,12 @@ parasail_result_t* parasail_sw_table_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_8_pointer = parasail_sw_table_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_8_pointer = parasail_sw_table_striped_avx2_256_8;
@@ -1649,6 +1841,12 @@ parasail_result_t* parasail_sw_table_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_diag_64_pointer = parasail_sw_table_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_diag_64_pointer = parasail_sw_table_diag_avx2_256_64;
@@ -1691,6 +1889,12 @@ parasail_result_t* parasail_sw_table_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_diag_32_pointer = parasail_sw_table_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_diag_32_pointer = parasail_sw_table_diag_avx2_256_32;
@@ -1733,6 +1937,12 @@ parasail_result_t* parasail_sw_table_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_diag_16_pointer = parasail_sw_table_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_diag_16_pointer = parasail_sw_table_diag_avx2_256_16;
@@ -1775,6 +1985,12 @@ parasail_result_t* parasail_sw_table_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_diag_8_pointer = parasail_sw_table_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_diag_8_pointer = parasail_sw_table_diag_avx2_256_8;
@@ -1817,6 +2033,12 @@ parasail_result_t* parasail_sw_stats_table_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_64_pointer = parasail_sw_stats_table_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_64_pointer = parasail_sw_stats_table_scan_avx2_256_64;
@@ -1859,6 +2081,12 @@ parasail_result_t* parasail_sw_stats_table_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_32_pointer = parasail_sw_stats_table_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_32_pointer = parasail_sw_stats_table_scan_avx2_256_32;
@@ -1901,6 +2129,12 @@ parasail_result_t* parasail_sw_stats_table_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_16_pointer = parasail_sw_stats_table_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_16_pointer = parasail_sw_stats_table_scan_avx2_256_16;
@@ -1943,6 +2177,12 @@ parasail_result_t* parasail_sw_stats_table_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_8_pointer = parasail_sw_stats_table_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_8_pointer = parasail_sw_stats_table_scan_avx2_256_8;
@@ -1985,6 +2225,12 @@ parasail_result_t* parasail_sw_stats_table_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_64_pointer = parasail_sw_stats_table_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_64_pointer = parasail_sw_stats_table_striped_avx2_256_64;
@@ -2027,6 +2273,12 @@ parasail_result_t* parasail_sw_stats_table_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_32_pointer = parasail_sw_stats_table_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_32_pointer = parasail_sw_stats_table_striped_avx2_256_32;
@@ -2069,6 +2321,12 @@ parasail_result_t* parasail_sw_stats_table_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_16_pointer = parasail_sw_stats_table_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_16_pointer = parasail_sw_stats_table_striped_avx2_256_16;
@@ -2111,6 +2369,12 @@ parasail_result_t* parasail_sw_stats_table_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_8_pointer = parasail_sw_stats_table_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_8_pointer = parasail_sw_stats_table_striped_avx2_256_8;
@@ -2153,6 +2417,12 @@ parasail_result_t* parasail_sw_stats_table_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_diag_64_pointer = parasail_sw_stats_table_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_diag_64_pointer = parasail_sw_stats_table_diag_avx2_256_64;
@@ -2195,6 +2465,12 @@ parasail_result_t* parasail_sw_stats_table_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_diag_32_pointer = parasail_sw_stats_table_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_diag_32_pointer = parasail_sw_stats_table_diag_avx2_256_32;
@@ -2237,6 +2513,12 @@ parasail_result_t* parasail_sw_stats_table_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_diag_16_pointer = parasail_sw_stats_table_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_diag_16_pointer = parasail_sw_stats_table_diag_avx2_256_16;
@@ -2279,6 +2561,12 @@ parasail_result_t* parasail_sw_stats_table_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_diag_8_pointer = parasail_sw_stats_table_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_diag_8_pointer = parasail_sw_stats_table_diag_avx2_256_8;
@@ -2321,6 +2609,12 @@ parasail_result_t* parasail_sw_rowcol_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_64_pointer = parasail_sw_rowcol_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_64_pointer = parasail_sw_rowcol_scan_avx2_256_64;
@@ -2363,6 +2657,12 @@ parasail_result_t* parasail_sw_rowcol_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_32_pointer = parasail_sw_rowcol_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_32_pointer = parasail_sw_rowcol_scan_avx2_256_32;
@@ -2405,6 +2705,12 @@ parasail_result_t* parasail_sw_rowcol_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_16_pointer = parasail_sw_rowcol_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_16_pointer = parasail_sw_rowcol_scan_avx2_256_16;
@@ -2447,6 +2753,12 @@ parasail_result_t* parasail_sw_rowcol_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_8_pointer = parasail_sw_rowcol_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_8_pointer = parasail_sw_rowcol_scan_avx2_256_8;
@@ -2489,6 +2801,12 @@ parasail_result_t* parasail_sw_rowcol_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_64_pointer = parasail_sw_rowcol_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_64_pointer = parasail_sw_rowcol_striped_avx2_256_64;
@@ -2531,6 +2849,12 @@ parasail_result_t* parasail_sw_rowcol_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_32_pointer = parasail_sw_rowcol_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_32_pointer = parasail_sw_rowcol_striped_avx2_256_32;
@@ -2573,6 +2897,12 @@ parasail_result_t* parasail_sw_rowcol_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_16_pointer = parasail_sw_rowcol_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_16_pointer = parasail_sw_rowcol_striped_avx2_256_16;
@@ -2615,6 +2945,12 @@ parasail_result_t* parasail_sw_rowcol_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_8_pointer = parasail_sw_rowcol_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_8_pointer = parasail_sw_rowcol_striped_avx2_256_8;
@@ -2657,6 +2993,12 @@ parasail_result_t* parasail_sw_rowcol_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_diag_64_pointer = parasail_sw_rowcol_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_diag_64_pointer = parasail_sw_rowcol_diag_avx2_256_64;
@@ -2699,6 +3041,12 @@ parasail_result_t* parasail_sw_rowcol_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_diag_32_pointer = parasail_sw_rowcol_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_diag_32_pointer = parasail_sw_rowcol_diag_avx2_256_32;
@@ -2741,6 +3089,12 @@ parasail_result_t* parasail_sw_rowcol_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_diag_16_pointer = parasail_sw_rowcol_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_diag_16_pointer = parasail_sw_rowcol_diag_avx2_256_16;
@@ -2783,6 +3137,12 @@ parasail_result_t* parasail_sw_rowcol_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_diag_8_pointer = parasail_sw_rowcol_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_diag_8_pointer = parasail_sw_rowcol_diag_avx2_256_8;
@@ -2825,6 +3185,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_64_pointer = parasail_sw_stats_rowcol_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_64_pointer = parasail_sw_stats_rowcol_scan_avx2_256_64;
@@ -2867,6 +3233,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_32_pointer = parasail_sw_stats_rowcol_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_32_pointer = parasail_sw_stats_rowcol_scan_avx2_256_32;
@@ -2909,6 +3281,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_16_pointer = parasail_sw_stats_rowcol_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_16_pointer = parasail_sw_stats_rowcol_scan_avx2_256_16;
@@ -2951,6 +3329,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_8_pointer = parasail_sw_stats_rowcol_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_8_pointer = parasail_sw_stats_rowcol_scan_avx2_256_8;
@@ -2993,6 +3377,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_64_pointer = parasail_sw_stats_rowcol_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_64_pointer = parasail_sw_stats_rowcol_striped_avx2_256_64;
@@ -3035,6 +3425,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_32_pointer = parasail_sw_stats_rowcol_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_32_pointer = parasail_sw_stats_rowcol_striped_avx2_256_32;
@@ -3077,6 +3473,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_16_pointer = parasail_sw_stats_rowcol_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_16_pointer = parasail_sw_stats_rowcol_striped_avx2_256_16;
@@ -3119,6 +3521,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_8_pointer = parasail_sw_stats_rowcol_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_8_pointer = parasail_sw_stats_rowcol_striped_avx2_256_8;
@@ -3161,6 +3569,12 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_diag_64_pointer = parasail_sw_stats_rowcol_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_diag_64_pointer = parasail_sw_stats_rowcol_diag_avx2_256_64;
@@ -3203,6 +3617,12 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_diag_32_pointer = parasail_sw_stats_rowcol_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_diag_32_pointer = parasail_sw_stats_rowcol_diag_avx2_256_32;
@@ -3245,6 +3665,12 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_diag_16_pointer = parasail_sw_stats_rowcol_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_diag_16_pointer = parasail_sw_stats_rowcol_diag_avx2_256_16;
@@ -3287,6 +3713,12 @@ parasail_result_t* parasail_sw_stats_rowcol_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_diag_8_pointer = parasail_sw_stats_rowcol_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_diag_8_pointer = parasail_sw_stats_rowcol_diag_avx2_256_8;
@@ -3329,6 +3761,12 @@ parasail_result_t* parasail_sw_trace_scan_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_64_pointer = parasail_sw_trace_scan_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_64_pointer = parasail_sw_trace_scan_avx2_256_64;
@@ -3371,6 +3809,12 @@ parasail_result_t* parasail_sw_trace_scan_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_32_pointer = parasail_sw_trace_scan_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_32_pointer = parasail_sw_trace_scan_avx2_256_32;
@@ -3413,6 +3857,12 @@ parasail_result_t* parasail_sw_trace_scan_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_16_pointer = parasail_sw_trace_scan_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_16_pointer = parasail_sw_trace_scan_avx2_256_16;
@@ -3455,6 +3905,12 @@ parasail_result_t* parasail_sw_trace_scan_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_8_pointer = parasail_sw_trace_scan_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_8_pointer = parasail_sw_trace_scan_avx2_256_8;
@@ -3497,6 +3953,12 @@ parasail_result_t* parasail_sw_trace_striped_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_64_pointer = parasail_sw_trace_striped_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_64_pointer = parasail_sw_trace_striped_avx2_256_64;
@@ -3539,6 +4001,12 @@ parasail_result_t* parasail_sw_trace_striped_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_32_pointer = parasail_sw_trace_striped_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_32_pointer = parasail_sw_trace_striped_avx2_256_32;
@@ -3581,6 +4049,12 @@ parasail_result_t* parasail_sw_trace_striped_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_16_pointer = parasail_sw_trace_striped_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_16_pointer = parasail_sw_trace_striped_avx2_256_16;
@@ -3623,6 +4097,12 @@ parasail_result_t* parasail_sw_trace_striped_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_8_pointer = parasail_sw_trace_striped_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_8_pointer = parasail_sw_trace_striped_avx2_256_8;
@@ -3665,6 +4145,12 @@ parasail_result_t* parasail_sw_trace_diag_64_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_diag_64_pointer = parasail_sw_trace_diag_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_diag_64_pointer = parasail_sw_trace_diag_avx2_256_64;
@@ -3707,6 +4193,12 @@ parasail_result_t* parasail_sw_trace_diag_32_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_diag_32_pointer = parasail_sw_trace_diag_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_diag_32_pointer = parasail_sw_trace_diag_avx2_256_32;
@@ -3749,6 +4241,12 @@ parasail_result_t* parasail_sw_trace_diag_16_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_diag_16_pointer = parasail_sw_trace_diag_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_diag_16_pointer = parasail_sw_trace_diag_avx2_256_16;
@@ -3791,6 +4289,12 @@ parasail_result_t* parasail_sw_trace_diag_8_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_diag_8_pointer = parasail_sw_trace_diag_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_diag_8_pointer = parasail_sw_trace_diag_avx2_256_8;
@@ -3832,6 +4336,12 @@ parasail_result_t* parasail_sw_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_64_pointer = parasail_sw_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_profile_64_pointer = parasail_sw_scan_profile_avx2_256_64;
@@ -3873,7 +4383,13 @@ parasail_result_t* parasail_sw_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
-#if HAVE_AVX2
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_32_pointer = parasail_sw_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_profile_32_pointer = parasail_sw_scan_profile_avx2_256_32;
     }
@@ -3914,6 +4430,12 @@ parasail_result_t* parasail_sw_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_16_pointer = parasail_sw_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_profile_16_pointer = parasail_sw_scan_profile_avx2_256_16;
@@ -3955,6 +4477,12 @@ parasail_result_t* parasail_sw_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_8_pointer = parasail_sw_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_scan_profile_8_pointer = parasail_sw_scan_profile_avx2_256_8;
@@ -3996,6 +4524,12 @@ parasail_result_t* parasail_sw_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_64_pointer = parasail_sw_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_profile_64_pointer = parasail_sw_striped_profile_avx2_256_64;
@@ -4037,6 +4571,12 @@ parasail_result_t* parasail_sw_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_32_pointer = parasail_sw_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_profile_32_pointer = parasail_sw_striped_profile_avx2_256_32;
@@ -4078,6 +4618,12 @@ parasail_result_t* parasail_sw_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_16_pointer = parasail_sw_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_profile_16_pointer = parasail_sw_striped_profile_avx2_256_16;
@@ -4119,6 +4665,12 @@ parasail_result_t* parasail_sw_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_8_pointer = parasail_sw_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_striped_profile_8_pointer = parasail_sw_striped_profile_avx2_256_8;
@@ -4160,6 +4712,12 @@ parasail_result_t* parasail_sw_stats_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_profile_64_pointer = parasail_sw_stats_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_profile_64_pointer = parasail_sw_stats_scan_profile_avx2_256_64;
@@ -4201,6 +4759,12 @@ parasail_result_t* parasail_sw_stats_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_profile_32_pointer = parasail_sw_stats_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_profile_32_pointer = parasail_sw_stats_scan_profile_avx2_256_32;
@@ -4242,6 +4806,12 @@ parasail_result_t* parasail_sw_stats_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_profile_16_pointer = parasail_sw_stats_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_profile_16_pointer = parasail_sw_stats_scan_profile_avx2_256_16;
@@ -4283,6 +4853,12 @@ parasail_result_t* parasail_sw_stats_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_scan_profile_8_pointer = parasail_sw_stats_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_scan_profile_8_pointer = parasail_sw_stats_scan_profile_avx2_256_8;
@@ -4324,6 +4900,12 @@ parasail_result_t* parasail_sw_stats_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_profile_64_pointer = parasail_sw_stats_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_profile_64_pointer = parasail_sw_stats_striped_profile_avx2_256_64;
@@ -4365,6 +4947,12 @@ parasail_result_t* parasail_sw_stats_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_profile_32_pointer = parasail_sw_stats_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_profile_32_pointer = parasail_sw_stats_striped_profile_avx2_256_32;
@@ -4406,6 +4994,12 @@ parasail_result_t* parasail_sw_stats_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_profile_16_pointer = parasail_sw_stats_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_profile_16_pointer = parasail_sw_stats_striped_profile_avx2_256_16;
@@ -4447,6 +5041,12 @@ parasail_result_t* parasail_sw_stats_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_striped_profile_8_pointer = parasail_sw_stats_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_striped_profile_8_pointer = parasail_sw_stats_striped_profile_avx2_256_8;
@@ -4488,6 +5088,12 @@ parasail_result_t* parasail_sw_table_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_profile_64_pointer = parasail_sw_table_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_profile_64_pointer = parasail_sw_table_scan_profile_avx2_256_64;
@@ -4529,6 +5135,12 @@ parasail_result_t* parasail_sw_table_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_profile_32_pointer = parasail_sw_table_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_profile_32_pointer = parasail_sw_table_scan_profile_avx2_256_32;
@@ -4570,6 +5182,12 @@ parasail_result_t* parasail_sw_table_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_profile_16_pointer = parasail_sw_table_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_profile_16_pointer = parasail_sw_table_scan_profile_avx2_256_16;
@@ -4611,6 +5229,12 @@ parasail_result_t* parasail_sw_table_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_scan_profile_8_pointer = parasail_sw_table_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_scan_profile_8_pointer = parasail_sw_table_scan_profile_avx2_256_8;
@@ -4652,6 +5276,12 @@ parasail_result_t* parasail_sw_table_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_profile_64_pointer = parasail_sw_table_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_profile_64_pointer = parasail_sw_table_striped_profile_avx2_256_64;
@@ -4693,6 +5323,12 @@ parasail_result_t* parasail_sw_table_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_profile_32_pointer = parasail_sw_table_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_profile_32_pointer = parasail_sw_table_striped_profile_avx2_256_32;
@@ -4734,6 +5370,12 @@ parasail_result_t* parasail_sw_table_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_profile_16_pointer = parasail_sw_table_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_profile_16_pointer = parasail_sw_table_striped_profile_avx2_256_16;
@@ -4775,6 +5417,12 @@ parasail_result_t* parasail_sw_table_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_table_striped_profile_8_pointer = parasail_sw_table_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_table_striped_profile_8_pointer = parasail_sw_table_striped_profile_avx2_256_8;
@@ -4816,6 +5464,12 @@ parasail_result_t* parasail_sw_stats_table_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_profile_64_pointer = parasail_sw_stats_table_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_profile_64_pointer = parasail_sw_stats_table_scan_profile_avx2_256_64;
@@ -4857,6 +5511,12 @@ parasail_result_t* parasail_sw_stats_table_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_profile_32_pointer = parasail_sw_stats_table_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_profile_32_pointer = parasail_sw_stats_table_scan_profile_avx2_256_32;
@@ -4898,6 +5558,12 @@ parasail_result_t* parasail_sw_stats_table_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_profile_16_pointer = parasail_sw_stats_table_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_profile_16_pointer = parasail_sw_stats_table_scan_profile_avx2_256_16;
@@ -4939,6 +5605,12 @@ parasail_result_t* parasail_sw_stats_table_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_scan_profile_8_pointer = parasail_sw_stats_table_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_scan_profile_8_pointer = parasail_sw_stats_table_scan_profile_avx2_256_8;
@@ -4980,6 +5652,12 @@ parasail_result_t* parasail_sw_stats_table_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_profile_64_pointer = parasail_sw_stats_table_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_profile_64_pointer = parasail_sw_stats_table_striped_profile_avx2_256_64;
@@ -5021,6 +5699,12 @@ parasail_result_t* parasail_sw_stats_table_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_profile_32_pointer = parasail_sw_stats_table_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_profile_32_pointer = parasail_sw_stats_table_striped_profile_avx2_256_32;
@@ -5062,6 +5746,12 @@ parasail_result_t* parasail_sw_stats_table_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_profile_16_pointer = parasail_sw_stats_table_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_profile_16_pointer = parasail_sw_stats_table_striped_profile_avx2_256_16;
@@ -5103,6 +5793,12 @@ parasail_result_t* parasail_sw_stats_table_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_table_striped_profile_8_pointer = parasail_sw_stats_table_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_table_striped_profile_8_pointer = parasail_sw_stats_table_striped_profile_avx2_256_8;
@@ -5144,6 +5840,12 @@ parasail_result_t* parasail_sw_rowcol_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_profile_64_pointer = parasail_sw_rowcol_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_profile_64_pointer = parasail_sw_rowcol_scan_profile_avx2_256_64;
@@ -5185,6 +5887,12 @@ parasail_result_t* parasail_sw_rowcol_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_profile_32_pointer = parasail_sw_rowcol_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_profile_32_pointer = parasail_sw_rowcol_scan_profile_avx2_256_32;
@@ -5226,6 +5934,12 @@ parasail_result_t* parasail_sw_rowcol_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_profile_16_pointer = parasail_sw_rowcol_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_profile_16_pointer = parasail_sw_rowcol_scan_profile_avx2_256_16;
@@ -5267,6 +5981,12 @@ parasail_result_t* parasail_sw_rowcol_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_scan_profile_8_pointer = parasail_sw_rowcol_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_scan_profile_8_pointer = parasail_sw_rowcol_scan_profile_avx2_256_8;
@@ -5308,6 +6028,12 @@ parasail_result_t* parasail_sw_rowcol_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_profile_64_pointer = parasail_sw_rowcol_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_profile_64_pointer = parasail_sw_rowcol_striped_profile_avx2_256_64;
@@ -5349,6 +6075,12 @@ parasail_result_t* parasail_sw_rowcol_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_profile_32_pointer = parasail_sw_rowcol_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_profile_32_pointer = parasail_sw_rowcol_striped_profile_avx2_256_32;
@@ -5390,6 +6122,12 @@ parasail_result_t* parasail_sw_rowcol_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_profile_16_pointer = parasail_sw_rowcol_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_profile_16_pointer = parasail_sw_rowcol_striped_profile_avx2_256_16;
@@ -5431,6 +6169,12 @@ parasail_result_t* parasail_sw_rowcol_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_rowcol_striped_profile_8_pointer = parasail_sw_rowcol_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_rowcol_striped_profile_8_pointer = parasail_sw_rowcol_striped_profile_avx2_256_8;
@@ -5472,6 +6216,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_profile_64_pointer = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_profile_64_pointer = parasail_sw_stats_rowcol_scan_profile_avx2_256_64;
@@ -5513,6 +6263,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_profile_32_pointer = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_profile_32_pointer = parasail_sw_stats_rowcol_scan_profile_avx2_256_32;
@@ -5554,6 +6310,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_profile_16_pointer = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_profile_16_pointer = parasail_sw_stats_rowcol_scan_profile_avx2_256_16;
@@ -5595,6 +6357,12 @@ parasail_result_t* parasail_sw_stats_rowcol_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_scan_profile_8_pointer = parasail_sw_stats_rowcol_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_scan_profile_8_pointer = parasail_sw_stats_rowcol_scan_profile_avx2_256_8;
@@ -5636,6 +6404,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_profile_64_pointer = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_profile_64_pointer = parasail_sw_stats_rowcol_striped_profile_avx2_256_64;
@@ -5677,6 +6451,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_profile_32_pointer = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_profile_32_pointer = parasail_sw_stats_rowcol_striped_profile_avx2_256_32;
@@ -5718,6 +6498,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_profile_16_pointer = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_profile_16_pointer = parasail_sw_stats_rowcol_striped_profile_avx2_256_16;
@@ -5759,6 +6545,12 @@ parasail_result_t* parasail_sw_stats_rowcol_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_stats_rowcol_striped_profile_8_pointer = parasail_sw_stats_rowcol_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_stats_rowcol_striped_profile_8_pointer = parasail_sw_stats_rowcol_striped_profile_avx2_256_8;
@@ -5800,6 +6592,12 @@ parasail_result_t* parasail_sw_trace_scan_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_profile_64_pointer = parasail_sw_trace_scan_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_profile_64_pointer = parasail_sw_trace_scan_profile_avx2_256_64;
@@ -5841,6 +6639,12 @@ parasail_result_t* parasail_sw_trace_scan_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_profile_32_pointer = parasail_sw_trace_scan_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_profile_32_pointer = parasail_sw_trace_scan_profile_avx2_256_32;
@@ -5882,6 +6686,12 @@ parasail_result_t* parasail_sw_trace_scan_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_profile_16_pointer = parasail_sw_trace_scan_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_profile_16_pointer = parasail_sw_trace_scan_profile_avx2_256_16;
@@ -5923,6 +6733,12 @@ parasail_result_t* parasail_sw_trace_scan_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_scan_profile_8_pointer = parasail_sw_trace_scan_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_scan_profile_8_pointer = parasail_sw_trace_scan_profile_avx2_256_8;
@@ -5964,6 +6780,12 @@ parasail_result_t* parasail_sw_trace_striped_profile_64_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_profile_64_pointer = parasail_sw_trace_striped_profile_avx512bw_512_64;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_profile_64_pointer = parasail_sw_trace_striped_profile_avx2_256_64;
@@ -6005,6 +6827,12 @@ parasail_result_t* parasail_sw_trace_striped_profile_32_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_profile_32_pointer = parasail_sw_trace_striped_profile_avx512bw_512_32;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_profile_32_pointer = parasail_sw_trace_striped_profile_avx2_256_32;
@@ -6046,6 +6874,12 @@ parasail_result_t* parasail_sw_trace_striped_profile_16_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_profile_16_pointer = parasail_sw_trace_striped_profile_avx512bw_512_16;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_profile_16_pointer = parasail_sw_trace_striped_profile_avx2_256_16;
@@ -6087,6 +6921,12 @@ parasail_result_t* parasail_sw_trace_striped_profile_8_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_trace_striped_profile_8_pointer = parasail_sw_trace_striped_profile_avx512bw_512_8;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         parasail_sw_trace_striped_profile_8_pointer = parasail_sw_trace_striped_profile_avx2_256_8;
@@ -7330,3 +8170,1593 @@ parasail_result_t* parasail_sw_trace_striped_profile_8(
     return parasail_sw_trace_striped_profile_8_pointer(profile, s2, s2Len, open, gap);
 }
 
+/* profile workspace dispatchers */
+parasail_pwfunction_t parasail_sw_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_8_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_64_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_32_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_16_ws_dispatcher;
+parasail_pwfunction_t parasail_sw_striped_profile_8_ws_dispatcher;
+parasail_pwfunction_t * parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_8_ws_dispatcher;
+
+parasail_result_t* parasail_sw_scan_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_avx512bw_512_64_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_altivec_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_64_ws_pointer = parasail_sw_scan_profile_neon_128_64_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_64_ws_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_avx512bw_512_32_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_altivec_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_32_ws_pointer = parasail_sw_scan_profile_neon_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_32_ws_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_avx512bw_512_16_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_altivec_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_16_ws_pointer = parasail_sw_scan_profile_neon_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_16_ws_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_avx512bw_512_8_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_altivec_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_8_ws_pointer = parasail_sw_scan_profile_neon_128_8_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_8_ws_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_64_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_avx512bw_512_64_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_avx2_256_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_sse41_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_sse2_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_altivec_128_64_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_64_ws_pointer = parasail_sw_striped_profile_neon_128_64_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_64_ws_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_64_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_64_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_32_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_avx512bw_512_32_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_avx2_256_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_sse41_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_sse2_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_altivec_128_32_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_32_ws_pointer = parasail_sw_striped_profile_neon_128_32_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_32_ws_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_32_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_32_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_16_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_avx512bw_512_16_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_avx2_256_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_sse41_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_sse2_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_altivec_128_16_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_16_ws_pointer = parasail_sw_striped_profile_neon_128_16_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_16_ws_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_16_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_16_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_8_ws_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_avx512bw_512_8_ws;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_avx2_256_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_sse41_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_sse2_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_altivec_128_8_ws;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_8_ws_pointer = parasail_sw_striped_profile_neon_128_8_ws;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_8_ws_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_8_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_8_ws_pointer(profile, s2, s2Len, open, gap, workspace, result);
+}
+
+/* profile encoded dispatchers */
+parasail_pefunction_t parasail_sw_scan_profile_64_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_64_enc_dispatcher;
+parasail_pefunction_t parasail_sw_scan_profile_32_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_32_enc_dispatcher;
+parasail_pefunction_t parasail_sw_scan_profile_16_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_16_enc_dispatcher;
+parasail_pefunction_t parasail_sw_scan_profile_8_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_8_enc_dispatcher;
+parasail_pefunction_t parasail_sw_striped_profile_64_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_64_enc_dispatcher;
+parasail_pefunction_t parasail_sw_striped_profile_32_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_32_enc_dispatcher;
+parasail_pefunction_t parasail_sw_striped_profile_16_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_16_enc_dispatcher;
+parasail_pefunction_t parasail_sw_striped_profile_8_enc_dispatcher;
+parasail_pefunction_t * parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_8_enc_dispatcher;
+
+parasail_result_t* parasail_sw_scan_profile_64_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_avx512bw_512_64_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_avx2_256_64_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_sse41_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_sse2_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_altivec_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_64_enc_pointer = parasail_sw_scan_profile_neon_128_64_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_64_enc_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_64_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_64_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_32_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_avx512bw_512_32_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_avx2_256_32_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_sse41_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_sse2_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_altivec_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_32_enc_pointer = parasail_sw_scan_profile_neon_128_32_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_32_enc_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_32_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_32_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_16_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_avx512bw_512_16_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_avx2_256_16_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_sse41_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_sse2_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_altivec_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_16_enc_pointer = parasail_sw_scan_profile_neon_128_16_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_16_enc_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_16_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_16_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_8_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_avx512bw_512_8_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_avx2_256_8_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_sse41_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_sse2_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_altivec_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_scan_profile_8_enc_pointer = parasail_sw_scan_profile_neon_128_8_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_scan_profile_8_enc_pointer = NULL;
+    }
+    return parasail_sw_scan_profile_8_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_scan_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_scan_profile_8_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_64_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_avx512bw_512_64_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_avx2_256_64_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_sse41_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_sse2_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_altivec_128_64_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_64_enc_pointer = parasail_sw_striped_profile_neon_128_64_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_64_enc_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_64_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_64_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_64_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_32_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_avx512bw_512_32_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_avx2_256_32_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_sse41_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_sse2_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_altivec_128_32_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_32_enc_pointer = parasail_sw_striped_profile_neon_128_32_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_32_enc_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_32_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_32_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_32_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_16_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_avx512bw_512_16_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_avx2_256_16_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_sse41_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_sse2_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_altivec_128_16_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_16_enc_pointer = parasail_sw_striped_profile_neon_128_16_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_16_enc_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_16_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_16_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_16_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_8_enc_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_avx512bw_512_8_enc;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_avx2_256_8_enc;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_sse41_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_sse2_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_altivec_128_8_enc;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_striped_profile_8_enc_pointer = parasail_sw_striped_profile_neon_128_8_enc;
+    }
+    else
+#endif
+    {
+        parasail_sw_striped_profile_8_enc_pointer = NULL;
+    }
+    return parasail_sw_striped_profile_8_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* parasail_sw_striped_profile_8_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return parasail_sw_striped_profile_8_enc_pointer(profile, s2, open, gap, workspace, result);
+}
+
+/* inter-sequence batch dispatchers */
+parasail_bfunction_t parasail_sw_batch_32_dispatcher;
+parasail_bfunction_t * parasail_sw_batch_32_pointer = parasail_sw_batch_32_dispatcher;
+parasail_bfunction_t parasail_sw_batch_16_dispatcher;
+parasail_bfunction_t * parasail_sw_batch_16_pointer = parasail_sw_batch_16_dispatcher;
+parasail_bfunction_t parasail_sw_batch_8_dispatcher;
+parasail_bfunction_t * parasail_sw_batch_8_pointer = parasail_sw_batch_8_dispatcher;
+parasail_bpfunction_t parasail_sw_batch_profile_32_dispatcher;
+parasail_bpfunction_t * parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_32_dispatcher;
+parasail_bpfunction_t parasail_sw_batch_profile_16_dispatcher;
+parasail_bpfunction_t * parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_16_dispatcher;
+parasail_bpfunction_t parasail_sw_batch_profile_8_dispatcher;
+parasail_bpfunction_t * parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_8_dispatcher;
+
+parasail_result_t** parasail_sw_batch_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_avx512bw_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_32_pointer = parasail_sw_batch_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_32_pointer = parasail_sw_batch;
+    }
+    return parasail_sw_batch_32_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_batch_32_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_avx512bw_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_16_pointer = parasail_sw_batch_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_16_pointer = parasail_sw_batch;
+    }
+    return parasail_sw_batch_16_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_batch_16_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_avx512bw_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_8_pointer = parasail_sw_batch_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_8_pointer = parasail_sw_batch;
+    }
+    return parasail_sw_batch_8_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_batch_8_pointer(s1, s1Len, s2s, s2Lens, count, open, gap, matrix);
+}
+
+parasail_result_t** parasail_sw_batch_profile_32_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_avx512bw_512_32;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_sse2_128_32;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_altivec_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_profile_32_pointer = parasail_sw_batch_profile;
+    }
+    return parasail_sw_batch_profile_32_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+parasail_result_t** parasail_sw_batch_profile_32(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    return parasail_sw_batch_profile_32_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+parasail_result_t** parasail_sw_batch_profile_16_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_avx512bw_512_16;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_sse2_128_16;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_altivec_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_profile_16_pointer = parasail_sw_batch_profile;
+    }
+    return parasail_sw_batch_profile_16_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+parasail_result_t** parasail_sw_batch_profile_16(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    return parasail_sw_batch_profile_16_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+parasail_result_t** parasail_sw_batch_profile_8_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_avx512bw_512_8;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_sse2_128_8;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_altivec_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sw_batch_profile_8_pointer = parasail_sw_batch_profile;
+    }
+    return parasail_sw_batch_profile_8_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+parasail_result_t** parasail_sw_batch_profile_8(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    return parasail_sw_batch_profile_8_pointer(profile, s2s, s2Lens, count, open, gap);
+}
+
+/* banded dispatchers */
+parasail_kfunction_t parasail_sw_banded_32_dispatcher;
+parasail_kfunction_t * parasail_sw_banded_32_pointer = parasail_sw_banded_32_dispatcher;
+parasail_kfunction_t parasail_sw_banded_16_dispatcher;
+parasail_kfunction_t * parasail_sw_banded_16_pointer = parasail_sw_banded_16_dispatcher;
+parasail_kfunction_t parasail_sw_banded_8_dispatcher;
+parasail_kfunction_t * parasail_sw_banded_8_pointer = parasail_sw_banded_8_dispatcher;
+parasail_kfunction_t parasail_sw_trace_banded_32_dispatcher;
+parasail_kfunction_t * parasail_sw_trace_banded_32_pointer = parasail_sw_trace_banded_32_dispatcher;
+parasail_kfunction_t parasail_sw_trace_banded_16_dispatcher;
+parasail_kfunction_t * parasail_sw_trace_banded_16_pointer = parasail_sw_trace_banded_16_dispatcher;
+parasail_kfunction_t parasail_sw_trace_banded_8_dispatcher;
+parasail_kfunction_t * parasail_sw_trace_banded_8_pointer = parasail_sw_trace_banded_8_dispatcher;
+
+parasail_result_t* parasail_sw_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_banded_32_pointer = parasail_sw_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_banded_32_pointer = parasail_sw_banded_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_banded_32_pointer = parasail_sw_banded_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_sw_banded_32_pointer = parasail_sw_banded;
+    }
+    return parasail_sw_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_banded_16_pointer = parasail_sw_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_banded_16_pointer = parasail_sw_banded_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_banded_16_pointer = parasail_sw_banded_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_sw_banded_16_pointer = parasail_sw_banded;
+    }
+    return parasail_sw_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_banded_8_pointer = parasail_sw_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_banded_8_pointer = parasail_sw_banded_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_banded_8_pointer = parasail_sw_banded_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sw_banded_8_pointer = parasail_sw_banded;
+    }
+    return parasail_sw_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_32_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_trace_banded_32_pointer = parasail_sw_trace_banded_avx2_256_32;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_trace_banded_32_pointer = parasail_sw_trace_banded_sse41_128_32;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_trace_banded_32_pointer = parasail_sw_trace_banded_neon_128_32;
+    }
+    else
+#endif
+    {
+        parasail_sw_trace_banded_32_pointer = parasail_sw_trace_banded;
+    }
+    return parasail_sw_trace_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_32(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_trace_banded_32_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_16_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_trace_banded_16_pointer = parasail_sw_trace_banded_avx2_256_16;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_trace_banded_16_pointer = parasail_sw_trace_banded_sse41_128_16;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_trace_banded_16_pointer = parasail_sw_trace_banded_neon_128_16;
+    }
+    else
+#endif
+    {
+        parasail_sw_trace_banded_16_pointer = parasail_sw_trace_banded;
+    }
+    return parasail_sw_trace_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_16(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_trace_banded_16_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_8_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        parasail_sw_trace_banded_8_pointer = parasail_sw_trace_banded_avx2_256_8;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        parasail_sw_trace_banded_8_pointer = parasail_sw_trace_banded_sse41_128_8;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        parasail_sw_trace_banded_8_pointer = parasail_sw_trace_banded_neon_128_8;
+    }
+    else
+#endif
+    {
+        parasail_sw_trace_banded_8_pointer = parasail_sw_trace_banded;
+    }
+    return parasail_sw_trace_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded_8(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return parasail_sw_trace_banded_8_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
@@ -98,6 +98,9 @@ STATIC parasail_result_t* PNAME(
     int32_t end_ref = 0;
     const int s1Len = profile->s1Len;
     const parasail_matrix_t *matrix = profile->matrix;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
     const int32_t segWidth = 2; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     vec128i* const restrict vProfile  = (vec128i*)profile->profile64.score;
@@ -410,6 +413,38 @@ end:
                 end_ref = j;
             }
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        if (INT32_MIN != min_score && score < min_score
+                && gain < min_score) {
+            /* the lanes past the end of the query are padding */
+            const int32_t last_lane = (s1Len - 1) / segLen;
+            const int32_t last_seg = (s1Len - 1) % segLen;
+            const vec128i vPadLo = _mm_cmpgt_epi64(
+                    _mm_set1_epi64(segWidth - 1 - last_lane),
+                    _mm_set_epi64(0,1));
+            const vec128i vPadHi = _mm_cmpgt_epi64(
+                    _mm_set1_epi64(segWidth - last_lane),
+                    _mm_set_epi64(0,1));
+            vec128i vColMax = vZero;
+            int64_t col_score;
+            for (i=0; i<segLen; ++i) {
+                vec128i vC = _mm_load_si128(pvHStore + i);
+                vC = _mm_blendv_epi8(vC, vZero, i > last_seg ? vPadHi : vPadLo);
+                vColMax = _mm_max_epi64(vColMax, vC);
+            }
+            col_score = _mm_hmax_epi64(vColMax);
+            if (col_score + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+                result->stop_ref = j;
+                /* leave j one past the last column, as after the loop */
+                ++j;
+                break;
+            }
+        }
     }
 
 #ifdef PARASAIL_ROWCOL
@@ -527,7 +562,8 @@ parasail_result_t* INAME(
 
     /* find the end loc first with the faster implementation */
     parasail_result_t *result = parasail_sw_striped_profile_altivec_128_64(profile, s2, s2Len, open, gap);
-    if (!parasail_result_is_saturated(result)) {
+    if (!parasail_result_is_saturated(result)
+            && !parasail_result_is_pruned(result)) {
 #if 0
         int s1Len_new = 0;
         int s2Len_new = 0;
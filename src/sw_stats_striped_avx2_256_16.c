@@ -148,6 +148,9 @@ STATIC parasail_result_t* PNAME(
     int32_t end_ref = 0;
     const int s1Len = profile->s1Len;
     const parasail_matrix_t *matrix = profile->matrix;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
     const int32_t segWidth = 16; /* number of values in vector unit */
     const int32_t segLen = (s1Len + segWidth - 1) / segWidth;
     __m256i* const restrict vProfile  = (__m256i*)profile->profile16.score;
@@ -472,6 +475,38 @@ end:
                 end_ref = j;
             }
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        if (INT32_MIN != min_score && (int64_t)score - bias < min_score
+                && gain < min_score) {
+            /* the lanes past the end of the query are padding */
+            const int32_t last_lane = (s1Len - 1) / segLen;
+            const int32_t last_seg = (s1Len - 1) % segLen;
+            const __m256i vPadLo = _mm256_cmpgt_epi16(
+                    _mm256_set1_epi16(segWidth - 1 - last_lane),
+                    _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+            const __m256i vPadHi = _mm256_cmpgt_epi16(
+                    _mm256_set1_epi16(segWidth - last_lane),
+                    _mm256_set_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+            __m256i vColMax = vBias;
+            int16_t col_score;
+            for (i=0; i<segLen; ++i) {
+                __m256i vC = _mm256_load_si256(pvHStore + i);
+                vC = _mm256_blendv_epi8(vC, vBias, i > last_seg ? vPadHi : vPadLo);
+                vColMax = _mm256_max_epi16(vColMax, vC);
+            }
+            col_score = _mm256_hmax_epi16_rpl(vColMax);
+            if ((int64_t)col_score - bias + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+                result->stop_ref = j;
+                /* leave j one past the last column, as after the loop */
+                ++j;
+                break;
+            }
+        }
     }
 
 #ifdef PARASAIL_ROWCOL
@@ -589,7 +624,8 @@ parasail_result_t* INAME(
 
     /* find the end loc first with the faster implementation */
     parasail_result_t *result = parasail_sw_striped_profile_avx2_256_16(profile, s2, s2Len, open, gap);
-    if (!parasail_result_is_saturated(result)) {
+    if (!parasail_result_is_saturated(result)
+            && !parasail_result_is_pruned(result)) {
 #if 0
         int s1Len_new = 0;
         int s2Len_new = 0;
@@ -0,0 +1,182 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Banded traceback.  Only the cells within k diagonals of the band
+ * around the two corner diagonals are computed, and the trace table
+ * keeps one row of band cells per query position instead of a full
+ * s1Len*s2Len table.  Cell (i,j) of the band is at i*W + (j-i-lo),
+ * where lo is the lowest diagonal j-i of the band and W its width.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+
+#define BANDED_NW 0
+#define BANDED_SG 1
+#define BANDED_SW 2
+
+static parasail_result_t* banded_trace(
+        const int alg,
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const int lo = MIN(0, s2Len-s1Len) - k;
+    const int hi = MAX(0, s2Len-s1Len) + k;
+    const int W = hi - lo + 1;
+    parasail_result_t *result = parasail_result_new_trace(s1Len, W, 16, sizeof(int8_t));
+    int8_t * const restrict HT = (int8_t*)result->trace->trace_table;
+    int * const restrict s1 = parasail_memalign_int(16, s1Len);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len);
+    /* H and F of the previous row, column j at index j+1 */
+    int * const restrict H = parasail_memalign_int(16, s2Len+1);
+    int * const restrict F = parasail_memalign_int(16, s2Len+1);
+    int score = NEG_INF_32;
+    int end_query = s1Len;
+    int end_ref = s2Len;
+    int i = 0;
+    int j = 0;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* first row, outside of the band is never aligned */
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+    for (j=0; j<s2Len; ++j) {
+        if (j+1 <= hi) {
+            H[j+1] = (BANDED_NW == alg) ? -open - j*gap : 0;
+        }
+        else {
+            H[j+1] = NEG_INF_32;
+        }
+        F[j+1] = NEG_INF_32;
+    }
+
+    for (i=0; i<s1Len; ++i) {
+        const int * const restrict matrow = &matrix->matrix[matrix->size*s1[i]];
+        const int jbeg = MAX(0, i+lo);
+        const int jend = MIN(s2Len-1, i+hi);
+        int NH = H[jbeg];
+        int WH = NEG_INF_32;
+        int E = NEG_INF_32;
+        if (0 == jbeg) {
+            if (-1-i >= lo) {
+                WH = (BANDED_NW == alg) ? -open - i*gap : 0;
+            }
+            H[0] = WH;
+        }
+        for (j=jbeg; j<=jend; ++j) {
+            int H_dag;
+            int E_opn;
+            int E_ext;
+            int F_opn;
+            int F_ext;
+            int NWH = NH;
+            int8_t t;
+            NH = H[j+1];
+            F_opn = NH - open;
+            F_ext = F[j+1] - gap;
+            F[j+1] = MAX(F_opn, F_ext);
+            E_opn = WH - open;
+            E_ext = E - gap;
+            E = MAX(E_opn, E_ext);
+            H_dag = NWH + matrow[s2[j]];
+            WH = MAX(H_dag, E);
+            WH = MAX(WH, F[j+1]);
+            if (BANDED_SW == alg) {
+                WH = MAX(WH, 0);
+            }
+            H[j+1] = WH;
+            t = (F_opn > F_ext) ? PARASAIL_DIAG_F : PARASAIL_DEL_F;
+            t |= (E_opn > E_ext) ? PARASAIL_DIAG_E : PARASAIL_INS_E;
+            t |= (WH == H_dag) ? PARASAIL_DIAG
+               : (WH == F[j+1]) ? PARASAIL_DEL
+                                : PARASAIL_INS;
+            if (BANDED_SW == alg && 0 == WH) {
+                t &= PARASAIL_ZERO_MASK;
+            }
+            HT[(int64_t)i*W + (j-i-lo)] = t;
+            /* prefer the smallest end_ref, then the smallest end_query */
+            if (BANDED_SW == alg
+                    || (BANDED_SG == alg
+                        && (i == s1Len-1 || j == s2Len-1))) {
+                if (WH > score
+                        || (WH == score && (j < end_ref
+                                || (j == end_ref && i < end_query)))) {
+                    score = WH;
+                    end_query = i;
+                    end_ref = j;
+                }
+            }
+        }
+    }
+
+    if (BANDED_NW == alg) {
+        score = H[s2Len];
+        end_query = s1Len-1;
+        end_ref = s2Len-1;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->trace->band = k;
+    result->flag |= PARASAIL_FLAG_NOVEC | PARASAIL_FLAG_TRACE
+        | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+    result->flag |= (BANDED_NW == alg) ? PARASAIL_FLAG_NW
+                  : (BANDED_SG == alg) ? PARASAIL_FLAG_SG
+                                       : PARASAIL_FLAG_SW;
+
+    parasail_free(F);
+    parasail_free(H);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_trace(BANDED_NW, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sg_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_trace(BANDED_SG, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_banded(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return banded_trace(BANDED_SW, s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
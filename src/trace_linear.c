@@ -0,0 +1,323 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ *
+ * Traceback in reduced memory.  The forward pass keeps only the H and F
+ * rows at every K-th row.  The traceback then walks the alignment from
+ * its end, recomputing the trace bits of one block of K rows at a time
+ * from the nearest checkpoint.  Only the trace byte of each cell visited
+ * by the walk is kept in the result, in walk order, so the cigar and
+ * traceback code replay exactly the walk that parasail_*_trace would
+ * have produced.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parasail.h"
+#include "parasail/memory.h"
+
+#define NEG_INF_32 (INT32_MIN/2)
+#define MAX(a,b) ((a)>(b)?(a):(b))
+
+#define LINEAR_NW 0
+#define LINEAR_SG 1
+#define LINEAR_SW 2
+
+typedef struct linear {
+    int alg;
+    const int *s1;
+    const int *s2;
+    int s1Len;
+    int s2Len;
+    int open;
+    int gap;
+    const parasail_matrix_t *matrix;
+    int *H;
+    int *F;
+    int score;
+    int end_query;
+    int end_ref;
+} linear_t;
+
+/* Compute row i of the DP table in place from row i-1 held in H and F,
+ * exactly as parasail_{nw,sg,sw}_trace do.  The trace bits of the row
+ * are written to HT unless it is NULL.  The best score and its position
+ * are tracked when track is set. */
+static void linear_row(linear_t *l, const int i, int8_t *HT, const int track)
+{
+    const int * const restrict s2 = l->s2;
+    int * const restrict H = l->H;
+    int * const restrict F = l->F;
+    const int s2Len = l->s2Len;
+    const int open = l->open;
+    const int gap = l->gap;
+    const int alg = l->alg;
+    const int * const restrict matrow =
+        &l->matrix->matrix[l->matrix->size*l->s1[i-1]];
+    int NH = H[0];
+    int WH = (LINEAR_NW == alg) ? -open - (i-1)*gap : 0;
+    int E = NEG_INF_32;
+    int j = 0;
+
+    H[0] = WH;
+    for (j=1; j<=s2Len; ++j) {
+        int H_dag;
+        int E_opn;
+        int E_ext;
+        int F_opn;
+        int F_ext;
+        int NWH = NH;
+        NH = H[j];
+        F_opn = NH - open;
+        F_ext = F[j] - gap;
+        F[j] = MAX(F_opn, F_ext);
+        E_opn = WH - open;
+        E_ext = E    - gap;
+        E    = MAX(E_opn, E_ext);
+        H_dag = NWH + matrow[s2[j-1]];
+        if (LINEAR_SW == alg) {
+            WH = MAX(H_dag, 0);
+            WH = MAX(WH, E);
+        }
+        else {
+            WH = MAX(H_dag, E);
+        }
+        WH = MAX(WH, F[j]);
+        H[j] = WH;
+        if (track) {
+            if (LINEAR_SW == alg) {
+                if (WH > l->score) {
+                    l->end_query = i-1;
+                    l->end_ref = j-1;
+                }
+                else if (l->score == WH && j-1 < l->end_ref) {
+                    l->end_query = i-1;
+                    l->end_ref = j-1;
+                }
+                l->score = MAX(l->score, WH);
+            }
+            else if (LINEAR_SG == alg && i == l->s1Len) {
+                if (WH > l->score) {
+                    l->score = WH;
+                    l->end_query = l->s1Len-1;
+                    l->end_ref = j-1;
+                }
+                else if (WH == l->score && j-1 < l->end_ref) {
+                    l->end_query = l->s1Len-1;
+                    l->end_ref = j-1;
+                }
+            }
+        }
+        if (NULL != HT) {
+            int8_t t = (F_opn > F_ext) ? PARASAIL_DIAG_F : PARASAIL_DEL_F;
+            t |= (E_opn > E_ext) ? PARASAIL_DIAG_E : PARASAIL_INS_E;
+            t |= (WH == H_dag) ? PARASAIL_DIAG
+               : (WH == F[j])  ? PARASAIL_DEL
+                               : PARASAIL_INS;
+            if (LINEAR_SW == alg && 0 == WH) {
+                t &= PARASAIL_ZERO_MASK;
+            }
+            HT[j-1] = t;
+        }
+    }
+
+    if (track && LINEAR_SG == alg && i < l->s1Len) {
+        if (WH > l->score) {
+            l->score = WH;
+            l->end_query = i-1;
+            l->end_ref = s2Len-1;
+        }
+    }
+}
+
+/* Rows per checkpoint.  Checkpoints cost 2 ints per column and the
+ * recomputed block 1 byte per column, so about sqrt(8*s1Len) balances
+ * the two. */
+static int linear_rows_per_block(const int s1Len)
+{
+    int k = 1;
+    while ((long long)k*k < 8LL*s1Len) {
+        ++k;
+    }
+    return k;
+}
+
+static parasail_result_t* linear_trace(
+        const int alg,
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const int K = linear_rows_per_block(s1Len);
+    const int blocks = (s1Len + K - 1) / K;
+    const size_t width = (size_t)s2Len + 1;
+    const int path_size = 2*(s1Len+s2Len) + 2;
+    parasail_result_t *result = parasail_result_new_trace(1, path_size, 16, sizeof(int8_t));
+    int8_t * const restrict path = (int8_t*)result->trace->trace_table;
+    int * const restrict s1 = parasail_memalign_int(16, s1Len+1);
+    int * const restrict s2 = parasail_memalign_int(16, s2Len+1);
+    int * const restrict H = parasail_memalign_int(16, s2Len+1);
+    int * const restrict F = parasail_memalign_int(16, s2Len+1);
+    int * const restrict checkpoints = (int*)malloc(sizeof(int)*2*width*(blocks > 0 ? blocks : 1));
+    int8_t * const restrict BT = (int8_t*)malloc(sizeof(int8_t)*(size_t)K*(s2Len > 0 ? s2Len : 1));
+    linear_t l;
+    int block = -1;
+    int64_t i = 0;
+    int64_t j = 0;
+    int64_t step = 0;
+    int where = PARASAIL_DIAG;
+
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    l.alg = alg;
+    l.s1 = s1;
+    l.s2 = s2;
+    l.s1Len = s1Len;
+    l.s2Len = s2Len;
+    l.open = open;
+    l.gap = gap;
+    l.matrix = matrix;
+    l.H = H;
+    l.F = F;
+    l.score = NEG_INF_32;
+    l.end_query = s1Len;
+    l.end_ref = s2Len;
+
+    /* first row */
+    H[0] = 0;
+    F[0] = NEG_INF_32;
+    for (j=1; j<=s2Len; ++j) {
+        H[j] = (LINEAR_NW == alg) ? -open -(int)(j-1)*gap : 0;
+        F[j] = NEG_INF_32;
+    }
+
+    /* forward pass, saving the rows above each block */
+    for (i=1; i<=s1Len; ++i) {
+        if (0 == (i-1) % K) {
+            int *ck = checkpoints + 2*width*((i-1)/K);
+            memcpy(ck, H, sizeof(int)*width);
+            memcpy(ck+width, F, sizeof(int)*width);
+        }
+        linear_row(&l, (int)i, NULL, 1);
+    }
+
+    if (LINEAR_NW == alg) {
+        l.score = H[s2Len];
+        l.end_query = s1Len-1;
+        l.end_ref = s2Len-1;
+    }
+
+    /* Walk back from the end.  This mirrors the loop in cigar_template.c
+     * and traceback_template.c and stores the byte each iteration reads. */
+    i = l.end_query;
+    j = l.end_ref;
+    if (LINEAR_SG == alg
+            && l.end_query+1 != s1Len && l.end_ref+1 != s2Len) {
+        /* invalid end position, the replay rejects it before reading */
+        i = -1;
+    }
+    while (i >= 0 && j >= 0) {
+        const int b = (int)(i / K);
+        int8_t t = 0;
+        if (b != block) {
+            const int *ck = checkpoints + 2*width*b;
+            const int last = (b+1)*K < s1Len ? (b+1)*K : s1Len;
+            int r = 0;
+            memcpy(H, ck, sizeof(int)*width);
+            memcpy(F, ck+width, sizeof(int)*width);
+            for (r=b*K+1; r<=last; ++r) {
+                linear_row(&l, r, BT + (size_t)(r-b*K-1)*s2Len, 0);
+            }
+            block = b;
+        }
+        t = BT[(size_t)(i-(int64_t)b*K)*s2Len + j];
+        path[step++] = t;
+        if (PARASAIL_DIAG == where) {
+            if (t & PARASAIL_DIAG) {
+                --i;
+                --j;
+            }
+            else if (t & PARASAIL_INS) {
+                where = PARASAIL_INS;
+            }
+            else if (t & PARASAIL_DEL) {
+                where = PARASAIL_DEL;
+            }
+            else {
+                break;
+            }
+        }
+        else if (PARASAIL_INS == where) {
+            --j;
+            if (t & PARASAIL_DIAG_E) {
+                where = PARASAIL_DIAG;
+            }
+            else if (!(t & PARASAIL_INS_E)) {
+                break;
+            }
+        }
+        else {
+            --i;
+            if (t & PARASAIL_DIAG_F) {
+                where = PARASAIL_DIAG;
+            }
+            else if (!(t & PARASAIL_DEL_F)) {
+                break;
+            }
+        }
+    }
+
+    result->score = l.score;
+    result->end_query = l.end_query;
+    result->end_ref = l.end_ref;
+    result->flag |= PARASAIL_FLAG_NOVEC | PARASAIL_FLAG_TRACE
+        | PARASAIL_FLAG_LINEAR
+        | PARASAIL_FLAG_BITS_INT | PARASAIL_FLAG_LANES_1;
+    result->flag |= (LINEAR_NW == alg) ? PARASAIL_FLAG_NW
+                  : (LINEAR_SG == alg) ? PARASAIL_FLAG_SG
+                                       : PARASAIL_FLAG_SW;
+
+    free(BT);
+    free(checkpoints);
+    parasail_free(F);
+    parasail_free(H);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+parasail_result_t* parasail_nw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    return linear_trace(LINEAR_NW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sg_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    return linear_trace(LINEAR_SG, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
+
+parasail_result_t* parasail_sw_trace_linear(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    return linear_trace(LINEAR_SW, s1, s1Len, s2, s2Len, open, gap, matrix);
+}
@@ -53,7 +53,14 @@ static inline char match_char(
 #define CONCAT3_(X, Y, Z) X##Y##Z
 #define CONCAT3(X, Y, Z) CONCAT3_(X, Y, Z)
 #define LOC_NOVEC int64_t loc = i*lenb + j;
+/* striped and scan results store one trace byte per cell at every
+ * vector width, in the striped order of the query */
 #define LOC_STRIPED int64_t loc = j*segLen*segWidth + (i%segLen)*segWidth + (i/segLen);
+/* linear results store one trace byte per step of the walk */
+#define LOC_LINEAR int64_t loc = step++;
+/* banded results store one row of band cells per query position,
+ * adaptive bands also record the first column of each row */
+#define LOC_BANDED int64_t loc = i*bandW + (j-(NULL != bandStart && i >= 0 ? bandStart[i] : i+bandLo));
 
 #define T 8
 #include "traceback_template.c"
@@ -69,31 +76,25 @@ static inline char match_char(
 #include "traceback_template.c"
 #undef T
 
-#define T 16
-#define STRIPED
-#include "traceback_template.c"
-#undef T
-#undef STRIPED
-
 #define T 32
 #include "traceback_template.c"
 #undef T
 
-#define T 32
-#define STRIPED
+#define T 64
 #include "traceback_template.c"
 #undef T
-#undef STRIPED
 
-#define T 64
+#define T 8
+#define LINEAR
 #include "traceback_template.c"
 #undef T
+#undef LINEAR
 
-#define T 64
-#define STRIPED
+#define T 8
+#define BANDED
 #include "traceback_template.c"
 #undef T
-#undef STRIPED
+#undef BANDED
 
 parasail_traceback_t* parasail_result_get_traceback(
         parasail_result_t *result,
@@ -106,28 +107,21 @@ parasail_traceback_t* parasail_result_get_traceback(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED
+    if (result->flag & PARASAIL_FLAG_LINEAR) {
+        return parasail_result_get_traceback_linear_8(
+                result, seqA, lena, seqB, lenb,
+                matrix, match, pos, neg);
+    }
+    else if (result->flag & PARASAIL_FLAG_BANDED) {
+        return parasail_result_get_traceback_banded_8(
+                result, seqA, lena, seqB, lenb,
+                matrix, match, pos, neg);
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED
             || result->flag & PARASAIL_FLAG_SCAN) {
-        if (result->flag & PARASAIL_FLAG_BITS_8) {
-            return parasail_result_get_traceback_striped_8(
-                    result, seqA, lena, seqB, lenb,
-                    matrix, match, pos, neg);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            return parasail_result_get_traceback_striped_16(
-                    result, seqA, lena, seqB, lenb,
-                    matrix, match, pos, neg);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            return parasail_result_get_traceback_striped_32(
-                    result, seqA, lena, seqB, lenb,
-                    matrix, match, pos, neg);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            return parasail_result_get_traceback_striped_64(
-                    result, seqA, lena, seqB, lenb,
-                    matrix, match, pos, neg);
-        }
+        return parasail_result_get_traceback_striped_8(
+                result, seqA, lena, seqB, lenb,
+                matrix, match, pos, neg);
     }
     else {
         return parasail_result_get_traceback_8(
@@ -164,28 +158,21 @@ void parasail_traceback_generic_extra(
 {
     assert(parasail_result_is_trace(result));
 
-    if (result->flag & PARASAIL_FLAG_STRIPED
+    if (result->flag & PARASAIL_FLAG_LINEAR) {
+        parasail_traceback_linear_8(seqA, lena, seqB, lenb, nameA,
+                nameB, matrix, result, match, pos, neg, width,
+                name_width, use_stats, int_width, stream);
+    }
+    else if (result->flag & PARASAIL_FLAG_BANDED) {
+        parasail_traceback_banded_8(seqA, lena, seqB, lenb, nameA,
+                nameB, matrix, result, match, pos, neg, width,
+                name_width, use_stats, int_width, stream);
+    }
+    else if (result->flag & PARASAIL_FLAG_STRIPED
             || result->flag & PARASAIL_FLAG_SCAN) {
-        if (result->flag & PARASAIL_FLAG_BITS_8) {
-            parasail_traceback_striped_8(seqA, lena, seqB, lenb, nameA,
-                    nameB, matrix, result, match, pos, neg, width,
-                    name_width, use_stats, int_width, stream);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_16) {
-            parasail_traceback_striped_16(seqA, lena, seqB, lenb, nameA,
-                    nameB, matrix, result, match, pos, neg, width,
-                    name_width, use_stats, int_width, stream);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_32) {
-            parasail_traceback_striped_32(seqA, lena, seqB, lenb, nameA,
-                    nameB, matrix, result, match, pos, neg, width,
-                    name_width, use_stats, int_width, stream);
-        }
-        else if (result->flag & PARASAIL_FLAG_BITS_64) {
-            parasail_traceback_striped_64(seqA, lena, seqB, lenb, nameA,
-                    nameB, matrix, result, match, pos, neg, width,
-                    name_width, use_stats, int_width, stream);
-        }
+        parasail_traceback_striped_8(seqA, lena, seqB, lenb, nameA,
+                nameB, matrix, result, match, pos, neg, width,
+                name_width, use_stats, int_width, stream);
     }
     else {
         parasail_traceback_8(seqA, lena, seqB, lenb, nameA, nameB,
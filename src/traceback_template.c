@@ -5,6 +5,12 @@
 #if defined(STRIPED)
 #define NAME parasail_result_get_traceback_striped_
 #define LOC LOC_STRIPED
+#elif defined(LINEAR)
+#define NAME parasail_result_get_traceback_linear_
+#define LOC LOC_LINEAR
+#elif defined(BANDED)
+#define NAME parasail_result_get_traceback_banded_
+#define LOC LOC_BANDED
 #else
 #define NAME parasail_result_get_traceback_
 #define LOC LOC_NOVEC
@@ -30,6 +36,18 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
     int64_t j = result->end_ref;
     int where = PARASAIL_DIAG;
     D *HT = (D*)result->trace->trace_table;
+#if defined(LINEAR)
+    int64_t step = 0;
+#endif
+#if defined(BANDED)
+    const int * const bandStart = result->trace->band_start;
+    int64_t bandLo = (lenb < lena ? lenb-lena : 0) - result->trace->band;
+    int64_t bandW = (lenb < lena ? lena-lenb : lenb-lena)
+        + 2*result->trace->band + 1;
+    if (NULL != bandStart) {
+        bandW = 2*result->trace->band + 1;
+    }
+#endif
 #if defined(STRIPED)
     int64_t segWidth = 0;
     int64_t segLen = 0;
@@ -182,6 +200,12 @@ static inline parasail_traceback_t* CONCAT(NAME, T) (
 #if defined(STRIPED)
 #define NAME parasail_traceback_striped_
 #define LOC LOC_STRIPED
+#elif defined(LINEAR)
+#define NAME parasail_traceback_linear_
+#define LOC LOC_LINEAR
+#elif defined(BANDED)
+#define NAME parasail_traceback_banded_
+#define LOC LOC_BANDED
 #else
 #define NAME parasail_traceback_
 #define LOC LOC_NOVEC
@@ -215,6 +239,18 @@ static inline void CONCAT(NAME, T) (
     int64_t c_ins = 0;
     int64_t c_del = 0;
     D *HT = (D*)result->trace->trace_table;
+#if defined(LINEAR)
+    int64_t step = 0;
+#endif
+#if defined(BANDED)
+    const int * const bandStart = result->trace->band_start;
+    int64_t bandLo = (lenb < lena ? lenb-lena : 0) - result->trace->band;
+    int64_t bandW = (lenb < lena ? lena-lenb : lenb-lena)
+        + 2*result->trace->band + 1;
+    if (NULL != bandStart) {
+        bandW = 2*result->trace->band + 1;
+    }
+#endif
     int64_t namelenA = (NULL == nameA) ? 0 : (int64_t)strlen(nameA);
     int64_t namelenB = (NULL == nameB) ? 0 : (int64_t)strlen(nameB);
     char tmp[32];
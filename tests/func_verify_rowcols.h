@@ -51,6 +51,10 @@ static parasail_function_info_t parasail_nw_rowcol_sse41_functions[] = {
 {parasail_nw_rowcol_diag_sse41_128_32, "parasail_nw_rowcol_diag_sse41_128_32", "nw",    "diag", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_16, "parasail_nw_rowcol_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_sse41_128_8, "parasail_nw_rowcol_diag_sse41_128_8", "nw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_32, "parasail_nw_rowcol_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_sse41_128_16, "parasail_nw_rowcol_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_sse41_128_32, "parasail_nw_rowcol_wavefront_sse41_128_32", "nw", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_sse41_128_16, "parasail_nw_rowcol_wavefront_sse41_128_16", "nw", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_rowcol_sse41 = {"parasail_nw_rowcol_sse41", parasail_nw_rowcol_sse41_functions};
@@ -71,10 +75,34 @@ static parasail_function_info_t parasail_nw_rowcol_avx2_functions[] = {
 {parasail_nw_rowcol_diag_avx2_256_32, "parasail_nw_rowcol_diag_avx2_256_32", "nw",    "diag", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_16, "parasail_nw_rowcol_diag_avx2_256_16", "nw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_avx2_256_8,  "parasail_nw_rowcol_diag_avx2_256_8",  "nw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_32, "parasail_nw_rowcol_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_avx2_256_16, "parasail_nw_rowcol_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_avx2_256_32, "parasail_nw_rowcol_wavefront_avx2_256_32", "nw", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_avx2_256_16, "parasail_nw_rowcol_wavefront_avx2_256_16", "nw", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_rowcol_avx2 = {"parasail_nw_rowcol_avx2", parasail_nw_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_rowcol_avx512bw_functions[] = {
+{parasail_nw_rowcol,                  "parasail_nw_rowcol",                  "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_nw_rowcol_scan,             "parasail_nw_rowcol_scan",             "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_64, "parasail_nw_rowcol_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_32, "parasail_nw_rowcol_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_16, "parasail_nw_rowcol_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_scan_avx512bw_512_8, "parasail_nw_rowcol_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_64, "parasail_nw_rowcol_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_32, "parasail_nw_rowcol_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_16, "parasail_nw_rowcol_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_striped_avx512bw_512_8, "parasail_nw_rowcol_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_64, "parasail_nw_rowcol_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_32, "parasail_nw_rowcol_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_16, "parasail_nw_rowcol_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_diag_avx512bw_512_8, "parasail_nw_rowcol_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_rowcol_avx512bw = {"parasail_nw_rowcol_avx512bw", parasail_nw_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_rowcol_altivec_functions[] = {
 {parasail_nw_rowcol,                  "parasail_nw_rowcol",                  "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -111,6 +139,10 @@ static parasail_function_info_t parasail_nw_rowcol_neon_functions[] = {
 {parasail_nw_rowcol_diag_neon_128_32, "parasail_nw_rowcol_diag_neon_128_32", "nw",    "diag", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_neon_128_16, "parasail_nw_rowcol_diag_neon_128_16", "nw",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_nw_rowcol_diag_neon_128_8,  "parasail_nw_rowcol_diag_neon_128_8",  "nw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_neon_128_32, "parasail_nw_rowcol_blocked_neon_128_32", "nw", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_blocked_neon_128_16, "parasail_nw_rowcol_blocked_neon_128_16", "nw", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_neon_128_32, "parasail_nw_rowcol_wavefront_neon_128_32", "nw", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_nw_rowcol_wavefront_neon_128_16, "parasail_nw_rowcol_wavefront_neon_128_16", "nw", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_rowcol_neon = {"parasail_nw_rowcol_neon", parasail_nw_rowcol_neon_functions};
@@ -172,6 +204,10 @@ static parasail_function_info_t parasail_sg_rowcol_sse41_functions[] = {
 {parasail_sg_rowcol_diag_sse41_128_32, "parasail_sg_rowcol_diag_sse41_128_32", "sg",    "diag", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_16, "parasail_sg_rowcol_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_sse41_128_8, "parasail_sg_rowcol_diag_sse41_128_8", "sg",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_32, "parasail_sg_rowcol_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_sse41_128_16, "parasail_sg_rowcol_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_sse41_128_32, "parasail_sg_rowcol_wavefront_sse41_128_32", "sg", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_sse41_128_16, "parasail_sg_rowcol_wavefront_sse41_128_16", "sg", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_rowcol_sse41 = {"parasail_sg_rowcol_sse41", parasail_sg_rowcol_sse41_functions};
@@ -192,10 +228,34 @@ static parasail_function_info_t parasail_sg_rowcol_avx2_functions[] = {
 {parasail_sg_rowcol_diag_avx2_256_32, "parasail_sg_rowcol_diag_avx2_256_32", "sg",    "diag", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_16, "parasail_sg_rowcol_diag_avx2_256_16", "sg",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_avx2_256_8,  "parasail_sg_rowcol_diag_avx2_256_8",  "sg",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_32, "parasail_sg_rowcol_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_avx2_256_16, "parasail_sg_rowcol_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_avx2_256_32, "parasail_sg_rowcol_wavefront_avx2_256_32", "sg", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_avx2_256_16, "parasail_sg_rowcol_wavefront_avx2_256_16", "sg", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_rowcol_avx2 = {"parasail_sg_rowcol_avx2", parasail_sg_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_rowcol_avx512bw_functions[] = {
+{parasail_sg_rowcol,                  "parasail_sg_rowcol",                  "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sg_rowcol_scan,             "parasail_sg_rowcol_scan",             "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_64, "parasail_sg_rowcol_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_32, "parasail_sg_rowcol_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_16, "parasail_sg_rowcol_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_scan_avx512bw_512_8, "parasail_sg_rowcol_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_64, "parasail_sg_rowcol_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_32, "parasail_sg_rowcol_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_16, "parasail_sg_rowcol_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_striped_avx512bw_512_8, "parasail_sg_rowcol_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_64, "parasail_sg_rowcol_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_32, "parasail_sg_rowcol_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_16, "parasail_sg_rowcol_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_diag_avx512bw_512_8, "parasail_sg_rowcol_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_rowcol_avx512bw = {"parasail_sg_rowcol_avx512bw", parasail_sg_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_rowcol_altivec_functions[] = {
 {parasail_sg_rowcol,                  "parasail_sg_rowcol",                  "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -232,6 +292,10 @@ static parasail_function_info_t parasail_sg_rowcol_neon_functions[] = {
 {parasail_sg_rowcol_diag_neon_128_32, "parasail_sg_rowcol_diag_neon_128_32", "sg",    "diag", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_neon_128_16, "parasail_sg_rowcol_diag_neon_128_16", "sg",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sg_rowcol_diag_neon_128_8,  "parasail_sg_rowcol_diag_neon_128_8",  "sg",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_neon_128_32, "parasail_sg_rowcol_blocked_neon_128_32", "sg", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_blocked_neon_128_16, "parasail_sg_rowcol_blocked_neon_128_16", "sg", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_neon_128_32, "parasail_sg_rowcol_wavefront_neon_128_32", "sg", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sg_rowcol_wavefront_neon_128_16, "parasail_sg_rowcol_wavefront_neon_128_16", "sg", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_rowcol_neon = {"parasail_sg_rowcol_neon", parasail_sg_rowcol_neon_functions};
@@ -293,6 +357,10 @@ static parasail_function_info_t parasail_sw_rowcol_sse41_functions[] = {
 {parasail_sw_rowcol_diag_sse41_128_32, "parasail_sw_rowcol_diag_sse41_128_32", "sw",    "diag", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_sse41_128_16, "parasail_sw_rowcol_diag_sse41_128_16", "sw",    "diag", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_sse41_128_8, "parasail_sw_rowcol_diag_sse41_128_8", "sw",    "diag", "sse41", "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_sse41_128_32, "parasail_sw_rowcol_blocked_sse41_128_32", "sw", "blocked", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_sse41_128_16, "parasail_sw_rowcol_blocked_sse41_128_16", "sw", "blocked", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_sse41_128_32, "parasail_sw_rowcol_wavefront_sse41_128_32", "sw", "wavefront", "sse41", "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_sse41_128_16, "parasail_sw_rowcol_wavefront_sse41_128_16", "sw", "wavefront", "sse41", "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_rowcol_sse41 = {"parasail_sw_rowcol_sse41", parasail_sw_rowcol_sse41_functions};
@@ -313,10 +381,34 @@ static parasail_function_info_t parasail_sw_rowcol_avx2_functions[] = {
 {parasail_sw_rowcol_diag_avx2_256_32, "parasail_sw_rowcol_diag_avx2_256_32", "sw",    "diag", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_16, "parasail_sw_rowcol_diag_avx2_256_16", "sw",    "diag", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_avx2_256_8,  "parasail_sw_rowcol_diag_avx2_256_8",  "sw",    "diag", "avx2",  "256",  "8", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_32, "parasail_sw_rowcol_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_avx2_256_16, "parasail_sw_rowcol_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_avx2_256_32, "parasail_sw_rowcol_wavefront_avx2_256_32", "sw", "wavefront", "avx2",  "256", "32",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_avx2_256_16, "parasail_sw_rowcol_wavefront_avx2_256_16", "sw", "wavefront", "avx2",  "256", "16", 16, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_rowcol_avx2 = {"parasail_sw_rowcol_avx2", parasail_sw_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_rowcol_avx512bw_functions[] = {
+{parasail_sw_rowcol,                  "parasail_sw_rowcol",                  "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
+{parasail_sw_rowcol_scan,             "parasail_sw_rowcol_scan",             "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_64, "parasail_sw_rowcol_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_32, "parasail_sw_rowcol_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_16, "parasail_sw_rowcol_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_scan_avx512bw_512_8, "parasail_sw_rowcol_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_64, "parasail_sw_rowcol_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_32, "parasail_sw_rowcol_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_16, "parasail_sw_rowcol_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_striped_avx512bw_512_8, "parasail_sw_rowcol_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_64, "parasail_sw_rowcol_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_32, "parasail_sw_rowcol_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_16, "parasail_sw_rowcol_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_diag_avx512bw_512_8, "parasail_sw_rowcol_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_rowcol_avx512bw = {"parasail_sw_rowcol_avx512bw", parasail_sw_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_rowcol_altivec_functions[] = {
 {parasail_sw_rowcol,                  "parasail_sw_rowcol",                  "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 0, 1},
@@ -353,6 +445,10 @@ static parasail_function_info_t parasail_sw_rowcol_neon_functions[] = {
 {parasail_sw_rowcol_diag_neon_128_32, "parasail_sw_rowcol_diag_neon_128_32", "sw",    "diag", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_neon_128_16, "parasail_sw_rowcol_diag_neon_128_16", "sw",    "diag", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {parasail_sw_rowcol_diag_neon_128_8,  "parasail_sw_rowcol_diag_neon_128_8",  "sw",    "diag", "neon",  "128",  "8", 16, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_neon_128_32, "parasail_sw_rowcol_blocked_neon_128_32", "sw", "blocked", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_blocked_neon_128_16, "parasail_sw_rowcol_blocked_neon_128_16", "sw", "blocked", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_neon_128_32, "parasail_sw_rowcol_wavefront_neon_128_32", "sw", "wavefront", "neon",  "128", "32",  4, 0, 0, 0, 0, 0},
+{parasail_sw_rowcol_wavefront_neon_128_16, "parasail_sw_rowcol_wavefront_neon_128_16", "sw", "wavefront", "neon",  "128", "16",  8, 0, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_rowcol_neon = {"parasail_sw_rowcol_neon", parasail_sw_rowcol_neon_functions};
@@ -438,6 +534,26 @@ static parasail_function_info_t parasail_nw_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_stats_rowcol_avx2 = {"parasail_nw_stats_rowcol_avx2", parasail_nw_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_stats_rowcol_avx512bw_functions[] = {
+{parasail_nw_stats_rowcol,            "parasail_nw_stats_rowcol",            "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_nw_stats_rowcol_scan,       "parasail_nw_stats_rowcol_scan",       "nw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_64, "parasail_nw_stats_rowcol_scan_avx512bw_512_64", "nw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_32, "parasail_nw_stats_rowcol_scan_avx512bw_512_32", "nw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_16, "parasail_nw_stats_rowcol_scan_avx512bw_512_16", "nw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_scan_avx512bw_512_8, "parasail_nw_stats_rowcol_scan_avx512bw_512_8", "nw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_64, "parasail_nw_stats_rowcol_striped_avx512bw_512_64", "nw_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_32, "parasail_nw_stats_rowcol_striped_avx512bw_512_32", "nw_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_16, "parasail_nw_stats_rowcol_striped_avx512bw_512_16", "nw_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_striped_avx512bw_512_8, "parasail_nw_stats_rowcol_striped_avx512bw_512_8", "nw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_64, "parasail_nw_stats_rowcol_diag_avx512bw_512_64", "nw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_32, "parasail_nw_stats_rowcol_diag_avx512bw_512_32", "nw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_16, "parasail_nw_stats_rowcol_diag_avx512bw_512_16", "nw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_nw_stats_rowcol_diag_avx512bw_512_8, "parasail_nw_stats_rowcol_diag_avx512bw_512_8", "nw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_stats_rowcol_avx512bw = {"parasail_nw_stats_rowcol_avx512bw", parasail_nw_stats_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_stats_rowcol_altivec_functions[] = {
 {parasail_nw_stats_rowcol,            "parasail_nw_stats_rowcol",            "nw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -559,6 +675,26 @@ static parasail_function_info_t parasail_sg_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_stats_rowcol_avx2 = {"parasail_sg_stats_rowcol_avx2", parasail_sg_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_stats_rowcol_avx512bw_functions[] = {
+{parasail_sg_stats_rowcol,            "parasail_sg_stats_rowcol",            "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sg_stats_rowcol_scan,       "parasail_sg_stats_rowcol_scan",       "sg_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_64, "parasail_sg_stats_rowcol_scan_avx512bw_512_64", "sg_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_32, "parasail_sg_stats_rowcol_scan_avx512bw_512_32", "sg_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_16, "parasail_sg_stats_rowcol_scan_avx512bw_512_16", "sg_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_scan_avx512bw_512_8, "parasail_sg_stats_rowcol_scan_avx512bw_512_8", "sg_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_64, "parasail_sg_stats_rowcol_striped_avx512bw_512_64", "sg_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_32, "parasail_sg_stats_rowcol_striped_avx512bw_512_32", "sg_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_16, "parasail_sg_stats_rowcol_striped_avx512bw_512_16", "sg_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_striped_avx512bw_512_8, "parasail_sg_stats_rowcol_striped_avx512bw_512_8", "sg_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_64, "parasail_sg_stats_rowcol_diag_avx512bw_512_64", "sg_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_32, "parasail_sg_stats_rowcol_diag_avx512bw_512_32", "sg_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_16, "parasail_sg_stats_rowcol_diag_avx512bw_512_16", "sg_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sg_stats_rowcol_diag_avx512bw_512_8, "parasail_sg_stats_rowcol_diag_avx512bw_512_8", "sg_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_stats_rowcol_avx512bw = {"parasail_sg_stats_rowcol_avx512bw", parasail_sg_stats_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_stats_rowcol_altivec_functions[] = {
 {parasail_sg_stats_rowcol,            "parasail_sg_stats_rowcol",            "sg_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
@@ -680,6 +816,26 @@ static parasail_function_info_t parasail_sw_stats_rowcol_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_stats_rowcol_avx2 = {"parasail_sw_stats_rowcol_avx2", parasail_sw_stats_rowcol_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_stats_rowcol_avx512bw_functions[] = {
+{parasail_sw_stats_rowcol,            "parasail_sw_stats_rowcol",            "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
+{parasail_sw_stats_rowcol_scan,       "parasail_sw_stats_rowcol_scan",       "sw_stats",    "scan", "NA",     "32", "32",  1, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_64, "parasail_sw_stats_rowcol_scan_avx512bw_512_64", "sw_stats",    "scan", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_32, "parasail_sw_stats_rowcol_scan_avx512bw_512_32", "sw_stats",    "scan", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_16, "parasail_sw_stats_rowcol_scan_avx512bw_512_16", "sw_stats",    "scan", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_scan_avx512bw_512_8, "parasail_sw_stats_rowcol_scan_avx512bw_512_8", "sw_stats",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_64, "parasail_sw_stats_rowcol_striped_avx512bw_512_64", "sw_stats", "striped", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_32, "parasail_sw_stats_rowcol_striped_avx512bw_512_32", "sw_stats", "striped", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_16, "parasail_sw_stats_rowcol_striped_avx512bw_512_16", "sw_stats", "striped", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_striped_avx512bw_512_8, "parasail_sw_stats_rowcol_striped_avx512bw_512_8", "sw_stats", "striped", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_64, "parasail_sw_stats_rowcol_diag_avx512bw_512_64", "sw_stats",    "diag", "avx512bw", "512", "64",  8, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_32, "parasail_sw_stats_rowcol_diag_avx512bw_512_32", "sw_stats",    "diag", "avx512bw", "512", "32", 16, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_16, "parasail_sw_stats_rowcol_diag_avx512bw_512_16", "sw_stats",    "diag", "avx512bw", "512", "16", 32, 0, 0, 0, 1, 0},
+{parasail_sw_stats_rowcol_diag_avx512bw_512_8, "parasail_sw_stats_rowcol_diag_avx512bw_512_8", "sw_stats",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_stats_rowcol_avx512bw = {"parasail_sw_stats_rowcol_avx512bw", parasail_sw_stats_rowcol_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_stats_rowcol_altivec_functions[] = {
 {parasail_sw_stats_rowcol,            "parasail_sw_stats_rowcol",            "sw_stats",    "orig", "NA",     "32", "32",  1, 0, 0, 0, 1, 1},
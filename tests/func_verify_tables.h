@@ -49,6 +49,8 @@ static parasail_function_info_t parasail_nw_table_sse41_functions[] = {
 {parasail_nw_table_diag_sse41_128_32, "parasail_nw_table_diag_sse41_128_32", "nw",    "diag", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_16, "parasail_nw_table_diag_sse41_128_16", "nw",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_sse41_128_8,  "parasail_nw_table_diag_sse41_128_8",  "nw",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_32, "parasail_nw_table_blocked_sse41_128_32", "nw", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_sse41_128_16, "parasail_nw_table_blocked_sse41_128_16", "nw", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_table_sse41 = {"parasail_nw_table_sse41", parasail_nw_table_sse41_functions};
@@ -68,10 +70,31 @@ static parasail_function_info_t parasail_nw_table_avx2_functions[] = {
 {parasail_nw_table_diag_avx2_256_32,  "parasail_nw_table_diag_avx2_256_32",  "nw",    "diag", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_16,  "parasail_nw_table_diag_avx2_256_16",  "nw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_avx2_256_8,   "parasail_nw_table_diag_avx2_256_8",   "nw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_32, "parasail_nw_table_blocked_avx2_256_32", "nw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_avx2_256_16, "parasail_nw_table_blocked_avx2_256_16", "nw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_table_avx2 = {"parasail_nw_table_avx2", parasail_nw_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_table_avx512bw_functions[] = {
+{parasail_nw_table,                   "parasail_nw_table",                   "nw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_nw_table_scan_avx512bw_512_64, "parasail_nw_table_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_32, "parasail_nw_table_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_16, "parasail_nw_table_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_scan_avx512bw_512_8, "parasail_nw_table_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_64, "parasail_nw_table_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_32, "parasail_nw_table_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_16, "parasail_nw_table_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_striped_avx512bw_512_8, "parasail_nw_table_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_64, "parasail_nw_table_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_32, "parasail_nw_table_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_16, "parasail_nw_table_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_nw_table_diag_avx512bw_512_8, "parasail_nw_table_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_table_avx512bw = {"parasail_nw_table_avx512bw", parasail_nw_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_table_altivec_functions[] = {
 {parasail_nw_table,                   "parasail_nw_table",                   "nw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -106,6 +129,8 @@ static parasail_function_info_t parasail_nw_table_neon_functions[] = {
 {parasail_nw_table_diag_neon_128_32,  "parasail_nw_table_diag_neon_128_32",  "nw",    "diag", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_neon_128_16,  "parasail_nw_table_diag_neon_128_16",  "nw",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_nw_table_diag_neon_128_8,   "parasail_nw_table_diag_neon_128_8",   "nw",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_neon_128_32, "parasail_nw_table_blocked_neon_128_32", "nw", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_nw_table_blocked_neon_128_16, "parasail_nw_table_blocked_neon_128_16", "nw", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_nw_table_neon = {"parasail_nw_table_neon", parasail_nw_table_neon_functions};
@@ -170,6 +195,8 @@ static parasail_function_info_t parasail_sg_table_sse41_functions[] = {
 {parasail_sg_table_diag_sse41_128_32, "parasail_sg_table_diag_sse41_128_32", "sg",    "diag", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_16, "parasail_sg_table_diag_sse41_128_16", "sg",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_sse41_128_8,  "parasail_sg_table_diag_sse41_128_8",  "sg",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_32, "parasail_sg_table_blocked_sse41_128_32", "sg", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_sse41_128_16, "parasail_sg_table_blocked_sse41_128_16", "sg", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_table_sse41 = {"parasail_sg_table_sse41", parasail_sg_table_sse41_functions};
@@ -189,10 +216,31 @@ static parasail_function_info_t parasail_sg_table_avx2_functions[] = {
 {parasail_sg_table_diag_avx2_256_32,  "parasail_sg_table_diag_avx2_256_32",  "sg",    "diag", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_16,  "parasail_sg_table_diag_avx2_256_16",  "sg",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_avx2_256_8,   "parasail_sg_table_diag_avx2_256_8",   "sg",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_32, "parasail_sg_table_blocked_avx2_256_32", "sg", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_avx2_256_16, "parasail_sg_table_blocked_avx2_256_16", "sg", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_table_avx2 = {"parasail_sg_table_avx2", parasail_sg_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_table_avx512bw_functions[] = {
+{parasail_sg_table,                   "parasail_sg_table",                   "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sg_table_scan_avx512bw_512_64, "parasail_sg_table_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_32, "parasail_sg_table_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_16, "parasail_sg_table_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_scan_avx512bw_512_8, "parasail_sg_table_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_64, "parasail_sg_table_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_32, "parasail_sg_table_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_16, "parasail_sg_table_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_striped_avx512bw_512_8, "parasail_sg_table_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_64, "parasail_sg_table_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_32, "parasail_sg_table_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_16, "parasail_sg_table_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sg_table_diag_avx512bw_512_8, "parasail_sg_table_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_table_avx512bw = {"parasail_sg_table_avx512bw", parasail_sg_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_table_altivec_functions[] = {
 {parasail_sg_table,                   "parasail_sg_table",                   "sg",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -227,6 +275,8 @@ static parasail_function_info_t parasail_sg_table_neon_functions[] = {
 {parasail_sg_table_diag_neon_128_32,  "parasail_sg_table_diag_neon_128_32",  "sg",    "diag", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_neon_128_16,  "parasail_sg_table_diag_neon_128_16",  "sg",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sg_table_diag_neon_128_8,   "parasail_sg_table_diag_neon_128_8",   "sg",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_neon_128_32, "parasail_sg_table_blocked_neon_128_32", "sg", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sg_table_blocked_neon_128_16, "parasail_sg_table_blocked_neon_128_16", "sg", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sg_table_neon = {"parasail_sg_table_neon", parasail_sg_table_neon_functions};
@@ -291,6 +341,8 @@ static parasail_function_info_t parasail_sw_table_sse41_functions[] = {
 {parasail_sw_table_diag_sse41_128_32, "parasail_sw_table_diag_sse41_128_32", "sw",    "diag", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_sse41_128_16, "parasail_sw_table_diag_sse41_128_16", "sw",    "diag", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_sse41_128_8,  "parasail_sw_table_diag_sse41_128_8",  "sw",    "diag", "sse41", "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_sse41_128_32, "parasail_sw_table_blocked_sse41_128_32", "sw", "blocked", "sse41", "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_sse41_128_16, "parasail_sw_table_blocked_sse41_128_16", "sw", "blocked", "sse41", "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_table_sse41 = {"parasail_sw_table_sse41", parasail_sw_table_sse41_functions};
@@ -310,10 +362,31 @@ static parasail_function_info_t parasail_sw_table_avx2_functions[] = {
 {parasail_sw_table_diag_avx2_256_32,  "parasail_sw_table_diag_avx2_256_32",  "sw",    "diag", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_16,  "parasail_sw_table_diag_avx2_256_16",  "sw",    "diag", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_avx2_256_8,   "parasail_sw_table_diag_avx2_256_8",   "sw",    "diag", "avx2",  "256",  "8", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_32, "parasail_sw_table_blocked_avx2_256_32", "sw", "blocked", "avx2",  "256", "32",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_avx2_256_16, "parasail_sw_table_blocked_avx2_256_16", "sw", "blocked", "avx2",  "256", "16", 16, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_table_avx2 = {"parasail_sw_table_avx2", parasail_sw_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_table_avx512bw_functions[] = {
+{parasail_sw_table,                   "parasail_sw_table",                   "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
+{parasail_sw_table_scan_avx512bw_512_64, "parasail_sw_table_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_32, "parasail_sw_table_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_16, "parasail_sw_table_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_scan_avx512bw_512_8, "parasail_sw_table_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_64, "parasail_sw_table_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_32, "parasail_sw_table_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_16, "parasail_sw_table_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_striped_avx512bw_512_8, "parasail_sw_table_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_64, "parasail_sw_table_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_32, "parasail_sw_table_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_16, "parasail_sw_table_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 0, 0},
+{parasail_sw_table_diag_avx512bw_512_8, "parasail_sw_table_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_table_avx512bw = {"parasail_sw_table_avx512bw", parasail_sw_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_table_altivec_functions[] = {
 {parasail_sw_table,                   "parasail_sw_table",                   "sw",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 0, 1},
@@ -348,6 +421,8 @@ static parasail_function_info_t parasail_sw_table_neon_functions[] = {
 {parasail_sw_table_diag_neon_128_32,  "parasail_sw_table_diag_neon_128_32",  "sw",    "diag", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_neon_128_16,  "parasail_sw_table_diag_neon_128_16",  "sw",    "diag", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {parasail_sw_table_diag_neon_128_8,   "parasail_sw_table_diag_neon_128_8",   "sw",    "diag", "neon",  "128",  "8", 16, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_neon_128_32, "parasail_sw_table_blocked_neon_128_32", "sw", "blocked", "neon",  "128", "32",  4, 1, 0, 0, 0, 0},
+{parasail_sw_table_blocked_neon_128_16, "parasail_sw_table_blocked_neon_128_16", "sw", "blocked", "neon",  "128", "16",  8, 1, 0, 0, 0, 0},
 {NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
 };
 static parasail_function_group_t parasail_sw_table_neon = {"parasail_sw_table_neon", parasail_sw_table_neon_functions};
@@ -435,6 +510,25 @@ static parasail_function_info_t parasail_nw_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_stats_table_avx2 = {"parasail_nw_stats_table_avx2", parasail_nw_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_stats_table_avx512bw_functions[] = {
+{parasail_nw_stats_table,             "parasail_nw_stats_table",             "nw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_nw_stats_table_scan_avx512bw_512_64, "parasail_nw_stats_table_scan_avx512bw_512_64", "nw_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_32, "parasail_nw_stats_table_scan_avx512bw_512_32", "nw_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_16, "parasail_nw_stats_table_scan_avx512bw_512_16", "nw_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_scan_avx512bw_512_8, "parasail_nw_stats_table_scan_avx512bw_512_8", "nw_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_64, "parasail_nw_stats_table_striped_avx512bw_512_64", "nw_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_32, "parasail_nw_stats_table_striped_avx512bw_512_32", "nw_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_16, "parasail_nw_stats_table_striped_avx512bw_512_16", "nw_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_striped_avx512bw_512_8, "parasail_nw_stats_table_striped_avx512bw_512_8", "nw_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_64, "parasail_nw_stats_table_diag_avx512bw_512_64", "nw_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_32, "parasail_nw_stats_table_diag_avx512bw_512_32", "nw_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_16, "parasail_nw_stats_table_diag_avx512bw_512_16", "nw_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_nw_stats_table_diag_avx512bw_512_8, "parasail_nw_stats_table_diag_avx512bw_512_8", "nw_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_nw_stats_table_avx512bw = {"parasail_nw_stats_table_avx512bw", parasail_nw_stats_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_stats_table_altivec_functions[] = {
 {parasail_nw_stats_table,             "parasail_nw_stats_table",             "nw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -556,6 +650,25 @@ static parasail_function_info_t parasail_sg_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_stats_table_avx2 = {"parasail_sg_stats_table_avx2", parasail_sg_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_stats_table_avx512bw_functions[] = {
+{parasail_sg_stats_table,             "parasail_sg_stats_table",             "sg_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sg_stats_table_scan_avx512bw_512_64, "parasail_sg_stats_table_scan_avx512bw_512_64", "sg_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_32, "parasail_sg_stats_table_scan_avx512bw_512_32", "sg_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_16, "parasail_sg_stats_table_scan_avx512bw_512_16", "sg_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_scan_avx512bw_512_8, "parasail_sg_stats_table_scan_avx512bw_512_8", "sg_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_64, "parasail_sg_stats_table_striped_avx512bw_512_64", "sg_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_32, "parasail_sg_stats_table_striped_avx512bw_512_32", "sg_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_16, "parasail_sg_stats_table_striped_avx512bw_512_16", "sg_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_striped_avx512bw_512_8, "parasail_sg_stats_table_striped_avx512bw_512_8", "sg_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_64, "parasail_sg_stats_table_diag_avx512bw_512_64", "sg_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_32, "parasail_sg_stats_table_diag_avx512bw_512_32", "sg_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_16, "parasail_sg_stats_table_diag_avx512bw_512_16", "sg_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sg_stats_table_diag_avx512bw_512_8, "parasail_sg_stats_table_diag_avx512bw_512_8", "sg_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sg_stats_table_avx512bw = {"parasail_sg_stats_table_avx512bw", parasail_sg_stats_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_stats_table_altivec_functions[] = {
 {parasail_sg_stats_table,             "parasail_sg_stats_table",             "sg_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -677,6 +790,25 @@ static parasail_function_info_t parasail_sw_stats_table_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_stats_table_avx2 = {"parasail_sw_stats_table_avx2", parasail_sw_stats_table_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_stats_table_avx512bw_functions[] = {
+{parasail_sw_stats_table,             "parasail_sw_stats_table",             "sw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
+{parasail_sw_stats_table_scan_avx512bw_512_64, "parasail_sw_stats_table_scan_avx512bw_512_64", "sw_stats",    "scan", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_32, "parasail_sw_stats_table_scan_avx512bw_512_32", "sw_stats",    "scan", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_16, "parasail_sw_stats_table_scan_avx512bw_512_16", "sw_stats",    "scan", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_scan_avx512bw_512_8, "parasail_sw_stats_table_scan_avx512bw_512_8", "sw_stats",    "scan", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_64, "parasail_sw_stats_table_striped_avx512bw_512_64", "sw_stats", "striped", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_32, "parasail_sw_stats_table_striped_avx512bw_512_32", "sw_stats", "striped", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_16, "parasail_sw_stats_table_striped_avx512bw_512_16", "sw_stats", "striped", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_striped_avx512bw_512_8, "parasail_sw_stats_table_striped_avx512bw_512_8", "sw_stats", "striped", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_64, "parasail_sw_stats_table_diag_avx512bw_512_64", "sw_stats",    "diag", "avx512bw", "512", "64",  8, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_32, "parasail_sw_stats_table_diag_avx512bw_512_32", "sw_stats",    "diag", "avx512bw", "512", "32", 16, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_16, "parasail_sw_stats_table_diag_avx512bw_512_16", "sw_stats",    "diag", "avx512bw", "512", "16", 32, 1, 0, 0, 1, 0},
+{parasail_sw_stats_table_diag_avx512bw_512_8, "parasail_sw_stats_table_diag_avx512bw_512_8", "sw_stats",    "diag", "avx512bw", "512",  "8", 64, 1, 0, 0, 1, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 0, 0, 0}
+};
+static parasail_function_group_t parasail_sw_stats_table_avx512bw = {"parasail_sw_stats_table_avx512bw", parasail_sw_stats_table_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_stats_table_altivec_functions[] = {
 {parasail_sw_stats_table,             "parasail_sw_stats_table",             "sw_stats",    "orig", "NA",     "32", "32",  1, 1, 0, 0, 1, 1},
@@ -75,6 +75,26 @@ static parasail_function_info_t parasail_nw_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_nw_trace_avx2 = {"parasail_nw_trace_avx2", parasail_nw_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_nw_trace_avx512bw_functions[] = {
+{parasail_nw_trace,                   "parasail_nw_trace",                   "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_nw_trace_scan,              "parasail_nw_trace_scan",              "nw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_64, "parasail_nw_trace_scan_avx512bw_512_64", "nw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_32, "parasail_nw_trace_scan_avx512bw_512_32", "nw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_16, "parasail_nw_trace_scan_avx512bw_512_16", "nw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_scan_avx512bw_512_8, "parasail_nw_trace_scan_avx512bw_512_8", "nw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_64, "parasail_nw_trace_striped_avx512bw_512_64", "nw", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_32, "parasail_nw_trace_striped_avx512bw_512_32", "nw", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_16, "parasail_nw_trace_striped_avx512bw_512_16", "nw", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_striped_avx512bw_512_8, "parasail_nw_trace_striped_avx512bw_512_8", "nw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_64, "parasail_nw_trace_diag_avx512bw_512_64", "nw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_32, "parasail_nw_trace_diag_avx512bw_512_32", "nw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_16, "parasail_nw_trace_diag_avx512bw_512_16", "nw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_nw_trace_diag_avx512bw_512_8, "parasail_nw_trace_diag_avx512bw_512_8", "nw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_nw_trace_avx512bw = {"parasail_nw_trace_avx512bw", parasail_nw_trace_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_nw_trace_altivec_functions[] = {
 {parasail_nw_trace,                   "parasail_nw_trace",                   "nw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -196,6 +216,26 @@ static parasail_function_info_t parasail_sg_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sg_trace_avx2 = {"parasail_sg_trace_avx2", parasail_sg_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sg_trace_avx512bw_functions[] = {
+{parasail_sg_trace,                   "parasail_sg_trace",                   "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sg_trace_scan,              "parasail_sg_trace_scan",              "sg",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_64, "parasail_sg_trace_scan_avx512bw_512_64", "sg",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_32, "parasail_sg_trace_scan_avx512bw_512_32", "sg",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_16, "parasail_sg_trace_scan_avx512bw_512_16", "sg",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_scan_avx512bw_512_8, "parasail_sg_trace_scan_avx512bw_512_8", "sg",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_64, "parasail_sg_trace_striped_avx512bw_512_64", "sg", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_32, "parasail_sg_trace_striped_avx512bw_512_32", "sg", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_16, "parasail_sg_trace_striped_avx512bw_512_16", "sg", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_striped_avx512bw_512_8, "parasail_sg_trace_striped_avx512bw_512_8", "sg", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_64, "parasail_sg_trace_diag_avx512bw_512_64", "sg",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_32, "parasail_sg_trace_diag_avx512bw_512_32", "sg",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_16, "parasail_sg_trace_diag_avx512bw_512_16", "sg",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sg_trace_diag_avx512bw_512_8, "parasail_sg_trace_diag_avx512bw_512_8", "sg",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sg_trace_avx512bw = {"parasail_sg_trace_avx512bw", parasail_sg_trace_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sg_trace_altivec_functions[] = {
 {parasail_sg_trace,                   "parasail_sg_trace",                   "sg",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -317,6 +357,26 @@ static parasail_function_info_t parasail_sw_trace_avx2_functions[] = {
 };
 static parasail_function_group_t parasail_sw_trace_avx2 = {"parasail_sw_trace_avx2", parasail_sw_trace_avx2_functions};
 #endif
+#if HAVE_AVX512BW
+static parasail_function_info_t parasail_sw_trace_avx512bw_functions[] = {
+{parasail_sw_trace,                   "parasail_sw_trace",                   "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
+{parasail_sw_trace_scan,              "parasail_sw_trace_scan",              "sw",    "scan", "NA",     "32", "32",  1, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_64, "parasail_sw_trace_scan_avx512bw_512_64", "sw",    "scan", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_32, "parasail_sw_trace_scan_avx512bw_512_32", "sw",    "scan", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_16, "parasail_sw_trace_scan_avx512bw_512_16", "sw",    "scan", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_scan_avx512bw_512_8, "parasail_sw_trace_scan_avx512bw_512_8", "sw",    "scan", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_64, "parasail_sw_trace_striped_avx512bw_512_64", "sw", "striped", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_32, "parasail_sw_trace_striped_avx512bw_512_32", "sw", "striped", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_16, "parasail_sw_trace_striped_avx512bw_512_16", "sw", "striped", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_striped_avx512bw_512_8, "parasail_sw_trace_striped_avx512bw_512_8", "sw", "striped", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_64, "parasail_sw_trace_diag_avx512bw_512_64", "sw",    "diag", "avx512bw", "512", "64",  8, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_32, "parasail_sw_trace_diag_avx512bw_512_32", "sw",    "diag", "avx512bw", "512", "32", 16, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_16, "parasail_sw_trace_diag_avx512bw_512_16", "sw",    "diag", "avx512bw", "512", "16", 32, 0, 0, 1, 0, 0},
+{parasail_sw_trace_diag_avx512bw_512_8, "parasail_sw_trace_diag_avx512bw_512_8", "sw",    "diag", "avx512bw", "512",  "8", 64, 0, 0, 1, 0, 0},
+{NULL, "NULL", "NULL", "NULL", "NULL", "NULL", "NULL", 0, 0, 0, 1, 0, 0}
+};
+static parasail_function_group_t parasail_sw_trace_avx512bw = {"parasail_sw_trace_avx512bw", parasail_sw_trace_avx512bw_functions};
+#endif
 #if HAVE_ALTIVEC
 static parasail_function_info_t parasail_sw_trace_altivec_functions[] = {
 {parasail_sw_trace,                   "parasail_sw_trace",                   "sw",    "orig", "NA",     "32", "32",  1, 0, 0, 1, 0, 1},
@@ -169,6 +169,7 @@ int main(int argc, char **argv)
     int do_sse2 = 1;
     int do_sse41 = 1;
     int do_avx2 = 1;
+    int do_avx512bw = 1;
     int do_disp = 1;
     int do_nw = 1;
     int do_sg = 1;
@@ -267,6 +268,7 @@ int main(int argc, char **argv)
                 do_sse2 = (NULL == strstr(optarg, "sse2"));
                 do_sse41 = (NULL == strstr(optarg, "sse41"));
                 do_avx2 = (NULL == strstr(optarg, "avx2"));
+                do_avx512bw = (NULL == strstr(optarg, "avx512bw"));
                 do_disp = (NULL == strstr(optarg, "disp"));
                 do_nw = (NULL == strstr(optarg, "nw"));
                 do_sg = (NULL == strstr(optarg, "sg"));
@@ -373,7 +375,8 @@ int main(int argc, char **argv)
         int saturated = 0;
         if ((0 == strncmp(f.isa, "sse2",  4) && 0 == parasail_can_use_sse2()) 
                 || (0 == strncmp(f.isa, "sse41", 5) && 0 == parasail_can_use_sse41())
-                || (0 == strncmp(f.isa, "avx2",  4) && 0 == parasail_can_use_avx2())) {
+                || (0 == strncmp(f.isa, "avx2",  4) && 0 == parasail_can_use_avx2())
+                || (0 == strncmp(f.isa, "avx512bw", 8) && 0 == parasail_can_use_avx512bw())) {
             f = functions[index++];
             continue;
         }
@@ -389,6 +392,10 @@ int main(int argc, char **argv)
             f = functions[index++];
             continue;
         }
+        if (!do_avx512bw && strstr(f.name, "avx512bw")) {
+            f = functions[index++];
+            continue;
+        }
         if (!do_disp && strstr(f.name, "disp")) {
             f = functions[index++];
             continue;
@@ -18,7 +18,10 @@
 #include <unistd.h>
 #endif
 
+#include "parasail.h"
 #include "parasail/io.h"
+#include "parasail/matrix_lookup.h"
+#include "timer_real.h"
 
 
 static inline unsigned long binomial_coefficient(unsigned long n, unsigned long k)
@@ -61,9 +64,27 @@ int main(int argc, char **argv)
     char *filename = NULL;
     int c = 0;
     int distribution = 0;
+    char *funcname = NULL;
+    parasail_function_t *function = NULL;
+    const char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int gap_open = 10;
+    int gap_extend = 1;
 
-    while ((c = getopt(argc, argv, "f:d")) != -1) {
+    while ((c = getopt(argc, argv, "a:f:m:o:e:d")) != -1) {
         switch (c) {
+            case 'a':
+                funcname = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'o':
+                gap_open = atoi(optarg);
+                break;
+            case 'e':
+                gap_extend = atoi(optarg);
+                break;
             case 'd':
                 distribution = 1;
                 break;
@@ -71,7 +92,8 @@ int main(int argc, char **argv)
                 filename = optarg;
                 break;
             case '?':
-                if (optopt == 'f' || optopt == 'n') {
+                if (optopt == 'f' || optopt == 'a' || optopt == 'm'
+                        || optopt == 'o' || optopt == 'e') {
                     fprintf(stderr,
                             "Option -%c requires an argument.\n",
                             optopt);
@@ -101,6 +123,19 @@ int main(int argc, char **argv)
         exit(1);
     }
 
+    if (funcname) {
+        function = parasail_lookup_function(funcname);
+        if (NULL == function) {
+            fprintf(stderr, "Specified function not found.\n");
+            exit(1);
+        }
+        matrix = parasail_matrix_lookup(matrixname);
+        if (NULL == matrix) {
+            fprintf(stderr, "Specified substitution matrix not found.\n");
+            exit(1);
+        }
+    }
+
     if (distribution) {
         for (i=0; i<seq_count; ++i) {
             printf("%lu\n", (unsigned long)sequences->seqs[i].seq.l);
@@ -123,6 +158,25 @@ int main(int argc, char **argv)
             }
             printf("work=%lu\n", work);
             printf("columns=%lu\n", columns);
+
+            /* optionally time one function over all pairs */
+            if (function) {
+                double timer_secs = timer_real();
+                for (i=0; i<limit; ++i) {
+                    parasail_result_t *result = NULL;
+                    k_combination2(i, &a, &b);
+                    result = function(
+                            sequences->seqs[a].seq.s,
+                            (int)sequences->seqs[a].seq.l,
+                            sequences->seqs[b].seq.s,
+                            (int)sequences->seqs[b].seq.l,
+                            gap_open, gap_extend, matrix);
+                    parasail_result_free(result);
+                }
+                timer_secs = timer_real() - timer_secs;
+                printf("%s time=%f gcups=%f\n", funcname,
+                        timer_secs, work/timer_secs/1000000000.0);
+            }
         }
     }
 
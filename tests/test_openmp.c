@@ -143,7 +143,7 @@ int main(int argc, char **argv)
     char *funcname2 = NULL;
     parasail_function_t *function1 = NULL;
     parasail_function_t *function2 = NULL;
-    int banded = 0;
+    parasail_kfunction_t *kfunction = NULL;
     int kbandsize = 3;
     int c = 0;
     char *matrixname = "blosum62";
@@ -281,10 +281,10 @@ int main(int argc, char **argv)
             }
         }
 #endif
-        if (NULL == function1 && NULL != strstr(funcname1, "nw_banded")) {
-            banded = 1;
+        if (NULL == function1) {
+            kfunction = parasail_lookup_kfunction(funcname1);
         }
-        if (NULL == function1 && 0 == banded) {
+        if (NULL == function1 && NULL == kfunction) {
             fprintf(stderr, "Specified function1 not found.\n");
             exit(1);
         }
@@ -424,8 +424,8 @@ int main(int argc, char **argv)
                                 sequences_database->seqs[b].seq.s, sequences_database->seqs[b].seq.l,
                                 gap_open, gap_extend, matrix);
                     }
-                    else if (0 != banded) {
-                        result = parasail_nw_banded(
+                    else if (NULL != kfunction) {
+                        result = kfunction(
                                 sequences_database->seqs[a].seq.s, query_size,
                                 sequences_database->seqs[b].seq.s, sequences_database->seqs[b].seq.l,
                                 gap_open, gap_extend, kbandsize, matrix);
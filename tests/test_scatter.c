@@ -210,6 +210,7 @@ int main(int argc, char **argv)
         /* generate 'seq_count' number of random strings */
         sequences = (parasail_sequences_t*)malloc(sizeof(parasail_sequences_t));
         sequences->l = seq_count;
+        sequences->arena = NULL;
         sequences->seqs = (parasail_sequence_t*)malloc(sizeof(parasail_sequence_t)*seq_count);
         for (i=0; i<seq_count; ++i) {
             size_t size = (rand()%32767)+10;
@@ -0,0 +1,226 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/io.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+typedef struct auto_function_info {
+    parasail_function_t *pointer;
+    parasail_function_t *reference;
+    const char *name;
+} auto_function_info_t;
+
+static const auto_function_info_t functions[] = {
+    {parasail_nw_auto, parasail_nw, "parasail_nw_auto"},
+    {parasail_sg_auto, parasail_sg, "parasail_sg_auto"},
+    {parasail_sw_auto, parasail_sw, "parasail_sw_auto"},
+    {NULL, NULL, ""}
+};
+
+static void check_result(
+        const char *name,
+        unsigned long a,
+        unsigned long b,
+        int open,
+        int extend,
+        const parasail_matrix_t *matrix,
+        const parasail_result_t *reference_result,
+        const parasail_result_t *result)
+{
+    if (parasail_result_is_saturated(result)) {
+        printf("%s(%lu,%lu,%d,%d,%s) saturated\n",
+                name, a, b, open, extend, matrix->name);
+    }
+    if (reference_result->score != result->score) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong score (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->score, result->score);
+    }
+    if (reference_result->end_query != result->end_query) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->end_query, result->end_query);
+    }
+    if (reference_result->end_ref != result->end_ref) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->end_ref, result->end_ref);
+    }
+}
+
+/* Every pair runs twice so that the second call sees the saturation
+ * counts of the first. */
+static void check_functions(
+        const auto_function_info_t *f,
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+    int pass = 0;
+
+    for (function_index=0;
+            NULL!=f[function_index].pointer;
+            ++function_index) {
+        const char *name = f[function_index].name;
+        printf("checking %s\n", name);
+        for (pass=0; pass<2; ++pass) {
+            for (a=0; a<seq_count; ++a) {
+                const char *s1 = sequences->seqs[a].seq.s;
+                int s1Len = (int)sequences->seqs[a].seq.l;
+                for (b=0; b<seq_count; ++b) {
+                    const char *s2 = sequences->seqs[b].seq.s;
+                    int s2Len = (int)sequences->seqs[b].seq.l;
+                    parasail_result_t *reference_result = NULL;
+                    parasail_result_t *result = NULL;
+                    if (verbose) printf("\t%s(%lu,%lu)\n", name, a, b);
+                    reference_result = f[function_index].reference(
+                            s1, s1Len, s2, s2Len, open, extend, matrix);
+                    result = f[function_index].pointer(
+                            s1, s1Len, s2, s2Len, open, extend, matrix);
+                    check_result(name, a, b, open, extend, matrix,
+                            reference_result, result);
+                    parasail_result_free(reference_result);
+                    parasail_result_free(result);
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    char *cachename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:c:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'c':
+                cachename = optarg;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n' || optopt == 'c') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    /* the first calibration measures and saves the model, the second
+     * must read it back */
+    if (cachename) {
+        double start = 0.0;
+        remove(cachename);
+        start = parasail_time();
+        if (0 != parasail_auto_calibrate(cachename)) {
+            printf("could not save the cost model to %s\n", cachename);
+        }
+        printf("calibrated in %f seconds\n", parasail_time() - start);
+        start = parasail_time();
+        if (0 != parasail_auto_calibrate(cachename)) {
+            printf("could not read the cost model from %s\n", cachename);
+        }
+        printf("loaded in %f seconds\n", parasail_time() - start);
+    }
+
+    check_functions(functions, sequences, seq_count, matrix, open, extend);
+
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
@@ -0,0 +1,409 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/function_lookup.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+/* band sizes checked when none is given on the command line */
+static const int bands[] = {0, 1, 3, 10, 50};
+
+static int diff_string(const char *a, const char *b)
+{
+    if (NULL == a || NULL == b) {
+        return a != b;
+    }
+    return 0 != strcmp(a, b);
+}
+
+static int can_use(const char *isa)
+{
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    if (0 == strcmp(isa, "neon")) {
+        return parasail_can_use_neon();
+    }
+    return 1;
+}
+
+static parasail_kfunction_t * lookup_reference(
+        const parasail_kfunction_info_t *f)
+{
+    if (0 == strcmp(f->alg, "nw")) {
+        return f->is_trace ? parasail_nw_trace_banded : parasail_nw_banded;
+    }
+    if (0 == strcmp(f->alg, "sg")) {
+        return f->is_trace ? parasail_sg_trace_banded : parasail_sg_banded;
+    }
+    return f->is_trace ? parasail_sw_trace_banded : parasail_sw_banded;
+}
+
+/* The vectorized banded results must match the scalar banded reference
+ * for the same band, including the cigar of the trace variants. */
+static void check_functions(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend,
+        int k)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+
+    for (function_index=0;
+            NULL!=kfunctions[function_index].pointer;
+            ++function_index) {
+        const parasail_kfunction_info_t *f = &kfunctions[function_index];
+        const char *name = f->name;
+        parasail_kfunction_t *reference = lookup_reference(f);
+        if (f->is_ref || 0 != strcmp(f->type, "banded")
+                || !can_use(f->isa)) {
+            continue;
+        }
+        printf("checking %s k=%d\n", name, k);
+        for (a=0; a<seq_count; ++a) {
+            for (b=0; b<seq_count; ++b) {
+                const char *s1 = sequences->seqs[a].seq.s;
+                int s1Len = (int)sequences->seqs[a].seq.l;
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                parasail_result_t *reference_result = NULL;
+                parasail_result_t *result = NULL;
+                if (verbose) printf("\t%s(%lu,%lu,k=%d)\n", name, a, b, k);
+                reference_result = reference(
+                        s1, s1Len, s2, s2Len, open, extend, k, matrix);
+                result = f->pointer(
+                        s1, s1Len, s2, s2Len, open, extend, k, matrix);
+                if (parasail_result_is_saturated(result)) {
+                    parasail_result_free(result);
+                    parasail_result_free(reference_result);
+                    continue;
+                }
+                if (!parasail_result_is_banded(result)) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) wrong flag (%d)\n",
+                            name, a, b, open, extend, k, matrix->name,
+                            result->flag);
+                }
+                if (reference_result->score != result->score) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) wrong score (%d!=%d)\n",
+                            name, a, b, open, extend, k, matrix->name,
+                            reference_result->score, result->score);
+                }
+                if (reference_result->end_query != result->end_query) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                            name, a, b, open, extend, k, matrix->name,
+                            reference_result->end_query, result->end_query);
+                }
+                if (reference_result->end_ref != result->end_ref) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                            name, a, b, open, extend, k, matrix->name,
+                            reference_result->end_ref, result->end_ref);
+                }
+                if (f->is_trace) {
+                    parasail_cigar_t *reference_cigar = NULL;
+                    parasail_cigar_t *cigar = NULL;
+                    char *reference_cigar_string = NULL;
+                    char *cigar_string = NULL;
+                    reference_cigar = parasail_result_get_cigar(
+                            reference_result, s1, s1Len, s2, s2Len, matrix);
+                    cigar = parasail_result_get_cigar(
+                            result, s1, s1Len, s2, s2Len, matrix);
+                    if (reference_cigar) {
+                        reference_cigar_string = parasail_cigar_decode(reference_cigar);
+                    }
+                    if (cigar) {
+                        cigar_string = parasail_cigar_decode(cigar);
+                    }
+                    if (diff_string(reference_cigar_string, cigar_string)
+                            || (cigar && reference_cigar
+                                && (reference_cigar->beg_query != cigar->beg_query
+                                    || reference_cigar->beg_ref != cigar->beg_ref))) {
+                        printf("%s(%lu,%lu,%d,%d,%d,%s) wrong cigar\n",
+                                name, a, b, open, extend, k, matrix->name);
+                    }
+                    free(cigar_string);
+                    free(reference_cigar_string);
+                    if (cigar) parasail_cigar_free(cigar);
+                    if (reference_cigar) parasail_cigar_free(reference_cigar);
+                }
+                parasail_result_free(result);
+                parasail_result_free(reference_result);
+            }
+        }
+    }
+}
+
+typedef struct adaptive_function_info {
+    parasail_kfunction_t *pointer;
+    parasail_kfunction_t *score_only;
+    parasail_function_t *reference;
+    const char *name;
+} adaptive_function_info_t;
+
+static const adaptive_function_info_t adaptive_functions[] = {
+    {parasail_nw_trace_banded_adaptive, parasail_nw_banded_adaptive,
+        parasail_nw_trace, "parasail_nw_trace_banded_adaptive"},
+    {parasail_sg_trace_banded_adaptive, parasail_sg_banded_adaptive,
+        parasail_sg_trace, "parasail_sg_trace_banded_adaptive"},
+    {parasail_sw_trace_banded_adaptive, parasail_sw_banded_adaptive,
+        parasail_sw_trace, "parasail_sw_trace_banded_adaptive"},
+    {NULL, NULL, NULL, ""}
+};
+
+/* Score the alignment described by a cigar; semi-global alignments do
+ * not pay for the gaps at either end. */
+static int score_cigar(
+        const parasail_cigar_t *cigar,
+        const char *s1, const char *s2,
+        const parasail_matrix_t *matrix,
+        int open, int extend, int free_end_gaps)
+{
+    int score = 0;
+    int i = cigar->beg_query;
+    int j = cigar->beg_ref;
+    int c = 0;
+    for (c=0; c<cigar->len; ++c) {
+        char op = parasail_cigar_decode_op(cigar->seq[c]);
+        int len = (int)parasail_cigar_decode_len(cigar->seq[c]);
+        int l = 0;
+        if ('=' == op || 'X' == op || 'M' == op) {
+            for (l=0; l<len; ++l, ++i, ++j) {
+                score += matrix->matrix[matrix->size
+                    * matrix->mapper[(unsigned char)s1[i]]
+                    + matrix->mapper[(unsigned char)s2[j]]];
+            }
+        }
+        else {
+            if (!free_end_gaps || (0 != c && cigar->len-1 != c)) {
+                score -= open + (len-1)*extend;
+            }
+            if ('I' == op) {
+                i += len;
+            }
+            else {
+                j += len;
+            }
+        }
+    }
+    return score;
+}
+
+/* An adaptive band wide enough to hold every row must agree with the
+ * full table, and a narrow band must give a cigar of its own score. */
+static void check_adaptive(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend,
+        int k)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+
+    for (function_index=0;
+            NULL!=adaptive_functions[function_index].pointer;
+            ++function_index) {
+        const adaptive_function_info_t *f = &adaptive_functions[function_index];
+        const char *name = f->name;
+        /* sg gaps are free at the ends, and an sw cigar that reaches the
+         * table edge is padded with end gaps */
+        int free_end_gaps = NULL == strstr(name, "_nw_");
+        printf("checking %s k=%d\n", name, k);
+        for (a=0; a<seq_count; ++a) {
+            for (b=0; b<seq_count; ++b) {
+                const char *s1 = sequences->seqs[a].seq.s;
+                int s1Len = (int)sequences->seqs[a].seq.l;
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                int kk = k < 0 ? 2*(s1Len+s2Len) : k;
+                parasail_result_t *score_result = NULL;
+                parasail_result_t *result = NULL;
+                parasail_cigar_t *cigar = NULL;
+                if (verbose) printf("\t%s(%lu,%lu,k=%d)\n", name, a, b, kk);
+                result = f->pointer(
+                        s1, s1Len, s2, s2Len, open, extend, kk, matrix);
+                score_result = f->score_only(
+                        s1, s1Len, s2, s2Len, open, extend, kk, matrix);
+                if (!parasail_result_is_banded(result)
+                        || !parasail_result_is_trace(result)) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) wrong flag (%d)\n",
+                            name, a, b, open, extend, kk, matrix->name,
+                            result->flag);
+                }
+                if (score_result->score != result->score
+                        || score_result->end_query != result->end_query
+                        || score_result->end_ref != result->end_ref) {
+                    printf("%s(%lu,%lu,%d,%d,%d,%s) trace and score differ\n",
+                            name, a, b, open, extend, kk, matrix->name);
+                }
+                if (k < 0) {
+                    parasail_result_t *reference_result = f->reference(
+                            s1, s1Len, s2, s2Len, open, extend, matrix);
+                    if (reference_result->score != result->score) {
+                        printf("%s(%lu,%lu,%d,%d,%d,%s) wrong score (%d!=%d)\n",
+                                name, a, b, open, extend, kk, matrix->name,
+                                reference_result->score, result->score);
+                    }
+                    parasail_result_free(reference_result);
+                }
+                /* a band that lost the alignment has no traceback */
+                if (result->score > INT_MIN/4) {
+                    cigar = parasail_result_get_cigar(
+                            result, s1, s1Len, s2, s2Len, matrix);
+                    if (NULL == cigar
+                            || result->score != score_cigar(cigar, s1, s2,
+                                matrix, open, extend, free_end_gaps)) {
+                        printf("%s(%lu,%lu,%d,%d,%d,%s) wrong cigar\n",
+                                name, a, b, open, extend, kk, matrix->name);
+                    }
+                    if (cigar) parasail_cigar_free(cigar);
+                }
+                parasail_result_free(score_result);
+                parasail_result_free(result);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+    int k = -1;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:k:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'k':
+                errno = 0;
+                k = strtol(optarg, &endptr, 10);
+                if (errno || k < 0) {
+                    perror("strtol k");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n' || optopt == 'k') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    if (k >= 0) {
+        check_functions(sequences, seq_count, matrix, open, extend, k);
+        check_adaptive(sequences, seq_count, matrix, open, extend, k);
+    }
+    else {
+        size_t i = 0;
+        for (i=0; i<sizeof(bands)/sizeof(bands[0]); ++i) {
+            check_functions(sequences, seq_count, matrix, open, extend, bands[i]);
+            check_adaptive(sequences, seq_count, matrix, open, extend, bands[i]);
+        }
+        /* a band covering the whole table */
+        check_adaptive(sequences, seq_count, matrix, open, extend, -1);
+    }
+
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
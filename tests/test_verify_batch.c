@@ -0,0 +1,267 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+typedef struct batch_function_info {
+    parasail_bfunction_t *pointer;
+    const char *name;
+    int (*usable)(void);
+} batch_function_info_t;
+
+static int always(void)
+{
+    return 1;
+}
+
+static const batch_function_info_t functions[] = {
+    {parasail_sw_batch, "parasail_sw_batch", always},
+    {parasail_sw_batch_32, "parasail_sw_batch_32", always},
+    {parasail_sw_batch_16, "parasail_sw_batch_16", always},
+    {parasail_sw_batch_8, "parasail_sw_batch_8", always},
+    {parasail_sw_batch_sat, "parasail_sw_batch_sat", always},
+#if HAVE_SSE2
+    {parasail_sw_batch_sse2_128_32, "parasail_sw_batch_sse2_128_32", parasail_can_use_sse2},
+    {parasail_sw_batch_sse2_128_16, "parasail_sw_batch_sse2_128_16", parasail_can_use_sse2},
+    {parasail_sw_batch_sse2_128_8, "parasail_sw_batch_sse2_128_8", parasail_can_use_sse2},
+    {parasail_sw_batch_sse2_128_sat, "parasail_sw_batch_sse2_128_sat", parasail_can_use_sse2},
+#endif
+#if HAVE_SSE41
+    {parasail_sw_batch_sse41_128_32, "parasail_sw_batch_sse41_128_32", parasail_can_use_sse41},
+    {parasail_sw_batch_sse41_128_16, "parasail_sw_batch_sse41_128_16", parasail_can_use_sse41},
+    {parasail_sw_batch_sse41_128_8, "parasail_sw_batch_sse41_128_8", parasail_can_use_sse41},
+    {parasail_sw_batch_sse41_128_sat, "parasail_sw_batch_sse41_128_sat", parasail_can_use_sse41},
+#endif
+#if HAVE_AVX2
+    {parasail_sw_batch_avx2_256_32, "parasail_sw_batch_avx2_256_32", parasail_can_use_avx2},
+    {parasail_sw_batch_avx2_256_16, "parasail_sw_batch_avx2_256_16", parasail_can_use_avx2},
+    {parasail_sw_batch_avx2_256_8, "parasail_sw_batch_avx2_256_8", parasail_can_use_avx2},
+    {parasail_sw_batch_avx2_256_sat, "parasail_sw_batch_avx2_256_sat", parasail_can_use_avx2},
+#endif
+#if HAVE_AVX512BW
+    {parasail_sw_batch_avx512bw_512_32, "parasail_sw_batch_avx512bw_512_32", parasail_can_use_avx512bw},
+    {parasail_sw_batch_avx512bw_512_16, "parasail_sw_batch_avx512bw_512_16", parasail_can_use_avx512bw},
+    {parasail_sw_batch_avx512bw_512_8, "parasail_sw_batch_avx512bw_512_8", parasail_can_use_avx512bw},
+    {parasail_sw_batch_avx512bw_512_sat, "parasail_sw_batch_avx512bw_512_sat", parasail_can_use_avx512bw},
+#endif
+#if HAVE_ALTIVEC
+    {parasail_sw_batch_altivec_128_32, "parasail_sw_batch_altivec_128_32", parasail_can_use_altivec},
+    {parasail_sw_batch_altivec_128_16, "parasail_sw_batch_altivec_128_16", parasail_can_use_altivec},
+    {parasail_sw_batch_altivec_128_8, "parasail_sw_batch_altivec_128_8", parasail_can_use_altivec},
+    {parasail_sw_batch_altivec_128_sat, "parasail_sw_batch_altivec_128_sat", parasail_can_use_altivec},
+#endif
+#if HAVE_NEON
+    {parasail_sw_batch_neon_128_32, "parasail_sw_batch_neon_128_32", parasail_can_use_neon},
+    {parasail_sw_batch_neon_128_16, "parasail_sw_batch_neon_128_16", parasail_can_use_neon},
+    {parasail_sw_batch_neon_128_8, "parasail_sw_batch_neon_128_8", parasail_can_use_neon},
+    {parasail_sw_batch_neon_128_sat, "parasail_sw_batch_neon_128_sat", parasail_can_use_neon},
+#endif
+    {NULL, "", NULL}
+};
+
+/* Every query is aligned against all database sequences in one batch
+ * call and each result is compared to the serial parasail_sw. */
+static void check_functions(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long query_index = 0;
+    unsigned long i = 0;
+    const char **s2s = NULL;
+    int *s2Lens = NULL;
+
+    s2s = (const char**)malloc(sizeof(const char*)*seq_count);
+    s2Lens = (int*)malloc(sizeof(int)*seq_count);
+    for (i=0; i<seq_count; ++i) {
+        s2s[i] = sequences->seqs[i].seq.s;
+        s2Lens[i] = (int)sequences->seqs[i].seq.l;
+    }
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        unsigned long saturated = 0;
+        const char *name = functions[function_index].name;
+        if (!functions[function_index].usable()) {
+            continue;
+        }
+        printf("checking %s\n", name);
+        for (query_index=0; query_index<seq_count; ++query_index) {
+            const char *s1 = sequences->seqs[query_index].seq.s;
+            int s1Len = (int)sequences->seqs[query_index].seq.l;
+            parasail_result_t **results = functions[function_index].pointer(
+                    s1, s1Len, s2s, s2Lens, (int)seq_count,
+                    open, extend, matrix);
+            for (i=0; i<seq_count; ++i) {
+                parasail_result_t *reference_result = parasail_sw(
+                        s1, s1Len, s2s[i], s2Lens[i], open, extend, matrix);
+                parasail_result_t *result = results[i];
+                if (verbose) printf("\t%s(%lu,%lu)\n", name, query_index, i);
+                if (PARASAIL_FLAG_INVALID & result->flag) {
+                    printf("%s(%lu,%lu,%d,%d,%s) invalid result flag (%d %d)\n",
+                            name, query_index, i, open, extend,
+                            matrix->name,
+                            result->flag, PARASAIL_FLAG_INVALID);
+                }
+                if (!parasail_result_is_sw(result)
+                        || !parasail_result_is_batch(result)) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong flag (%d)\n",
+                            name, query_index, i, open, extend,
+                            matrix->name, result->flag);
+                }
+                if (parasail_result_is_saturated(result)) {
+                    /* no point in comparing a result that saturated */
+                    parasail_result_free(reference_result);
+                    saturated += 1;
+                    continue;
+                }
+                if (reference_result->score != result->score) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong score (%d!=%d)\n",
+                            name, query_index, i, open, extend,
+                            matrix->name,
+                            reference_result->score, result->score);
+                }
+                if (reference_result->end_query != result->end_query) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                            name, query_index, i, open, extend,
+                            matrix->name,
+                            reference_result->end_query, result->end_query);
+                }
+                if (reference_result->end_ref != result->end_ref) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                            name, query_index, i, open, extend,
+                            matrix->name,
+                            reference_result->end_ref, result->end_ref);
+                }
+                parasail_result_free(reference_result);
+            }
+            parasail_result_batch_free(results, (int)seq_count);
+        }
+        if (verbose && saturated) {
+            printf("%s %d %d %s saturated %lu times\n",
+                    name, open, extend, matrix->name, saturated);
+        }
+    }
+
+    free(s2Lens);
+    free(s2s);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    check_functions(sequences, seq_count, matrix, open, extend);
+
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
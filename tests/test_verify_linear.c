@@ -0,0 +1,238 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+typedef struct linear_function_info {
+    parasail_function_t *pointer;
+    parasail_function_t *reference;
+    const char *name;
+} linear_function_info_t;
+
+static const linear_function_info_t functions[] = {
+    {parasail_nw_trace_linear, parasail_nw_trace, "parasail_nw_trace_linear"},
+    {parasail_sg_trace_linear, parasail_sg_trace, "parasail_sg_trace_linear"},
+    {parasail_sw_trace_linear, parasail_sw_trace, "parasail_sw_trace_linear"},
+    {NULL, NULL, ""}
+};
+
+static int diff_string(const char *a, const char *b)
+{
+    if (NULL == a || NULL == b) {
+        return a != b;
+    }
+    return 0 != strcmp(a, b);
+}
+
+/* The linear results must give the same cigar and traceback as the
+ * full trace table of the reference. */
+static void check_functions(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+
+    for (function_index=0;
+            NULL!=functions[function_index].pointer;
+            ++function_index) {
+        const char *name = functions[function_index].name;
+        printf("checking %s\n", name);
+        for (a=0; a<seq_count; ++a) {
+            for (b=0; b<seq_count; ++b) {
+                const char *s1 = sequences->seqs[a].seq.s;
+                int s1Len = (int)sequences->seqs[a].seq.l;
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                parasail_result_t *reference_result = NULL;
+                parasail_result_t *result = NULL;
+                parasail_cigar_t *reference_cigar = NULL;
+                parasail_cigar_t *cigar = NULL;
+                char *reference_cigar_string = NULL;
+                char *cigar_string = NULL;
+                parasail_traceback_t *reference_traceback = NULL;
+                parasail_traceback_t *traceback = NULL;
+                if (verbose) printf("\t%s(%lu,%lu)\n", name, a, b);
+                reference_result = functions[function_index].reference(
+                        s1, s1Len, s2, s2Len, open, extend, matrix);
+                result = functions[function_index].pointer(
+                        s1, s1Len, s2, s2Len, open, extend, matrix);
+                if (!parasail_result_is_linear(result)
+                        || !parasail_result_is_trace(result)) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong flag (%d)\n",
+                            name, a, b, open, extend, matrix->name,
+                            result->flag);
+                }
+                if (reference_result->score != result->score) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong score (%d!=%d)\n",
+                            name, a, b, open, extend, matrix->name,
+                            reference_result->score, result->score);
+                }
+                if (reference_result->end_query != result->end_query) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                            name, a, b, open, extend, matrix->name,
+                            reference_result->end_query, result->end_query);
+                }
+                if (reference_result->end_ref != result->end_ref) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                            name, a, b, open, extend, matrix->name,
+                            reference_result->end_ref, result->end_ref);
+                }
+                reference_cigar = parasail_result_get_cigar(
+                        reference_result, s1, s1Len, s2, s2Len, matrix);
+                cigar = parasail_result_get_cigar(
+                        result, s1, s1Len, s2, s2Len, matrix);
+                if (reference_cigar) {
+                    reference_cigar_string = parasail_cigar_decode(reference_cigar);
+                }
+                if (cigar) {
+                    cigar_string = parasail_cigar_decode(cigar);
+                }
+                if (diff_string(reference_cigar_string, cigar_string)
+                        || (cigar && (reference_cigar->beg_query != cigar->beg_query
+                                || reference_cigar->beg_ref != cigar->beg_ref))) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong cigar\n",
+                            name, a, b, open, extend, matrix->name);
+                }
+                reference_traceback = parasail_result_get_traceback(
+                        reference_result, s1, s1Len, s2, s2Len, matrix,
+                        '|', ':', '.');
+                traceback = parasail_result_get_traceback(
+                        result, s1, s1Len, s2, s2Len, matrix,
+                        '|', ':', '.');
+                if (diff_string(reference_traceback->query, traceback->query)
+                        || diff_string(reference_traceback->comp, traceback->comp)
+                        || diff_string(reference_traceback->ref, traceback->ref)) {
+                    printf("%s(%lu,%lu,%d,%d,%s) wrong traceback\n",
+                            name, a, b, open, extend, matrix->name);
+                }
+                parasail_traceback_free(traceback);
+                parasail_traceback_free(reference_traceback);
+                free(cigar_string);
+                free(reference_cigar_string);
+                if (cigar) parasail_cigar_free(cigar);
+                if (reference_cigar) parasail_cigar_free(reference_cigar);
+                parasail_result_free(result);
+                parasail_result_free(reference_result);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    check_functions(sequences, seq_count, matrix, open, extend);
+
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/function_lookup.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+static int can_use(const char *isa)
+{
+    if (0 == strcmp(isa, "sse2")) {
+        return parasail_can_use_sse2();
+    }
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    if (0 == strcmp(isa, "avx512bw")) {
+        return parasail_can_use_avx512bw();
+    }
+    if (0 == strcmp(isa, "altivec")) {
+        return parasail_can_use_altivec();
+    }
+    if (0 == strcmp(isa, "neon")) {
+        return parasail_can_use_neon();
+    }
+    return 1;
+}
+
+static parasail_function_t * lookup_reference(
+        const parasail_function_info_t *f)
+{
+    char name[64];
+    sprintf(name, "parasail_%s%s", f->alg,
+            f->is_table ? "_table" : f->is_rowcol ? "_rowcol" : "");
+    return parasail_lookup_function(name);
+}
+
+/* random DNA, each residue of a related sequence copied from the other
+ * with probability 3/4 */
+static void random_dna(char *s, int length, const char *alphabet,
+        const char *related, int related_length)
+{
+    int size = (int)strlen(alphabet);
+    int i = 0;
+    for (i=0; i<length; ++i) {
+        if (related && i < related_length && rand() % 4) {
+            s[i] = related[i];
+        }
+        else {
+            s[i] = alphabet[rand() % size];
+        }
+    }
+    s[length] = '\0';
+}
+
+static void check_result(
+        const parasail_function_info_t *f,
+        const char *matrixname,
+        int s1Len, int s2Len, int open, int extend,
+        const parasail_result_t *reference_result,
+        const parasail_result_t *result)
+{
+    if (reference_result->score != result->score) {
+        printf("%s(%d,%d,%d,%d,%s) wrong score (%d!=%d)\n",
+                f->name, s1Len, s2Len, open, extend, matrixname,
+                reference_result->score, result->score);
+    }
+    if (reference_result->end_query != result->end_query) {
+        printf("%s(%d,%d,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                f->name, s1Len, s2Len, open, extend, matrixname,
+                reference_result->end_query, result->end_query);
+    }
+    if (reference_result->end_ref != result->end_ref) {
+        printf("%s(%d,%d,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                f->name, s1Len, s2Len, open, extend, matrixname,
+                reference_result->end_ref, result->end_ref);
+    }
+    if (f->is_table && 0 != memcmp(
+                reference_result->tables->score_table,
+                result->tables->score_table,
+                sizeof(int)*s1Len*s2Len)) {
+        printf("%s(%d,%d,%d,%d,%s) wrong score table\n",
+                f->name, s1Len, s2Len, open, extend, matrixname);
+    }
+    if (f->is_rowcol && (0 != memcmp(
+                reference_result->rowcols->score_row,
+                result->rowcols->score_row, sizeof(int)*s2Len)
+            || 0 != memcmp(
+                reference_result->rowcols->score_col,
+                result->rowcols->score_col, sizeof(int)*s1Len))) {
+        printf("%s(%d,%d,%d,%d,%s) wrong score row or column\n",
+                f->name, s1Len, s2Len, open, extend, matrixname);
+    }
+}
+
+/* The striped kernels score match/mismatch matrices without a query
+ * profile; ambiguity codes in the sequences fall back to the profile. */
+static void check_functions(
+        const parasail_matrix_t *matrix,
+        const char *alphabet,
+        unsigned long pair_count,
+        int max_length,
+        int open,
+        int extend)
+{
+    unsigned long pair_index = 0;
+    char *s1 = (char*)malloc(max_length+1);
+    char *s2 = (char*)malloc(max_length+1);
+
+    printf("checking striped functions, matrix %s, alphabet %s\n",
+            matrix->name, alphabet);
+    for (pair_index=0; pair_index<pair_count; ++pair_index) {
+        int s1Len = 1 + rand() % max_length;
+        int s2Len = 1 + rand() % max_length;
+        unsigned long function_index = 0;
+        random_dna(s1, s1Len, alphabet, NULL, 0);
+        random_dna(s2, s2Len, alphabet,
+                pair_index % 2 ? s1 : NULL, s1Len);
+        for (function_index=0;
+                NULL!=functions[function_index].pointer;
+                ++function_index) {
+            const parasail_function_info_t *f = &functions[function_index];
+            parasail_function_t *reference = NULL;
+            parasail_result_t *reference_result = NULL;
+            parasail_result_t *result = NULL;
+            if (0 != strcmp(f->type, "striped")
+                    || f->is_trace || f->is_stats
+                    || !can_use(f->isa)) {
+                continue;
+            }
+            if (verbose) printf("\t%s(%d,%d)\n", f->name, s1Len, s2Len);
+            reference = lookup_reference(f);
+            reference_result = reference(
+                    s1, s1Len, s2, s2Len, open, extend, matrix);
+            result = f->pointer(
+                    s1, s1Len, s2, s2Len, open, extend, matrix);
+            if (!parasail_result_is_saturated(result)) {
+                check_result(f, matrix->name, s1Len, s2Len, open, extend,
+                        reference_result, result);
+            }
+            parasail_result_free(reference_result);
+            parasail_result_free(result);
+        }
+    }
+
+    free(s2);
+    free(s1);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long pair_count = 20;
+    int max_length = 300;
+    char *endptr = NULL;
+    int c = 0;
+    int open = 5;
+    int extend = 2;
+    parasail_matrix_t *matrix = NULL;
+
+    while ((c = getopt(argc, argv, "n:l:o:e:v")) != -1) {
+        switch (c) {
+            case 'n':
+                errno = 0;
+                pair_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'l':
+                errno = 0;
+                max_length = strtol(optarg, &endptr, 10);
+                if (errno || max_length < 1) {
+                    perror("strtol length");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'n' || optopt == 'l'
+                        || optopt == 'o' || optopt == 'e') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    srand(1);
+
+    matrix = parasail_matrix_create("ACGT", 2, -3);
+    check_functions(matrix, "ACGT", pair_count, max_length, open, extend);
+    check_functions(matrix, "ACGTN", pair_count, max_length, open, extend);
+    parasail_matrix_free(matrix);
+
+    check_functions(parasail_matrix_lookup("dnafull"), "ACGT",
+            pair_count, max_length, open, extend);
+    check_functions(parasail_matrix_lookup("dnafull"), "ACGTN",
+            pair_count, max_length, open, extend);
+
+    return 0;
+}
@@ -431,6 +431,21 @@ int main(int argc, char **argv)
     }
 #endif
 
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        if (test_scores) {
+            check_functions(parasail_nw_rowcol_avx512bw, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_rowcol_avx512bw, sequences, limit, matrix, gap);
+            check_functions(parasail_sw_rowcol_avx512bw, sequences, limit, matrix, gap);
+        }
+        if (test_stats) {
+            check_functions(parasail_nw_stats_rowcol_avx512bw, sequences, limit, matrix, gap);
+            check_functions(parasail_sg_stats_rowcol_avx512bw, sequences, limit, matrix, gap);
+            check_functions(parasail_sw_stats_rowcol_avx512bw, sequences, limit, matrix, gap);
+        }
+    }
+#endif
+
 #if HAVE_ALTIVEC
     if (parasail_can_use_altivec()) {
         if (test_scores) {
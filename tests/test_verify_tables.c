@@ -313,6 +313,7 @@ int main(int argc, char **argv)
     int do_sse2 = 1;
     int do_sse41 = 1;
     int do_avx2 = 1;
+    int do_avx512bw = 1;
     int do_altivec = 1;
     int do_neon = 1;
     int do_disp = 1;
@@ -365,6 +366,7 @@ int main(int argc, char **argv)
                 do_sse2 = (NULL == strstr(optarg, "sse2"));
                 do_sse41 = (NULL == strstr(optarg, "sse41"));
                 do_avx2 = (NULL == strstr(optarg, "avx2"));
+                do_avx512bw = (NULL == strstr(optarg, "avx512bw"));
                 do_altivec = (NULL == strstr(optarg, "altivec"));
                 do_neon = (NULL == strstr(optarg, "neon"));
                 do_disp = (NULL == strstr(optarg, "disp"));
@@ -473,6 +475,21 @@ int main(int argc, char **argv)
     }
 #endif
 
+#if HAVE_AVX512BW
+    if (do_avx512bw && parasail_can_use_avx512bw()) {
+        if (test_scores) {
+            if (do_nw) check_functions(parasail_nw_table_avx512bw, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_table_avx512bw, sequences, limit, matrix, gap);
+            if (do_sw) check_functions(parasail_sw_table_avx512bw, sequences, limit, matrix, gap);
+        }
+        if (test_stats) {
+            if (do_nw) check_functions(parasail_nw_stats_table_avx512bw, sequences, limit, matrix, gap);
+            if (do_sg) check_functions(parasail_sg_stats_table_avx512bw, sequences, limit, matrix, gap);
+            if (do_sw) check_functions(parasail_sw_stats_table_avx512bw, sequences, limit, matrix, gap);
+        }
+    }
+#endif
+
 #if HAVE_ALTIVEC
     if (do_altivec && parasail_can_use_altivec()) {
         if (test_scores) {
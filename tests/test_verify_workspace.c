@@ -0,0 +1,304 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+typedef struct ws_function_info {
+    parasail_pwfunction_t *pointer;
+    parasail_pefunction_t *encoded;
+    parasail_pfunction_t *reference;
+    parasail_pcreator_t *creator;
+    const char *name;
+    int (*usable)(void);
+} ws_function_info_t;
+
+static int always(void)
+{
+    return 1;
+}
+
+#define WS_ENTRY(alg, par, suffix, creator, usable)           \
+    {parasail_##alg##_##par##_profile_##suffix##_ws,          \
+     parasail_##alg##_##par##_profile_##suffix##_enc,         \
+     parasail_##alg##_##par##_profile_##suffix,               \
+     creator,                                                 \
+     "parasail_" #alg "_" #par "_profile_" #suffix "_ws",     \
+     usable}
+
+#define WS_WIDTHS(alg, par, isa, pre, usable)                 \
+    WS_ENTRY(alg, par, isa##_64, parasail_profile_create_##pre##_64, usable),  \
+    WS_ENTRY(alg, par, isa##_32, parasail_profile_create_##pre##_32, usable),  \
+    WS_ENTRY(alg, par, isa##_16, parasail_profile_create_##pre##_16, usable),  \
+    WS_ENTRY(alg, par, isa##_8, parasail_profile_create_##pre##_8, usable),    \
+    WS_ENTRY(alg, par, isa##_sat, parasail_profile_create_##pre##_sat, usable)
+
+#define WS_ALGS(isa, pre, usable)                             \
+    WS_WIDTHS(nw, scan, isa, pre, usable),                    \
+    WS_WIDTHS(sg, scan, isa, pre, usable),                    \
+    WS_WIDTHS(sw, scan, isa, pre, usable),                    \
+    WS_WIDTHS(nw, striped, isa, pre, usable),                 \
+    WS_WIDTHS(sg, striped, isa, pre, usable),                 \
+    WS_WIDTHS(sw, striped, isa, pre, usable)
+
+static const ws_function_info_t functions[] = {
+#if HAVE_SSE2
+    WS_ALGS(sse2_128, sse_128, parasail_can_use_sse2),
+#endif
+#if HAVE_SSE41
+    WS_ALGS(sse41_128, sse_128, parasail_can_use_sse41),
+#endif
+#if HAVE_AVX2
+    WS_ALGS(avx2_256, avx_256, parasail_can_use_avx2),
+#endif
+#if HAVE_AVX512BW
+    WS_ALGS(avx512bw_512, avx_512, parasail_can_use_avx512bw),
+#endif
+#if HAVE_ALTIVEC
+    WS_ALGS(altivec_128, altivec_128, parasail_can_use_altivec),
+#endif
+#if HAVE_NEON
+    WS_ALGS(neon_128, neon_128, parasail_can_use_neon),
+#endif
+    {NULL, NULL, NULL, NULL, "", NULL}
+};
+
+/* dispatching variants use the dispatching profile creators */
+static const ws_function_info_t dispatch_functions[] = {
+    WS_ENTRY(nw, scan, 64, parasail_profile_create_64, always),
+    WS_ENTRY(nw, scan, 32, parasail_profile_create_32, always),
+    WS_ENTRY(nw, scan, 16, parasail_profile_create_16, always),
+    WS_ENTRY(nw, scan, 8, parasail_profile_create_8, always),
+    WS_ENTRY(nw, scan, sat, parasail_profile_create_sat, always),
+    WS_ENTRY(sg, striped, 32, parasail_profile_create_32, always),
+    WS_ENTRY(sg, striped, sat, parasail_profile_create_sat, always),
+    WS_ENTRY(sw, striped, 16, parasail_profile_create_16, always),
+    WS_ENTRY(sw, striped, 8, parasail_profile_create_8, always),
+    WS_ENTRY(sw, striped, sat, parasail_profile_create_sat, always),
+    {NULL, NULL, NULL, NULL, "", NULL}
+};
+
+static void check_result(
+        const char *name,
+        unsigned long a,
+        unsigned long b,
+        int open,
+        int extend,
+        const parasail_matrix_t *matrix,
+        const parasail_result_t *reference_result,
+        const parasail_result_t *result)
+{
+    if (reference_result->flag != result->flag) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong flag (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->flag, result->flag);
+    }
+    if (reference_result->score != result->score) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong score (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->score, result->score);
+    }
+    if (reference_result->end_query != result->end_query) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong end_query (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->end_query, result->end_query);
+    }
+    if (reference_result->end_ref != result->end_ref) {
+        printf("%s(%lu,%lu,%d,%d,%s) wrong end_ref (%d!=%d)\n",
+                name, a, b, open, extend, matrix->name,
+                reference_result->end_ref, result->end_ref);
+    }
+}
+
+/* One workspace and one result are reused for every pair so the
+ * workspace has to grow and shrink correctly between calls.  If encoded
+ * is not NULL the *_enc functions are checked too. */
+static void check_functions(
+        const ws_function_info_t *f,
+        parasail_sequences_t *sequences,
+        parasail_encoded_sequences_t *encoded,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+
+    for (function_index=0;
+            NULL!=f[function_index].pointer;
+            ++function_index) {
+        const char *name = f[function_index].name;
+        parasail_workspace_t *workspace = NULL;
+        parasail_result_t *result = NULL;
+        if (!f[function_index].usable()) {
+            continue;
+        }
+        printf("checking %s\n", name);
+        workspace = parasail_workspace_new();
+        result = parasail_result_new();
+        for (a=0; a<seq_count; ++a) {
+            parasail_profile_t *profile = f[function_index].creator(
+                    sequences->seqs[a].seq.s,
+                    (int)sequences->seqs[a].seq.l,
+                    matrix);
+            for (b=0; b<seq_count; ++b) {
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                parasail_result_t *reference_result = NULL;
+                if (verbose) printf("\t%s(%lu,%lu)\n", name, a, b);
+                reference_result = f[function_index].reference(
+                        profile, s2, s2Len, open, extend);
+                f[function_index].pointer(
+                        profile, s2, s2Len, open, extend,
+                        workspace, result);
+                check_result(name, a, b, open, extend, matrix,
+                        reference_result, result);
+                if (NULL != encoded) {
+                    f[function_index].encoded(
+                            profile, &encoded->seqs[b], open, extend,
+                            workspace, result);
+                    check_result(name, a, b, open, extend, matrix,
+                            reference_result, result);
+                }
+                parasail_result_free(reference_result);
+            }
+            parasail_profile_free(profile);
+        }
+        parasail_result_free(result);
+        parasail_workspace_free(workspace);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    parasail_encoded_sequences_t *encoded = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+    int bits = 0;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:b:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'b':
+                errno = 0;
+                bits = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol bits");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    if (bits) {
+        encoded = parasail_sequences_encode(sequences, matrix, bits);
+    }
+
+    check_functions(functions, sequences, encoded, seq_count, matrix, open, extend);
+    check_functions(dispatch_functions, sequences, encoded, seq_count, matrix, open, extend);
+
+    if (encoded) {
+        parasail_encoded_sequences_free(encoded);
+    }
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
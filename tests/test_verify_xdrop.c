@@ -0,0 +1,409 @@
+#include "config.h"
+
+/* getopt needs _POSIX_C_SOURCE 2 */
+#define _POSIX_C_SOURCE 2
+
+#include <ctype.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if defined(_MSC_VER)
+#include "wingetopt/src/getopt.h"
+#else
+#include <unistd.h>
+#endif
+
+#include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/function_lookup.h"
+#include "parasail/io.h"
+#include "parasail/memory.h"
+#include "parasail/matrix_lookup.h"
+
+static int verbose = 0;
+
+typedef struct drop_setting {
+    int xdrop;
+    int zdrop;
+} drop_setting_t;
+
+/* drop settings checked for every pair; the first never stops */
+static const drop_setting_t settings[] = {
+    {0, 0},
+    {10, 0},
+    {40, 0},
+    {0, 10},
+    {0, 40},
+    {25, 25}
+};
+
+typedef struct drop_result {
+    int score;
+    int end_query;
+    int end_ref;
+    int stop_ref;
+} drop_result_t;
+
+static int can_use(const char *isa)
+{
+    if (0 == strcmp(isa, "sse2")) {
+        return parasail_can_use_sse2();
+    }
+    if (0 == strcmp(isa, "sse41")) {
+        return parasail_can_use_sse41();
+    }
+    if (0 == strcmp(isa, "avx2")) {
+        return parasail_can_use_avx2();
+    }
+    if (0 == strcmp(isa, "avx512bw")) {
+        return parasail_can_use_avx512bw();
+    }
+    if (0 == strcmp(isa, "altivec")) {
+        return parasail_can_use_altivec();
+    }
+    if (0 == strcmp(isa, "neon")) {
+        return parasail_can_use_neon();
+    }
+    return 1;
+}
+
+/* smallest row of column j holding value */
+static int find_row(const int *table, int s1Len, int s2Len, int j, int value)
+{
+    int i = 0;
+    for (i=0; i<s1Len; ++i) {
+        if (table[i*s2Len + j] == value) {
+            return i;
+        }
+    }
+    return s1Len-1;
+}
+
+/* Apply the column-wise X-drop and Z-drop rules of the striped kernels
+ * to the full score table. */
+static drop_result_t reference_drop(
+        const int *table, int s1Len, int s2Len,
+        int is_sw, int gap, drop_setting_t setting)
+{
+    drop_result_t r;
+    int best = INT_MIN;
+    int best_query = 0;
+    int best_ref = 0;
+    int i = 0;
+    int j = 0;
+    r.score = INT_MIN;
+    r.end_query = 0;
+    r.end_ref = 0;
+    r.stop_ref = -1;
+    for (j=0; j<s2Len; ++j) {
+        int col_score = INT_MIN;
+        for (i=0; i<s1Len; ++i) {
+            if (table[i*s2Len + j] > col_score) {
+                col_score = table[i*s2Len + j];
+            }
+        }
+        if (!is_sw && table[(s1Len-1)*s2Len + j] > r.score) {
+            r.score = table[(s1Len-1)*s2Len + j];
+            r.end_query = s1Len-1;
+            r.end_ref = j;
+        }
+        if (col_score > best) {
+            best = col_score;
+            best_query = find_row(table, s1Len, s2Len, j, best);
+            best_ref = j;
+        }
+        else if (0 < setting.xdrop || 0 < setting.zdrop) {
+            int drop = best - col_score;
+            int stop = 0;
+            if (0 < setting.xdrop && drop > setting.xdrop) {
+                stop = 1;
+            }
+            else if (0 < setting.zdrop && drop > setting.zdrop) {
+                int col_query = find_row(table, s1Len, s2Len, j, col_score);
+                int diff = (col_query - best_query) - (j - best_ref);
+                if (drop > setting.zdrop + gap*(diff < 0 ? -diff : diff)) {
+                    stop = 1;
+                }
+            }
+            if (stop) {
+                r.stop_ref = j;
+                break;
+            }
+        }
+    }
+    if (is_sw) {
+        r.score = best;
+        r.end_query = best_query;
+        r.end_ref = best_ref;
+    }
+    else if (-1 == r.stop_ref) {
+        int score_last = INT_MIN;
+        for (i=0; i<s1Len; ++i) {
+            if (table[i*s2Len + s2Len-1] > score_last) {
+                score_last = table[i*s2Len + s2Len-1];
+            }
+        }
+        if (score_last > r.score
+                || (score_last == r.score && r.end_ref == s2Len-1)) {
+            r.score = score_last;
+            r.end_query = find_row(table, s1Len, s2Len, s2Len-1, score_last);
+            r.end_ref = s2Len-1;
+        }
+    }
+    return r;
+}
+
+/* The striped sw and sg kernels must stop in the same column as the
+ * reference rules applied to the scalar score table. */
+static void check_functions(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+    size_t s = 0;
+
+    for (function_index=0;
+            NULL!=pfunctions[function_index].pointer;
+            ++function_index) {
+        const parasail_pfunction_info_t *f = &pfunctions[function_index];
+        const char *name = f->name;
+        int is_sw = 0 == strcmp(f->alg, "sw");
+        if ((!is_sw && 0 != strcmp(f->alg, "sg"))
+                || 0 != strcmp(f->type, "striped_profile")
+                || f->is_table || f->is_rowcol || f->is_trace
+                || f->is_stats || !can_use(f->isa)) {
+            continue;
+        }
+        printf("checking %s\n", name);
+        for (a=0; a<seq_count; ++a) {
+            const char *s1 = sequences->seqs[a].seq.s;
+            int s1Len = (int)sequences->seqs[a].seq.l;
+            parasail_profile_t *profile = f->creator(s1, s1Len, matrix);
+            for (b=0; b<seq_count; ++b) {
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                parasail_result_t *table = is_sw
+                    ? parasail_sw_table(s1, s1Len, s2, s2Len, open, extend, matrix)
+                    : parasail_sg_table(s1, s1Len, s2, s2Len, open, extend, matrix);
+                for (s=0; s<sizeof(settings)/sizeof(settings[0]); ++s) {
+                    parasail_result_t *result = NULL;
+                    drop_result_t ref;
+                    int stopped = 0;
+                    if (verbose) printf("\t%s(%lu,%lu,x=%d,z=%d)\n",
+                            name, a, b, settings[s].xdrop, settings[s].zdrop);
+                    profile->xdrop = settings[s].xdrop;
+                    profile->zdrop = settings[s].zdrop;
+                    result = f->pointer(profile, s2, s2Len, open, extend);
+                    if (parasail_result_is_saturated(result)) {
+                        parasail_result_free(result);
+                        continue;
+                    }
+                    ref = reference_drop(table->tables->score_table,
+                            s1Len, s2Len, is_sw, extend, settings[s]);
+                    stopped = 0 != parasail_result_is_xdrop(result);
+                    if (stopped != (-1 != ref.stop_ref)
+                            || result->stop_ref != ref.stop_ref) {
+                        printf("%s(%lu,%lu,%d,%d,x=%d,z=%d) wrong stop (%d!=%d)\n",
+                                name, a, b, open, extend,
+                                settings[s].xdrop, settings[s].zdrop,
+                                ref.stop_ref, result->stop_ref);
+                    }
+                    if (ref.score != result->score
+                            || ref.end_query != result->end_query
+                            || ref.end_ref != result->end_ref) {
+                        printf("%s(%lu,%lu,%d,%d,x=%d,z=%d) wrong result "
+                                "(%d,%d,%d != %d,%d,%d)\n",
+                                name, a, b, open, extend,
+                                settings[s].xdrop, settings[s].zdrop,
+                                ref.score, ref.end_query, ref.end_ref,
+                                result->score, result->end_query,
+                                result->end_ref);
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(table);
+            }
+            parasail_profile_free(profile);
+        }
+    }
+}
+
+/* A threshold the pair reaches must leave the result untouched, and
+ * one above the full score must prune the pair by the last column. */
+static void check_pruning(
+        parasail_sequences_t *sequences,
+        unsigned long seq_count,
+        const parasail_matrix_t *matrix,
+        int open,
+        int extend)
+{
+    unsigned long function_index = 0;
+    unsigned long a = 0;
+    unsigned long b = 0;
+    int s = 0;
+
+    for (function_index=0;
+            NULL!=pfunctions[function_index].pointer;
+            ++function_index) {
+        const parasail_pfunction_info_t *f = &pfunctions[function_index];
+        const char *name = f->name;
+        if ((0 != strcmp(f->alg, "sw") && 0 != strcmp(f->alg, "sg")
+                    && 0 != strcmp(f->alg, "sw_stats")
+                    && 0 != strcmp(f->alg, "sg_stats"))
+                || 0 != strcmp(f->type, "striped_profile")
+                || f->is_table || f->is_rowcol || f->is_trace
+                || !can_use(f->isa)) {
+            continue;
+        }
+        printf("checking %s pruning\n", name);
+        for (a=0; a<seq_count; ++a) {
+            const char *s1 = sequences->seqs[a].seq.s;
+            int s1Len = (int)sequences->seqs[a].seq.l;
+            parasail_profile_t *profile = f->creator(s1, s1Len, matrix);
+            for (b=0; b<seq_count; ++b) {
+                const char *s2 = sequences->seqs[b].seq.s;
+                int s2Len = (int)sequences->seqs[b].seq.l;
+                parasail_result_t *full = NULL;
+                profile->min_score = INT32_MIN;
+                full = f->pointer(profile, s2, s2Len, open, extend);
+                if (parasail_result_is_saturated(full)) {
+                    parasail_result_free(full);
+                    continue;
+                }
+                for (s=-1; s<=1; ++s) {
+                    parasail_result_t *result = NULL;
+                    int pruned = 0;
+                    profile->min_score = full->score + s;
+                    result = f->pointer(profile, s2, s2Len, open, extend);
+                    if (parasail_result_is_saturated(result)) {
+                        parasail_result_free(result);
+                        continue;
+                    }
+                    pruned = 0 != parasail_result_is_pruned(result);
+                    if (pruned != (s > 0)
+                            || (pruned && result->stop_ref < 0)) {
+                        printf("%s(%lu,%lu,%d,%d,min=%d) wrong prune (%d)\n",
+                                name, a, b, open, extend,
+                                profile->min_score, result->stop_ref);
+                    }
+                    if (!pruned && (full->score != result->score
+                                || full->end_query != result->end_query
+                                || full->end_ref != result->end_ref
+                                || (f->is_stats
+                                    && (full->stats->matches != result->stats->matches
+                                        || full->stats->length != result->stats->length)))) {
+                        printf("%s(%lu,%lu,%d,%d,min=%d) wrong result\n",
+                                name, a, b, open, extend,
+                                profile->min_score);
+                    }
+                    parasail_result_free(result);
+                }
+                parasail_result_free(full);
+            }
+            parasail_profile_free(profile);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seq_count = 0;
+    parasail_sequences_t *sequences = NULL;
+    char *endptr = NULL;
+    char *filename = NULL;
+    int c = 0;
+    char *matrixname = "blosum62";
+    const parasail_matrix_t *matrix = NULL;
+    int open = 10;
+    int extend = 1;
+
+    while ((c = getopt(argc, argv, "f:m:n:o:e:v")) != -1) {
+        switch (c) {
+            case 'f':
+                filename = optarg;
+                break;
+            case 'm':
+                matrixname = optarg;
+                break;
+            case 'n':
+                errno = 0;
+                seq_count = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol");
+                    exit(1);
+                }
+                break;
+            case 'o':
+                errno = 0;
+                open = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol open");
+                    exit(1);
+                }
+                break;
+            case 'e':
+                errno = 0;
+                extend = strtol(optarg, &endptr, 10);
+                if (errno) {
+                    perror("strtol extend");
+                    exit(1);
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case '?':
+                if (optopt == 'f' || optopt == 'n') {
+                    fprintf(stderr,
+                            "Option -%c requires an argument.\n",
+                            optopt);
+                }
+                else if (isprint(optopt)) {
+                    fprintf(stderr, "Unknown option `-%c'.\n",
+                            optopt);
+                }
+                else {
+                    fprintf(stderr,
+                            "Unknown option character `\\x%x'.\n",
+                            optopt);
+                }
+                exit(1);
+            default:
+                fprintf(stderr, "default case in getopt\n");
+                exit(1);
+        }
+    }
+
+    if (filename) {
+        sequences = parasail_sequences_from_file(filename);
+        if (0 == seq_count || seq_count > sequences->l) {
+            seq_count = sequences->l;
+        }
+    }
+    else {
+        fprintf(stderr, "no filename specified\n");
+        exit(1);
+    }
+
+    matrix = parasail_matrix_lookup(matrixname);
+    if (NULL == matrix) {
+        fprintf(stderr, "Specified substitution matrix not found.\n");
+        exit(1);
+    }
+
+    check_functions(sequences, seq_count, matrix, open, extend);
+    check_pruning(sequences, seq_count, matrix, open, extend);
+
+    parasail_sequences_free(sequences);
+
+    return 0;
+}
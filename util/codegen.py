@@ -18,6 +18,7 @@ import sys
 from isa import sse2
 from isa import sse41
 from isa import avx2
+from isa import avx512bw
 from isa import altivec
 from isa import neon
 
@@ -71,6 +72,25 @@ bias_templates = [
 "sw_stats_striped_bias.c",
 ]
 
+batch_templates = [
+"sw_batch.c",
+]
+
+banded_templates = [
+"nw_banded.c",
+"sg_banded.c",
+"sw_banded.c",
+"nw_trace_banded.c",
+"sg_trace_banded.c",
+"sw_trace_banded.c",
+]
+
+blocked_templates = [
+"nw_blocked.c",
+"sg_blocked.c",
+"sw_blocked.c",
+]
+
 
 output_dir = "generated/"
 if not os.path.exists(output_dir):
@@ -206,6 +226,17 @@ def generate_printer(params):
                 bias_rowcol += "    col[%(LANE)2d*seglen+t] = (%(INT)s)%(VEXTRACT)s(vH, %(LANE)2d) - bias;\n" % params
             else:
                 bias_rowcol += "    col[%(LANE)s*seglen+t] = (%(INT)s)%(VEXTRACT)s(vH, %(LANE)s) - bias;\n" % params
+    elif "banded" in params["NAME"]:
+        # lane K holds row i+K, column j-K, diagonal j-i-2K
+        for lane in range(params["LANES"]):
+            params["LANE"] = lane
+            params["LANE2"] = 2*lane
+            params["LANE_END"] = params["LANES"]-lane-1
+            trace += """
+    if (0 <= i+%(LANE)s && i+%(LANE)s < s1Len && 0 <= j-%(LANE)s && j-%(LANE)s < s2Len
+            && lo <= j-i-%(LANE2)s && j-i-%(LANE2)s <= hi) {
+        array[1LL*(i+%(LANE)s)*W + (j-i-%(LANE2)s-lo)] = (int8_t)%(VEXTRACT)s(vWH, %(LANE_END)s);
+    }\n"""[1:] % params
     elif "diag" in params["NAME"]:
         for lane in range(params["LANES"]):
             params["LANE"] = lane
@@ -229,6 +260,10 @@ def generate_printer(params):
     if (j-%(LANE)s == s2Len-1 && 0 <= i+%(LANE)s && i+%(LANE)s < s1Len) {
         col[(i+%(LANE)s)] = (%(INT)s)%(VEXTRACT)s(vWH, %(LANE_END)s);
     }\n"""[1:] % params
+    elif "batch" in params["NAME"]:
+        pass # batch kernels have no table or rowcol output
+    elif "blocked" in params["NAME"]:
+        pass # blocked kernels store their lanes with memcpy
     else:
         print "bad printer name"
         sys.exit(1)
@@ -297,8 +332,142 @@ def generate_saturation_check_old(params):
     return params
 
 
+def generate_saturation_check_banded(params):
+    # Banded kernels use saturating arithmetic at 8 and 16 bits.  Cells
+    # outside of the band are NEG_INF, so they are left out of the min.
+    width = params["WIDTH"]
+    params["STATS_SATURATION_CHECK_INIT"] = ""
+    params["STATS_SATURATION_CHECK_MID"] = ""
+    params["STATS_SATURATION_CHECK_MID1"] = ""
+    params["STATS_SATURATION_CHECK_MID2"] = ""
+    params["STATS_SATURATION_CHECK_FINAL"] = ""
+    if width not in [8, 16]:
+        params["SATURATION_CHECK_INIT"] = ""
+        params["SATURATION_CHECK_MID"] = ""
+        params["SATURATION_CHECK_FINAL"] = ""
+        return params
+    params["SATURATION_CHECK_INIT"] = """
+    %(VTYPE)s vNegLimit = %(VSET1)s(INT%(WIDTH)s_MIN);
+    %(VTYPE)s vPosLimit = %(VSET1)s(INT%(WIDTH)s_MAX);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;""".strip() % params
+    params["SATURATION_CHECK_MID"] = """
+            /* check for saturation */
+            {
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vWH);
+                vSaturationCheckMin = %(VBLEND)s(
+                        %(VMIN)s(vSaturationCheckMin, vWH),
+                        vSaturationCheckMin, vOut);
+            }""".strip() % params
+    # the boundary row and column of nw are not computed in vWH
+    params["SATURATION_CHECK_BOUNDARY"] = ""
+    if "nw" in params["NAME"]:
+        params["SATURATION_CHECK_BOUNDARY"] = """
+            || -open - (int64_t)MAX(MIN(hi,s2Len),MIN(-lo,s1Len))*gap
+                <= INT%(WIDTH)s_MIN""" % params
+    params["SATURATION_CHECK_FINAL"] = generate_mask_compares("""
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPEQ)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPEQ)s(vSaturationCheckMax, vPosLimit)))%(SATURATION_CHECK_BOUNDARY)s) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }""".strip(), params) % params
+    params["NEG_INF"] = "INT%(WIDTH)s_MIN" % params
+    params["VADD"] = params["VADDSx%(WIDTH)s" % params]
+    params["VSUB"] = params["VSUBSx%(WIDTH)s" % params]
+    for p in ["VMAX", "VMIN", "VBLEND", "VCMPEQ"]:
+        if (params[p].endswith("_rpl")
+                and params[p] not in params["FIXES"]):
+            params["FIXES"] += params[params[p]]
+    return params
+
+
+def generate_saturation_check_blocked(params):
+    # Blocked kernels use saturating arithmetic at 16 bits.  The padded
+    # rows of the last vector are left out of the min.  Each block keeps
+    # its own min and max so that tiles of different blocks may run
+    # concurrently, the kernel combines them at the end.
+    width = params["WIDTH"]
+    params["STATS_SATURATION_CHECK_INIT"] = ""
+    params["STATS_SATURATION_CHECK_MID"] = ""
+    params["STATS_SATURATION_CHECK_MID1"] = ""
+    params["STATS_SATURATION_CHECK_MID2"] = ""
+    params["STATS_SATURATION_CHECK_FINAL"] = ""
+    if width not in [8, 16]:
+        params["BLOCKED_SAT_FIELDS"] = ""
+        params["BLOCKED_SAT_RESET"] = ""
+        params["BLOCKED_SAT_SAVE"] = ""
+        params["BLOCKED_SAT_DECL"] = ""
+        params["BLOCKED_SAT_MERGE"] = ""
+        params["SATURATION_CHECK_INIT"] = ""
+        params["SATURATION_CHECK_MID"] = ""
+        params["SATURATION_CHECK_FINAL"] = ""
+        return params
+    params["BLOCKED_SAT_FIELDS"] = """
+    %(VTYPE)s vSaturationCheckMin;
+    %(VTYPE)s vSaturationCheckMax;""" % params
+    params["BLOCKED_SAT_RESET"] = """
+    blk->vSaturationCheckMin = %(VSET1)s(INT%(WIDTH)s_MAX);
+    blk->vSaturationCheckMax = %(VSET1)s(INT%(WIDTH)s_MIN);""" % params
+    params["BLOCKED_SAT_SAVE"] = """
+    blk->vSaturationCheckMin = vSaturationCheckMin;
+    blk->vSaturationCheckMax = vSaturationCheckMax;"""
+    params["BLOCKED_SAT_DECL"] = """
+    %(VTYPE)s vNegLimit = %(VSET1)s(INT%(WIDTH)s_MIN);
+    %(VTYPE)s vPosLimit = %(VSET1)s(INT%(WIDTH)s_MAX);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;""".strip() % params
+    params["BLOCKED_SAT_MERGE"] = """
+        vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, blk->vSaturationCheckMin);
+        vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, blk->vSaturationCheckMax);""" % params
+    params["SATURATION_CHECK_INIT"] = """
+    %(VTYPE)s vSaturationCheckMin = blk->vSaturationCheckMin;
+    %(VTYPE)s vSaturationCheckMax = blk->vSaturationCheckMax;
+    %(VTYPE)s vNoPad = %(VSET0)s();
+    %(VTYPE)s vPad = %(VCMPGT)s(
+            %(VSET)s(%(BLOCKED_POSITIONS)s),
+            %(VSET1)s((s1Len-1)%%N));""".strip() % params
+    params["SATURATION_CHECK_MID"] = """
+            /* check for saturation */
+            {
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+                vSaturationCheckMin = %(VBLEND)s(
+                        %(VMIN)s(vSaturationCheckMin, vH),
+                        vSaturationCheckMin,
+                        r0+(v+1)*N > s1Len ? vPad : vNoPad);
+            }""".strip() % params
+    # the boundary row and column of nw are not computed in vH
+    params["SATURATION_CHECK_BOUNDARY"] = ""
+    if "nw" in params["NAME"]:
+        params["SATURATION_CHECK_BOUNDARY"] = """
+            || -open - (int64_t)MAX(s1Len,s2Len)*gap <= INT%(WIDTH)s_MIN""" % params
+    params["SATURATION_CHECK_FINAL"] = generate_mask_compares("""
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPEQ)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPEQ)s(vSaturationCheckMax, vPosLimit)))%(SATURATION_CHECK_BOUNDARY)s) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }""".strip(), params) % params
+    params["NEG_INF"] = "INT%(WIDTH)s_MIN" % params
+    params["VADD"] = params["VADDSx%(WIDTH)s" % params]
+    params["VSUB"] = params["VSUBSx%(WIDTH)s" % params]
+    for p in ["VMAX", "VMIN", "VBLEND", "VCMPEQ", "VCMPGT", "VSET"]:
+        if (params[p].endswith("_rpl")
+                and params[p] not in params["FIXES"]):
+            params["FIXES"] += params[params[p]]
+    return params
+
+
 def generate_saturation_check(params):
     width = params["WIDTH"]
+    if "banded" in params["NAME"]:
+        return generate_saturation_check_banded(params)
+    if "blocked" in params["NAME"]:
+        return generate_saturation_check_blocked(params)
     if width == 8:
         params["SATURATION_CHECK_INIT"] = """
     %(VTYPE)s vNegLimit = %(VSET1)s(INT8_MIN);
@@ -336,7 +505,7 @@ def generate_saturation_check(params):
                 vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
             }""".strip() % params
 
-        params["SATURATION_CHECK_FINAL"] = """
+        params["SATURATION_CHECK_FINAL"] = generate_mask_compares("""
     if (%(VMOVEMASK)s(%(VOR)s(
             %(VCMPEQ)s(vSaturationCheckMin, vNegLimit),
             %(VCMPEQ)s(vSaturationCheckMax, vPosLimit)))) {
@@ -344,7 +513,7 @@ def generate_saturation_check(params):
         score = INT8_MAX;
         end_query = 0;
         end_ref = 0;
-    }""".strip() % params
+    }""".strip(), params) % params
 
         params["STATS_SATURATION_CHECK_INIT"] = """
     %(VTYPE)s vNegLimit = %(VSET1)s(INT8_MIN);
@@ -386,7 +555,7 @@ def generate_saturation_check(params):
                 vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vHL);
             }""".strip() % params
 
-        params["STATS_SATURATION_CHECK_FINAL"] = """
+        params["STATS_SATURATION_CHECK_FINAL"] = generate_mask_compares("""
     if (%(VMOVEMASK)s(%(VOR)s(
             %(VCMPEQ)s(vSaturationCheckMin, vNegLimit),
             %(VCMPEQ)s(vSaturationCheckMax, vPosLimit)))) {
@@ -397,7 +566,7 @@ def generate_saturation_check(params):
         length = 0;
         end_query = 0;
         end_ref = 0;
-    }""".strip() % params
+    }""".strip(), params) % params
 
         params["NEG_INF"] = "INT8_MIN"
         params["VADD"] = params["VADDSx8"]
@@ -409,6 +578,11 @@ def generate_saturation_check(params):
                 if (params[p].endswith("_rpl")
                         and params[p] not in params["FIXES"]):
                     params["FIXES"] += params[params[p]]
+        for p in ["VCMPEQ"]:
+            if (params[p].endswith("_rpl")
+                    and params[p] in params["SATURATION_CHECK_FINAL"]
+                    and params[p] not in params["FIXES"]):
+                params["FIXES"] += params[params[p]]
     else:
         params["SATURATION_CHECK_INIT"] = ""
         params["SATURATION_CHECK_MID"] = ""
@@ -444,6 +618,28 @@ def generated_params_diag(params):
     return params
 
 
+def generated_params_blocked(params):
+    # F extends down the lanes of a vector, log2(LANES) shifts of the
+    # running max with the gap extensions it crosses resolve all lanes
+    lanes = params["LANES"]
+    params["BLOCKED_POSITIONS"] = ",".join(
+            ["%d"%i for i in reversed(range(lanes))])
+    decl = []
+    scan = []
+    step = 1
+    while step < lanes:
+        decay = ",".join(["NEG_INF" if lane < step else "-%d*gap"%step
+            for lane in reversed(range(lanes))])
+        decl.append("%s vFDecay%d = %s(%s);" % (
+            params["VTYPE"], step, params["VSETx%(WIDTH)s"%params], decay))
+        scan.append("vF = %%(VMAX)s(vF, %%(VADD)s(%%(VSHIFT)s(vF, %d), vFDecay%d));" % (
+            step*params["BYTES"], step))
+        step *= 2
+    params["BLOCKED_FSCAN_DECL"] = "\n    ".join(decl)
+    params["BLOCKED_FSCAN"] = "\n                ".join(scan)
+    return params
+
+
 def generated_params_striped(params):
     params["STRIPED_INSERT_MASK"] = "0,"*(params["LANES"]-1)+"1"
     params["POSITION_MASK"] = ",".join([str(i) for i in range(params["LANES"])])
@@ -484,7 +680,7 @@ def generated_params_scan(params):
     params["SCAN_INSERT_MASK"] = "1"+",0"*(params["LANES"]-1)
     params["SCAN_NEG_INF_FRONT"] = "0,"*(params["LANES"]-1)+"NEG_LIMIT"
     params["POSITION_MASK"] = ",".join([str(i) for i in range(params["LANES"])])
-    if "avx" in params["ISA"]:
+    if "avx" in params["ISA"] and params["BITS"] == 256:
         params["SCAN_AVX2_BLENDV_FIX"] = """
 
 /* clang optimization broke blendv in this code */
@@ -503,6 +699,88 @@ static inline __m256i _mm256_blendv_epi8_rpl(__m256i a, __m256i b, __m256i mask)
     return params
 
 
+def split_call(text, start):
+    # text[start] is the '(' of a call; return (args, index past ')')
+    depth = 0
+    args = []
+    last = start+1
+    for i in range(start, len(text)):
+        c = text[i]
+        if c == '(':
+            depth += 1
+        elif c == ')':
+            depth -= 1
+            if depth == 0:
+                args.append(text[last:i])
+                return args, i+1
+        elif c == ',' and depth == 1:
+            args.append(text[last:i])
+            last = i+1
+    return None, None
+
+
+def mask_expr(expr):
+    # convert a vector compare expression to a mask register expression,
+    # or return None if the expression is not made of compares only
+    m = re.match(r'(\s*)%\((VCMPEQ|VCMPGT|VCMPLT|VOR|VAND)\)s\(', expr)
+    if not m:
+        return None
+    args, end = split_call(expr, m.end()-1)
+    if args is None or expr[end:].strip():
+        return None
+    ws, op = m.group(1), m.group(2)
+    if op.startswith("VCMP"):
+        return "%s%%(%s_MASK)s(%s)" % (ws, op, ",".join(args))
+    lhs = mask_expr(args[0])
+    rhs = mask_expr(args[1])
+    if lhs is None or rhs is None:
+        return None
+    sym = {"VOR":"|", "VAND":"&"}[op]
+    return "%s(%s %s%s)" % (ws, lhs.lstrip(), sym, rhs)
+
+
+def generate_mask_compares(template, params):
+    # ISAs with mask registers (AVX-512) compare directly into a mask
+    # instead of building a vector of compare results and moving its
+    # sign bits out with VMOVEMASK.
+    if "VCMPGT_MASKx8" not in params:
+        return template
+    template = re.sub(
+            r'%\(VTYPE\)s vCompare = %\(VCMPGT\)s(\([^()]*\));\s*'
+            r'if \(%\(VMOVEMASK\)s\(vCompare\)\)',
+            r'if (%(VCMPGT_MASK)s\1)', template)
+    pieces = []
+    last = 0
+    token = "%(VMOVEMASK)s("
+    pos = template.find(token)
+    while pos >= 0:
+        args, end = split_call(template, pos+len(token)-1)
+        expr = None
+        if args is not None and len(args) == 1:
+            expr = mask_expr(args[0])
+        if expr is None:
+            pieces.append(template[last:pos+len(token)])
+            last = pos+len(token)
+        else:
+            pieces.append(template[last:pos])
+            pieces.append(expr.lstrip())
+            last = end
+        pos = template.find(token, last)
+    pieces.append(template[last:])
+    return "".join(pieces)
+
+
+def select_lookup(template, params):
+    # the score lookup kernels between '#if LOOKUP' and its endif need a
+    # byte shuffle, ISAs and widths without VLOOKUP drop them
+    if "VLOOKUPx%(WIDTH)s" % params in params:
+        replacement = r'\1'
+    else:
+        replacement = ''
+    return re.sub(r'#if LOOKUP\n(.*?)#endif /\* LOOKUP \*/\n',
+            replacement, template, flags=re.S)
+
+
 def generated_params(template, params):
     # some params are generated from given params
     bits = params["BITS"]
@@ -514,8 +792,10 @@ def generated_params(template, params):
     params["LAST_POS"] = params["LANES"]-1
     params["INT"] = "int%(WIDTH)s_t" % params
     params["NEG_INF"] = "(INT%(WIDTH)s_MIN/(%(INT)s)(2))" % params
-    if "diag" in params["NAME"]:
+    if "diag" in params["NAME"] or "banded" in params["NAME"]:
         params = generated_params_diag(params)
+    elif "blocked" in params["NAME"]:
+        params = generated_params_blocked(params)
     elif "striped" in params["NAME"]:
         params = generated_params_striped(params)
     elif "scan" in params["NAME"]:
@@ -526,8 +806,11 @@ def generated_params(template, params):
         if key.endswith(suffix):
             new_key = key.split('x')[0]
             params[new_key] = params[key]
+    for key in ["VCMPEQ_MASK", "VCMPGT_MASK", "VCMPLT_MASK", "VLOOKUP"]:
+        if key+suffix in params:
+            params[key] = params[key+suffix]
     fixes = ""
-    template_params = re.findall(r'%\([A-Za-z0-9]+\)s', template)
+    template_params = re.findall(r'%\([A-Za-z0-9_]+\)s', template)
     for param in params:
         wrapped_param = r'%%(%s)s'%param
         if (wrapped_param in template_params
@@ -542,6 +825,9 @@ def generated_params(template, params):
     params["FIXES"] = fixes
     params = generate_printer(params)
     params = generate_saturation_check(params)
+    if "blocked" in params["NAME"]:
+        # the F scan is filled in after VADD is chosen for the width
+        params["BLOCKED_FSCAN"] = params["BLOCKED_FSCAN"] % params
     params = generate_H(params)
     params = generate_H_and_E(params)
     return params
@@ -550,7 +836,7 @@ def generated_params(template, params):
 for template_filename in template_filenames:
     template = open(template_dir+template_filename).read()
     for width in [64,32,16,8]:
-        for isa in [sse2,sse41,avx2,altivec,neon]:
+        for isa in [sse2,sse41,avx2,avx512bw,altivec,neon]:
             params = copy.deepcopy(isa)
             params["WIDTH"] = width
             prefix = template_filename[:-2]
@@ -596,11 +882,16 @@ for template_filename in template_filenames:
             params["PNAME_TABLE"] = "parasail_"+function_table_pname
             params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
             params["PNAME_TRACE"] = "parasail_"+function_trace_pname
-            params = generated_params(template, params)
+            params["PNAME_WS"] = params["PNAME"]+"_ws"
+            params["PNAME_ENC"] = params["PNAME"]+"_enc"
+            params["PNAME_PROMOTE"] = params["PNAME"]+"_promote"
+            template_isa = generate_mask_compares(
+                    select_lookup(template, params), params)
+            params = generated_params(template_isa, params)
             output_filename = "%s%s.c" % (output_dir, function_name)
-            result = template % params
+            result = template_isa % params
             writer = open(output_filename, "w")
-            writer.write(template % params)
+            writer.write(template_isa % params)
             writer.write("\n")
             writer.close()
 
@@ -624,7 +915,7 @@ for template_filename in special_templates:
         table_prefix = "%s_%s_table_%s" % (parts[0], parts[1], parts[2])
         rowcol_prefix = "%s_%s_rowcol_%s" % (parts[0], parts[1], parts[2])
         trace_prefix = "%s_%s_%s" % (parts[0], parts[1], parts[2])
-    for isa in [sse2,sse41,avx2,altivec,neon]:
+    for isa in [sse2,sse41,avx2,avx512bw,altivec,neon]:
         params = copy.deepcopy(isa)
         params["WIDTH"] = width
         function_name = "%s_%s%s_%s_%s" % (prefix,
@@ -639,11 +930,12 @@ for template_filename in special_templates:
         params["NAME_TABLE"] = "parasail_"+function_table_name
         params["NAME_ROWCOL"] = "parasail_"+function_rowcol_name
         params["NAME_TRACE"] = "parasail_"+function_trace_name
-        params = generated_params(template, params)
+        template_isa = generate_mask_compares(template, params)
+        params = generated_params(template_isa, params)
         output_filename = "%s%s.c" % (output_dir, function_name)
-        result = template % params
+        result = template_isa % params
         writer = open(output_filename, "w")
-        writer.write(template % params)
+        writer.write(template_isa % params)
         writer.write("\n")
         writer.close()
 
@@ -670,7 +962,7 @@ for template_filename in bias_templates:
     rowcol_prefix_prof = rowcol_prefix + "_profile"
     trace_prefix_prof = trace_prefix + "_profile"
     for width in [16,8]:
-        for isa in [sse2,sse41,avx2,altivec,neon]:
+        for isa in [sse2,sse41,avx2,avx512bw,altivec,neon]:
             params = copy.deepcopy(isa)
             params["WIDTH"] = width
             function_name = "%s_%s%s_%s_%s" % (prefix,
@@ -699,13 +991,103 @@ for template_filename in bias_templates:
             params["PNAME_TABLE"] = "parasail_"+function_table_pname
             params["PNAME_ROWCOL"] = "parasail_"+function_rowcol_pname
             params["PNAME_TRACE"] = "parasail_"+function_trace_pname
-            params = generated_params(template, params)
+            params["PNAME_WS"] = params["PNAME"]+"_ws"
+            params["PNAME_ENC"] = params["PNAME"]+"_enc"
+            params["PNAME_PROMOTE"] = params["PNAME"]+"_promote"
+            template_isa = generate_mask_compares(
+                    select_lookup(template, params), params)
+            params = generated_params(template_isa, params)
             params["VADD"] = params["VADDSx%d"%width]
             params["VSUB"] = params["VSUBSx%d"%width]
             output_filename = "%s%s.c" % (output_dir, function_name)
-            result = template % params
+            result = template_isa % params
+            writer = open(output_filename, "w")
+            writer.write(template_isa % params)
+            writer.write("\n")
+            writer.close()
+
+# inter-sequence batch templates, one database sequence per lane
+for template_filename in batch_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    prefix_prof = "%s_profile" % prefix
+    for width in [32,16,8]:
+        for isa in [sse2,sse41,avx2,avx512bw,altivec,neon]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_pname = "%s_%s%s_%s_%s" % (prefix_prof,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["PNAME"] = "parasail_"+function_pname
+            template_isa = generate_mask_compares(template, params)
+            params = generated_params(template_isa, params)
+            if "VADDSx%d"%width in params:
+                params["VADD"] = params["VADDSx%d"%width]
+                params["VSUB"] = params["VSUBSx%d"%width]
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            result = template_isa % params
+            writer = open(output_filename, "w")
+            writer.write(template_isa % params)
+            writer.write("\n")
+            writer.close()
+
+# banded templates, the anti-diagonal kernel restricted to a band
+for template_filename in banded_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    for width in [32,16,8]:
+        for isa in [sse41,avx2,neon]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["NAME_TRACE"] = "parasail_"+function_name
+            template_isa = generate_mask_compares(template, params)
+            params = generated_params(template_isa, params)
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            result = template_isa % params
             writer = open(output_filename, "w")
-            writer.write(template % params)
+            writer.write(template_isa % params)
             writer.write("\n")
             writer.close()
 
+# blocked templates, cache-sized blocks of query rows carrying the
+# boundary row between blocks, and the wavefront over tiles of them
+for template_filename in blocked_templates:
+    template = open(template_dir+template_filename).read()
+    prefix = template_filename[:-2]
+    parts = prefix.split('_')
+    table_prefix = "%s_table_%s" % (parts[0], parts[1])
+    rowcol_prefix = "%s_rowcol_%s" % (parts[0], parts[1])
+    wavefront_prefix = "%s_wavefront" % parts[0]
+    rowcol_wavefront_prefix = "%s_rowcol_wavefront" % parts[0]
+    for width in [32,16]:
+        for isa in [sse41,avx2,neon]:
+            params = copy.deepcopy(isa)
+            params["WIDTH"] = width
+            function_name = "%s_%s%s_%s_%s" % (prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_table_name = "%s_%s%s_%s_%s" % (table_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            function_rowcol_name = "%s_%s%s_%s_%s" % (rowcol_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME"] = "parasail_"+function_name
+            params["NAME_TABLE"] = "parasail_"+function_table_name
+            params["NAME_ROWCOL"] = "parasail_"+function_rowcol_name
+            params["NAME_WAVEFRONT"] = "parasail_%s_%s%s_%s_%s" % (
+                    wavefront_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            params["NAME_ROWCOL_WAVEFRONT"] = "parasail_%s_%s%s_%s_%s" % (
+                    rowcol_wavefront_prefix,
+                    isa["ISA"], isa["ISA_VERSION"], isa["BITS"], width)
+            template_isa = generate_mask_compares(template, params)
+            params = generated_params(template_isa, params)
+            output_filename = "%s%s.c" % (output_dir, function_name)
+            result = template_isa % params
+            writer = open(output_filename, "w")
+            writer.write(template_isa % params)
+            writer.write("\n")
+            writer.close()
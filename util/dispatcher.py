@@ -95,6 +95,12 @@ parasail_result_t* %(PREFIX)s_dispatcher(
         const int open, const int gap,
         const parasail_matrix_t *matrix)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512bw_512_%(WIDTH)s;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
@@ -156,6 +162,12 @@ parasail_result_t* %(PREFIX)s_dispatcher(
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
 {
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512bw_512_%(WIDTH)s;
+    }
+    else
+#endif
 #if HAVE_AVX2
     if (parasail_can_use_avx2()) {
         %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
@@ -246,6 +258,255 @@ parasail_result_t* %(PREFIX)s(
 {
     return %(PREFIX)s_pointer(profile, s2, s2Len, open, gap);
 }
+""" % params
+
+    txt += codegen_workspace(alg)
+    txt += codegen_workspace(alg, "enc", "parasail_pefunction_t", "encoded",
+            "const parasail_encoded_t * const restrict s2,", "s2")
+
+    if alg == "sw":
+        txt += codegen_batch()
+
+    txt += codegen_banded(alg)
+
+    return txt
+
+
+def codegen_workspace(alg, suffix="ws", ftype="parasail_pwfunction_t",
+        desc="workspace",
+        s2_param="const char * const restrict s2, const int s2Len,",
+        s2_arg="s2, s2Len"):
+    txt = """
+/* profile %s dispatchers */
+""" % desc
+    for par in ["scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            prefix = "parasail_%s_%s_%d_%s" % (alg, par, width, suffix)
+            txt += "%s %s_dispatcher;\n" % (ftype, prefix)
+            txt += "%s * %s_pointer = %s_dispatcher;\n" % (
+                    ftype, prefix, prefix)
+
+    for par in ["scan_profile", "striped_profile"]:
+        for width in [64, 32, 16, 8]:
+            params = {
+                    "PREFIX": "parasail_%s_%s_%d_%s" % (alg, par, width, suffix),
+                    "PREFIX2": "parasail_%s_%s" % (alg, par),
+                    "WIDTH": width,
+                    "SUFFIX": suffix,
+                    "S2_PARAM": s2_param,
+                    "S2_ARG": s2_arg
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const parasail_profile_t * const restrict profile,
+        %(S2_PARAM)s
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512bw_512_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s_%(SUFFIX)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = NULL;
+    }
+    return %(PREFIX)s_pointer(profile, %(S2_ARG)s, open, gap, workspace, result);
+}
+
+parasail_result_t* %(PREFIX)s(
+        const parasail_profile_t * const restrict profile,
+        %(S2_PARAM)s
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return %(PREFIX)s_pointer(profile, %(S2_ARG)s, open, gap, workspace, result);
+}
+""" % params
+
+    return txt
+
+
+def codegen_batch():
+    txt = """
+/* inter-sequence batch dispatchers */
+"""
+    for par in ["batch", "batch_profile"]:
+        for width in [32, 16, 8]:
+            if par == "batch":
+                ftype = "parasail_bfunction_t"
+            else:
+                ftype = "parasail_bpfunction_t"
+            prefix = "parasail_sw_%s_%d" % (par, width)
+            txt += "%s %s_dispatcher;\n" % (ftype, prefix)
+            txt += "%s * %s_pointer = %s_dispatcher;\n" % (
+                    ftype, prefix, prefix)
+
+    for par in ["batch", "batch_profile"]:
+        for width in [32, 16, 8]:
+            params = {
+                    "PREFIX": "parasail_sw_%s_%d" % (par, width),
+                    "PREFIX2": "parasail_sw_%s" % par,
+                    "WIDTH": width
+            }
+            if par == "batch":
+                params["ARGS"] = """const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix"""
+                params["CALL"] = "s1, s1Len, s2s, s2Lens, count, open, gap, matrix"
+            else:
+                params["ARGS"] = """const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap"""
+                params["CALL"] = "profile, s2s, s2Lens, count, open, gap"
+            txt += """
+parasail_result_t** %(PREFIX)s_dispatcher(
+        %(ARGS)s)
+{
+#if HAVE_AVX512BW
+    if (parasail_can_use_avx512bw()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx512bw_512_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE2
+    if (parasail_can_use_sse2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse2_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_ALTIVEC
+    if (parasail_can_use_altivec()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_altivec_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(PREFIX2)s;
+    }
+    return %(PREFIX)s_pointer(%(CALL)s);
+}
+
+parasail_result_t** %(PREFIX)s(
+        %(ARGS)s)
+{
+    return %(PREFIX)s_pointer(%(CALL)s);
+}
+""" % params
+
+    return txt
+
+def codegen_banded(alg):
+    txt = """
+/* banded dispatchers */
+"""
+    for par in ["banded", "trace_banded"]:
+        for width in [32, 16, 8]:
+            prefix = "parasail_%s_%s_%d" % (alg, par, width)
+            txt += "parasail_kfunction_t %s_dispatcher;\n" % prefix
+            txt += "parasail_kfunction_t * %s_pointer = %s_dispatcher;\n" % (
+                    prefix, prefix)
+
+    for par in ["banded", "trace_banded"]:
+        for width in [32, 16, 8]:
+            params = {
+                    "PREFIX": "parasail_%s_%s_%d" % (alg, par, width),
+                    "PREFIX2": "parasail_%s_%s" % (alg, par),
+                    "WIDTH": width
+            }
+            txt += """
+parasail_result_t* %(PREFIX)s_dispatcher(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+#if HAVE_AVX2
+    if (parasail_can_use_avx2()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_avx2_256_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_SSE41
+    if (parasail_can_use_sse41()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_sse41_128_%(WIDTH)s;
+    }
+    else
+#endif
+#if HAVE_NEON
+    if (parasail_can_use_neon()) {
+        %(PREFIX)s_pointer = %(PREFIX2)s_neon_128_%(WIDTH)s;
+    }
+    else
+#endif
+    {
+        %(PREFIX)s_pointer = %(PREFIX2)s;
+    }
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
+
+parasail_result_t* %(PREFIX)s(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    return %(PREFIX)s_pointer(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+}
 """ % params
 
     return txt
@@ -45,6 +45,7 @@ isa_to_bits = {
     "sse2"    : 128,
     "sse41"   : 128,
     "avx2"    : 256,
+    "avx512bw": 512,
     "altivec" : 128,
     "neon"    : 128,
 }
@@ -59,7 +60,7 @@ for table in ["_rowcol"]:
             if stats:
                 is_stats = 1
             pre = "parasail_"+alg+stats+table
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
+            for isa in ["sse2", "sse41", "avx2", "avx512bw", "altivec", "neon"]:
                 print "#if HAVE_%s" % isa.upper()
                 print "static parasail_function_info_t %s_%s_functions[] = {" % (pre, isa)
                 print_fmt(pre,         pre,         alg+stats, "orig", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 1)
@@ -70,6 +71,11 @@ for table in ["_rowcol"]:
                     for width in widths:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_trace, is_stats, 0)
+                if isa in ["sse41", "avx2", "neon"] and not stats:
+                    for par in ["blocked", "wavefront"]:
+                        for width in [32, 16]:
+                            name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+                            print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_trace, is_stats, 0)
                 print_null()
                 print "};"
                 print 'static parasail_function_group_t %s_%s = {"%s_%s", %s_%s_functions};' % ((pre, isa)*3)
@@ -43,6 +43,7 @@ isa_to_bits = {
     "sse2"    : 128,
     "sse41"   : 128,
     "avx2"    : 256,
+    "avx512bw": 512,
     "altivec" : 128,
     "neon"    : 128,
 }
@@ -56,7 +57,7 @@ for table in ["_trace"]:
             if stats:
                 is_stats = 1
             pre = "parasail_"+alg+stats+table
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
+            for isa in ["sse2", "sse41", "avx2", "avx512bw", "altivec", "neon"]:
                 print "#if HAVE_%s" % isa.upper()
                 print "static parasail_function_info_t %s_%s_functions[] = {" % (pre, isa)
                 print_fmt(pre,         pre,         alg+stats, "orig", "NA", "32", "32", 1, is_table, is_stats, 1)
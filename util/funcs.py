@@ -67,6 +67,7 @@ isa_to_bits = {
     "sse2"    : 128,
     "sse41"   : 128,
     "avx2"    : 256,
+    "avx512bw": 512,
     "altivec" : 128,
     "neon"    : 128,
 }
@@ -92,7 +93,7 @@ for table in ["", "_table", "_rowcol", "_trace"]:
             pre = "parasail_"+alg+stats+table
             print_fmt(pre,         pre,         alg+stats, "orig", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 1)
             print_fmt(pre+"_scan", pre+"_scan", alg+stats, "scan", "NA", "32", "32", 1, is_table, is_rowcol, is_trace, is_stats, 0)
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
+            for isa in ["sse2", "sse41", "avx2", "avx512bw", "altivec", "neon"]:
                 print "#if HAVE_%s" % isa.upper()
                 bits = isa_to_bits[isa]
                 for par in ["scan", "striped", "diag"]:
@@ -105,19 +106,31 @@ for table in ["", "_table", "_rowcol", "_trace"]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits,
                                 width, elem, is_table, is_rowcol, is_trace, is_stats, 0)
-                # blocked implementations only exist for sw sse41 32 and 16 bit
-                if (isa == "sse41" and alg == "sw"
+                # blocked implementations exist for sse41, avx2 and neon
+                # at 32 and 16 bit
+                if (isa in ["sse41", "avx2", "neon"]
                         and not stats and "trace" not in table):
                     par = "blocked"
                     for width in [32, 16]:
                         name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
                         print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_trace, is_stats, 0)
+                # as are the wavefront implementations, without tables
+                if (isa in ["sse41", "avx2", "neon"]
+                        and not stats and table in ["", "_rowcol"]):
+                    par = "wavefront"
+                    for width in [32, 16]:
+                        name = "%s_%s_%s_%s_%s" % (pre, par, isa, bits, width)
+                        print_fmt(name, name, alg+stats, par, isa, bits, width, bits/width, is_table, is_rowcol, is_trace, is_stats, 0)
                 print "#endif"
             # also print the dispatcher function
             for par in ["scan", "striped", "diag"]:
                 for width in [64, 32, 16, 8, "sat"]:
                     name = "%s_%s_%s" % (pre, par, width)
                     print_fmt(name, name, alg+stats, par, "disp", "NA", width, -1, is_table, is_rowcol, is_trace, is_stats, 0)
+            # and the automatic function
+            if not stats and not table:
+                name = "%s_auto" % pre
+                print_fmt(name, name, alg, "auto", "disp", "NA", "NA", -1, 0, 0, 0, 0, 0)
 
 print_null()
 print "};"
@@ -142,7 +155,7 @@ for table in ["", "_table", "_rowcol", "_trace"]:
             if stats:
                 is_stats = 1
             pre = "parasail_"+alg+stats+table
-            for isa in ["sse2", "sse41", "avx2", "altivec", "neon"]:
+            for isa in ["sse2", "sse41", "avx2", "avx512bw", "altivec", "neon"]:
                 print "#if HAVE_%s" % isa.upper()
                 bits = isa_to_bits[isa]
                 for par in ["scan_profile", "striped_profile"]:
@@ -171,6 +184,39 @@ for table in ["", "_table", "_rowcol", "_trace"]:
 print_pnull()
 print "};"
 
+print
+print "static const parasail_kfunction_info_t kfunctions[] = {"
+
+for table in ["", "_trace"]:
+    for alg in ["nw", "sg", "sw"]:
+        is_trace = 0
+        if table == "_trace":
+            is_trace = 1
+        pre = "parasail_"+alg+table
+        print_fmt(pre+"_banded", pre+"_banded", alg, "banded", "NA", "32", "32", 1, 0, 0, is_trace, 0, 1)
+        for isa in ["sse41", "avx2", "neon"]:
+            print "#if HAVE_%s" % isa.upper()
+            bits = isa_to_bits[isa]
+            for width in [32, 16, 8, "sat"]:
+                elem = 0
+                if "sat" == width:
+                    elem = bits/8
+                else:
+                    elem = bits/width
+                name = "%s_banded_%s_%s_%s" % (pre, isa, bits, width)
+                print_fmt(name, name, alg, "banded", isa, bits,
+                        width, elem, 0, 0, is_trace, 0, 0)
+            print "#endif"
+        # also print the dispatcher function
+        for width in [32, 16, 8, "sat"]:
+            name = "%s_banded_%s" % (pre, width)
+            print_fmt(name, name, alg, "banded", "disp", "NA", width, -1, 0, 0, is_trace, 0, 0)
+        # the adaptive band is not a reference for the fixed band
+        print_fmt(pre+"_banded_adaptive", pre+"_banded_adaptive", alg, "adaptive", "NA", "32", "32", 1, 0, 0, is_trace, 0, 0)
+
+print_null()
+print "};"
+
 print """
 #ifdef __cplusplus
 }
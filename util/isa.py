@@ -80,6 +80,10 @@ sse2 = {
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
     "VSTORE"      : "_mm_store_si128",
+    "VSTORE_TRACEx8"   : "_mm_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm_store_trace_epi64_rpl",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
@@ -281,6 +285,31 @@ static inline __m128i _mm_set_epi64x_rpl(int64_t e1, int64_t e0) {
     return A.m;
 }
 #endif
+""",
+    "_mm_store_trace_epi8_rpl" : """
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, __m128i v) {
+    _mm_storeu_si128((__m128i*)p, v);
+}
+""",
+    "_mm_store_trace_epi16_rpl" : """
+static inline void _mm_store_trace_epi16_rpl(int8_t *p, __m128i v) {
+    _mm_storel_epi64((__m128i*)p, _mm_packs_epi16(v, v));
+}
+""",
+    "_mm_store_trace_epi32_rpl" : """
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, __m128i v) {
+    int32_t t;
+    v = _mm_packs_epi32(v, v);
+    v = _mm_packs_epi16(v, v);
+    t = _mm_cvtsi128_si32(v);
+    memcpy(p, &t, sizeof(t));
+}
+""",
+    "_mm_store_trace_epi64_rpl" : """
+static inline void _mm_store_trace_epi64_rpl(int8_t *p, __m128i v) {
+    p[0] = (int8_t)_mm_cvtsi128_si32(v);
+    p[1] = (int8_t)_mm_extract_epi16(v, 4);
+}
 """,
 }
 
@@ -319,6 +348,9 @@ sse41 = {
     "VINSERTx32"  : "_mm_insert_epi32",
     "VINSERTx64"  : "_mm_insert_epi64_rpl",
     "VLOAD"       : "_mm_load_si128",
+    "VLOOKUPx8"   : "_mm_lookup_epi8_rpl",
+    "VLOOKUPx16"  : "_mm_lookup_epi16_rpl",
+    "VLOOKUPx32"  : "_mm_lookup_epi32_rpl",
     "VHMAXx8"     : "_mm_hmax_epi8_rpl",
     "VHMAXx16"    : "_mm_hmax_epi16_rpl",
     "VHMAXx32"    : "_mm_hmax_epi32_rpl",
@@ -352,6 +384,10 @@ sse41 = {
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
     "VSTORE"      : "_mm_store_si128",
+    "VSTORE_TRACEx8"   : "_mm_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm_store_trace_epi64_rpl",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
@@ -481,6 +517,48 @@ static inline __m128i _mm_set_epi64x_rpl(int64_t e1, int64_t e0) {
     return A.m;
 }
 #endif
+""",
+    "_mm_store_trace_epi8_rpl" : """
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, __m128i v) {
+    _mm_storeu_si128((__m128i*)p, v);
+}
+""",
+    "_mm_store_trace_epi16_rpl" : """
+static inline void _mm_store_trace_epi16_rpl(int8_t *p, __m128i v) {
+    _mm_storel_epi64((__m128i*)p, _mm_packs_epi16(v, v));
+}
+""",
+    "_mm_store_trace_epi32_rpl" : """
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, __m128i v) {
+    int32_t t;
+    v = _mm_packs_epi32(v, v);
+    v = _mm_packs_epi16(v, v);
+    t = _mm_cvtsi128_si32(v);
+    memcpy(p, &t, sizeof(t));
+}
+""",
+    "_mm_store_trace_epi64_rpl" : """
+static inline void _mm_store_trace_epi64_rpl(int8_t *p, __m128i v) {
+    p[0] = (int8_t)_mm_cvtsi128_si32(v);
+    p[1] = (int8_t)_mm_extract_epi16(v, 4);
+}
+""",
+    "_mm_lookup_epi8_rpl" : """
+static inline __m128i _mm_lookup_epi8_rpl(__m128i lo, __m128i hi, __m128i ilo, __m128i ihi) {
+    return _mm_or_si128(_mm_shuffle_epi8(lo, ilo), _mm_shuffle_epi8(hi, ihi));
+}
+""",
+    "_mm_lookup_epi16_rpl" : """
+static inline __m128i _mm_lookup_epi16_rpl(__m128i lo, __m128i hi, __m128i ilo, __m128i ihi) {
+    return _mm_srai_epi16(
+            _mm_or_si128(_mm_shuffle_epi8(lo, ilo), _mm_shuffle_epi8(hi, ihi)), 8);
+}
+""",
+    "_mm_lookup_epi32_rpl" : """
+static inline __m128i _mm_lookup_epi32_rpl(__m128i lo, __m128i hi, __m128i ilo, __m128i ihi) {
+    return _mm_srai_epi32(
+            _mm_or_si128(_mm_shuffle_epi8(lo, ilo), _mm_shuffle_epi8(hi, ihi)), 24);
+}
 """,
 }
 
@@ -519,6 +597,9 @@ avx2 = {
     "VINSERTx32"  : "_mm256_insert_epi32_rpl",
     "VINSERTx64"  : "_mm256_insert_epi64_rpl",
     "VLOAD"       : "_mm256_load_si256",
+    "VLOOKUPx8"   : "_mm256_lookup_epi8_rpl",
+    "VLOOKUPx16"  : "_mm256_lookup_epi16_rpl",
+    "VLOOKUPx32"  : "_mm256_lookup_epi32_rpl",
     "VHMAXx8"     : "_mm256_hmax_epi8_rpl",
     "VHMAXx16"    : "_mm256_hmax_epi16_rpl",
     "VHMAXx32"    : "_mm256_hmax_epi32_rpl",
@@ -552,6 +633,10 @@ avx2 = {
     "VRSHIFT"     : "_mm256_srli_si256_rpl",
     "VSHIFT"      : "_mm256_slli_si256_rpl",
     "VSTORE"      : "_mm256_store_si256",
+    "VSTORE_TRACEx8"   : "_mm256_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm256_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm256_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm256_store_trace_epi64_rpl",
     "VSUBx8"      : "_mm256_sub_epi8",
     "VSUBx16"     : "_mm256_sub_epi16",
     "VSUBx32"     : "_mm256_sub_epi32",
@@ -779,6 +864,342 @@ static inline __m256i _mm256_set_epi64x_rpl(int64_t e3, int64_t e2, int64_t e1,
     return A.m;
 }
 #endif
+""",
+    "_mm256_store_trace_epi8_rpl" : """
+static inline void _mm256_store_trace_epi8_rpl(int8_t *p, __m256i v) {
+    _mm256_storeu_si256((__m256i*)p, v);
+}
+""",
+    "_mm256_store_trace_epi16_rpl" : """
+static inline void _mm256_store_trace_epi16_rpl(int8_t *p, __m256i v) {
+    v = _mm256_packs_epi16(v, v);
+    v = _mm256_permute4x64_epi64(v, _MM_SHUFFLE(3,1,2,0));
+    _mm_storeu_si128((__m128i*)p, _mm256_castsi256_si128(v));
+}
+""",
+    "_mm256_store_trace_epi32_rpl" : """
+static inline void _mm256_store_trace_epi32_rpl(int8_t *p, __m256i v) {
+    v = _mm256_packs_epi32(v, v);
+    v = _mm256_packs_epi16(v, v);
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0,4,0,4,0,4,0,4));
+    _mm_storel_epi64((__m128i*)p, _mm256_castsi256_si128(v));
+}
+""",
+    "_mm256_store_trace_epi64_rpl" : """
+static inline void _mm256_store_trace_epi64_rpl(int8_t *p, __m256i v) {
+    int32_t t;
+    __m128i w = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+                v, _mm256_setr_epi32(0,2,4,6,0,2,4,6)));
+    w = _mm_packs_epi32(w, w);
+    w = _mm_packs_epi16(w, w);
+    t = _mm_cvtsi128_si32(w);
+    memcpy(p, &t, sizeof(t));
+}
+""",
+    "_mm256_lookup_epi8_rpl" : """
+static inline __m256i _mm256_lookup_epi8_rpl(__m256i lo, __m256i hi, __m256i ilo, __m256i ihi) {
+    return _mm256_or_si256(_mm256_shuffle_epi8(lo, ilo), _mm256_shuffle_epi8(hi, ihi));
+}
+""",
+    "_mm256_lookup_epi16_rpl" : """
+static inline __m256i _mm256_lookup_epi16_rpl(__m256i lo, __m256i hi, __m256i ilo, __m256i ihi) {
+    return _mm256_srai_epi16(
+            _mm256_or_si256(_mm256_shuffle_epi8(lo, ilo), _mm256_shuffle_epi8(hi, ihi)), 8);
+}
+""",
+    "_mm256_lookup_epi32_rpl" : """
+static inline __m256i _mm256_lookup_epi32_rpl(__m256i lo, __m256i hi, __m256i ilo, __m256i ihi) {
+    return _mm256_srai_epi32(
+            _mm256_or_si256(_mm256_shuffle_epi8(lo, ilo), _mm256_shuffle_epi8(hi, ihi)), 24);
+}
+""",
+}
+
+
+avx512bw = {
+    "ISA"         : "avx",
+    "ISA_VERSION" : "512bw",
+    "HEADER"      : "#include <immintrin.h>",
+    "BITS"        : 512,
+    "VTYPE"       : "__m512i",
+    "VADDx8"      : "_mm512_add_epi8",
+    "VADDx16"     : "_mm512_add_epi16",
+    "VADDx32"     : "_mm512_add_epi32",
+    "VADDx64"     : "_mm512_add_epi64",
+    "VADDSx8"     : "_mm512_adds_epi8",
+    "VADDSx16"    : "_mm512_adds_epi16",
+    "VBLEND"      : "_mm512_blendv_epi8_rpl",
+    "VCMPEQx8"    : "_mm512_cmpeq_epi8_rpl",
+    "VCMPEQx16"   : "_mm512_cmpeq_epi16_rpl",
+    "VCMPEQx32"   : "_mm512_cmpeq_epi32_rpl",
+    "VCMPEQx64"   : "_mm512_cmpeq_epi64_rpl",
+    "VCMPGTx8"    : "_mm512_cmpgt_epi8_rpl",
+    "VCMPGTx16"   : "_mm512_cmpgt_epi16_rpl",
+    "VCMPGTx32"   : "_mm512_cmpgt_epi32_rpl",
+    "VCMPGTx64"   : "_mm512_cmpgt_epi64_rpl",
+    "VCMPLTx8"    : "_mm512_cmplt_epi8_rpl",
+    "VCMPLTx16"   : "_mm512_cmplt_epi16_rpl",
+    "VCMPLTx32"   : "_mm512_cmplt_epi32_rpl",
+    "VCMPLTx64"   : "_mm512_cmplt_epi64_rpl",
+    "VCMPEQ_MASKx8"    : "_mm512_cmpeq_epi8_mask",
+    "VCMPEQ_MASKx16"   : "_mm512_cmpeq_epi16_mask",
+    "VCMPEQ_MASKx32"   : "_mm512_cmpeq_epi32_mask",
+    "VCMPEQ_MASKx64"   : "_mm512_cmpeq_epi64_mask",
+    "VCMPGT_MASKx8"    : "_mm512_cmpgt_epi8_mask",
+    "VCMPGT_MASKx16"   : "_mm512_cmpgt_epi16_mask",
+    "VCMPGT_MASKx32"   : "_mm512_cmpgt_epi32_mask",
+    "VCMPGT_MASKx64"   : "_mm512_cmpgt_epi64_mask",
+    "VCMPLT_MASKx8"    : "_mm512_cmplt_epi8_mask",
+    "VCMPLT_MASKx16"   : "_mm512_cmplt_epi16_mask",
+    "VCMPLT_MASKx32"   : "_mm512_cmplt_epi32_mask",
+    "VCMPLT_MASKx64"   : "_mm512_cmplt_epi64_mask",
+    "VEXTRACTx8"  : "_mm512_extract_epi8_rpl",
+    "VEXTRACTx16" : "_mm512_extract_epi16_rpl",
+    "VEXTRACTx32" : "_mm512_extract_epi32_rpl",
+    "VEXTRACTx64" : "_mm512_extract_epi64_rpl",
+    "VINSERTx8"   : "_mm512_insert_epi8_rpl",
+    "VINSERTx16"  : "_mm512_insert_epi16_rpl",
+    "VINSERTx32"  : "_mm512_insert_epi32_rpl",
+    "VINSERTx64"  : "_mm512_insert_epi64_rpl",
+    "VLOAD"       : "_mm512_load_si512",
+    "VLOOKUPx8"   : "_mm512_lookup_epi8_rpl",
+    "VLOOKUPx16"  : "_mm512_lookup_epi16_rpl",
+    "VLOOKUPx32"  : "_mm512_lookup_epi32_rpl",
+    "VHMAXx8"     : "_mm512_hmax_epi8_rpl",
+    "VHMAXx16"    : "_mm512_hmax_epi16_rpl",
+    "VHMAXx32"    : "_mm512_reduce_max_epi32",
+    "VHMAXx64"    : "_mm512_reduce_max_epi64",
+    "VMAXx8"      : "_mm512_max_epi8",
+    "VMAXx16"     : "_mm512_max_epi16",
+    "VMAXx32"     : "_mm512_max_epi32",
+    "VMAXx64"     : "_mm512_max_epi64",
+    "VMINx8"      : "_mm512_min_epi8",
+    "VMINx16"     : "_mm512_min_epi16",
+    "VMINx32"     : "_mm512_min_epi32",
+    "VMINx64"     : "_mm512_min_epi64",
+    "VMOVEMASK"   : "_mm512_movepi8_mask",
+    "VPACKS"      : "_mm512_packs_epi16_rpl",
+    "VUNPACKLO"   : "_mm512_unpacklo_epi8_rpl",
+    "VUNPACKHI"   : "_mm512_unpackhi_epi8_rpl",
+    "VAND"        : "_mm512_and_si512",
+    "VANDNOT"     : "_mm512_andnot_si512",
+    "VOR"         : "_mm512_or_si512",
+    "VXOR"        : "_mm512_xor_si512",
+    "VROTATE"     : "_mm512_rlli_si512_rpl",
+    "VSET0"       : "_mm512_setzero_si512",
+    "VSET1x8"     : "_mm512_set1_epi8",
+    "VSET1x16"    : "_mm512_set1_epi16",
+    "VSET1x32"    : "_mm512_set1_epi32",
+    "VSET1x64"    : "_mm512_set1_epi64",
+    "VSETx8"      : "_mm512_set_epi8",
+    "VSETx16"     : "_mm512_set_epi16",
+    "VSETx32"     : "_mm512_set_epi32",
+    "VSETx64"     : "_mm512_set_epi64",
+    "VRSHIFT"     : "_mm512_srli_si512_rpl",
+    "VSHIFT"      : "_mm512_slli_si512_rpl",
+    "VSTORE"      : "_mm512_store_si512",
+    "VSTORE_TRACEx8"   : "_mm512_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm512_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm512_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm512_store_trace_epi64_rpl",
+    "VSUBx8"      : "_mm512_sub_epi8",
+    "VSUBx16"     : "_mm512_sub_epi16",
+    "VSUBx32"     : "_mm512_sub_epi32",
+    "VSUBx64"     : "_mm512_sub_epi64",
+    "VSUBSx8"     : "_mm512_subs_epi8",
+    "VSUBSx16"    : "_mm512_subs_epi16",
+    "_mm512_blendv_epi8_rpl" : """
+#define _mm512_blendv_epi8_rpl(a,b,mask) _mm512_mask_blend_epi8(_mm512_movepi8_mask(mask), a, b)
+""",
+    "_mm512_cmpeq_epi8_rpl" : """
+#define _mm512_cmpeq_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a,b))
+""",
+    "_mm512_cmpeq_epi16_rpl" : """
+#define _mm512_cmpeq_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a,b))
+""",
+    "_mm512_cmpeq_epi32_rpl" : """
+#define _mm512_cmpeq_epi32_rpl(a,b) _mm512_maskz_set1_epi32(_mm512_cmpeq_epi32_mask(a,b), -1)
+""",
+    "_mm512_cmpeq_epi64_rpl" : """
+#define _mm512_cmpeq_epi64_rpl(a,b) _mm512_maskz_set1_epi64(_mm512_cmpeq_epi64_mask(a,b), -1)
+""",
+    "_mm512_cmpgt_epi8_rpl" : """
+#define _mm512_cmpgt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(a,b))
+""",
+    "_mm512_cmpgt_epi16_rpl" : """
+#define _mm512_cmpgt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(a,b))
+""",
+    "_mm512_cmpgt_epi32_rpl" : """
+#define _mm512_cmpgt_epi32_rpl(a,b) _mm512_maskz_set1_epi32(_mm512_cmpgt_epi32_mask(a,b), -1)
+""",
+    "_mm512_cmpgt_epi64_rpl" : """
+#define _mm512_cmpgt_epi64_rpl(a,b) _mm512_maskz_set1_epi64(_mm512_cmpgt_epi64_mask(a,b), -1)
+""",
+    "_mm512_cmplt_epi8_rpl" : """
+#define _mm512_cmplt_epi8_rpl(a,b) _mm512_movm_epi8(_mm512_cmplt_epi8_mask(a,b))
+""",
+    "_mm512_cmplt_epi16_rpl" : """
+#define _mm512_cmplt_epi16_rpl(a,b) _mm512_movm_epi16(_mm512_cmplt_epi16_mask(a,b))
+""",
+    "_mm512_cmplt_epi32_rpl" : """
+#define _mm512_cmplt_epi32_rpl(a,b) _mm512_maskz_set1_epi32(_mm512_cmplt_epi32_mask(a,b), -1)
+""",
+    "_mm512_cmplt_epi64_rpl" : """
+#define _mm512_cmplt_epi64_rpl(a,b) _mm512_maskz_set1_epi64(_mm512_cmplt_epi64_mask(a,b), -1)
+""",
+    "_mm512_hmax_epi8_rpl" : """
+static inline int8_t _mm512_hmax_epi8_rpl(__m512i a) {
+    __m256i b;
+    __m128i c;
+    b = _mm256_max_epi8(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    c = _mm_max_epi8(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 2));
+    c = _mm_max_epi8(c, _mm_srli_si128(c, 1));
+    return (int8_t)_mm_extract_epi8(c, 0);
+}
+""",
+    "_mm512_hmax_epi16_rpl" : """
+static inline int16_t _mm512_hmax_epi16_rpl(__m512i a) {
+    __m256i b;
+    __m128i c;
+    b = _mm256_max_epi16(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+    c = _mm_max_epi16(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 8));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 4));
+    c = _mm_max_epi16(c, _mm_srli_si128(c, 2));
+    return (int16_t)_mm_extract_epi16(c, 0);
+}
+""",
+    "_mm512_packs_epi16_rpl" : """
+static inline __m512i _mm512_packs_epi16_rpl(__m512i a, __m512i b) {
+    return _mm512_permutexvar_epi64(
+            _mm512_set_epi64(7,5,3,1,6,4,2,0),
+            _mm512_packs_epi16(a, b));
+}
+""",
+    "_mm512_unpacklo_epi8_rpl" : """
+static inline __m512i _mm512_unpacklo_epi8_rpl(__m512i a, __m512i b) {
+    __m512i idx = _mm512_set_epi64(3,3,2,2,1,1,0,0);
+    __m512i an = _mm512_permutexvar_epi64(idx, a);
+    __m512i bn = _mm512_permutexvar_epi64(idx, b);
+    return _mm512_unpacklo_epi8(an, bn);
+}
+""",
+    "_mm512_unpackhi_epi8_rpl" : """
+static inline __m512i _mm512_unpackhi_epi8_rpl(__m512i a, __m512i b) {
+    __m512i idx = _mm512_set_epi64(7,7,6,6,5,5,4,4);
+    __m512i an = _mm512_permutexvar_epi64(idx, a);
+    __m512i bn = _mm512_permutexvar_epi64(idx, b);
+    return _mm512_unpackhi_epi8(an, bn);
+}
+""",
+    "_mm512_srli_si512_rpl" : """
+#define _mm512_srli_si512_rpl(a,imm) _mm512_alignr_epi8(_mm512_maskz_shuffle_i64x2(0x3F, a, a, _MM_SHUFFLE(0,3,2,1)), a, imm)
+""",
+    "_mm512_slli_si512_rpl" : """
+#define _mm512_slli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_maskz_shuffle_i64x2(0xFC, a, a, _MM_SHUFFLE(2,1,0,0)), 16-imm)
+""",
+    "_mm512_rlli_si512_rpl" : """
+#define _mm512_rlli_si512_rpl(a,imm) _mm512_alignr_epi8(a, _mm512_shuffle_i64x2(a, a, _MM_SHUFFLE(2,1,0,3)), 16-imm)
+""",
+    "_mm512_insert_epi64_rpl" : """
+static inline __m512i _mm512_insert_epi64_rpl(__m512i a, int64_t i, int imm) {
+    __m512i_64_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+""",
+    "_mm512_insert_epi32_rpl" : """
+static inline __m512i _mm512_insert_epi32_rpl(__m512i a, int32_t i, int imm) {
+    __m512i_32_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+""",
+    "_mm512_insert_epi16_rpl" : """
+static inline __m512i _mm512_insert_epi16_rpl(__m512i a, int16_t i, int imm) {
+    __m512i_16_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+""",
+    "_mm512_insert_epi8_rpl" : """
+static inline __m512i _mm512_insert_epi8_rpl(__m512i a, int8_t i, int imm) {
+    __m512i_8_t A;
+    A.m = a;
+    A.v[imm] = i;
+    return A.m;
+}
+""",
+    "_mm512_extract_epi64_rpl" : """
+static inline int64_t _mm512_extract_epi64_rpl(__m512i a, int imm) {
+    __m512i_64_t A;
+    A.m = a;
+    return A.v[imm];
+}
+""",
+    "_mm512_extract_epi32_rpl" : """
+static inline int32_t _mm512_extract_epi32_rpl(__m512i a, int imm) {
+    __m512i_32_t A;
+    A.m = a;
+    return A.v[imm];
+}
+""",
+    "_mm512_extract_epi16_rpl" : """
+static inline int16_t _mm512_extract_epi16_rpl(__m512i a, int imm) {
+    __m512i_16_t A;
+    A.m = a;
+    return A.v[imm];
+}
+""",
+    "_mm512_extract_epi8_rpl" : """
+static inline int8_t _mm512_extract_epi8_rpl(__m512i a, int imm) {
+    __m512i_8_t A;
+    A.m = a;
+    return A.v[imm];
+}
+""",
+    "_mm512_store_trace_epi8_rpl" : """
+static inline void _mm512_store_trace_epi8_rpl(int8_t *p, __m512i v) {
+    _mm512_storeu_si512((void*)p, v);
+}
+""",
+    "_mm512_store_trace_epi16_rpl" : """
+static inline void _mm512_store_trace_epi16_rpl(int8_t *p, __m512i v) {
+    _mm256_storeu_si256((__m256i*)p, _mm512_cvtepi16_epi8(v));
+}
+""",
+    "_mm512_store_trace_epi32_rpl" : """
+static inline void _mm512_store_trace_epi32_rpl(int8_t *p, __m512i v) {
+    _mm_storeu_si128((__m128i*)p, _mm512_cvtepi32_epi8(v));
+}
+""",
+    "_mm512_store_trace_epi64_rpl" : """
+static inline void _mm512_store_trace_epi64_rpl(int8_t *p, __m512i v) {
+    _mm_storel_epi64((__m128i*)p, _mm512_cvtepi64_epi8(v));
+}
+""",
+    "_mm512_lookup_epi8_rpl" : """
+static inline __m512i _mm512_lookup_epi8_rpl(__m512i lo, __m512i hi, __m512i ilo, __m512i ihi) {
+    return _mm512_or_si512(_mm512_shuffle_epi8(lo, ilo), _mm512_shuffle_epi8(hi, ihi));
+}
+""",
+    "_mm512_lookup_epi16_rpl" : """
+static inline __m512i _mm512_lookup_epi16_rpl(__m512i lo, __m512i hi, __m512i ilo, __m512i ihi) {
+    return _mm512_srai_epi16(
+            _mm512_or_si512(_mm512_shuffle_epi8(lo, ilo), _mm512_shuffle_epi8(hi, ihi)), 8);
+}
+""",
+    "_mm512_lookup_epi32_rpl" : """
+static inline __m512i _mm512_lookup_epi32_rpl(__m512i lo, __m512i hi, __m512i ilo, __m512i ihi) {
+    return _mm512_srai_epi32(
+            _mm512_or_si512(_mm512_shuffle_epi8(lo, ilo), _mm512_shuffle_epi8(hi, ihi)), 24);
+}
 """,
 }
 
@@ -850,12 +1271,44 @@ altivec = {
     "VRSHIFT"     : "_mm_srli_si128",
     "VSHIFT"      : "_mm_slli_si128",
     "VSTORE"      : "_mm_store_si128",
+    "VSTORE_TRACEx8"   : "_mm_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm_store_trace_epi64_rpl",
     "VSUBx8"      : "_mm_sub_epi8",
     "VSUBx16"     : "_mm_sub_epi16",
     "VSUBx32"     : "_mm_sub_epi32",
     "VSUBx64"     : "_mm_sub_epi64",
     "VSUBSx8"     : "_mm_subs_epi8",
     "VSUBSx16"    : "_mm_subs_epi16",
+    "_mm_store_trace_epi8_rpl" : """
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, vec128i v) {
+    _mm_store_si128((vec128i*)p, v);
+}
+""",
+    "_mm_store_trace_epi16_rpl" : """
+static inline void _mm_store_trace_epi16_rpl(int8_t *p, vec128i v) {
+    int k;
+    v = _mm_packs_epi16(v, v);
+    for (k=0; k<8; ++k) {
+        p[k] = _mm_extract_epi8(v, k);
+    }
+}
+""",
+    "_mm_store_trace_epi32_rpl" : """
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, vec128i v) {
+    int k;
+    for (k=0; k<4; ++k) {
+        p[k] = (int8_t)_mm_extract_epi32(v, k);
+    }
+}
+""",
+    "_mm_store_trace_epi64_rpl" : """
+static inline void _mm_store_trace_epi64_rpl(int8_t *p, vec128i v) {
+    p[0] = (int8_t)_mm_extract_epi64(v, 0);
+    p[1] = (int8_t)_mm_extract_epi64(v, 1);
+}
+""",
 }
 
 
@@ -893,6 +1346,9 @@ neon = {
     "VINSERTx32"  : "simde_mm_insert_epi32",
     "VINSERTx64"  : "simde_mm_insert_epi64",
     "VLOAD"       : "simde_mm_load_si128",
+    "VLOOKUPx8"   : "_mm_lookup_epi8_rpl",
+    "VLOOKUPx16"  : "_mm_lookup_epi16_rpl",
+    "VLOOKUPx32"  : "_mm_lookup_epi32_rpl",
     "VHMAXx8"     : "simde_mm_hmax_epi8",
     "VHMAXx16"    : "simde_mm_hmax_epi16",
     "VHMAXx32"    : "simde_mm_hmax_epi32",
@@ -926,12 +1382,58 @@ neon = {
     "VRSHIFT"     : "simde_mm_srli_si128",
     "VSHIFT"      : "simde_mm_slli_si128",
     "VSTORE"      : "simde_mm_store_si128",
+    "VSTORE_TRACEx8"   : "_mm_store_trace_epi8_rpl",
+    "VSTORE_TRACEx16"  : "_mm_store_trace_epi16_rpl",
+    "VSTORE_TRACEx32"  : "_mm_store_trace_epi32_rpl",
+    "VSTORE_TRACEx64"  : "_mm_store_trace_epi64_rpl",
     "VSUBx8"      : "simde_mm_sub_epi8",
     "VSUBx16"     : "simde_mm_sub_epi16",
     "VSUBx32"     : "simde_mm_sub_epi32",
     "VSUBx64"     : "simde_mm_sub_epi64",
     "VSUBSx8"     : "simde_mm_subs_epi8",
     "VSUBSx16"    : "simde_mm_subs_epi16",
+    "_mm_store_trace_epi8_rpl" : """
+static inline void _mm_store_trace_epi8_rpl(int8_t *p, simde__m128i v) {
+    simde_mm_storeu_si128((simde__m128i*)p, v);
+}
+""",
+    "_mm_store_trace_epi16_rpl" : """
+static inline void _mm_store_trace_epi16_rpl(int8_t *p, simde__m128i v) {
+    simde_mm_storel_epi64((simde__m128i*)p, simde_mm_packs_epi16(v, v));
+}
+""",
+    "_mm_store_trace_epi32_rpl" : """
+static inline void _mm_store_trace_epi32_rpl(int8_t *p, simde__m128i v) {
+    int32_t t;
+    v = simde_mm_packs_epi32(v, v);
+    v = simde_mm_packs_epi16(v, v);
+    t = simde_mm_cvtsi128_si32(v);
+    memcpy(p, &t, sizeof(t));
+}
+""",
+    "_mm_store_trace_epi64_rpl" : """
+static inline void _mm_store_trace_epi64_rpl(int8_t *p, simde__m128i v) {
+    p[0] = (int8_t)simde_mm_cvtsi128_si32(v);
+    p[1] = (int8_t)simde_mm_extract_epi16(v, 4);
+}
+""",
+    "_mm_lookup_epi8_rpl" : """
+static inline simde__m128i _mm_lookup_epi8_rpl(simde__m128i lo, simde__m128i hi, simde__m128i ilo, simde__m128i ihi) {
+    return simde_mm_or_si128(simde_mm_shuffle_epi8(lo, ilo), simde_mm_shuffle_epi8(hi, ihi));
+}
+""",
+    "_mm_lookup_epi16_rpl" : """
+static inline simde__m128i _mm_lookup_epi16_rpl(simde__m128i lo, simde__m128i hi, simde__m128i ilo, simde__m128i ihi) {
+    return simde_mm_srai_epi16(
+            simde_mm_or_si128(simde_mm_shuffle_epi8(lo, ilo), simde_mm_shuffle_epi8(hi, ihi)), 8);
+}
+""",
+    "_mm_lookup_epi32_rpl" : """
+static inline simde__m128i _mm_lookup_epi32_rpl(simde__m128i lo, simde__m128i hi, simde__m128i ilo, simde__m128i ihi) {
+    return simde_mm_srai_epi32(
+            simde_mm_or_si128(simde_mm_shuffle_epi8(lo, ilo), simde_mm_shuffle_epi8(hi, ihi)), 24);
+}
+""",
 }
 
 
@@ -939,6 +1441,7 @@ isa = {
         "sse2"     : sse2,
         "sse41"    : sse41,
         "avx2"     : avx2,
+        "avx512bw" : avx512bw,
         "altivec"  : altivec,
         "neon"     : neon,
 }
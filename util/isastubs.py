@@ -34,6 +34,9 @@ def isa_to_guard(isa):
     if '_sse_' in isa:
         print '#if HAVE_SSE2 || HAVE_SSE41'
         print '#else'
+    elif '_avx_512' in isa:
+        print "#if HAVE_AVX512BW"
+        print '#else'
     elif '_avx_' in isa:
         print "#if HAVE_AVX2"
         print '#else'
@@ -43,6 +46,9 @@ def isa_to_guard(isa):
     elif 'sse41' in isa:
         print "#if HAVE_SSE41"
         print '#else'
+    elif 'avx512bw' in isa:
+        print "#if HAVE_AVX512BW"
+        print '#else'
     elif 'avx2' in isa:
         print "#if HAVE_AVX2"
         print '#else'
@@ -82,6 +88,76 @@ def body2():
 }
 #endif"""
 
+def body4():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body5():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2s);
+    UNUSED(s2Lens);
+    UNUSED(count);
+    UNUSED(open);
+    UNUSED(gap);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body7():
+    print """{
+    UNUSED(s1);
+    UNUSED(s1Len);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(k);
+    UNUSED(matrix);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body6():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(s2Len);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
+def body8():
+    print """{
+    UNUSED(profile);
+    UNUSED(s2);
+    UNUSED(open);
+    UNUSED(gap);
+    UNUSED(workspace);
+    UNUSED(result);
+    errno = ENOSYS;
+    return NULL;
+}
+#endif"""
+
 def body3():
     print """{
     UNUSED(s1);
@@ -101,6 +177,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -129,6 +206,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -147,12 +225,66 @@ for a in alg:
                     print " "*8+"const int open, const int gap)"
                     body2()
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
+# vectorized profile workspace implementations (3x2x30 = 180 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+p+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result)"
+            body6()
+
+# vectorized profile encoded implementations (3x2x30 = 180 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+p+i+'_enc('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const parasail_encoded_t * const restrict s2,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result)"
+            body8()
+
+# vectorized implementations of blocked (3x1x3x3x2 = 54 impl)
+alg = ["nw", "sg", "sw"]
 stats = [""]
 table = ["", "_table", "_rowcol", "_trace"]
 par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
 for a in alg:
     for s in stats:
         for t in table:
@@ -169,11 +301,37 @@ for a in alg:
                     print " "*8+"const parasail_matrix_t* matrix)"
                     body1()
 
+# vectorized implementations of wavefront (3x1x2x3x2 = 36 impl)
+alg = ["nw", "sg", "sw"]
+stats = [""]
+table = ["", "_rowcol"]
+par = ["_wavefront"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
+for a in alg:
+    for s in stats:
+        for t in table:
+            for p in par:
+                for i in isa:
+                    print ""
+                    isa_to_guard(i)
+                    print "extern"
+                    print "parasail_result_t* parasail_"+a+s+t+p+i+'('
+                    print " "*8+"const char * const restrict s1, const int s1Len,"
+                    print " "*8+"const char * const restrict s2, const int s2Len,"
+                    print " "*8+"const int open, const int gap,"
+                    print " "*8+"const parasail_matrix_t* matrix)"
+                    body1()
+
 # profile creation functions (2x13 = 26 impl)
 stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx_512_64", "_avx_512_32", "_avx_512_16", "_avx_512_8", "_avx_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     ]
@@ -187,4 +345,56 @@ for s in stats:
         print " "*8+"const parasail_matrix_t* matrix)"
         body3()
 
+# inter-sequence batch implementations (1x6x4 = 24 impl)
+isa = [
+    "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for i in isa:
+    print ""
+    isa_to_guard(i)
+    print "extern"
+    print "parasail_result_t** parasail_sw_batch"+i+'('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const char * const * const restrict s2s,"
+    print " "*8+"const int * const restrict s2Lens, const int count,"
+    print " "*8+"const int open, const int gap,"
+    print " "*8+"const parasail_matrix_t* matrix)"
+    body4()
+for i in isa:
+    print ""
+    isa_to_guard(i)
+    print "extern"
+    print "parasail_result_t** parasail_sw_batch_profile"+i+'('
+    print " "*8+"const parasail_profile_t * const restrict profile,"
+    print " "*8+"const char * const * const restrict s2s,"
+    print " "*8+"const int * const restrict s2Lens, const int count,"
+    print " "*8+"const int open, const int gap)"
+    body5()
+
+# banded implementations (3x2x3x4 = 72 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_banded", "_trace_banded"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            isa_to_guard(i)
+            print "extern"
+            print "parasail_result_t* parasail_"+a+p+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix)"
+            body7()
+
 print # for newline at end of file
@@ -6,11 +6,21 @@ EXPORTS
     parasail_profile_free
     parasail_version
     parasail_result_free
+    parasail_result_batch_free
+    parasail_workspace_new
+    parasail_workspace_free
+    parasail_encode
+    parasail_encoded_free
+    parasail_set_sat_hook
+    parasail_set_profile_budget
+    parasail_auto_calibrate
     parasail_lookup_function
     parasail_lookup_pfunction
     parasail_lookup_pcreator
     parasail_lookup_function_info
     parasail_lookup_pfunction_info
+    parasail_lookup_kfunction
+    parasail_lookup_kfunction_info
     parasail_time
     parasail_matrix_lookup
     parasail_matrix_create
@@ -19,6 +29,23 @@ EXPORTS
     parasail_matrix_copy
     parasail_matrix_set_value
     parasail_nw_banded
+    parasail_sg_banded
+    parasail_sw_banded
+    parasail_nw_trace_banded
+    parasail_sg_trace_banded
+    parasail_sw_trace_banded
+    parasail_nw_banded_adaptive
+    parasail_sg_banded_adaptive
+    parasail_sw_banded_adaptive
+    parasail_nw_trace_banded_adaptive
+    parasail_sg_trace_banded_adaptive
+    parasail_sw_trace_banded_adaptive
+    parasail_nw_auto
+    parasail_sg_auto
+    parasail_sw_auto
+    parasail_nw_trace_linear
+    parasail_sg_trace_linear
+    parasail_sw_trace_linear
     parasail_traceback_generic
     parasail_traceback_generic_extra
     parasail_cigar_encode
@@ -38,11 +65,15 @@ EXPORTS
     parasail_result_is_sg
     parasail_result_is_sw
     parasail_result_is_saturated
+    parasail_result_is_xdrop
+    parasail_result_is_pruned
     parasail_result_is_banded
     parasail_result_is_scan
     parasail_result_is_striped
     parasail_result_is_diag
     parasail_result_is_blocked
+    parasail_result_is_batch
+    parasail_result_is_linear
     parasail_result_is_stats
     parasail_result_is_stats_table
     parasail_result_is_stats_rowcol
@@ -74,6 +105,9 @@ EXPORTS
     parasail_sequences_from_file
     parasail_sequences_pack
     parasail_sequences_free
+    parasail_sequences_encode
+    parasail_encoded_sequences_from_file
+    parasail_encoded_sequences_free
     parasail_open
     parasail_close
     parasail_is_fasta
@@ -159,6 +193,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -179,6 +214,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -190,12 +226,58 @@ for a in alg:
                 for i in isa:
                     print "    parasail_"+a+s+t+p+i
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
+# vectorized and dispatching profile workspace implementations
+# (3x2x(30+5) = 210 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
+    "_64", "_32", "_16", "_8", "_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print "    parasail_"+a+p+i+"_ws"
+
+# vectorized and dispatching profile encoded implementations
+# (3x2x(30+5) = 210 impl)
+for a in alg:
+    for p in par:
+        for i in isa:
+            print "    parasail_"+a+p+i+"_enc"
+
+# vectorized implementations of blocked (3x1x3x3x2 = 54 impl)
+alg = ["nw", "sg", "sw"]
 stats = [""]
 table = ["", "_table", "_rowcol"]
 par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
+for a in alg:
+    for s in stats:
+        for t in table:
+            for p in par:
+                for i in isa:
+                    print "    parasail_"+a+s+t+p+i
+
+# vectorized implementations of wavefront (3x1x2x3x2 = 36 impl)
+alg = ["nw", "sg", "sw"]
+stats = [""]
+table = ["", "_rowcol"]
+par = ["_wavefront"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
 for a in alg:
     for s in stats:
         for t in table:
@@ -236,6 +318,7 @@ stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx_512_64", "_avx_512_32", "_avx_512_16", "_avx_512_8", "_avx_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     "_64", "_32", "_16", "_8", "_sat"
@@ -256,3 +339,31 @@ for a in alg:
             for p in par:
                 print "    parasail_"+a+s+t+p+"_sat"
 
+
+# inter-sequence batch implementations, serial reference, vectorized,
+# and dispatching (1x(1+6x4+4) = 29 impl, each with a profile variant)
+batch = ["", "_32", "_16", "_8", "_sat",
+    "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for p in ["", "_profile"]:
+    for i in batch:
+        print "    parasail_sw_batch"+p+i
+
+# banded implementations, vectorized and dispatching
+# (3x2x(4+3x4) = 96 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_banded", "_trace_banded"]
+isa = ["_32", "_16", "_8", "_sat",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print "    parasail_"+a+p+i
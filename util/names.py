@@ -39,6 +39,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -64,6 +65,7 @@ isa = [
     "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
     "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
     "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
     ]
@@ -79,12 +81,50 @@ for a in alg:
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap);"
 
-# vectorized implementations of blocked (1x1x3x1x2 = 6 impl)
-alg = ["sw"]
+# vectorized profile workspace implementations (3x2x30 = 180 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_scan_profile", "_striped_profile"]
+isa = [
+    "_sse2_128_64", "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_64", "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_64", "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_64", "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+i+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
+# vectorized profile encoded implementations (3x2x30 = 180 impl)
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+i+'_enc('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const parasail_encoded_t * const restrict s2,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
+# vectorized implementations of blocked (3x1x3x3x2 = 54 impl)
+alg = ["nw", "sg", "sw"]
 stats = [""]
 table = ["", "_table", "_rowcol", "_trace"]
 par = ["_blocked"]
-isa = ["_sse41_128_32", "_sse41_128_16"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
 for a in alg:
     for s in stats:
         for t in table:
@@ -98,6 +138,28 @@ for a in alg:
                     print " "*8+"const int open, const int gap,"
                     print " "*8+"const parasail_matrix_t* matrix);"
 
+# vectorized implementations of wavefront (3x1x2x3x2 = 36 impl)
+alg = ["nw", "sg", "sw"]
+stats = [""]
+table = ["", "_rowcol"]
+par = ["_wavefront"]
+isa = [
+    "_sse41_128_32", "_sse41_128_16",
+    "_avx2_256_32", "_avx2_256_16",
+    "_neon_128_32", "_neon_128_16",
+    ]
+for a in alg:
+    for s in stats:
+        for t in table:
+            for p in par:
+                for i in isa:
+                    print ""
+                    print "extern parasail_result_t* parasail_"+a+s+t+p+i+'('
+                    print " "*8+"const char * const restrict s1, const int s1Len,"
+                    print " "*8+"const char * const restrict s2, const int s2Len,"
+                    print " "*8+"const int open, const int gap,"
+                    print " "*8+"const parasail_matrix_t* matrix);"
+
 # dispatching implementations (3x2x3x3x4 = 216 impl)
 alg = ["nw", "sg", "sw"]
 stats = ["", "_stats"]
@@ -135,11 +197,39 @@ for a in alg:
                     print " "*8+"const char * const restrict s2, const int s2Len,"
                     print " "*8+"const int open, const int gap);"
 
+# dispatching profile workspace implementations (3x2x5 = 30 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_scan_profile", "_striped_profile"]
+width = ["_64", "_32", "_16", "_8", "_sat"]
+for a in alg:
+    for p in par:
+        for w in width:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+w+'_ws('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
+# dispatching profile encoded implementations (3x2x5 = 30 impl)
+for a in alg:
+    for p in par:
+        for w in width:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+w+'_enc('
+            print " "*8+"const parasail_profile_t * const restrict profile,"
+            print " "*8+"const parasail_encoded_t * const restrict s2,"
+            print " "*8+"const int open, const int gap,"
+            print " "*8+"parasail_workspace_t * const restrict workspace,"
+            print " "*8+"parasail_result_t * const restrict result);"
+
 # profile creation functions (2x13 = 26 impl)
 stats = ["", "_stats"]
 isa = [
     "_sse_128_64", "_sse_128_32", "_sse_128_16", "_sse_128_8", "_sse_128_sat",
     "_avx_256_64", "_avx_256_32", "_avx_256_16", "_avx_256_8", "_avx_256_sat",
+    "_avx_512_64", "_avx_512_32", "_avx_512_16", "_avx_512_8", "_avx_512_sat",
     "_altivec_128_64", "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
     "_neon_128_64", "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat",
     "_64", "_32", "_16", "_8", "_sat"
@@ -168,3 +258,48 @@ for a in alg:
                 print " "*8+"const int open, const int gap,"
                 print " "*8+"const parasail_matrix_t* matrix);"
 
+
+# inter-sequence batch implementations, serial reference, vectorized,
+# and dispatching (1x(1+6x4+4) = 29 impl, each with a profile variant)
+batch = ["", "_32", "_16", "_8", "_sat",
+    "_sse2_128_32", "_sse2_128_16", "_sse2_128_8", "_sse2_128_sat",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_avx512bw_512_32", "_avx512bw_512_16", "_avx512bw_512_8", "_avx512bw_512_sat",
+    "_altivec_128_32", "_altivec_128_16", "_altivec_128_8", "_altivec_128_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for i in batch:
+    print ""
+    print "extern parasail_result_t** parasail_sw_batch"+i+'('
+    print " "*8+"const char * const restrict s1, const int s1Len,"
+    print " "*8+"const char * const * const restrict s2s,"
+    print " "*8+"const int * const restrict s2Lens, const int count,"
+    print " "*8+"const int open, const int gap,"
+    print " "*8+"const parasail_matrix_t* matrix);"
+for i in batch:
+    print ""
+    print "extern parasail_result_t** parasail_sw_batch_profile"+i+'('
+    print " "*8+"const parasail_profile_t * const restrict profile,"
+    print " "*8+"const char * const * const restrict s2s,"
+    print " "*8+"const int * const restrict s2Lens, const int count,"
+    print " "*8+"const int open, const int gap);"
+
+# banded implementations, vectorized and dispatching
+# (3x2x(4+3x4) = 96 impl)
+alg = ["nw", "sg", "sw"]
+par = ["_banded", "_trace_banded"]
+isa = ["_32", "_16", "_8", "_sat",
+    "_sse41_128_32", "_sse41_128_16", "_sse41_128_8", "_sse41_128_sat",
+    "_avx2_256_32", "_avx2_256_16", "_avx2_256_8", "_avx2_256_sat",
+    "_neon_128_32", "_neon_128_16", "_neon_128_8", "_neon_128_sat"
+    ]
+for a in alg:
+    for p in par:
+        for i in isa:
+            print ""
+            print "extern parasail_result_t* parasail_"+a+p+i+'('
+            print " "*8+"const char * const restrict s1, const int s1Len,"
+            print " "*8+"const char * const restrict s2, const int s2Len,"
+            print " "*8+"const int open, const int gap, const int k,"
+            print " "*8+"const parasail_matrix_t* matrix);"
@@ -19,6 +19,8 @@ txt = """/**
 #include <string.h>
 
 #include "parasail.h"
+#include "parasail/cpuid.h"
+#include "parasail/memory.h"
 
 """
 for alg in ["nw", "sg", "sw"]:
@@ -26,7 +28,9 @@ for alg in ["nw", "sg", "sw"]:
         for stats in ["", "_stats"]:
             if 'stats' in stats and 'trace' in table: continue
             for par in ["_scan", "_striped", "_diag"]:
-                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_altivec_128", "_neon_128"]:
+                # striped sw promotes instead, see below
+                if alg+stats+table+par == "sw_striped": continue
+                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512bw_512", "_altivec_128", "_neon_128"]:
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
@@ -62,12 +66,51 @@ parasail_result_t* %(PREFIX)s_sat(
 %(ISA_POST)s
 """ % params
 
+for alg in ["nw", "sg", "sw"]:
+    for par in ["_banded", "_trace_banded"]:
+        for isa in ["", "_sse41_128", "_avx2_256", "_neon_128"]:
+            prefix = "parasail_%s%s%s"%(alg, par, isa)
+            if isa:
+                isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                isa_post = "#endif"
+            else:
+                isa_pre = ""
+                isa_post = ""
+            params = {"PREFIX":prefix,
+                    "ISA_PRE":isa_pre,
+                    "ISA_POST":isa_post}
+            txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+    result = %(PREFIX)s_8(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = %(PREFIX)s_16(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = %(PREFIX)s_32(s1, s1Len, s2, s2Len, open, gap, k, matrix);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
 for alg in ["nw", "sg", "sw"]:
     for table in ["", "_table", "_rowcol", "_trace"]:
         for stats in ["", "_stats"]:
             if 'stats' in stats and 'trace' in table: continue
             for par in ["_scan_profile", "_striped_profile"]:
-                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_altivec_128", "_neon_128"]:
+                if alg+stats+table+par == "sw_striped_profile": continue
+                for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512bw_512", "_altivec_128", "_neon_128"]:
                     prefix = "parasail_%s%s%s%s%s"%(alg, stats, table, par, isa)
                     if isa:
                         isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
@@ -102,6 +145,418 @@ parasail_result_t* %(PREFIX)s_sat(
 %(ISA_POST)s
 """ % params
 
+for alg in ["nw", "sg", "sw"]:
+    for par in ["_scan_profile", "_striped_profile"]:
+        if alg+par == "sw_striped_profile": continue
+        for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512bw_512", "_altivec_128", "_neon_128"]:
+            prefix = "parasail_%s%s%s"%(alg, par, isa)
+            if isa:
+                isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+                isa_post = "#endif"
+            else:
+                isa_pre = ""
+                isa_post = ""
+            params = {"PREFIX":prefix,
+                    "ISA_PRE":isa_pre,
+                    "ISA_POST":isa_post}
+            txt += """
+%(ISA_PRE)s
+parasail_result_t* %(PREFIX)s_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    %(PREFIX)s_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        %(PREFIX)s_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        %(PREFIX)s_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* %(PREFIX)s_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    %(PREFIX)s_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        %(PREFIX)s_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        %(PREFIX)s_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# Striped sw keeps the work done before saturating.  The narrow kernel
+# saves its last exact column and the wider kernel resumes after it.
+# nw and sg saturate on the gap penalties along the first row and
+# column, so there is little to keep and they recompute as above.
+txt += """
+
+typedef parasail_result_t* parasail_ppfunction_t(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result,
+        parasail_promote_t * const restrict promote);
+
+static parasail_sat_hook_t *sat_hook = NULL;
+static void *sat_hook_data = NULL;
+
+void parasail_set_sat_hook(parasail_sat_hook_t *hook, void *data)
+{
+    sat_hook = hook;
+    sat_hook_data = data;
+}
+
+/* Align using the 8, 16, then 32-bit kernels in functions, each one
+ * resuming where the previous one saturated.  Profile widths missing
+ * from profile are created using creators.  If encoded is not NULL it
+ * is aligned instead of s2. */
+static parasail_result_t* sat_promote(
+        parasail_ppfunction_t * const * functions,
+        parasail_pcreator_t * const * creators,
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    static const int bits[3] = {8, 16, 32};
+    const void *scores[3] = {
+        profile->profile8.score,
+        profile->profile16.score,
+        profile->profile32.score};
+    parasail_promote_t promote = {-1, 0, NULL, NULL};
+    int k = 0;
+
+    for (k=0; k<3; ++k) {
+        parasail_profile_t *created = NULL;
+        if (k > 0 && NULL != sat_hook && promote.column >= 0) {
+            sat_hook(bits[k-1], bits[k],
+                    (long long)(promote.column+1)*profile->s1Len,
+                    sat_hook_data);
+        }
+        if (NULL == scores[k]) {
+            created = creators[k](profile->s1, profile->s1Len, profile->matrix);
+        }
+        functions[k](created ? created : profile,
+                s2, s2Len, encoded, open, gap, workspace, result, &promote);
+        if (NULL != created) {
+            parasail_profile_free(created);
+        }
+        if (!parasail_result_is_saturated(result)) {
+            break;
+        }
+    }
+
+    free(promote.E);
+    free(promote.H);
+
+    return result;
+}
+"""
+
+for isa, pre in [("_sse2_128", "sse_128"), ("_sse41_128", "sse_128"),
+        ("_avx2_256", "avx_256"), ("_avx512bw_512", "avx_512"),
+        ("_altivec_128", "altivec_128"), ("_neon_128", "neon_128")]:
+    params = {"PREFIX":"parasail_sw_striped"+isa,
+            "PPREFIX":"parasail_sw_striped_profile"+isa,
+            "NAME":"sw_striped"+isa,
+            "CREATOR":"parasail_profile_create_"+pre,
+            "ISA_PRE":"#if HAVE_" + isa.split('_')[1].upper(),
+            "ISA_POST":"#endif"}
+    txt += """
+%(ISA_PRE)s
+extern parasail_ppfunction_t %(PPREFIX)s_8_promote;
+extern parasail_ppfunction_t %(PPREFIX)s_16_promote;
+extern parasail_ppfunction_t %(PPREFIX)s_32_promote;
+
+static parasail_ppfunction_t * const %(NAME)s_promote[3] = {
+    %(PPREFIX)s_8_promote,
+    %(PPREFIX)s_16_promote,
+    %(PPREFIX)s_32_promote};
+
+static parasail_pcreator_t * const %(NAME)s_creators[3] = {
+    %(CREATOR)s_8,
+    %(CREATOR)s_16,
+    %(CREATOR)s_32};
+
+parasail_result_t* %(PPREFIX)s_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(%(NAME)s_promote, %(NAME)s_creators,
+            profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* %(PPREFIX)s_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return sat_promote(%(NAME)s_promote, %(NAME)s_creators,
+            profile, NULL, s2->length, s2, open, gap, workspace, result);
+}
+
+parasail_result_t* %(PPREFIX)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    sat_promote(%(NAME)s_promote, %(NAME)s_creators,
+            profile, s2, s2Len, NULL, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = %(CREATOR)s_8(s1, s1Len, matrix);
+    parasail_result_t *result = %(PPREFIX)s_sat(
+            profile, s2, s2Len, open, gap);
+    parasail_profile_free(profile);
+    return result;
+}
+%(ISA_POST)s
+""" % params
+
+# the dispatching versions pick the same instruction set as the
+# dispatching profile creators and fall back to recomputing
+chain = ""
+for isa in ["_avx512bw_512", "_avx2_256", "_sse41_128", "_sse2_128", "_altivec_128", "_neon_128"]:
+    chain += """#if HAVE_%(ISA)s
+    if (parasail_can_use_%(LOWER)s()) {
+        return %%(PREFIX)s%(SUFFIX)s_%%(SAT)s(%%(ARGS)s);
+    }
+#endif
+""" % {"ISA":isa.split('_')[1].upper(), "LOWER":isa.split('_')[1],
+        "SUFFIX":isa}
+
+txt += """
+parasail_result_t* parasail_sw_striped_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_result_t * result = NULL;
+
+""" + chain % {"PREFIX":"parasail_sw_striped",
+        "SAT":"sat",
+        "ARGS":"s1, s1Len, s2, s2Len, open, gap, matrix"} + """
+    result = parasail_sw_striped_8(s1, s1Len, s2, s2Len, open, gap, matrix);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_16(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_32(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+{
+    parasail_result_t * result = NULL;
+
+""" + chain % {"PREFIX":"parasail_sw_striped_profile",
+        "SAT":"sat",
+        "ARGS":"profile, s2, s2Len, open, gap"} + """
+    result = parasail_sw_striped_profile_8(profile, s2, s2Len, open, gap);
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_16(profile, s2, s2Len, open, gap);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_result_free(result);
+        result = parasail_sw_striped_profile_32(profile, s2, s2Len, open, gap);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat_ws(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+""" + chain % {"PREFIX":"parasail_sw_striped_profile",
+        "SAT":"sat_ws",
+        "ARGS":"profile, s2, s2Len, open, gap, workspace, result"} + """
+    parasail_sw_striped_profile_8_ws(profile, s2, s2Len, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_16_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_32_ws(profile, s2, s2Len, open, gap, workspace, result);
+    }
+
+    return result;
+}
+
+parasail_result_t* parasail_sw_striped_profile_sat_enc(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+""" + chain % {"PREFIX":"parasail_sw_striped_profile",
+        "SAT":"sat_enc",
+        "ARGS":"profile, s2, open, gap, workspace, result"} + """
+    parasail_sw_striped_profile_8_enc(profile, s2, open, gap, workspace, result);
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_16_enc(profile, s2, open, gap, workspace, result);
+    }
+    if (parasail_result_is_saturated(result)) {
+        parasail_sw_striped_profile_32_enc(profile, s2, open, gap, workspace, result);
+    }
+
+    return result;
+}
+"""
+
+# inter-sequence batch functions recompute only the saturated sequences
+txt += """
+
+/* Replace the saturated results of a batch with results recomputed by
+ * function, which should use a wider element. */
+static void batch_resat(
+        parasail_bpfunction_t *function,
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        parasail_result_t **results)
+{
+    int i = 0;
+    int n = 0;
+    const char **sub_s2s = NULL;
+    int *sub_s2Lens = NULL;
+    int *index = NULL;
+    parasail_result_t **sub_results = NULL;
+
+    if (NULL == results) {
+        return;
+    }
+
+    for (i=0; i<count; ++i) {
+        if (parasail_result_is_saturated(results[i])) {
+            ++n;
+        }
+    }
+    if (0 == n) {
+        return;
+    }
+
+    sub_s2s = (const char **)malloc(sizeof(const char *)*n);
+    sub_s2Lens = (int *)malloc(sizeof(int)*n);
+    index = (int *)malloc(sizeof(int)*n);
+    n = 0;
+    for (i=0; i<count; ++i) {
+        if (parasail_result_is_saturated(results[i])) {
+            sub_s2s[n] = s2s[i];
+            sub_s2Lens[n] = s2Lens[i];
+            index[n] = i;
+            ++n;
+        }
+    }
+
+    sub_results = function(profile, sub_s2s, sub_s2Lens, n, open, gap);
+    for (i=0; i<n; ++i) {
+        parasail_result_free(results[index[i]]);
+        results[index[i]] = sub_results[i];
+    }
+
+    free(sub_results);
+    free(index);
+    free(sub_s2Lens);
+    free(sub_s2s);
+}
+"""
+
+for isa in ["", "_sse2_128", "_sse41_128", "_avx2_256", "_avx512bw_512", "_altivec_128", "_neon_128"]:
+    prefix = "parasail_sw_batch"
+    pprefix = "parasail_sw_batch_profile"
+    if isa:
+        isa_pre = "#if HAVE_" + isa.split('_')[1].upper()
+        isa_post = "#endif"
+    else:
+        isa_pre = ""
+        isa_post = ""
+    params = {"PREFIX":prefix+isa,
+            "PPREFIX":pprefix+isa,
+            "ISA_PRE":isa_pre,
+            "ISA_POST":isa_post}
+    txt += """
+%(ISA_PRE)s
+parasail_result_t** %(PPREFIX)s_sat(
+        const parasail_profile_t * const restrict profile,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap)
+{
+    parasail_result_t ** results = NULL;
+
+    results = %(PPREFIX)s_8(profile, s2s, s2Lens, count, open, gap);
+    batch_resat(%(PPREFIX)s_16,
+            profile, s2s, s2Lens, count, open, gap, results);
+    batch_resat(%(PPREFIX)s_32,
+            profile, s2s, s2Lens, count, open, gap, results);
+
+    return results;
+}
+
+parasail_result_t** %(PREFIX)s_sat(
+        const char * const restrict s1, const int s1Len,
+        const char * const * const restrict s2s,
+        const int * const restrict s2Lens, const int count,
+        const int open, const int gap,
+        const parasail_matrix_t *matrix)
+{
+    parasail_profile_t *profile = parasail_profile_new(s1, s1Len, matrix);
+    parasail_result_t **results = %(PPREFIX)s_sat(
+            profile, s2s, s2Lens, count, open, gap);
+    parasail_profile_free(profile);
+    return results;
+}
+%(ISA_POST)s
+""" % params
+
 
 output_dir = "generated/"
 if not os.path.exists(output_dir):
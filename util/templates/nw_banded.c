@@ -0,0 +1,189 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+%(FIXES)s
+
+#define FNAME %(NAME)s
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s PAD = N-1;
+    const %(INDEX)s PAD2 = PAD*2;
+    const %(INDEX)s s1Len_PAD = s1Len+PAD;
+    const %(INDEX)s s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const %(INDEX)s lo = MIN(0, s2Len-s1Len) - k;
+    const %(INDEX)s hi = MAX(0, s2Len-s1Len) + k;
+    %(INT)s * const restrict s1 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s1Len+PAD);
+    %(INT)s * const restrict s2B= parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _H_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _F_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    %(INT)s * const restrict H_pr = _H_pr+PAD;
+    %(INT)s * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new();
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vOpen = %(VSET1)s(open);
+    %(VTYPE)s vGap  = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET1)s(0);
+    %(VTYPE)s vK = %(VSET)s(%(DIAG_I)s);
+    %(VTYPE)s v2K = %(VADD)s(vK, vK);
+    %(SATURATION_CHECK_INIT)s
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? MAX(-open - j*gap, NEG_INF) : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const %(INDEX)s jbeg = MAX(0, i+lo);
+        const %(INDEX)s jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const %(INDEX)s kLast = s1Len-1-i;
+        %(VTYPE)s vNH = vNegInf;
+        %(VTYPE)s vWH = vNegInf;
+        %(VTYPE)s vE = vNegInf;
+        %(VTYPE)s vF = vNegInf;
+        %(VTYPE)s vRowOut = %(VCMPGT)s(vK, %(VSET1)s(CLAMP(kLast)));
+        %(DIAG_MATROW_DECL)s
+        vNH = %(VINSERT)s(vNH, H_pr[jbeg-1], %(LAST_POS)s);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = %(VINSERT)s(vWH, MAX(-open - i*gap, NEG_INF), %(LAST_POS)s);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            %(VTYPE)s vMat;
+            %(VTYPE)s vNWH = vNH;
+            %(VTYPE)s vOut = vZero;
+            vNH = %(VRSHIFT)s(vWH, %(BYTES)s);
+            vNH = %(VINSERT)s(vNH, H_pr[j], %(LAST_POS)s);
+            vF = %(VRSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, F_pr[j], %(LAST_POS)s);
+            vF = %(VMAX)s(
+                    %(VSUB)s(vNH, vOpen),
+                    %(VSUB)s(vF, vGap));
+            vE = %(VMAX)s(
+                    %(VSUB)s(vWH, vOpen),
+                    %(VSUB)s(vE, vGap));
+            vMat = %(VSET)s(
+                    %(DIAG_MATROW_USE)s
+                    );
+            vNWH = %(VADD)s(vNWH, vMat);
+            vWH = %(VMAX)s(vNWH, vE);
+            vWH = %(VMAX)s(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                %(VTYPE)s cond = %(VCMPEQ)s(vK, %(VSET1)s(CLAMP(j+1)));
+                %(VTYPE)s condEF;
+                vOut = %(VOR)s(
+                        %(VOR)s(
+                            %(VCMPGT)s(v2K, %(VSET1)s(CLAMP(j-i-lo))),
+                            %(VCMPLT)s(v2K, %(VSET1)s(CLAMP(j-i-hi)))),
+                        %(VOR)s(
+                            %(VOR)s(
+                                %(VCMPLT)s(vK, %(VSET1)s(CLAMP(j-s2Len+1))),
+                                %(VCMPGT)s(vK, %(VSET1)s(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = %(VOR)s(cond, vOut);
+                vWH = %(VBLEND)s(vWH, %(VSET1)s(MAX(-open - (i+j+1)*gap, NEG_INF)), cond);
+                vWH = %(VBLEND)s(vWH, vNegInf, vOut);
+                vE = %(VBLEND)s(vE, vNegInf, condEF);
+                vF = %(VBLEND)s(vF, vNegInf, condEF);
+            }
+            %(SATURATION_CHECK_MID)s
+            H_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vWH,0);
+            F_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vF,0);
+            /* the last cell of the table is in the last stripe */
+            if (kLast <= PAD && j == s2Len-1+kLast) {
+                %(INT)s lanes[%(LANES)s];
+                memcpy(lanes, &vWH, sizeof(lanes));
+                score = lanes[PAD-kLast];
+            }
+        }
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
@@ -0,0 +1,444 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+%(FIXES)s
+
+#ifdef PARASAIL_TABLE
+static inline void arr_store(
+        int *array,
+        %(VTYPE)s vH,
+        %(INDEX)s r,
+        %(INDEX)s s1Len,
+        %(INDEX)s j,
+        %(INDEX)s s2Len)
+{
+    %(INT)s values[%(LANES)s];
+    %(INDEX)s lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<%(LANES)s && r+lane<s1Len; ++lane) {
+        array[1LL*(r+lane)*s2Len + j] = values[lane];
+    }
+}
+#endif
+
+#ifdef PARASAIL_ROWCOL
+static inline void arr_store_col(
+        int *col,
+        %(VTYPE)s vH,
+        %(INDEX)s r,
+        %(INDEX)s s1Len)
+{
+    %(INT)s values[%(LANES)s];
+    %(INDEX)s lane = 0;
+    memcpy(values, &vH, sizeof(values));
+    for (lane=0; lane<%(LANES)s && r+lane<s1Len; ++lane) {
+        col[r+lane] = values[lane];
+    }
+}
+#endif
+
+/* a block of query rows, lane k of vector v holds row r0+v*N+k; its H
+ * and E columns and the corner above them carry the block from one
+ * tile of database columns to the next */
+typedef struct block {
+    %(VTYPE)s *vProfile;
+    %(VTYPE)s *pvH;
+    %(VTYPE)s *pvE;
+    %(INDEX)s r0;
+    %(INDEX)s V;
+    %(INT)s H_corner;
+    int score;%(BLOCKED_SAT_FIELDS)s
+} block_t;
+
+static void block_init(
+        block_t * const restrict blk,
+        const %(INT)s * const restrict s1,
+        const int s1Len,
+        const %(INDEX)s r0, const %(INDEX)s V,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s n = matrix->size; /* number of residues in matrix */
+    %(INDEX)s i = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s v = 0;
+
+    blk->r0 = r0;
+    blk->V = V;
+    blk->H_corner = 0 == r0 ? 0 : MAX(-open-(int64_t)gap*(r0-1), NEG_INF);
+    blk->score = NEG_INF;%(BLOCKED_SAT_RESET)s
+
+    /* block profile, padded rows score 0 */
+    for (k=0; k<n; ++k) {
+        for (v=0; v<V; ++v) {
+            %(INT)s t[%(LANES)s];
+            for (i=0; i<N; ++i) {
+                const %(INDEX)s r = r0+v*N+i;
+                t[i] = r >= s1Len ? 0 : matrix->matrix[n*k+s1[r]];
+            }
+            memcpy(&blk->vProfile[k*V+v], t, sizeof(t));
+        }
+    }
+
+    /* the column left of the block */
+    for (v=0; v<V; ++v) {
+        %(INT)s h[%(LANES)s];
+        %(INT)s e[%(LANES)s];
+        for (i=0; i<N; ++i) {
+            int64_t tmp = -open-(int64_t)gap*(r0+v*N+i);
+            h[i] = tmp < NEG_INF ? NEG_INF : tmp;
+            tmp = tmp - open;
+            e[i] = tmp < NEG_INF ? NEG_INF : tmp;
+        }
+        memcpy(&blk->pvH[v], h, sizeof(h));
+        memcpy(&blk->pvE[v], e, sizeof(e));
+    }
+}
+
+/* database columns [j0,j1) of a block, Hrow and Frow hold the last row
+ * of the block above on entry and the last row of this block on exit */
+static void block_tile(
+        block_t * const restrict blk,
+        const %(INT)s * const restrict s2,
+        const %(INDEX)s j0, const %(INDEX)s j1,
+        %(INT)s * const restrict Hrow,
+        %(INT)s * const restrict Frow,
+        const int s1Len, const int s2Len,
+        const int open, const int gap,
+        parasail_result_t * const restrict result)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s r0 = blk->r0;
+    const %(INDEX)s V = blk->V;
+    const %(VTYPE)s * const restrict vProfile = blk->vProfile;
+    %(VTYPE)s * const restrict pvH = blk->pvH;
+    %(VTYPE)s * const restrict pvE = blk->pvE;
+    %(INDEX)s j = 0;
+    %(INDEX)s v = 0;
+    %(INT)s H_corner = blk->H_corner;
+    int score = blk->score;
+    %(VTYPE)s vOpen = %(VSET1)s(open);
+    %(VTYPE)s vGap  = %(VSET1)s(gap);
+    %(BLOCKED_FSCAN_DECL)s
+    %(SATURATION_CHECK_INIT)s
+
+    for (j=j0; j<j1; ++j) {
+        const %(VTYPE)s *pvP = vProfile + s2[j]*V;
+        const %(INT)s H_next = Hrow[j];
+        %(INT)s cD = H_corner;
+        %(INT)s cF = Frow[j];
+        %(VTYPE)s vH = %(VSET0)s();
+        for (v=0; v<V; ++v) {
+            %(VTYPE)s vHp = %(VLOAD)s(pvH+v);
+            %(VTYPE)s vE = %(VLOAD)s(pvE+v);
+            %(VTYPE)s vHo;
+            %(VTYPE)s vF;
+            /* lane k takes its diagonal from lane k-1, lane 0 from
+             * the last lane of the previous vector */
+            vH = %(VINSERT)s(%(VSHIFT)s(vHp, %(BYTES)s), cD, 0);
+            cD = (%(INT)s)%(VEXTRACT)s(vHp, %(LAST_POS)s);
+            vH = %(VADD)s(vH, %(VLOAD)s(pvP+v));
+            vH = %(VMAX)s(vH, vE);
+            /* F opens from the row above and extends down the
+             * lanes, resolved exactly by a prefix scan */
+            vHo = %(VSUB)s(vH, vOpen);
+            vF = %(VINSERT)s(%(VSHIFT)s(vHo, %(BYTES)s), cF, 0);
+            %(BLOCKED_FSCAN)s
+            vH = %(VMAX)s(vH, vF);
+            vHo = %(VSUB)s(vH, vOpen);
+            cF = (%(INT)s)%(VEXTRACT)s(
+                    %(VMAX)s(vHo, %(VSUB)s(vF, vGap)), %(LAST_POS)s);
+            %(SATURATION_CHECK_MID)s
+            %(VSTORE)s(pvH+v, vH);
+            %(VSTORE)s(pvE+v, %(VMAX)s(vHo, %(VSUB)s(vE, vGap)));
+#ifdef PARASAIL_TABLE
+            arr_store(result->tables->score_table, vH, r0+v*N, s1Len, j, s2Len);
+#endif
+        }
+        /* the last lane of the last vector is the row above the
+         * next block */
+        Hrow[j] = (%(INT)s)%(VEXTRACT)s(vH, %(LAST_POS)s);
+        Frow[j] = cF;
+        H_corner = H_next;
+#ifdef PARASAIL_ROWCOL
+        /* the last row of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            %(INT)s values[%(LANES)s];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            result->rowcols->score_row[j] = values[(s1Len-1)%%N];
+        }
+#endif
+    }
+    if (j1 == s2Len) {
+        /* the last cell of the table is in the last block */
+        if (r0+V*N >= s1Len) {
+            %(INT)s values[%(LANES)s];
+            memcpy(values, &pvH[V-1], sizeof(values));
+            score = values[(s1Len-1)%%N];
+        }
+#ifdef PARASAIL_ROWCOL
+        for (v=0; v<V; ++v) {
+            arr_store_col(result->rowcols->score_col, pvH[v], r0+v*N, s1Len);
+        }
+#endif
+    }
+
+    blk->H_corner = H_corner;
+    blk->score = score;%(BLOCKED_SAT_SAVE)s
+}
+
+#ifdef PARASAIL_TABLE
+#define FNAME %(NAME_TABLE)s
+#else
+#ifdef PARASAIL_ROWCOL
+#define FNAME %(NAME_ROWCOL)s
+#define WNAME %(NAME_ROWCOL_WAVEFRONT)s
+#else
+#define FNAME %(NAME)s
+#define WNAME %(NAME_WAVEFRONT)s
+#endif
+#endif
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s n = matrix->size; /* number of residues in matrix */
+    const %(INDEX)s segLen = (s1Len + N - 1) / N;
+    /* each block of query rows keeps its profile and its H and E
+     * columns within the cache budget */
+    const %(INDEX)s blockLen = MIN(segLen,
+            MAX(1, PARASAIL_BLOCKED_CACHE / (%(INDEX)s)((n+2)*sizeof(%(VTYPE)s))));
+    %(INT)s * const restrict s1 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s1Len);
+    %(INT)s * const restrict s2 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    %(INT)s * const restrict Hrow = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    %(INT)s * const restrict Frow = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    block_t block;
+    block_t * const restrict blk = &block;
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s r0 = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    int score = NEG_INF;
+    %(BLOCKED_SAT_DECL)s
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(s1Len, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    blk->vProfile = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*n*blockLen);
+    blk->pvH = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*blockLen);
+    blk->pvE = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*blockLen);
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+    /* iterate over blocks of query rows, each over the whole database
+     * sequence */
+    for (r0=0; r0<s1Len; r0+=blockLen*N) {
+        block_init(blk, s1, s1Len, r0, MIN(blockLen, segLen - r0/N),
+                open, gap, matrix);
+        block_tile(blk, s2, 0, s2Len, Hrow, Frow, s1Len, s2Len,
+                open, gap, result);
+        /* the last block leaves the last cell of the table */
+        score = blk->score;%(BLOCKED_SAT_MERGE)s
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blk->pvE);
+    parasail_free(blk->pvH);
+    parasail_free(blk->vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+
+#ifdef WNAME
+parasail_result_t* WNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s n = matrix->size; /* number of residues in matrix */
+    const %(INDEX)s segLen = (s1Len + N - 1) / N;
+#ifdef _OPENMP
+    /* called from within a parallel region the wavefront runs on the
+     * calling thread alone */
+    const %(INDEX)s threads = omp_in_parallel() ? 1 : omp_get_max_threads();
+#else
+    const %(INDEX)s threads = 1;
+#endif
+    /* at least one block of query rows per thread, none larger than
+     * the cache budget */
+    const %(INDEX)s blockLen = MIN(MIN(segLen, (segLen + threads - 1) / threads),
+            MAX(1, PARASAIL_BLOCKED_CACHE / (%(INDEX)s)((n+2)*sizeof(%(VTYPE)s))));
+    const %(INDEX)s nblocks = (segLen + blockLen - 1) / blockLen;
+    /* a few tiles of database columns per thread keep the wavefront
+     * full without paying a barrier for every few columns */
+    const %(INDEX)s tileLen = MAX(PARASAIL_WAVEFRONT_TILE,
+            (s2Len + 4*threads - 1) / (4*threads));
+    const %(INDEX)s ntiles = (s2Len + tileLen - 1) / tileLen;
+    %(INT)s * const restrict s1 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s1Len);
+    %(INT)s * const restrict s2 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    %(INT)s * const restrict Hrow = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    %(INT)s * const restrict Frow = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len);
+    %(VTYPE)s * const restrict vProfile = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*n*blockLen*nblocks);
+    %(VTYPE)s * const restrict pvH = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*blockLen*nblocks);
+    %(VTYPE)s * const restrict pvE = parasail_memalign(%(ALIGNMENT)s, sizeof(%(VTYPE)s)*blockLen*nblocks);
+    block_t * const restrict blocks = parasail_memalign(%(ALIGNMENT)s, sizeof(block_t)*nblocks);
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s b = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    int score = NEG_INF;
+    %(BLOCKED_SAT_DECL)s
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(s1Len, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+
+    /* convert _s1 and _s2 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+
+    /* the row above the first block */
+    for (j=0; j<s2Len; ++j) {
+        int64_t tmp = -open-(int64_t)gap*j;
+        Hrow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+        tmp = tmp - open;
+        Frow[j] = tmp < NEG_INF ? NEG_INF : tmp;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+    {
+        %(INDEX)s d = 0;
+        %(INDEX)s t = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (t=0; t<nblocks; ++t) {
+            blocks[t].vProfile = vProfile + n*blockLen*t;
+            blocks[t].pvH = pvH + blockLen*t;
+            blocks[t].pvE = pvE + blockLen*t;
+            block_init(&blocks[t], s1, s1Len, t*blockLen*N,
+                    MIN(blockLen, segLen - t*blockLen), open, gap, matrix);
+        }
+
+        /* tile (t,c) needs (t-1,c) for the row above it and (t,c-1)
+         * for the columns left of it, so the tiles of an anti-diagonal
+         * run together and the barrier closing each one orders them */
+        for (d=0; d<nblocks+ntiles-1; ++d) {
+            const %(INDEX)s first = MAX(0, d-ntiles+1);
+            const %(INDEX)s last = MIN(d, nblocks-1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+            for (t=first; t<=last; ++t) {
+                const %(INDEX)s j0 = (d-t)*tileLen;
+                block_tile(&blocks[t], s2, j0, MIN(j0+tileLen, s2Len),
+                        Hrow, Frow, s1Len, s2Len, open, gap, result);
+            }
+        }
+    }
+
+    for (b=0; b<nblocks; ++b) {
+        const block_t * const restrict blk = &blocks[b];
+        /* the last cell of the table is in the last block */
+        if (b == nblocks-1) {
+            score = blk->score;
+        }%(BLOCKED_SAT_MERGE)s
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_BLOCKED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(blocks);
+    parasail_free(pvE);
+    parasail_free(pvH);
+    parasail_free(vProfile);
+    parasail_free(Frow);
+    parasail_free(Hrow);
+    parasail_free(s2);
+    parasail_free(s1);
+
+    return result;
+}
+#endif
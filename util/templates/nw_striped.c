@@ -53,24 +53,530 @@ static inline void arr_store_col(
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME_WS)s
+#define ENAME %(PNAME_ENC)s
+#define CNAME %(PNAME)s_core
 #endif
 #endif
 
+/* Match and mismatch scores need no query profile: the codes of the
+ * query residues, striped like the profile, are compared to the code of
+ * each database residue and the compare selects the score. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+    const %(INDEX)s tail = (s1Len - 1) %% segLen + 1;
+    %(VTYPE)s* const restrict pvQuery = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen+4);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vMatch;
+    %(VTYPE)s vMismatch;
+    %(VTYPE)s vMatchHead;
+    %(VTYPE)s vMismatchHead;
+    %(VTYPE)s vMatchTail;
+    %(VTYPE)s vMismatchTail;
+    %(INT)s score = NEG_INF;
+    %(SATURATION_CHECK_INIT)s
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        %(INT)s *q = (%(INT)s*)pvQuery;
+        %(INT)s *lane = (%(INT)s*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (%(INT)s)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = %(VLOAD)s(pvQuery + segLen);
+        vMismatchHead = %(VLOAD)s(pvQuery + segLen + 1);
+        vMatchTail = %(VLOAD)s(pvQuery + segLen + 2);
+        vMismatchTail = %(VLOAD)s(pvQuery + segLen + 3);
+    }
+
+%(INIT_H_AND_E)s
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        %(VTYPE)s vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
+
+        /* code of the database residue in every lane */
+        const %(VTYPE)s vCode = %(VSET1)s(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        %(VTYPE)s* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = %(VINSERT)s(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = %(VADD)s(vH, %(VBLEND)s(vMismatch, vMatch,
+                        %(VCMPEQ)s(%(VLOAD)s(pvQuery + i), vCode)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+            %(SATURATION_CHECK_MID)s
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            %(INT)s tmp2 = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+                %(SATURATION_CHECK_MID)s
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = %(VLOAD)s(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = %(VSHIFT)s (vH, %(BYTES)s);
+        }
+        score = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+#if LOOKUP
+/* Long queries make the profile too big for the cache; this variant keeps
+ * two 16-byte score tables per residue and the striped query codes as
+ * shuffle indexes, and looks each score up in the tables of the database
+ * residue. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = s1Len-1;
+    %(INDEX)s end_ref = s2Len-1;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+    %(VTYPE)s* const restrict pvTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*matrix->size);
+    %(VTYPE)s* const restrict pvIndex = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*segLen);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(INT)s score = NEG_INF;
+    %(SATURATION_CHECK_INIT)s
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<%(ALIGNMENT)s; ++i) {
+                %(INDEX)s lo = i %% 16;
+                %(INDEX)s hi = lo + 16;
+                table[2*k*%(ALIGNMENT)s + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*%(ALIGNMENT)s + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*%(ALIGNMENT)s; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                %(INDEX)s byte = (k+1)*%(BYTES)s - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*%(ALIGNMENT)s + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*%(ALIGNMENT)s + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+%(INIT_H_AND_E)s
+
+    /* initialize uppder boundary */
+    {
+        boundary[0] = 0;
+        for (i=1; i<=s2Len; ++i) {
+            int64_t tmp = -open-gap*(i-1);
+            boundary[i] = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+        }
+    }
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        %(VTYPE)s vF = vNegInf;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
+
+        /* score tables of the database residue */
+        const %(VTYPE)s* vTable = pvTable + 2*matrix->mapper[(unsigned char)s2[j]];
+        const %(VTYPE)s vTableLo = %(VLOAD)s(vTable);
+        const %(VTYPE)s vTableHi = %(VLOAD)s(vTable + 1);
+
+        /* Swap the 2 H buffers. */
+        %(VTYPE)s* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* insert upper boundary condition */
+        vH = %(VINSERT)s(vH, boundary[j], 0);
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VADD)s(vH, %(VLOOKUP)s(vTableLo, vTableHi,
+                        %(VLOAD)s(pvIndex + 2*i), %(VLOAD)s(pvIndex + 2*i + 1)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+            %(SATURATION_CHECK_MID)s
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            int64_t tmp = boundary[j+1]-open;
+            %(INT)s tmp2 = tmp < INT%(WIDTH)s_MIN ? INT%(WIDTH)s_MIN : tmp;
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, tmp2, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+                %(SATURATION_CHECK_MID)s
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = %(VLOAD)s(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+        }
+#endif
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    /* extract last value from the last column */
+    {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore + offset);
+        for (k=0; k<position; ++k) {
+            vH = %(VSHIFT)s (vH, %(BYTES)s);
+        }
+        score = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_NW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(boundary);
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+#endif /* LOOKUP */
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+#if LOOKUP
+    if (parasail_lookup_scores(matrix, sizeof(%(VTYPE)s)*matrix->size
+                *((s1Len + %(LANES)s - 1) / %(LANES)s))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif /* LOOKUP */
+
+    profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -84,10 +590,19 @@ parasail_result_t* PNAME(
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+#ifdef WNAME
+    %(VTYPE)s* const pvWork = (%(VTYPE)s*)parasail_workspace_reserve(
+            workspace, sizeof(%(VTYPE)s)*3*segLen + sizeof(%(INT)s)*(s2Len+1));
+    %(VTYPE)s* restrict pvHStore = pvWork;
+    %(VTYPE)s* restrict pvHLoad = pvWork + segLen;
+    %(VTYPE)s* const restrict pvE = pvWork + 2*segLen;
+    %(INT)s* const restrict boundary = (%(INT)s*)(pvWork + 3*segLen);
+#else
     %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
+#endif
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
@@ -98,10 +613,12 @@ parasail_result_t* PNAME(
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
 #endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
+#endif
 
 %(INIT_H_AND_E)s
 
@@ -125,7 +642,13 @@ parasail_result_t* PNAME(
         %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const %(VTYPE)s* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const %(VTYPE)s* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         %(VTYPE)s* pv = pvHLoad;
@@ -231,10 +754,12 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(boundary);
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -18,23 +19,15 @@
 
 %(FIXES)s
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        %(VTYPE)s *array,
+        int8_t *array,
         %(VTYPE)s vH,
         %(INDEX)s t,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    %(VSTORE)s(array + (1LL*d*seglen+t), vH);
-}
-
-static inline %(VTYPE)s arr_load(
-        %(VTYPE)s *array,
-        %(INDEX)s t,
-        %(INDEX)s seglen,
-        %(INDEX)s d)
-{
-    return %(VLOAD)s(array + (1LL*d*seglen+t));
+    %(VSTORE_TRACE)s(array + (1LL*d*seglen+t)*%(LANES)s, vH);
 }
 
 #define FNAME %(NAME_TRACE)s
@@ -69,6 +62,7 @@ parasail_result_t* PNAME(
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict pvP  = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
     %(VTYPE)s* const restrict pvE  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvET = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(INT)s* const restrict boundary = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+1);
     %(VTYPE)s* const restrict pvHt = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvH  = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
@@ -86,7 +80,7 @@ parasail_result_t* PNAME(
     %(VTYPE)s vSaturationCheckMax = vNegLimit;
     %(VTYPE)s vNegInfFront = vZero;
     %(VTYPE)s vSegLenXgap;
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, %(ALIGNMENT)s, sizeof(int8_t));
     %(VTYPE)s vTIns  = %(VSET1)s(PARASAIL_INS);
     %(VTYPE)s vTDel  = %(VSET1)s(PARASAIL_DEL);
     %(VTYPE)s vTDiag = %(VSET1)s(PARASAIL_DIAG);
@@ -156,7 +150,7 @@ parasail_result_t* PNAME(
             vE_ext = %(VSUB)s(vE, vGapE);
             case1 = %(VCMPGT)s(vE_opn, vE_ext);
             vET = %(VBLEND)s(vTInsE, vTDiagE, case1);
-            arr_store(result->trace->trace_table, vET, i, segLen, j);
+            %(VSTORE)s(pvET+i, vET);
             vE = %(VMAX)s(vE_opn, vE_ext);
             vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vE);
             vGapper = %(VADD)s(vHt, vGapper);
@@ -186,7 +180,7 @@ parasail_result_t* PNAME(
         vF = %(VADD)s(vF, vNegInfFront);
         vH = %(VMAX)s(vF, vHt);
         for (i=0; i<segLen; ++i) {
-            vET = arr_load(result->trace->trace_table, i, segLen, j);
+            vET = %(VLOAD)s(pvET+i);
             vHp = %(VLOAD)s(pvH+i);
             vHt = %(VLOAD)s(pvHt+i);
             vF_opn = %(VSUB)s(vH, vGapO);
@@ -239,6 +233,7 @@ parasail_result_t* PNAME(
     parasail_free(pvH);
     parasail_free(pvHt);
     parasail_free(boundary);
+    parasail_free(pvET);
     parasail_free(pvE);
 
     return result;
@@ -94,6 +94,9 @@ STATIC parasail_result_t* PNAME(
     %(INDEX)s end_ref = 0;
     const int s1Len = profile->s1Len;
     const parasail_matrix_t *matrix = profile->matrix;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
     const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
     const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
@@ -393,6 +396,39 @@ end:
         result->stats->rowcols->similar_row[j] = (%(INT)s) %(VEXTRACT)s (vHS, %(LAST_POS)s);
         result->stats->rowcols->length_row[j] = (%(INT)s) %(VEXTRACT)s (vHL, %(LAST_POS)s);
 #endif
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        if (INT32_MIN != min_score && gain < min_score) {
+            /* the lanes past the end of the query are padding */
+            const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+            const %(INDEX)s last_seg = (s1Len - 1) %% segLen;
+            const %(VTYPE)s vPadLo = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - 1 - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            const %(VTYPE)s vPadHi = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            %(VTYPE)s vColMax = vNegLimit;
+            %(INT)s col_score;
+            %(INT)s row_score;
+            for (i=0; i<segLen; ++i) {
+                %(VTYPE)s vC = %(VLOAD)s(pvHStore + i);
+                vC = %(VBLEND)s(vC, vNegLimit, i > last_seg ? vPadHi : vPadLo);
+                vColMax = %(VMAX)s(vColMax, vC);
+            }
+            col_score = %(VHMAX)s(vColMax);
+            /* the last row so far is the position lane of vMaxH */
+            row_score = %(VHMAX)s(%(VBLEND)s(vNegLimit, vMaxH, vPosMask));
+            if (row_score < min_score
+                    && (col_score > 0 ? col_score : 0) + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+                result->stop_ref = j;
+                break;
+            }
+        }
     }
 
     {
@@ -409,8 +445,9 @@ end:
         length = (%(INT)s)%(VEXTRACT)s(vMaxHL, %(LAST_POS)s);
     }
 
-    /* max of last column */
-    if (INT32_MAX == profile->stop || 0 == profile->stop)
+    /* max of last column, unless the pair was pruned before it */
+    if ((INT32_MAX == profile->stop || 0 == profile->stop)
+            && !(result->flag & PARASAIL_FLAG_PRUNED))
     {
         %(INT)s score_last;
         vMaxH = vNegLimit;
@@ -468,8 +505,11 @@ end:
         }
     }
 
+    /* vF starts each column at NEG_LIMIT, so a score that falls below
+     * the limit is clamped to it rather than going under; reaching the
+     * limit therefore counts as saturating too. */
     if (%(VMOVEMASK)s(%(VOR)s(
-            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPEQ)s(%(VMIN)s(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
             %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
         result->flag |= PARASAIL_FLAG_SATURATED;
         score = 0;
@@ -528,7 +568,8 @@ parasail_result_t* INAME(
 
     /* find the end loc first with the faster implementation */
     parasail_result_t *result = %(PNAME_BASE)s(profile, s2, s2Len, open, gap);
-    if (!parasail_result_is_saturated(result)) {
+    if (!parasail_result_is_saturated(result)
+            && !parasail_result_is_pruned(result)) {
         int s1Len_new = 0;
         int s2Len_new = 0;
         parasail_result_t *result_final = NULL;
@@ -539,12 +580,16 @@ parasail_result_t* INAME(
 
         if (s1Len_new == profile->s1Len) {
             /* special 'stop' value tells stats function not to
-             * consider last column results */
+             * consider last column results, and the faster pass has
+             * already checked min_score */
             int stop_save = profile->stop;
+            int min_score_save = profile->min_score;
             ((parasail_profile_t*)profile)->stop = 1;
+            ((parasail_profile_t*)profile)->min_score = INT32_MIN;
             result_final = PNAME(
                     profile, s2, s2Len_new, open, gap);
             ((parasail_profile_t*)profile)->stop = stop_save;
+            ((parasail_profile_t*)profile)->min_score = min_score_save;
         }
         else {
             parasail_profile_t *profile_final = NULL;
@@ -18,6 +18,27 @@
 
 %(FIXES)s
 
+/* smallest query position of the striped column holding value */
+static inline %(INDEX)s find_row(
+        const %(INT)s *t,
+        %(INT)s value,
+        %(INDEX)s s1Len,
+        %(INDEX)s segLen,
+        %(INDEX)s segWidth)
+{
+    %(INDEX)s row = s1Len - 1;
+    %(INDEX)s i = 0;
+    for (i=0; i<segLen*segWidth; ++i) {
+        if (t[i] == value) {
+            %(INDEX)s temp = i / segWidth + i %% segWidth * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
 #ifdef PARASAIL_TABLE
 static inline void arr_store_si%(BITS)s(
         int *array,
@@ -52,24 +73,596 @@ static inline void arr_store_col(
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME_WS)s
+#define ENAME %(PNAME_ENC)s
+#define CNAME %(PNAME)s_core
+#endif
+#endif
+
+/* Same as PNAME without a profile: the striped query codes are compared
+ * to the code of each database residue to select match or mismatch. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+    const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+    const %(INDEX)s tail = (s1Len - 1) %% segLen + 1;
+    %(VTYPE)s* const restrict pvQuery = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen+4);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    const %(VTYPE)s vGapO = %(VSET1)s(open);
+    const %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vMatch;
+    %(VTYPE)s vMismatch;
+    %(VTYPE)s vMatchHead;
+    %(VTYPE)s vMismatchHead;
+    %(VTYPE)s vMatchTail;
+    %(VTYPE)s vMismatchTail;
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(INT)s score = NEG_LIMIT;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+    %(VTYPE)s vMaxH = vNegLimit;
+    %(VTYPE)s vPosMask = %(VCMPEQ)s(%(VSET1)s(position),
+            %(VSET)s(%(POSITION_MASK)s));
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
 #endif
 #endif
 
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        %(INT)s *q = (%(INT)s*)pvQuery;
+        %(INT)s *lane = (%(INT)s*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (%(INT)s)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = %(VLOAD)s(pvQuery + segLen);
+        vMismatchHead = %(VLOAD)s(pvQuery + segLen + 1);
+        vMatchTail = %(VLOAD)s(pvQuery + segLen + 2);
+        vMismatchTail = %(VLOAD)s(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    parasail_memset_%(VTYPE)s(pvHStore, %(VSET1)s(0), segLen);
+    parasail_memset_%(VTYPE)s(pvE, %(VSET1)s(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        %(VTYPE)s vF = vNegLimit;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
+
+        /* code of the database residue in every lane */
+        const %(VTYPE)s vCode = %(VSET1)s(matrix->mapper[(unsigned char)s2[j]]);
+
+        /* Swap the 2 H buffers. */
+        %(VTYPE)s* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = %(VADD)s(vH, %(VBLEND)s(vMismatch, vMatch,
+                        %(VCMPEQ)s(%(VLOAD)s(pvQuery + i), vCode)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+            vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+            vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, -open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+                vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+            /* extract vector containing last value from the column */
+            %(VTYPE)s vCompare;
+            vH = %(VLOAD)s(pvHStore + offset);
+            vCompare = %(VAND)s(vPosMask, %(VCMPGT)s(vH, vMaxH));
+            vMaxH = %(VMAX)s(vH, vMaxH);
+            if (%(VMOVEMASK)s(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+#endif
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = %(VSHIFT)s(vMaxH, %(BYTES)s);
+        }
+        score = (%(INT)s) %(VEXTRACT)s(vMaxH, %(LAST_POS)s);
+    }
+
+    /* max of last column */
+    {
+        %(INT)s score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            %(VTYPE)s vH = %(VLOAD)s(pvHStore + i);
+            vMaxH = %(VMAX)s(vH, vMaxH);
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, vH, i, segLen);
+#endif
+        }
+
+        /* max in vec */
+        score_last = %(VHMAX)s(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                %(INT)s *t = (%(INT)s*)pvHStore;
+                %(INDEX)s column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        %(INDEX)s temp = i / segWidth + i %% segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPEQ)s(%(VMIN)s(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+#if LOOKUP
+/* Same as match_mismatch for any matrix of at most 32 residues with
+ * byte scores: a shuffle of the database residue's row of scores,
+ * indexed by the striped query codes, stands in for the profile. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+    %(VTYPE)s* const restrict pvTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*matrix->size);
+    %(VTYPE)s* const restrict pvIndex = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*segLen);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    const %(VTYPE)s vGapO = %(VSET1)s(open);
+    const %(VTYPE)s vGapE = %(VSET1)s(gap);
+    const %(INT)s NEG_LIMIT = (-open < matrix->min ?
+        INT%(WIDTH)s_MIN + open : INT%(WIDTH)s_MIN - matrix->min) + 1;
+    const %(INT)s POS_LIMIT = INT%(WIDTH)s_MAX - matrix->max - 1;
+    %(INT)s score = NEG_LIMIT;
+    %(VTYPE)s vNegLimit = %(VSET1)s(NEG_LIMIT);
+    %(VTYPE)s vPosLimit = %(VSET1)s(POS_LIMIT);
+    %(VTYPE)s vSaturationCheckMin = vPosLimit;
+    %(VTYPE)s vSaturationCheckMax = vNegLimit;
+    %(VTYPE)s vMaxH = vNegLimit;
+    %(VTYPE)s vPosMask = %(VCMPEQ)s(%(VSET1)s(position),
+            %(VSET)s(%(POSITION_MASK)s));
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<%(ALIGNMENT)s; ++i) {
+                %(INDEX)s lo = i %% 16;
+                %(INDEX)s hi = lo + 16;
+                table[2*k*%(ALIGNMENT)s + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*%(ALIGNMENT)s + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*%(ALIGNMENT)s; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                %(INDEX)s byte = (k+1)*%(BYTES)s - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*%(ALIGNMENT)s + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*%(ALIGNMENT)s + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* initialize H and E */
+    parasail_memset_%(VTYPE)s(pvHStore, %(VSET1)s(0), segLen);
+    parasail_memset_%(VTYPE)s(pvE, %(VSET1)s(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        /* Initialize F value to -inf.  Any errors to vH values will be
+         * corrected in the Lazy_F loop.  */
+        %(VTYPE)s vF = vNegLimit;
+
+        /* load final segment of pvHStore and shift left by 2 bytes */
+        %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
+
+        /* score tables of the database residue */
+        const %(VTYPE)s* vTable = pvTable + 2*matrix->mapper[(unsigned char)s2[j]];
+        const %(VTYPE)s vTableLo = %(VLOAD)s(vTable);
+        const %(VTYPE)s vTableHi = %(VLOAD)s(vTable + 1);
+
+        /* Swap the 2 H buffers. */
+        %(VTYPE)s* pv = pvHLoad;
+        pvHLoad = pvHStore;
+        pvHStore = pv;
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VADD)s(vH, %(VLOOKUP)s(vTableLo, vTableHi,
+                        %(VLOAD)s(pvIndex + 2*i), %(VLOAD)s(pvIndex + 2*i + 1)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+            vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+            vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, -open, 0);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+                vSaturationCheckMin = %(VMIN)s(vSaturationCheckMin, vH);
+                vSaturationCheckMax = %(VMAX)s(vSaturationCheckMax, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+            /* extract vector containing last value from the column */
+            %(VTYPE)s vCompare;
+            vH = %(VLOAD)s(pvHStore + offset);
+            vCompare = %(VAND)s(vPosMask, %(VCMPGT)s(vH, vMaxH));
+            vMaxH = %(VMAX)s(vH, vMaxH);
+            if (%(VMOVEMASK)s(vCompare)) {
+                end_ref = j;
+                end_query = s1Len - 1;
+            }
+#ifdef PARASAIL_ROWCOL
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+#endif
+        }
+    }
+
+    /* max last value from all columns */
+    {
+        for (k=0; k<position; ++k) {
+            vMaxH = %(VSHIFT)s(vMaxH, %(BYTES)s);
+        }
+        score = (%(INT)s) %(VEXTRACT)s(vMaxH, %(LAST_POS)s);
+    }
+
+    /* max of last column */
+    {
+        %(INT)s score_last;
+        vMaxH = vNegLimit;
+
+        for (i=0; i<segLen; ++i) {
+            %(VTYPE)s vH = %(VLOAD)s(pvHStore + i);
+            vMaxH = %(VMAX)s(vH, vMaxH);
+#ifdef PARASAIL_ROWCOL
+            arr_store_col(result->rowcols->score_col, vH, i, segLen);
+#endif
+        }
+
+        /* max in vec */
+        score_last = %(VHMAX)s(vMaxH);
+        if (score_last > score || (score_last == score && end_ref == s2Len - 1)) {
+            score = score_last;
+            end_ref = s2Len - 1;
+            end_query = s1Len;
+            /* Trace the alignment ending position on read. */
+            {
+                %(INT)s *t = (%(INT)s*)pvHStore;
+                %(INDEX)s column_len = segLen * segWidth;
+                for (i = 0; i<column_len; ++i, ++t) {
+                    if (*t == score) {
+                        %(INDEX)s temp = i / segWidth + i %% segWidth * segLen;
+                        if (temp < end_query) {
+                            end_query = temp;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (%(VMOVEMASK)s(%(VOR)s(
+            %(VCMPEQ)s(%(VMIN)s(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
+            %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+        score = 0;
+        end_query = 0;
+        end_ref = 0;
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+#endif /* LOOKUP */
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+#if LOOKUP
+    if (parasail_lookup_scores(matrix, sizeof(%(VTYPE)s)*matrix->size
+                *((s1Len + %(LANES)s - 1) / %(LANES)s))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif /* LOOKUP */
+
+    profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, s2, s2Len, NULL, open, gap, workspace, result);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return CNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL. */
+static parasail_result_t* CNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -83,9 +676,17 @@ parasail_result_t* PNAME(
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
     %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+#ifdef WNAME
+    %(VTYPE)s* const pvWork = (%(VTYPE)s*)parasail_workspace_reserve(
+            workspace, sizeof(%(VTYPE)s)*3*segLen);
+    %(VTYPE)s* restrict pvHStore = pvWork;
+    %(VTYPE)s* restrict pvHLoad = pvWork + segLen;
+    %(VTYPE)s* const restrict pvE = pvWork + 2*segLen;
+#else
     %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+#endif
     const %(VTYPE)s vGapO = %(VSET1)s(open);
     const %(VTYPE)s vGapE = %(VSET1)s(gap);
     const %(INT)s NEG_LIMIT = (-open < matrix->min ?
@@ -99,14 +700,25 @@ parasail_result_t* PNAME(
     %(VTYPE)s vMaxH = vNegLimit;
     %(VTYPE)s vPosMask = %(VCMPEQ)s(%(VSET1)s(position),
             %(VSET)s(%(POSITION_MASK)s));
+    const int xdrop = profile->xdrop;
+    const int zdrop = profile->zdrop;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
+    int prune = 0;
+    int64_t best = INT64_MIN;
+    %(INDEX)s best_query = 0;
+    %(INDEX)s best_ref = 0;
 #ifdef PARASAIL_TABLE
     parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
 #else
 #ifdef PARASAIL_ROWCOL
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
@@ -124,7 +736,13 @@ parasail_result_t* PNAME(
         %(VTYPE)s vH = %(VSHIFT)s(pvHStore[segLen - 1], %(BYTES)s);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        const %(VTYPE)s* vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         const %(VTYPE)s* vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         /* Swap the 2 H buffers. */
         %(VTYPE)s* pv = pvHLoad;
@@ -199,6 +817,66 @@ end:
             result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
 #endif
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        prune = INT32_MIN != min_score && gain < min_score;
+
+        /* X-drop: stop once every cell of the column has fallen more
+         * than xdrop below the best cell so far.  Z-drop also forgives
+         * the gap between the column's best cell and the best cell.
+         * The alignment then ends in the last row of the columns seen. */
+        if (0 < xdrop || 0 < zdrop || prune) {
+            /* the lanes past the end of the query are padding */
+            const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+            const %(INDEX)s last_seg = (s1Len - 1) %% segLen;
+            const %(VTYPE)s vPadLo = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - 1 - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            const %(VTYPE)s vPadHi = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            %(VTYPE)s vColMax = vNegLimit;
+            %(INT)s col_score;
+            %(INT)s row_score;
+            for (i=0; i<segLen; ++i) {
+                %(VTYPE)s vC = %(VLOAD)s(pvHStore + i);
+                vC = %(VBLEND)s(vC, vNegLimit, i > last_seg ? vPadHi : vPadLo);
+                vColMax = %(VMAX)s(vColMax, vC);
+            }
+            col_score = %(VHMAX)s(vColMax);
+            row_score = %(VHMAX)s(%(VBLEND)s(vNegLimit, vMaxH, vPosMask));
+            if (prune && row_score < min_score
+                    && (col_score > 0 ? col_score : 0) + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+            }
+            else if (col_score > best) {
+                best = col_score;
+                best_ref = j;
+                if (0 < zdrop) {
+                    best_query = find_row((%(INT)s*)pvHStore, col_score, s1Len, segLen, segWidth);
+                }
+            }
+            else {
+                int64_t drop = best - col_score;
+                if (0 < xdrop && drop > xdrop) {
+                    result->flag |= PARASAIL_FLAG_XDROP;
+                }
+                else if (0 < zdrop && drop > zdrop) {
+                    %(INDEX)s col_query = find_row((%(INT)s*)pvHStore, col_score, s1Len, segLen, segWidth);
+                    %(INDEX)s diff = (col_query - best_query) - (j - best_ref);
+                    if (drop > zdrop + (int64_t)gap*(diff < 0 ? -diff : diff)) {
+                        result->flag |= PARASAIL_FLAG_XDROP;
+                    }
+                }
+            }
+            if (result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED)) {
+                result->stop_ref = j;
+                break;
+            }
+        }
     }
 
     /* max last value from all columns */
@@ -209,8 +887,8 @@ end:
         score = (%(INT)s) %(VEXTRACT)s(vMaxH, %(LAST_POS)s);
     }
 
-    /* max of last column */
-    {
+    /* max of last column, unless the alignment stopped before it */
+    if (!(result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED))) {
         %(INT)s score_last;
         vMaxH = vNegLimit;
 
@@ -244,8 +922,11 @@ end:
         }
     }
 
+    /* vF starts each column at NEG_LIMIT, so a score that falls below
+     * the limit is clamped to it rather than going under; reaching the
+     * limit therefore counts as saturating too. */
     if (%(VMOVEMASK)s(%(VOR)s(
-            %(VCMPLT)s(vSaturationCheckMin, vNegLimit),
+            %(VCMPEQ)s(%(VMIN)s(vSaturationCheckMin, vNegLimit), vSaturationCheckMin),
             %(VCMPGT)s(vSaturationCheckMax, vPosLimit)))) {
         result->flag |= PARASAIL_FLAG_SATURATED;
         score = 0;
@@ -265,9 +946,11 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvE);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }
@@ -0,0 +1,254 @@
+/**
+ * @file
+ *
+ * @author jeff.daily@pnnl.gov
+ *
+ * Copyright (c) 2015 Battelle Memorial Institute.
+ */
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+%(HEADER)s
+
+#include "parasail.h"
+#include "parasail/memory.h"
+#include "parasail/internal_%(ISA)s.h"
+
+#define NEG_INF %(NEG_INF)s
+#define MAX(a,b) ((a)>(b)?(a):(b))
+#define MIN(a,b) ((a)<(b)?(a):(b))
+/* lane bounds are compared against vectors of lane numbers, so they are
+ * clamped to a range that fits in a vector element */
+#define CLAMP(x) MIN(MAX((x),-1),PAD2+1)
+%(FIXES)s
+
+static inline void arr_store_si%(BITS)s(
+        int8_t *array,
+        %(VTYPE)s vWH,
+        %(INDEX)s i,
+        %(INDEX)s s1Len,
+        %(INDEX)s j,
+        %(INDEX)s s2Len,
+        %(INDEX)s lo,
+        %(INDEX)s hi,
+        %(INDEX)s W)
+{
+%(PRINTER_TRACE)s
+}
+
+#define FNAME %(NAME_TRACE)s
+
+parasail_result_t* FNAME(
+        const char * const restrict _s1, const int s1Len,
+        const char * const restrict _s2, const int s2Len,
+        const int open, const int gap, const int k,
+        const parasail_matrix_t *matrix)
+{
+    const %(INDEX)s N = %(LANES)s; /* number of values in vector */
+    const %(INDEX)s PAD = N-1;
+    const %(INDEX)s PAD2 = PAD*2;
+    const %(INDEX)s s1Len_PAD = s1Len+PAD;
+    const %(INDEX)s s2Len_PAD = s2Len+PAD;
+    /* the band holds the diagonals j-i from lo to hi */
+    const %(INDEX)s lo = MIN(0, s2Len-s1Len) - k;
+    const %(INDEX)s hi = MAX(0, s2Len-s1Len) + k;
+    const %(INDEX)s W = hi - lo + 1;
+    %(INT)s * const restrict s1 = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s1Len+PAD);
+    %(INT)s * const restrict s2B= parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _H_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict _F_pr = parasail_memalign_%(INT)s(%(ALIGNMENT)s, s2Len+PAD2);
+    %(INT)s * const restrict s2 = s2B+PAD; /* will allow later for negative indices */
+    %(INT)s * const restrict H_pr = _H_pr+PAD;
+    %(INT)s * const restrict F_pr = _F_pr+PAD;
+    parasail_result_t *result = parasail_result_new_trace(s1Len, W, %(ALIGNMENT)s, sizeof(int8_t));
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s end_query = s1Len;
+    %(INDEX)s end_ref = s2Len;
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vOpen = %(VSET1)s(open);
+    %(VTYPE)s vGap  = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET1)s(0);
+    %(VTYPE)s vK = %(VSET)s(%(DIAG_I)s);
+    %(VTYPE)s v2K = %(VADD)s(vK, vK);
+    %(VTYPE)s vTDiag = %(VSET1)s(PARASAIL_DIAG);
+    %(VTYPE)s vTIns = %(VSET1)s(PARASAIL_INS);
+    %(VTYPE)s vTDel = %(VSET1)s(PARASAIL_DEL);
+    %(VTYPE)s vTDiagE = %(VSET1)s(PARASAIL_DIAG_E);
+    %(VTYPE)s vTInsE = %(VSET1)s(PARASAIL_INS_E);
+    %(VTYPE)s vTDiagF = %(VSET1)s(PARASAIL_DIAG_F);
+    %(VTYPE)s vTDelF = %(VSET1)s(PARASAIL_DEL_F);
+    %(SATURATION_CHECK_INIT)s
+
+    /* convert _s1 from char to int in range 0-23 */
+    for (i=0; i<s1Len; ++i) {
+        s1[i] = matrix->mapper[(unsigned char)_s1[i]];
+    }
+    /* pad back of s1 with dummy values */
+    for (i=s1Len; i<s1Len_PAD; ++i) {
+        s1[i] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* convert _s2 from char to int in range 0-23 */
+    for (j=0; j<s2Len; ++j) {
+        s2[j] = matrix->mapper[(unsigned char)_s2[j]];
+    }
+    /* pad front of s2 with dummy values */
+    for (j=-PAD; j<0; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+    /* pad back of s2 with dummy values */
+    for (j=s2Len; j<s2Len_PAD; ++j) {
+        s2[j] = 0; /* point to first matrix row because we don't care */
+    }
+
+    /* set initial values for stored row, outside of the band is never
+     * aligned */
+    for (j=0; j<s2Len; ++j) {
+        H_pr[j] = j+1 <= hi ? 0 : NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad front of stored row values */
+    for (j=-PAD; j<0; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    /* pad back of stored row values */
+    for (j=s2Len; j<s2Len+PAD; ++j) {
+        H_pr[j] = NEG_INF;
+        F_pr[j] = NEG_INF;
+    }
+    H_pr[-1] = 0; /* upper left corner */
+
+    /* iterate over query sequence */
+    for (i=0; i<s1Len; i+=N) {
+        /* lane k holds row i+k, column j-k; only the columns that put
+         * some lane inside the band are visited */
+        const %(INDEX)s jbeg = MAX(0, i+lo);
+        const %(INDEX)s jend = MIN(i+PAD2+hi, s2Len-1+PAD);
+        const %(INDEX)s kLast = s1Len-1-i;
+        %(VTYPE)s vNH = vNegInf;
+        %(VTYPE)s vWH = vNegInf;
+        %(VTYPE)s vE = vNegInf;
+        %(VTYPE)s vE_opn = vNegInf;
+        %(VTYPE)s vE_ext = vNegInf;
+        %(VTYPE)s vF = vNegInf;
+        %(VTYPE)s vF_opn = vNegInf;
+        %(VTYPE)s vF_ext = vNegInf;
+        %(VTYPE)s vRowOut = %(VCMPGT)s(vK, %(VSET1)s(CLAMP(kLast)));
+        %(DIAG_MATROW_DECL)s
+        vNH = %(VINSERT)s(vNH, H_pr[jbeg-1], %(LAST_POS)s);
+        if (0 == jbeg && -1-i >= lo) {
+            vWH = %(VINSERT)s(vWH, 0, %(LAST_POS)s);
+        }
+        /* iterate over database sequence */
+        for (j=jbeg; j<=jend; ++j) {
+            %(VTYPE)s vMat;
+            %(VTYPE)s vNWH = vNH;
+            %(VTYPE)s vOut = vZero;
+            vNH = %(VRSHIFT)s(vWH, %(BYTES)s);
+            vNH = %(VINSERT)s(vNH, H_pr[j], %(LAST_POS)s);
+            vF = %(VRSHIFT)s(vF, %(BYTES)s);
+            vF = %(VINSERT)s(vF, F_pr[j], %(LAST_POS)s);
+            vF_opn = %(VSUB)s(vNH, vOpen);
+            vF_ext = %(VSUB)s(vF, vGap);
+            vF = %(VMAX)s(vF_opn, vF_ext);
+            vE_opn = %(VSUB)s(vWH, vOpen);
+            vE_ext = %(VSUB)s(vE, vGap);
+            vE = %(VMAX)s(vE_opn, vE_ext);
+            vMat = %(VSET)s(
+                    %(DIAG_MATROW_USE)s
+                    );
+            vNWH = %(VADD)s(vNWH, vMat);
+            vWH = %(VMAX)s(vNWH, vE);
+            vWH = %(VMAX)s(vWH, vF);
+            /* near the edges of the band or the table, assign the j=-1
+             * boundary conditions and clear the cells outside */
+            if (j-i-lo < PAD2 || j-i > hi || j < PAD || j >= s2Len || kLast < PAD) {
+                %(VTYPE)s cond = %(VCMPEQ)s(vK, %(VSET1)s(CLAMP(j+1)));
+                %(VTYPE)s condEF;
+                vOut = %(VOR)s(
+                        %(VOR)s(
+                            %(VCMPGT)s(v2K, %(VSET1)s(CLAMP(j-i-lo))),
+                            %(VCMPLT)s(v2K, %(VSET1)s(CLAMP(j-i-hi)))),
+                        %(VOR)s(
+                            %(VOR)s(
+                                %(VCMPLT)s(vK, %(VSET1)s(CLAMP(j-s2Len+1))),
+                                %(VCMPGT)s(vK, %(VSET1)s(CLAMP(j+1)))),
+                            vRowOut));
+                condEF = %(VOR)s(cond, vOut);
+                vWH = %(VANDNOT)s(cond, vWH);
+                vWH = %(VBLEND)s(vWH, vNegInf, vOut);
+                vE = %(VBLEND)s(vE, vNegInf, condEF);
+                vF = %(VBLEND)s(vF, vNegInf, condEF);
+            }
+            %(SATURATION_CHECK_MID)s
+            /* trace table */
+            {
+                %(VTYPE)s case1 = %(VCMPEQ)s(vWH, vNWH);
+                %(VTYPE)s case2 = %(VCMPEQ)s(vWH, vF);
+                %(VTYPE)s vT = %(VBLEND)s(
+                        %(VBLEND)s(vTIns, vTDel, case2),
+                        vTDiag,
+                        case1);
+                %(VTYPE)s condE = %(VCMPGT)s(vE_opn, vE_ext);
+                %(VTYPE)s condF = %(VCMPGT)s(vF_opn, vF_ext);
+                %(VTYPE)s vET = %(VBLEND)s(vTInsE, vTDiagE, condE);
+                %(VTYPE)s vFT = %(VBLEND)s(vTDelF, vTDiagF, condF);
+                vT = %(VOR)s(vT, vET);
+                vT = %(VOR)s(vT, vFT);
+                arr_store_si%(BITS)s(result->trace->trace_table, vT, i, s1Len, j, s2Len, lo, hi, W);
+            }
+            H_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vWH,0);
+            F_pr[j-%(LAST_POS)s] = (%(INT)s)%(VEXTRACT)s(vF,0);
+            /* the lanes in the last column and the last row are
+             * candidates for the end of the alignment, prefer the
+             * smallest end_ref, then the smallest end_query */
+            if (j >= s2Len-1 || kLast <= PAD) {
+                %(INDEX)s lanes[2];
+                %(INDEX)s c = 0;
+                %(INT)s values[%(LANES)s];
+                memcpy(values, &vWH, sizeof(values));
+                lanes[0] = j-(s2Len-1);
+                lanes[1] = kLast;
+                for (c=0; c<2; ++c) {
+                    const %(INDEX)s lane = lanes[c];
+                    const %(INDEX)s ei = i+lane;
+                    const %(INDEX)s ej = j-lane;
+                    if (lane < 0 || lane > PAD || ei >= s1Len
+                            || ej < 0 || ej >= s2Len
+                            || ej-ei < lo || ej-ei > hi) {
+                        continue;
+                    }
+                    if (values[PAD-lane] > score
+                            || (values[PAD-lane] == score && (ej < end_ref
+                                    || (ej == end_ref && ei < end_query)))) {
+                        score = values[PAD-lane];
+                        end_query = ei;
+                        end_ref = ej;
+                    }
+                }
+            }
+        }
+    }
+
+    %(SATURATION_CHECK_FINAL)s
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->trace->band = k;
+    result->flag |= PARASAIL_FLAG_SG | PARASAIL_FLAG_DIAG
+        | PARASAIL_FLAG_TRACE | PARASAIL_FLAG_BANDED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+
+    parasail_free(_F_pr);
+    parasail_free(_H_pr);
+    parasail_free(s2B);
+    parasail_free(s1);
+
+    return result;
+}
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 %(HEADER)s
 
@@ -21,23 +22,15 @@
 #define NEG_INF %(NEG_INF)s
 %(FIXES)s
 
+/* the trace table keeps one byte per cell at every vector width */
 static inline void arr_store(
-        %(VTYPE)s *array,
+        int8_t *array,
         %(VTYPE)s vH,
         %(INDEX)s t,
         %(INDEX)s seglen,
         %(INDEX)s d)
 {
-    %(VSTORE)s(array + (1LL*d*seglen+t), vH);
-}
-
-static inline %(VTYPE)s arr_load(
-        %(VTYPE)s *array,
-        %(INDEX)s t,
-        %(INDEX)s seglen,
-        %(INDEX)s d)
-{
-    return %(VLOAD)s(array + (1LL*d*seglen+t));
+    %(VSTORE_TRACE)s(array + (1LL*d*seglen+t)*%(LANES)s, vH);
 }
 
 #define FNAME %(NAME_TRACE)s
@@ -77,6 +70,8 @@ parasail_result_t* PNAME(
     %(VTYPE)s* restrict pvEaStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* restrict pvEaLoad = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvHT = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvTCol = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvTNext = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
@@ -85,7 +80,7 @@ parasail_result_t* PNAME(
     %(VTYPE)s vPosMask = %(VCMPEQ)s(%(VSET1)s(position),
             %(VSET)s(%(POSITION_MASK)s));
     %(SATURATION_CHECK_INIT)s
-    parasail_result_t *result = parasail_result_new_trace(segLen, s2Len, %(ALIGNMENT)s, sizeof(%(VTYPE)s));
+    parasail_result_t *result = parasail_result_new_trace(segLen*segWidth, s2Len, %(ALIGNMENT)s, sizeof(int8_t));
     %(VTYPE)s vTIns  = %(VSET1)s(PARASAIL_INS);
     %(VTYPE)s vTDel  = %(VSET1)s(PARASAIL_DEL);
     %(VTYPE)s vTDiag = %(VSET1)s(PARASAIL_DIAG);
@@ -102,7 +97,7 @@ parasail_result_t* PNAME(
     parasail_memset_%(VTYPE)s(pvEaStore, %(VSET1)s(-open), segLen);
 
     for (i=0; i<segLen; ++i) {
-        arr_store(result->trace->trace_table, vTDiagE, i, segLen, 0);
+        %(VSTORE)s(pvTCol + i, vTDiagE);
     }
 
     /* outer loop over database sequence */
@@ -146,7 +141,7 @@ parasail_result_t* PNAME(
             %(SATURATION_CHECK_MID)s
 
             {
-                %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                %(VTYPE)s vTAll = %(VLOAD)s(pvTCol + i);
                 %(VTYPE)s case1 = %(VCMPEQ)s(vH, vH_dag);
                 %(VTYPE)s case2 = %(VCMPEQ)s(vH, vF);
                 %(VTYPE)s vT = %(VBLEND)s(
@@ -154,7 +149,7 @@ parasail_result_t* PNAME(
                         vTDiag, case1);
                 %(VSTORE)s(pvHT + i, vT);
                 vT = %(VOR)s(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i, segLen, j);
+                %(VSTORE)s(pvTCol + i, vT);
             }
 
             vEF_opn = %(VSUB)s(vH, vGapO);
@@ -171,7 +166,7 @@ parasail_result_t* PNAME(
                 if (j+1<s2Len) {
                     %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vEa_ext);
                     %(VTYPE)s vT = %(VBLEND)s(vTInsE, vTDiagE, cond);
-                    arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                    %(VSTORE)s(pvTNext + i, vT);
                 }
             }
 
@@ -179,11 +174,11 @@ parasail_result_t* PNAME(
             vF_ext = %(VSUB)s(vF, vGapE);
             vF = %(VMAX)s(vEF_opn, vF_ext);
             if (i+1<segLen) {
-                %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i+1, segLen, j);
+                %(VTYPE)s vTAll = %(VLOAD)s(pvTCol + i+1);
                 %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vF_ext);
                 %(VTYPE)s vT = %(VBLEND)s(vTDelF, vTDiagF, cond);
                 vT = %(VOR)s(vT, vTAll);
-                arr_store(result->trace->trace_table, vT, i+1, segLen, j);
+                %(VSTORE)s(pvTCol + i+1, vT);
             }
 
             /* Load the next vH. */
@@ -222,22 +217,22 @@ parasail_result_t* PNAME(
                     case1 = %(VCMPEQ)s(vH, vHp);
                     case2 = %(VCMPEQ)s(vH, vF);
                     cond = %(VANDNOT)s(case1,case2);
-                    vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    vTAll = %(VLOAD)s(pvTCol + i);
                     vT = %(VLOAD)s(pvHT + i);
                     vT = %(VBLEND)s(vT, vTDel, cond);
                     %(VSTORE)s(pvHT + i, vT);
                     vTAll = %(VAND)s(vTAll, vTMask);
                     vTAll = %(VOR)s(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    %(VSTORE)s(pvTCol + i, vTAll);
                 }
                 /* Update vF value. */
                 {
-                    %(VTYPE)s vTAll = arr_load(result->trace->trace_table, i, segLen, j);
+                    %(VTYPE)s vTAll = %(VLOAD)s(pvTCol + i);
                     %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vFa_ext);
                     %(VTYPE)s vT = %(VBLEND)s(vTDelF, vTDiagF, cond);
                     vTAll = %(VAND)s(vTAll, vFTMask);
                     vTAll = %(VOR)s(vTAll, vT);
-                    arr_store(result->trace->trace_table, vTAll, i, segLen, j);
+                    %(VSTORE)s(pvTCol + i, vTAll);
                 }
                 vEF_opn = %(VSUB)s(vH, vGapO);
                 vF_ext = %(VSUB)s(vF, vGapE);
@@ -249,7 +244,7 @@ parasail_result_t* PNAME(
                     if (j+1<s2Len) {
                         %(VTYPE)s cond = %(VCMPGT)s(vEF_opn, vEa_ext);
                         %(VTYPE)s vT = %(VBLEND)s(vTInsE, vTDiagE, cond);
-                        arr_store(result->trace->trace_table, vT, i, segLen, j+1);
+                        %(VSTORE)s(pvTNext + i, vT);
                     }
                 }
                 if (! %(VMOVEMASK)s(
@@ -265,6 +260,11 @@ parasail_result_t* PNAME(
             }
         }
 end:
+        /* the column is final, narrow its trace bits into the table */
+        for (i=0; i<segLen; ++i) {
+            arr_store(result->trace->trace_table, %(VLOAD)s(pvTCol + i), i, segLen, j);
+        }
+        SWAP(pvTCol, pvTNext)
         {
             /* extract vector containing last value from the column */
             %(VTYPE)s vCompare;
@@ -327,6 +327,8 @@ end:
         | PARASAIL_FLAG_TRACE
         | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
 
+    parasail_free(pvTNext);
+    parasail_free(pvTCol);
     parasail_free(pvHT);
     parasail_free(pvEaLoad);
     parasail_free(pvEaStore);
@@ -96,6 +96,9 @@ STATIC parasail_result_t* PNAME(
     %(INDEX)s end_ref = 0;
     const int s1Len = profile->s1Len;
     const parasail_matrix_t *matrix = profile->matrix;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
     const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
     const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
     %(VTYPE)s* const restrict vProfile  = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
@@ -408,6 +411,38 @@ end:
                 end_ref = j;
             }
         }
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        if (INT32_MIN != min_score && score < min_score
+                && gain < min_score) {
+            /* the lanes past the end of the query are padding */
+            const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+            const %(INDEX)s last_seg = (s1Len - 1) %% segLen;
+            const %(VTYPE)s vPadLo = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - 1 - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            const %(VTYPE)s vPadHi = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            %(VTYPE)s vColMax = vZero;
+            %(INT)s col_score;
+            for (i=0; i<segLen; ++i) {
+                %(VTYPE)s vC = %(VLOAD)s(pvHStore + i);
+                vC = %(VBLEND)s(vC, vZero, i > last_seg ? vPadHi : vPadLo);
+                vColMax = %(VMAX)s(vColMax, vC);
+            }
+            col_score = %(VHMAX)s(vColMax);
+            if (col_score + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+                result->stop_ref = j;
+                /* leave j one past the last column, as after the loop */
+                ++j;
+                break;
+            }
+        }
     }
 
 #ifdef PARASAIL_ROWCOL
@@ -525,7 +560,8 @@ parasail_result_t* INAME(
 
     /* find the end loc first with the faster implementation */
     parasail_result_t *result = %(PNAME_BASE)s(profile, s2, s2Len, open, gap);
-    if (!parasail_result_is_saturated(result)) {
+    if (!parasail_result_is_saturated(result)
+            && !parasail_result_is_pruned(result)) {
 #if 0
         int s1Len_new = 0;
         int s2Len_new = 0;
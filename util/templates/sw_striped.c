@@ -19,6 +19,27 @@
 #define NEG_INF %(NEG_INF)s
 %(FIXES)s
 
+/* smallest query position of the striped column holding value */
+static inline %(INDEX)s find_row(
+        const %(INT)s *t,
+        %(INT)s value,
+        %(INDEX)s s1Len,
+        %(INDEX)s segLen,
+        %(INDEX)s segWidth)
+{
+    %(INDEX)s row = s1Len - 1;
+    %(INDEX)s i = 0;
+    for (i=0; i<segLen*segWidth; ++i) {
+        if (t[i] == value) {
+            %(INDEX)s temp = i / segWidth + i %% segWidth * segLen;
+            if (temp < row) {
+                row = temp;
+            }
+        }
+    }
+    return row;
+}
+
 #ifdef PARASAIL_TABLE
 static inline void arr_store_si%(BITS)s(
         int *array,
@@ -53,24 +74,602 @@ static inline void arr_store_col(
 #else
 #define FNAME %(NAME)s
 #define PNAME %(PNAME)s
+#define WNAME %(PNAME_WS)s
+#define ENAME %(PNAME_ENC)s
+#define RNAME %(PNAME_PROMOTE)s
+#endif
+#endif
+
+/* Same as PNAME without a profile: comparing the striped query codes
+ * with the code of the database residue picks match or mismatch. */
+static parasail_result_t* match_mismatch(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix,
+        const int match, const int mismatch)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+    const %(INDEX)s tail = (s1Len - 1) %% segLen + 1;
+    %(VTYPE)s* const restrict pvQuery = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen+4);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(VTYPE)s vMatch;
+    %(VTYPE)s vMismatch;
+    %(VTYPE)s vMatchHead;
+    %(VTYPE)s vMismatchHead;
+    %(VTYPE)s vMatchTail;
+    %(VTYPE)s vMismatchTail;
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vMaxH = vNegInf;
+    %(VTYPE)s vMaxHUnit = vNegInf;
+    %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+#else
+    parasail_result_t *result = parasail_result_new();
+#endif
+#endif
+
+    /* stripe the query codes, and the scores by lane; the padding
+     * lanes past the end of the query score 0 like the profile, in
+     * every segment of the lanes after last_lane and from segment tail
+     * on in last_lane */
+    {
+        %(INT)s *q = (%(INT)s*)pvQuery;
+        %(INT)s *lane = (%(INT)s*)(pvQuery + segLen);
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                q[i*segWidth + k] = t < s1Len
+                    ? (%(INT)s)matrix->mapper[(unsigned char)s1[t]] : -1;
+            }
+        }
+        for (k=0; k<segWidth; ++k) {
+            lane[k] = k <= last_lane ? match : 0;
+            lane[segWidth + k] = k <= last_lane ? mismatch : 0;
+            lane[2*segWidth + k] = k < last_lane ? match : 0;
+            lane[3*segWidth + k] = k < last_lane ? mismatch : 0;
+        }
+        vMatchHead = %(VLOAD)s(pvQuery + segLen);
+        vMismatchHead = %(VLOAD)s(pvQuery + segLen + 1);
+        vMatchTail = %(VLOAD)s(pvQuery + segLen + 2);
+        vMismatchTail = %(VLOAD)s(pvQuery + segLen + 3);
+    }
+
+    /* initialize H and E */
+    parasail_memset_%(VTYPE)s(pvHStore, vZero, segLen);
+    parasail_memset_%(VTYPE)s(pvE, %(VSET1)s(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        %(VTYPE)s vF;
+        %(VTYPE)s vH;
+        %(VTYPE)s vCode;
+        %(VTYPE)s* pv = NULL;
+
+        /* Initialize F value to 0.  Any errors to vH values will be
+         * corrected in the Lazy_F loop. */
+        vF = vZero;
+
+        /* load final segment of pvHStore and shift left by %(BYTES)s bytes */
+        vH = %(VLOAD)s(&pvHStore[segLen - 1]);
+        vH = %(VSHIFT)s(vH, %(BYTES)s);
+
+        /* code of the database residue in every lane */
+        vCode = %(VSET1)s(matrix->mapper[(unsigned char)s2[j]]);
+
+        if (end_ref == j-2) {
+            /* Swap in the max buffer. */
+            pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+        else {
+            /* Swap the 2 H buffers. */
+            pv = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+
+        /* inner loop to process the query sequence */
+        vMatch = vMatchHead;
+        vMismatch = vMismatchHead;
+        for (i=0; i<segLen; ++i) {
+            if (i == tail) {
+                vMatch = vMatchTail;
+                vMismatch = vMismatchTail;
+            }
+            vH = %(VADD)s(vH, %(VBLEND)s(vMismatch, vMatch,
+                        %(VCMPEQ)s(%(VLOAD)s(pvQuery + i), vCode)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            vH = %(VMAX)s(vH, vZero);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+            vMaxH = %(VMAX)s(vH, vMaxH);
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vMaxH = %(VMAX)s(vH, vMaxH);
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = %(VLOAD)s(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+        }
+#endif
+
+        {
+            %(VTYPE)s vCompare = %(VCMPGT)s(vMaxH, vMaxHUnit);
+            if (%(VMOVEMASK)s(vCompare)) {
+                score = %(VHMAX)s(vMaxH);
+                /* if score has potential to overflow, abort early */
+                if (score > maxp) {
+                    result->flag |= PARASAIL_FLAG_SATURATED;
+                    break;
+                }
+                vMaxHUnit = %(VSET1)s(score);
+                end_ref = j;
+            }
+        }
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    if (score == INT%(WIDTH)s_MAX) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+    }
+
+    if (parasail_result_is_saturated(result)) {
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else {
+        if (end_ref == j-1) {
+            /* end_ref was the last store column */
+            %(VTYPE)s *pv = pvHMax;
+            pvHMax = pvHStore;
+            pvHStore = pv;
+        }
+        else if (end_ref == j-2) {
+            /* end_ref was the last load column */
+            %(VTYPE)s *pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pv;
+        }
+        end_query = find_row((%(INT)s*)pvHMax, score, s1Len, segLen, segWidth);
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHMax);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvQuery);
+
+    return result;
+}
+
+#if LOOKUP
+/* Same as PNAME without a profile: the score of each query residue is
+ * shuffled out of the matrix row of the database residue, so only two
+ * vectors per segment of query codes stream through the cache. */
+static parasail_result_t* lookup(
+        const char * const restrict s1, const int s1Len,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap, const parasail_matrix_t *matrix)
+{
+    %(INDEX)s i = 0;
+    %(INDEX)s j = 0;
+    %(INDEX)s k = 0;
+    %(INDEX)s end_query = 0;
+    %(INDEX)s end_ref = 0;
+    const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
+    const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
+    %(VTYPE)s* const restrict pvTable = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*matrix->size);
+    %(VTYPE)s* const restrict pvIndex = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, 2*segLen);
+    %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* restrict pvHMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+    %(VTYPE)s vGapO = %(VSET1)s(open);
+    %(VTYPE)s vGapE = %(VSET1)s(gap);
+    %(VTYPE)s vZero = %(VSET0)s();
+    %(VTYPE)s vNegInf = %(VSET1)s(NEG_INF);
+    %(INT)s score = NEG_INF;
+    %(VTYPE)s vMaxH = vNegInf;
+    %(VTYPE)s vMaxHUnit = vNegInf;
+    %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+#ifdef PARASAIL_TABLE
+    parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
+#else
+#ifdef PARASAIL_ROWCOL
+    parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
+    const %(INDEX)s offset = (s1Len - 1) %% segLen;
+    const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
+#else
+    parasail_result_t *result = parasail_result_new();
 #endif
 #endif
 
+    /* each row of the matrix as two tables of 16 byte scores, repeated
+     * in every 128-bit lane, and the striped query codes as shuffle
+     * indexes into them; only the high byte of an element indexes a
+     * score, every other byte and the padding index INT8_MIN for 0 */
+    {
+        int8_t *table = (int8_t*)pvTable;
+        int8_t *index = (int8_t*)pvIndex;
+        for (k=0; k<matrix->size; ++k) {
+            const int *row = matrix->matrix + k*matrix->size;
+            for (i=0; i<%(ALIGNMENT)s; ++i) {
+                %(INDEX)s lo = i %% 16;
+                %(INDEX)s hi = lo + 16;
+                table[2*k*%(ALIGNMENT)s + i] =
+                    lo < matrix->size ? (int8_t)row[lo] : 0;
+                table[(2*k+1)*%(ALIGNMENT)s + i] =
+                    hi < matrix->size ? (int8_t)row[hi] : 0;
+            }
+        }
+        for (i=0; i<2*segLen*%(ALIGNMENT)s; ++i) {
+            index[i] = INT8_MIN;
+        }
+        for (i=0; i<segLen; ++i) {
+            for (k=0; k<segWidth; ++k) {
+                %(INDEX)s t = k*segLen + i;
+                %(INDEX)s byte = (k+1)*%(BYTES)s - 1;
+                if (t < s1Len) {
+                    int code = matrix->mapper[(unsigned char)s1[t]];
+                    if (code < 16) {
+                        index[2*i*%(ALIGNMENT)s + byte] = (int8_t)code;
+                    }
+                    else {
+                        index[(2*i+1)*%(ALIGNMENT)s + byte] = (int8_t)(code - 16);
+                    }
+                }
+            }
+        }
+    }
+
+    /* initialize H and E */
+    parasail_memset_%(VTYPE)s(pvHStore, vZero, segLen);
+    parasail_memset_%(VTYPE)s(pvE, %(VSET1)s(-open), segLen);
+
+    /* outer loop over database sequence */
+    for (j=0; j<s2Len; ++j) {
+        %(VTYPE)s vE;
+        %(VTYPE)s vF;
+        %(VTYPE)s vH;
+        %(VTYPE)s vTableLo;
+        %(VTYPE)s vTableHi;
+        %(VTYPE)s* pv = NULL;
+
+        /* Initialize F value to 0.  Any errors to vH values will be
+         * corrected in the Lazy_F loop. */
+        vF = vZero;
+
+        /* load final segment of pvHStore and shift left by %(BYTES)s bytes */
+        vH = %(VLOAD)s(&pvHStore[segLen - 1]);
+        vH = %(VSHIFT)s(vH, %(BYTES)s);
+
+        /* score tables of the database residue */
+        vTableLo = %(VLOAD)s(pvTable + 2*matrix->mapper[(unsigned char)s2[j]]);
+        vTableHi = %(VLOAD)s(pvTable + 2*matrix->mapper[(unsigned char)s2[j]] + 1);
+
+        if (end_ref == j-2) {
+            /* Swap in the max buffer. */
+            pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+        else {
+            /* Swap the 2 H buffers. */
+            pv = pvHLoad;
+            pvHLoad = pvHStore;
+            pvHStore = pv;
+        }
+
+        /* inner loop to process the query sequence */
+        for (i=0; i<segLen; ++i) {
+            vH = %(VADD)s(vH, %(VLOOKUP)s(vTableLo, vTableHi,
+                        %(VLOAD)s(pvIndex + 2*i), %(VLOAD)s(pvIndex + 2*i + 1)));
+            vE = %(VLOAD)s(pvE + i);
+
+            /* Get max from vH, vE and vF. */
+            vH = %(VMAX)s(vH, vE);
+            vH = %(VMAX)s(vH, vF);
+            vH = %(VMAX)s(vH, vZero);
+            /* Save vH values. */
+            %(VSTORE)s(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+            arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+            vMaxH = %(VMAX)s(vH, vMaxH);
+
+            /* Update vE value. */
+            vH = %(VSUB)s(vH, vGapO);
+            vE = %(VSUB)s(vE, vGapE);
+            vE = %(VMAX)s(vE, vH);
+            %(VSTORE)s(pvE + i, vE);
+
+            /* Update vF value. */
+            vF = %(VSUB)s(vF, vGapE);
+            vF = %(VMAX)s(vF, vH);
+
+            /* Load the next vH. */
+            vH = %(VLOAD)s(pvHLoad + i);
+        }
+
+        /* Lazy_F loop: has been revised to disallow adjecent insertion and
+         * then deletion, so don't update E(i, i), learn from SWPS3 */
+        for (k=0; k<segWidth; ++k) {
+            vF = %(VSHIFT)s(vF, %(BYTES)s);
+            for (i=0; i<segLen; ++i) {
+                vH = %(VLOAD)s(pvHStore + i);
+                vH = %(VMAX)s(vH,vF);
+                %(VSTORE)s(pvHStore + i, vH);
+#ifdef PARASAIL_TABLE
+                arr_store_si%(BITS)s(result->tables->score_table, vH, i, segLen, j, s2Len);
+#endif
+                vMaxH = %(VMAX)s(vH, vMaxH);
+                vH = %(VSUB)s(vH, vGapO);
+                vF = %(VSUB)s(vF, vGapE);
+                if (! %(VMOVEMASK)s(%(VCMPGT)s(vF, vH))) goto end;
+            }
+        }
+end:
+        {
+        }
+
+#ifdef PARASAIL_ROWCOL
+        /* extract last value from the column */
+        {
+            vH = %(VLOAD)s(pvHStore + offset);
+            for (k=0; k<position; ++k) {
+                vH = %(VSHIFT)s(vH, %(BYTES)s);
+            }
+            result->rowcols->score_row[j] = (%(INT)s) %(VEXTRACT)s (vH, %(LAST_POS)s);
+        }
+#endif
+
+        {
+            %(VTYPE)s vCompare = %(VCMPGT)s(vMaxH, vMaxHUnit);
+            if (%(VMOVEMASK)s(vCompare)) {
+                score = %(VHMAX)s(vMaxH);
+                /* if score has potential to overflow, abort early */
+                if (score > maxp) {
+                    result->flag |= PARASAIL_FLAG_SATURATED;
+                    break;
+                }
+                vMaxHUnit = %(VSET1)s(score);
+                end_ref = j;
+            }
+        }
+    }
+
+#ifdef PARASAIL_ROWCOL
+    for (i=0; i<segLen; ++i) {
+        %(VTYPE)s vH = %(VLOAD)s(pvHStore+i);
+        arr_store_col(result->rowcols->score_col, vH, i, segLen);
+    }
+#endif
+
+    if (score == INT%(WIDTH)s_MAX) {
+        result->flag |= PARASAIL_FLAG_SATURATED;
+    }
+
+    if (parasail_result_is_saturated(result)) {
+        score = INT%(WIDTH)s_MAX;
+        end_query = 0;
+        end_ref = 0;
+    }
+    else {
+        if (end_ref == j-1) {
+            /* end_ref was the last store column */
+            %(VTYPE)s *pv = pvHMax;
+            pvHMax = pvHStore;
+            pvHStore = pv;
+        }
+        else if (end_ref == j-2) {
+            /* end_ref was the last load column */
+            %(VTYPE)s *pv = pvHMax;
+            pvHMax = pvHLoad;
+            pvHLoad = pv;
+        }
+        end_query = find_row((%(INT)s*)pvHMax, score, s1Len, segLen, segWidth);
+    }
+
+    result->score = score;
+    result->end_query = end_query;
+    result->end_ref = end_ref;
+    result->flag |= PARASAIL_FLAG_SW | PARASAIL_FLAG_STRIPED
+        | PARASAIL_FLAG_BITS_%(WIDTH)s | PARASAIL_FLAG_LANES_%(LANES)s;
+#ifdef PARASAIL_TABLE
+    result->flag |= PARASAIL_FLAG_TABLE;
+#endif
+#ifdef PARASAIL_ROWCOL
+    result->flag |= PARASAIL_FLAG_ROWCOL;
+#endif
+
+    parasail_free(pvE);
+    parasail_free(pvHMax);
+    parasail_free(pvHLoad);
+    parasail_free(pvHStore);
+    parasail_free(pvIndex);
+    parasail_free(pvTable);
+
+    return result;
+}
+#endif /* LOOKUP */
+
 parasail_result_t* FNAME(
         const char * const restrict s1, const int s1Len,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap, const parasail_matrix_t *matrix)
 {
-    parasail_profile_t *profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
-    parasail_result_t *result = PNAME(profile, s2, s2Len, open, gap);
+    parasail_profile_t *profile = NULL;
+    parasail_result_t *result = NULL;
+    int match = 0;
+    int mismatch = 0;
+
+    if (parasail_match_mismatch(matrix, s1, s1Len, s2, s2Len,
+                &match, &mismatch)) {
+        return match_mismatch(s1, s1Len, s2, s2Len, open, gap, matrix,
+                match, mismatch);
+    }
+#if LOOKUP
+    if (parasail_lookup_scores(matrix, sizeof(%(VTYPE)s)*matrix->size
+                *((s1Len + %(LANES)s - 1) / %(LANES)s))) {
+        return lookup(s1, s1Len, s2, s2Len, open, gap, matrix);
+    }
+#endif /* LOOKUP */
+
+    profile = parasail_profile_create_%(ISA)s_%(BITS)s_%(WIDTH)s(s1, s1Len, matrix);
+    result = PNAME(profile, s2, s2Len, open, gap);
     parasail_profile_free(profile);
     return result;
 }
 
+#ifdef WNAME
+parasail_result_t* RNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result,
+        parasail_promote_t * const restrict promote);
+
 parasail_result_t* PNAME(
         const parasail_profile_t * const restrict profile,
         const char * const restrict s2, const int s2Len,
         const int open, const int gap)
+{
+    parasail_workspace_t workspace = {NULL, 0};
+    parasail_result_t *result = parasail_result_new();
+    WNAME(profile, s2, s2Len, open, gap, &workspace, result);
+    parasail_workspace_release(&workspace);
+    return result;
+}
+
+parasail_result_t* WNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return RNAME(profile, s2, s2Len, NULL, open, gap, workspace, result, NULL);
+}
+
+parasail_result_t* ENAME(
+        const parasail_profile_t * const restrict profile,
+        const parasail_encoded_t * const restrict s2,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result)
+{
+    return RNAME(profile, NULL, s2->length, s2,
+            open, gap, workspace, result, NULL);
+}
+
+/* Same as WNAME, or as ENAME when encoded is not NULL.  If
+ * promote->column is not negative the alignment resumes after that
+ * column from the state saved by a narrower kernel.  If this kernel
+ * saturates, its last exact column is saved to promote so that a wider
+ * kernel can resume from it. */
+parasail_result_t* RNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const parasail_encoded_t * const restrict encoded,
+        const int open, const int gap,
+        parasail_workspace_t * const restrict workspace,
+        parasail_result_t * const restrict result,
+        parasail_promote_t * const restrict promote)
+#else
+parasail_result_t* PNAME(
+        const parasail_profile_t * const restrict profile,
+        const char * const restrict s2, const int s2Len,
+        const int open, const int gap)
+#endif
 {
     %(INDEX)s i = 0;
     %(INDEX)s j = 0;
@@ -82,10 +681,19 @@ parasail_result_t* PNAME(
     const %(INDEX)s segWidth = %(LANES)s; /* number of values in vector unit */
     const %(INDEX)s segLen = (s1Len + segWidth - 1) / segWidth;
     %(VTYPE)s* const restrict vProfile = (%(VTYPE)s*)profile->profile%(WIDTH)s.score;
+#ifdef WNAME
+    %(VTYPE)s* const pvWork = (%(VTYPE)s*)parasail_workspace_reserve(
+            workspace, sizeof(%(VTYPE)s)*4*segLen);
+    %(VTYPE)s* restrict pvHStore = pvWork;
+    %(VTYPE)s* restrict pvHLoad = pvWork + segLen;
+    %(VTYPE)s* restrict pvHMax = pvWork + 2*segLen;
+    %(VTYPE)s* const restrict pvE = pvWork + 3*segLen;
+#else
     %(VTYPE)s* restrict pvHStore = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* restrict pvHLoad =  parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* restrict pvHMax = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
     %(VTYPE)s* const restrict pvE = parasail_memalign_%(VTYPE)s(%(ALIGNMENT)s, segLen);
+#endif
     %(VTYPE)s vGapO = %(VSET1)s(open);
     %(VTYPE)s vGapE = %(VSET1)s(gap);
     %(VTYPE)s vZero = %(VSET0)s();
@@ -94,6 +702,13 @@ parasail_result_t* PNAME(
     %(VTYPE)s vMaxH = vNegInf;
     %(VTYPE)s vMaxHUnit = vNegInf;
     %(INT)s maxp = INT%(WIDTH)s_MAX - (%(INT)s)(matrix->max+1);
+    const int xdrop = profile->xdrop;
+    const int zdrop = profile->zdrop;
+    const int min_score = profile->min_score;
+    const int64_t max_gain = matrix->max > 0 ? matrix->max : 0;
+    int64_t gain = 0;
+    int prune = 0;
+    %(INDEX)s best_query = 0;
     /*%(INT)s stop = profile->stop == INT32_MAX ?  INT%(WIDTH)s_MAX : (%(INT)s)profile->stop;*/
 #ifdef PARASAIL_TABLE
     parasail_result_t *result = parasail_result_new_table1(segLen*segWidth, s2Len);
@@ -102,17 +717,42 @@ parasail_result_t* PNAME(
     parasail_result_t *result = parasail_result_new_rowcol1(segLen*segWidth, s2Len);
     const %(INDEX)s offset = (s1Len - 1) %% segLen;
     const %(INDEX)s position = (segWidth - 1) - (s1Len - 1) / segLen;
-#else
-    parasail_result_t *result = parasail_result_new();
 #endif
+#endif
+#ifdef WNAME
+    result->flag = 0;
+    result->stop_ref = -1;
 #endif
 
     /* initialize H and E */
     parasail_memset_%(VTYPE)s(pvHStore, vZero, segLen);
     parasail_memset_%(VTYPE)s(pvE, %(VSET1)s(-open), segLen);
 
+#ifdef WNAME
+    /* restripe the saved column, given in query order */
+    if (NULL != promote && promote->column >= 0) {
+        %(INT)s *h = (%(INT)s*)pvHStore;
+        %(INT)s *e = (%(INT)s*)pvE;
+        for (i=0; i<s1Len; ++i) {
+            %(INDEX)s t = i %% segLen * segWidth + i / segLen;
+            h[t] = (%(INT)s)(promote->H[i]);
+            e[t] = (%(INT)s)(promote->E[i]);
+        }
+        score = (%(INT)s)(promote->score);
+        vMaxH = %(VSET1)s(score);
+        vMaxHUnit = vMaxH;
+        end_ref = promote->column;
+        for (i=s1Len-1; i>=0; --i) {
+            if (promote->H[i] == promote->score) {
+                best_query = i;
+            }
+        }
+        j = promote->column + 1;
+    }
+#endif
+
     /* outer loop over database sequence */
-    for (j=0; j<s2Len; ++j) {
+    for (/* j set above */; j<s2Len; ++j) {
         %(VTYPE)s vE;
         %(VTYPE)s vF;
         %(VTYPE)s vH;
@@ -128,7 +768,13 @@ parasail_result_t* PNAME(
         vH = %(VSHIFT)s(vH, %(BYTES)s);
 
         /* Correct part of the vProfile */
+#ifdef WNAME
+        vP = vProfile + (NULL == encoded
+                ? matrix->mapper[(unsigned char)s2[j]]
+                : parasail_encoded_code(encoded, j)) * segLen;
+#else
         vP = vProfile + matrix->mapper[(unsigned char)s2[j]] * segLen;
+#endif
 
         if (end_ref == j-2) {
             /* Swap in the max buffer. */
@@ -214,6 +860,25 @@ end:
                 /* if score has potential to overflow, abort early */
                 if (score > maxp) {
                     result->flag |= PARASAIL_FLAG_SATURATED;
+#ifdef WNAME
+                    /* column j did not overflow, save it for a wider
+                     * kernel; it holds the new maximum so end_ref is j */
+                    if (NULL != promote) {
+                        %(INT)s *h = (%(INT)s*)pvHStore;
+                        %(INT)s *e = (%(INT)s*)pvE;
+                        if (NULL == promote->H) {
+                            promote->H = (int*)malloc(sizeof(int)*s1Len);
+                            promote->E = (int*)malloc(sizeof(int)*s1Len);
+                        }
+                        for (i=0; i<s1Len; ++i) {
+                            %(INDEX)s t = i %% segLen * segWidth + i / segLen;
+                            promote->H[i] = h[t];
+                            promote->E[i] = e[t];
+                        }
+                        promote->score = score;
+                        promote->column = j;
+                    }
+#endif
                     break;
                 }
                 vMaxHUnit = %(VSET1)s(score);
@@ -222,6 +887,60 @@ end:
         }
 
         /*if (score == stop) break;*/
+
+        /* Pruning: past this column a cell gains at most max_gain per
+         * column, and an alignment that has not started yet no more than
+         * that in total, so give up once neither can reach min_score. */
+        gain = max_gain * (s2Len-1-j < s1Len ? s2Len-1-j : s1Len);
+        prune = INT32_MIN != min_score && score < min_score
+            && gain < min_score;
+
+        /* X-drop: stop once every cell of the column has fallen more
+         * than xdrop below the best score.  Z-drop also forgives the
+         * gap between the column's best cell and the best score. */
+        if (0 < xdrop || 0 < zdrop || prune) {
+            /* the lanes past the end of the query are padding */
+            const %(INDEX)s last_lane = (s1Len - 1) / segLen;
+            const %(INDEX)s last_seg = (s1Len - 1) %% segLen;
+            const %(VTYPE)s vPadLo = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - 1 - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            const %(VTYPE)s vPadHi = %(VCMPGT)s(
+                    %(VSET1)s(segWidth - last_lane),
+                    %(VSET)s(%(POSITION_MASK)s));
+            %(VTYPE)s vColMax = vNegInf;
+            %(INT)s col_score;
+            int64_t drop;
+            for (i=0; i<segLen; ++i) {
+                %(VTYPE)s vC = %(VLOAD)s(pvHStore + i);
+                vC = %(VBLEND)s(vC, vNegInf, i > last_seg ? vPadHi : vPadLo);
+                vColMax = %(VMAX)s(vColMax, vC);
+            }
+            col_score = %(VHMAX)s(vColMax);
+            drop = (int64_t)score - col_score;
+            if (end_ref == j && 0 < zdrop) {
+                best_query = find_row((%(INT)s*)pvHStore, score, s1Len, segLen, segWidth);
+            }
+            if (prune && col_score + gain < min_score) {
+                result->flag |= PARASAIL_FLAG_PRUNED;
+            }
+            else if (0 < xdrop && drop > xdrop) {
+                result->flag |= PARASAIL_FLAG_XDROP;
+            }
+            else if (0 < zdrop && drop > zdrop) {
+                %(INDEX)s col_query = find_row((%(INT)s*)pvHStore, col_score, s1Len, segLen, segWidth);
+                %(INDEX)s diff = (col_query - best_query) - (j - end_ref);
+                if (drop > zdrop + (int64_t)gap*(diff < 0 ? -diff : diff)) {
+                    result->flag |= PARASAIL_FLAG_XDROP;
+                }
+            }
+            if (result->flag & (PARASAIL_FLAG_XDROP | PARASAIL_FLAG_PRUNED)) {
+                result->stop_ref = j;
+                /* leave j one past the last column, as after the loop */
+                ++j;
+                break;
+            }
+        }
     }
 
 #ifdef PARASAIL_ROWCOL
@@ -281,10 +1000,12 @@ end:
     result->flag |= PARASAIL_FLAG_ROWCOL;
 #endif
 
+#ifndef WNAME
     parasail_free(pvE);
     parasail_free(pvHMax);
     parasail_free(pvHLoad);
     parasail_free(pvHStore);
+#endif
 
     return result;
 }